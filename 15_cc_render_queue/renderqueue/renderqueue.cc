@@ -0,0 +1,173 @@
+#include "renderqueue.h"
+
+#include <glad/glad.h>
+
+#include <iostream>
+
+static const unsigned int PAYLOAD_SHIFT = 0;
+static const unsigned int DEPTH_SHIFT = PAYLOAD_SHIFT + RenderQueue::PAYLOAD_BITS;
+static const unsigned int TEXTURE_SHIFT = DEPTH_SHIFT + RenderQueue::DEPTH_BITS;
+static const unsigned int VAO_SHIFT = TEXTURE_SHIFT + RenderQueue::TEXTURE_BITS;
+static const unsigned int PROGRAM_SHIFT = VAO_SHIFT + RenderQueue::VAO_BITS;
+static const unsigned int PASS_SHIFT = PROGRAM_SHIFT + RenderQueue::PROGRAM_BITS;
+
+static uint64_t mask(unsigned int bits)
+{
+  return (((uint64_t)1) << bits) - 1;
+}
+
+static unsigned int field(uint64_t key, unsigned int shift, unsigned int bits)
+{
+  return (unsigned int)((key >> shift) & mask(bits));
+}
+
+RenderQueue::RenderQueue()
+{
+  this->keys.reserve(1024);
+  this->scratch.reserve(1024);
+  this->payloads.reserve(1024);
+  RenderQueueStats s = { 0, 0, 0, 0, 0 };
+  this->lastStats = s;
+  this->invalidate();
+  this->clear();
+}
+
+void RenderQueue::clear()
+{
+  this->keys.clear();
+  this->payloads.clear();
+}
+
+uint64_t RenderQueue::makeKey(unsigned int pass, GLuint program, GLuint vao,
+                              GLuint texture, float depth, unsigned int payload)
+{
+  if (depth < 0.0f) depth = 0.0f;
+  if (depth > 1.0f) depth = 1.0f;
+  uint64_t d = (uint64_t)(depth * (float)mask(DEPTH_BITS));
+
+  return ((uint64_t)pass << PASS_SHIFT) |
+         ((uint64_t)program << PROGRAM_SHIFT) |
+         ((uint64_t)vao << VAO_SHIFT) |
+         ((uint64_t)texture << TEXTURE_SHIFT) |
+         (d << DEPTH_SHIFT) |
+         ((uint64_t)payload << PAYLOAD_SHIFT);
+}
+
+bool RenderQueue::submit(unsigned int pass, GLuint program, GLuint vao, GLuint texture,
+                         float depth, const DrawCall &draw)
+{
+  if (this->payloads.size() > mask(PAYLOAD_BITS)) {
+    std::cout << "ERROR::RENDERQUEUE::FULL" << std::endl;
+    return false;
+  }
+  if (pass > mask(PASS_BITS) || program > mask(PROGRAM_BITS) ||
+      vao > mask(VAO_BITS) || texture > mask(TEXTURE_BITS)) {
+    std::cout << "ERROR::RENDERQUEUE::KEY_OUT_OF_RANGE" << std::endl;
+    return false;
+  }
+
+  unsigned int payload = this->payloads.size();
+  this->payloads.push_back(draw);
+  this->keys.push_back(makeKey(pass, program, vao, texture, depth, payload));
+  return true;
+}
+
+// LSD radix sort, 8 bits per pass;
+// a pass is skipped when all the keys have the same byte
+void RenderQueue::sort()
+{
+  size_t n = this->keys.size();
+  if (n < 2) return;
+
+  this->scratch.resize(n);
+  uint64_t *src = &this->keys[0];
+  uint64_t *dst = &this->scratch[0];
+
+  for (unsigned int shift = 0; shift < 64; shift += 8) {
+    size_t count[256] = { 0 };
+    for (size_t i = 0; i < n; i++)
+      count[(src[i] >> shift) & 0xff]++;
+
+    if (count[(src[0] >> shift) & 0xff] == n)
+      continue;
+
+    size_t offset = 0;
+    for (unsigned int b = 0; b < 256; b++) {
+      size_t c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < n; i++)
+      dst[count[(src[i] >> shift) & 0xff]++] = src[i];
+
+    uint64_t *tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+
+  // odd number of passes: the result is in the scratch buffer
+  if (src != &this->keys[0])
+    this->keys.swap(this->scratch);
+}
+
+void RenderQueue::execute()
+{
+  RenderQueueStats s = { 0, 0, 0, 0, 0 };
+
+  for (size_t i = 0; i < this->keys.size(); i++) {
+    uint64_t key = this->keys[i];
+    GLuint program = field(key, PROGRAM_SHIFT, PROGRAM_BITS);
+    GLuint vao = field(key, VAO_SHIFT, VAO_BITS);
+    GLuint texture = field(key, TEXTURE_SHIFT, TEXTURE_BITS);
+    const DrawCall &draw = this->payloads[field(key, PAYLOAD_SHIFT, PAYLOAD_BITS)];
+
+    if (!this->stateValid || program != this->currentProgram) {
+      glUseProgram(program);
+      this->currentProgram = program;
+      s.programBinds++;
+    } else {
+      s.redundantBinds++;
+    }
+    if (!this->stateValid || vao != this->currentVAO) {
+      glBindVertexArray(vao);
+      this->currentVAO = vao;
+      s.vaoBinds++;
+    } else {
+      s.redundantBinds++;
+    }
+    if (!this->stateValid || texture != this->currentTexture) {
+      glBindTexture(GL_TEXTURE_2D, texture);
+      this->currentTexture = texture;
+      s.textureBinds++;
+    } else {
+      s.redundantBinds++;
+    }
+    this->stateValid = true;
+
+    if (draw.indexed)
+      glDrawElements(draw.mode, draw.count, GL_UNSIGNED_INT, (void*)(size_t)draw.first);
+    else
+      glDrawArrays(draw.mode, draw.first, draw.count);
+    s.draws++;
+  }
+
+  this->lastStats = s;
+}
+
+void RenderQueue::invalidate()
+{
+  this->currentProgram = 0;
+  this->currentVAO = 0;
+  this->currentTexture = 0;
+  this->stateValid = false;
+}
+
+unsigned int RenderQueue::size() const
+{
+  return this->keys.size();
+}
+
+const RenderQueueStats& RenderQueue::stats() const
+{
+  return this->lastStats;
+}
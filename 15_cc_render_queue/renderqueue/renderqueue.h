@@ -0,0 +1,86 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <glad/glad.h>
+
+#include <stdint.h>
+#include <vector>
+
+// one draw, as stored in the queue payload array
+struct DrawCall
+{
+  GLenum mode;      // GL_TRIANGLES, ...
+  GLint first;      // first vertex (glDrawArrays) or byte offset (glDrawElements)
+  GLsizei count;    // number of vertices / indices
+  bool indexed;     // use glDrawElements (GL_UNSIGNED_INT) instead of glDrawArrays
+};
+
+// counters of the last execute()
+struct RenderQueueStats
+{
+  unsigned int draws;
+  unsigned int programBinds;
+  unsigned int vaoBinds;
+  unsigned int textureBinds;
+  unsigned int redundantBinds;   // binds skipped by the state filter
+};
+
+// Render queue: draws are submitted in any order, each one becomes
+// a 64 bit sort key; sorting the keys groups the draws by state
+// so that execute() issues the minimum number of binds.
+//
+// key layout (from the most significant bit):
+//   pass (4) | program (10) | vao (10) | texture (10) | depth (14) | payload (16)
+//
+// the payload index is in the low bits, so draws with the same state
+// keep the submission order.
+class RenderQueue
+{
+  public:
+    static const unsigned int PASS_BITS = 4;
+    static const unsigned int PROGRAM_BITS = 10;
+    static const unsigned int VAO_BITS = 10;
+    static const unsigned int TEXTURE_BITS = 10;
+    static const unsigned int DEPTH_BITS = 14;
+    static const unsigned int PAYLOAD_BITS = 16;
+
+    RenderQueue();
+
+    // start a new frame (drop the previous submissions)
+    void clear();
+
+    // depth in [0, 1], smaller is drawn first inside the same state
+    // returns false if the queue is full or a GL name does not fit the key
+    bool submit(unsigned int pass, GLuint program, GLuint vao, GLuint texture,
+                float depth, const DrawCall &draw);
+
+    // radix sort of the keys
+    void sort();
+
+    // issue the GL calls, skipping redundant binds
+    void execute();
+
+    // forget the cached GL state (call it if someone else touched the bindings)
+    void invalidate();
+
+    unsigned int size() const;
+    const RenderQueueStats& stats() const;
+
+    static uint64_t makeKey(unsigned int pass, GLuint program, GLuint vao,
+                            GLuint texture, float depth, unsigned int payload);
+
+  private:
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> scratch;
+    std::vector<DrawCall> payloads;
+
+    // redundant state filter
+    GLuint currentProgram;
+    GLuint currentVAO;
+    GLuint currentTexture;
+    bool stateValid;
+
+    RenderQueueStats lastStats;
+};
+
+#endif
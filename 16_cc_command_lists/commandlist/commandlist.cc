@@ -0,0 +1,172 @@
+#include "commandlist.h"
+
+#include <glad/glad.h>
+
+#include <iostream>
+
+struct UseProgramCommand
+{
+  CommandHeader header;
+  unsigned int program;
+};
+
+struct BindVertexArrayCommand
+{
+  CommandHeader header;
+  unsigned int vao;
+};
+
+struct Uniform1fCommand
+{
+  CommandHeader header;
+  int location;
+  float x;
+};
+
+struct Uniform2fCommand
+{
+  CommandHeader header;
+  int location;
+  float x, y;
+};
+
+struct DrawArraysCommand
+{
+  CommandHeader header;
+  int first;
+  int count;
+};
+
+struct DrawElementsCommand
+{
+  CommandHeader header;
+  int count;
+  unsigned int byteOffset;
+};
+
+CommandList::CommandList(size_t capacity)
+  : allocator(capacity)
+{
+  this->head = NULL;
+  this->tail = NULL;
+  this->count = 0;
+}
+
+void CommandList::reset()
+{
+  this->allocator.reset();
+  this->head = NULL;
+  this->tail = NULL;
+  this->count = 0;
+}
+
+void* CommandList::push(CommandType type, size_t size)
+{
+  CommandHeader *cmd = (CommandHeader*)this->allocator.allocate(size);
+  if (cmd == NULL) {
+    std::cout << "ERROR::COMMANDLIST::OUT_OF_MEMORY" << std::endl;
+    return NULL;
+  }
+  cmd->type = type;
+  cmd->next = NULL;
+  if (this->tail != NULL)
+    this->tail->next = cmd;
+  else
+    this->head = cmd;
+  this->tail = cmd;
+  this->count++;
+  return cmd;
+}
+
+void CommandList::useProgram(unsigned int program)
+{
+  UseProgramCommand *cmd = (UseProgramCommand*)push(CMD_USE_PROGRAM, sizeof(UseProgramCommand));
+  if (cmd) cmd->program = program;
+}
+
+void CommandList::bindVertexArray(unsigned int vao)
+{
+  BindVertexArrayCommand *cmd = (BindVertexArrayCommand*)push(CMD_BIND_VERTEX_ARRAY, sizeof(BindVertexArrayCommand));
+  if (cmd) cmd->vao = vao;
+}
+
+void CommandList::uniform1f(int location, float x)
+{
+  Uniform1fCommand *cmd = (Uniform1fCommand*)push(CMD_UNIFORM_1F, sizeof(Uniform1fCommand));
+  if (cmd) {
+    cmd->location = location;
+    cmd->x = x;
+  }
+}
+
+void CommandList::uniform2f(int location, float x, float y)
+{
+  Uniform2fCommand *cmd = (Uniform2fCommand*)push(CMD_UNIFORM_2F, sizeof(Uniform2fCommand));
+  if (cmd) {
+    cmd->location = location;
+    cmd->x = x;
+    cmd->y = y;
+  }
+}
+
+void CommandList::drawArrays(int first, int count)
+{
+  DrawArraysCommand *cmd = (DrawArraysCommand*)push(CMD_DRAW_ARRAYS, sizeof(DrawArraysCommand));
+  if (cmd) {
+    cmd->first = first;
+    cmd->count = count;
+  }
+}
+
+void CommandList::drawElements(int count, unsigned int byteOffset)
+{
+  DrawElementsCommand *cmd = (DrawElementsCommand*)push(CMD_DRAW_ELEMENTS, sizeof(DrawElementsCommand));
+  if (cmd) {
+    cmd->count = count;
+    cmd->byteOffset = byteOffset;
+  }
+}
+
+void CommandList::execute() const
+{
+  for (const CommandHeader *cmd = this->head; cmd != NULL; cmd = cmd->next) {
+    switch (cmd->type) {
+      case CMD_USE_PROGRAM:
+        glUseProgram(((const UseProgramCommand*)cmd)->program);
+        break;
+      case CMD_BIND_VERTEX_ARRAY:
+        glBindVertexArray(((const BindVertexArrayCommand*)cmd)->vao);
+        break;
+      case CMD_UNIFORM_1F: {
+        const Uniform1fCommand *c = (const Uniform1fCommand*)cmd;
+        glUniform1f(c->location, c->x);
+        break;
+      }
+      case CMD_UNIFORM_2F: {
+        const Uniform2fCommand *c = (const Uniform2fCommand*)cmd;
+        glUniform2f(c->location, c->x, c->y);
+        break;
+      }
+      case CMD_DRAW_ARRAYS: {
+        const DrawArraysCommand *c = (const DrawArraysCommand*)cmd;
+        glDrawArrays(GL_TRIANGLES, c->first, c->count);
+        break;
+      }
+      case CMD_DRAW_ELEMENTS: {
+        const DrawElementsCommand *c = (const DrawElementsCommand*)cmd;
+        glDrawElements(GL_TRIANGLES, c->count, GL_UNSIGNED_INT, (void*)(size_t)c->byteOffset);
+        break;
+      }
+    }
+  }
+}
+
+unsigned int CommandList::size() const
+{
+  return this->count;
+}
+
+size_t CommandList::memoryUsed() const
+{
+  return this->allocator.used();
+}
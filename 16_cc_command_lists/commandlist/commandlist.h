@@ -0,0 +1,59 @@
+#ifndef COMMANDLIST_H
+#define COMMANDLIST_H
+
+#include "linearallocator.h"
+
+// Command list: records draw commands without calling OpenGL,
+// so it can be filled by any thread.
+// The commands live in the list's own linear allocator and are
+// replayed by execute() on the thread that owns the GL context.
+//
+// handles (programs, VAOs) and uniform locations are plain integers,
+// nothing here depends on the GL headers.
+enum CommandType
+{
+  CMD_USE_PROGRAM,
+  CMD_BIND_VERTEX_ARRAY,
+  CMD_UNIFORM_1F,
+  CMD_UNIFORM_2F,
+  CMD_DRAW_ARRAYS,
+  CMD_DRAW_ELEMENTS
+};
+
+struct CommandHeader
+{
+  CommandType type;
+  CommandHeader *next;
+};
+
+class CommandList
+{
+  public:
+    CommandList(size_t capacity = 64 * 1024);
+
+    // drop all the commands (memory is kept for the next frame)
+    void reset();
+
+    void useProgram(unsigned int program);
+    void bindVertexArray(unsigned int vao);
+    void uniform1f(int location, float x);
+    void uniform2f(int location, float x, float y);
+    void drawArrays(int first, int count);                  // GL_TRIANGLES
+    void drawElements(int count, unsigned int byteOffset);  // GL_TRIANGLES, GL_UNSIGNED_INT
+
+    // replay the commands (GL thread only)
+    void execute() const;
+
+    unsigned int size() const;
+    size_t memoryUsed() const;
+
+  private:
+    LinearAllocator allocator;
+    CommandHeader *head;
+    CommandHeader *tail;
+    unsigned int count;
+
+    void* push(CommandType type, size_t size);
+};
+
+#endif
@@ -0,0 +1,80 @@
+#include "linearallocator.h"
+
+#include <stdlib.h>
+#include <iostream>
+
+LinearAllocator::LinearAllocator(size_t capacity)
+{
+  char *block = (char*)malloc(capacity);
+  if (block == NULL) {
+    // an empty block: the first allocate() tries malloc again
+    std::cout << "ERROR::LINEARALLOCATOR::OUT_OF_MEMORY" << std::endl;
+    capacity = 0;
+  }
+  this->blocks.push_back(block);
+  this->blockSizes.push_back(capacity);
+  this->offset = 0;
+  this->totalUsed = 0;
+}
+
+LinearAllocator::~LinearAllocator()
+{
+  for (size_t i = 0; i < this->blocks.size(); i++)
+    free(this->blocks[i]);
+}
+
+void* LinearAllocator::allocate(size_t size, size_t alignment)
+{
+  size_t aligned = (this->offset + alignment - 1) & ~(alignment - 1);
+
+  if (aligned + size > this->blockSizes.back()) {
+    // chain a new block (at least twice the last one)
+    size_t blockSize = this->blockSizes.back() * 2;
+    if (blockSize < size + alignment) blockSize = size + alignment;
+    char *block = (char*)malloc(blockSize);
+    if (block == NULL) return NULL;
+    this->blocks.push_back(block);
+    this->blockSizes.push_back(blockSize);
+    aligned = 0;
+  }
+
+  void *p = this->blocks.back() + aligned;
+  this->offset = aligned + size;
+  this->totalUsed += size;
+  return p;
+}
+
+void LinearAllocator::reset()
+{
+  if (this->blocks.size() > 1) {
+    size_t total = 0;
+    for (size_t i = 0; i < this->blocks.size(); i++) {
+      total += this->blockSizes[i];
+      free(this->blocks[i]);
+    }
+    this->blocks.clear();
+    this->blockSizes.clear();
+    char *block = (char*)malloc(total);
+    if (block == NULL) {
+      std::cout << "ERROR::LINEARALLOCATOR::OUT_OF_MEMORY" << std::endl;
+      total = 0;
+    }
+    this->blocks.push_back(block);
+    this->blockSizes.push_back(total);
+  }
+  this->offset = 0;
+  this->totalUsed = 0;
+}
+
+size_t LinearAllocator::used() const
+{
+  return this->totalUsed;
+}
+
+size_t LinearAllocator::capacity() const
+{
+  size_t total = 0;
+  for (size_t i = 0; i < this->blockSizes.size(); i++)
+    total += this->blockSizes[i];
+  return total;
+}
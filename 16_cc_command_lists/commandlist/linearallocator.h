@@ -0,0 +1,36 @@
+#ifndef LINEARALLOCATOR_H
+#define LINEARALLOCATOR_H
+
+#include <stddef.h>
+#include <vector>
+
+// Linear (bump) allocator: allocate() just moves a pointer forward,
+// reset() frees everything at once.
+// When the current block is full a new one is chained; on reset()
+// the blocks are merged into a single bigger one, so after a few
+// frames the allocator never touches malloc again.
+class LinearAllocator
+{
+  public:
+    LinearAllocator(size_t capacity);
+    ~LinearAllocator();
+
+    // NULL when malloc fails
+    void* allocate(size_t size, size_t alignment = sizeof(void*));
+    void reset();
+
+    size_t used() const;
+    size_t capacity() const;
+
+  private:
+    std::vector<char*> blocks;
+    std::vector<size_t> blockSizes;
+    size_t offset;        // in the last block
+    size_t totalUsed;
+
+    // not copyable
+    LinearAllocator(const LinearAllocator&);
+    LinearAllocator& operator=(const LinearAllocator&);
+};
+
+#endif
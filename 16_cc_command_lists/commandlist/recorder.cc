@@ -0,0 +1,116 @@
+#include "recorder.h"
+
+#include <unistd.h>
+
+CommandRecorder::CommandRecorder(unsigned int numLists)
+{
+  if (numLists == 0) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    numLists = cores > 0 ? (unsigned int)cores : 1;
+  }
+
+  for (unsigned int i = 0; i < numLists; i++)
+    this->lists.push_back(new CommandList());
+
+  pthread_mutex_init(&this->mutex, NULL);
+  pthread_cond_init(&this->startCond, NULL);
+  pthread_cond_init(&this->doneCond, NULL);
+  this->generation = 0;
+  this->pending = 0;
+  this->quit = false;
+  this->function = NULL;
+  this->userData = NULL;
+
+  // list 0 is recorded by the calling thread
+  this->workers.resize(numLists - 1);
+  for (unsigned int i = 0; i < this->workers.size(); i++) {
+    this->workers[i].recorder = this;
+    this->workers[i].index = i + 1;
+    pthread_create(&this->workers[i].thread, NULL, workerMain, &this->workers[i]);
+  }
+}
+
+CommandRecorder::~CommandRecorder()
+{
+  pthread_mutex_lock(&this->mutex);
+  this->quit = true;
+  pthread_cond_broadcast(&this->startCond);
+  pthread_mutex_unlock(&this->mutex);
+
+  for (unsigned int i = 0; i < this->workers.size(); i++)
+    pthread_join(this->workers[i].thread, NULL);
+
+  pthread_cond_destroy(&this->doneCond);
+  pthread_cond_destroy(&this->startCond);
+  pthread_mutex_destroy(&this->mutex);
+
+  for (unsigned int i = 0; i < this->lists.size(); i++)
+    delete this->lists[i];
+}
+
+void* CommandRecorder::workerMain(void *arg)
+{
+  Worker *worker = (Worker*)arg;
+  CommandRecorder *r = worker->recorder;
+  unsigned long seen = 0;
+
+  while (true) {
+    pthread_mutex_lock(&r->mutex);
+    while (!r->quit && r->generation == seen)
+      pthread_cond_wait(&r->startCond, &r->mutex);
+    if (r->quit) {
+      pthread_mutex_unlock(&r->mutex);
+      break;
+    }
+    seen = r->generation;
+    RecordFunction function = r->function;
+    void *userData = r->userData;
+    pthread_mutex_unlock(&r->mutex);
+
+    function(*r->lists[worker->index], worker->index, r->lists.size(), userData);
+
+    pthread_mutex_lock(&r->mutex);
+    if (--r->pending == 0)
+      pthread_cond_signal(&r->doneCond);
+    pthread_mutex_unlock(&r->mutex);
+  }
+
+  return NULL;
+}
+
+void CommandRecorder::record(RecordFunction function, void *userData)
+{
+  for (unsigned int i = 0; i < this->lists.size(); i++)
+    this->lists[i]->reset();
+
+  pthread_mutex_lock(&this->mutex);
+  this->function = function;
+  this->userData = userData;
+  this->pending = this->workers.size();
+  this->generation++;
+  pthread_cond_broadcast(&this->startCond);
+  pthread_mutex_unlock(&this->mutex);
+
+  function(*this->lists[0], 0, this->lists.size(), userData);
+
+  pthread_mutex_lock(&this->mutex);
+  while (this->pending > 0)
+    pthread_cond_wait(&this->doneCond, &this->mutex);
+  pthread_mutex_unlock(&this->mutex);
+}
+
+void CommandRecorder::execute() const
+{
+  for (unsigned int i = 0; i < this->lists.size(); i++)
+    this->lists[i]->execute();
+}
+
+unsigned int CommandRecorder::size() const
+{
+  return this->lists.size();
+}
+
+CommandList& CommandRecorder::list(unsigned int index)
+{
+  return *this->lists[index];
+}
@@ -0,0 +1,61 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include "commandlist.h"
+
+#include <pthread.h>
+#include <vector>
+
+// Command recorder: a fixed pool of worker threads, one command list each.
+// record() runs the same callback on every list in parallel (the calling
+// thread records list 0), execute() replays the lists on the GL thread
+// always in index order, so the frame is deterministic.
+class CommandRecorder
+{
+  public:
+    // index: list being recorded, count: number of lists
+    typedef void (*RecordFunction)(CommandList &list, unsigned int index,
+                                   unsigned int count, void *userData);
+
+    // numLists = 0: one list per CPU core
+    CommandRecorder(unsigned int numLists = 0);
+    ~CommandRecorder();
+
+    // blocks until every list has been recorded
+    void record(RecordFunction function, void *userData);
+
+    // GL thread only
+    void execute() const;
+
+    unsigned int size() const;
+    CommandList& list(unsigned int index);
+
+  private:
+    struct Worker
+    {
+      CommandRecorder *recorder;
+      unsigned int index;
+      pthread_t thread;
+    };
+
+    std::vector<CommandList*> lists;
+    std::vector<Worker> workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t startCond;
+    pthread_cond_t doneCond;
+    unsigned long generation;
+    unsigned int pending;
+    bool quit;
+
+    RecordFunction function;
+    void *userData;
+
+    static void* workerMain(void *arg);
+
+    // not copyable
+    CommandRecorder(const CommandRecorder&);
+    CommandRecorder& operator=(const CommandRecorder&);
+};
+
+#endif
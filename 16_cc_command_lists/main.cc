@@ -0,0 +1,187 @@
+// main.cc
+
+// command lists recorded by worker threads, submitted by the GL thread
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <cmath>
+
+#include "shader.h"
+#include "recorder.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define GRID_SIZE 64
+#define NUM_OBJECTS (GRID_SIZE * GRID_SIZE)
+
+// data shared (read only) by the recording threads
+struct Scene
+{
+  float time;
+  GLuint program;
+  GLuint vao;
+  GLint offsetLocation;
+  float baseX[NUM_OBJECTS];
+  float baseY[NUM_OBJECTS];
+};
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+void recordScene(CommandList &list, unsigned int index, unsigned int count, void *userData);
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Command Lists", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  GLuint triangleVAO, triangleVBO, triangleEBO;
+  glGenVertexArrays(1, &triangleVAO);
+  glGenBuffers(1, &triangleVBO);
+  glGenBuffers(1, &triangleEBO);
+
+  // bind triangle data
+  glBindVertexArray(triangleVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, triangleVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0,                  // vertex attribute to configure (loc = 0)
+                          3,                // size of vertex attribute, 3 coords
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glVertexAttribPointer(1,                  // vertex attribute to configure (loc = 1)
+                          3,                // size of vertex attribute, rgb
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)(3*sizeof(GL_FLOAT))  // start at
+  );
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  // uniform locations are looked up once, the workers only record them
+  GLint offsetLocation = glGetUniformLocation(ourShader.ID, "offset");
+  GLint scaleLocation = glGetUniformLocation(ourShader.ID, "scale");
+
+  // the scene: a grid of small triangles
+  Scene scene;
+  scene.program = ourShader.ID;
+  scene.vao = triangleVAO;
+  scene.offsetLocation = offsetLocation;
+  for (int y = 0; y < GRID_SIZE; y++) {
+    for (int x = 0; x < GRID_SIZE; x++) {
+      scene.baseX[y * GRID_SIZE + x] = -1.0f + (x + 0.5f) * 2.0f / GRID_SIZE;
+      scene.baseY[y * GRID_SIZE + x] = -1.0f + (y + 0.5f) * 2.0f / GRID_SIZE;
+    }
+  }
+
+  ourShader.use();
+  glUniform1f(scaleLocation, 1.5f / GRID_SIZE);
+
+  // one command list per core
+  CommandRecorder recorder;
+  std::cout << "recording on " << recorder.size() << " threads" << std::endl;
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // build the frame in parallel (no GL calls here) ...
+    scene.time = glfwGetTime();
+    recorder.record(recordScene, &scene);
+
+    // ... and submit it from the GL thread
+    recorder.execute();
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// record the slice [index/count] of the scene in the list:
+// animate, cull what is out of the screen, emit the draws
+void recordScene(CommandList &list, unsigned int index, unsigned int count, void *userData)
+{
+  Scene *scene = (Scene*)userData;
+  unsigned int begin = NUM_OBJECTS * index / count;
+  unsigned int end = NUM_OBJECTS * (index + 1) / count;
+
+  list.useProgram(scene->program);
+  list.bindVertexArray(scene->vao);
+  for (unsigned int i = begin; i < end; i++) {
+    float x = scene->baseX[i] + sin(scene->time + scene->baseY[i] * 4.0f) * 0.1f;
+    float y = scene->baseY[i];
+    if (x < -1.0f || x > 1.0f)
+      continue;
+    list.uniform2f(scene->offsetLocation, x, y);
+    list.drawElements(3, 0);
+  }
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+uniform vec2 offset;
+uniform float scale;
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = vec4(aPos.x * scale + offset.x, aPos.y * scale + offset.y, aPos.z, 1.0f);
+  vertexColor = aColor;
+}
@@ -0,0 +1,96 @@
+// bench_jobs.cc
+
+// job system microbenchmark:
+// - scheduling overhead of empty jobs
+// - parallelFor scaling on a compute loop
+// usage: bench_jobs [max threads] (default: number of cores, up to 64)
+
+#include "jobsystem.h"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <time.h>
+#include <unistd.h>
+
+#define EMPTY_JOBS 1000
+#define EMPTY_BATCHES 200
+#define FOR_COUNT (1 << 22)
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void emptyJob(void *data, unsigned int begin, unsigned int end)
+{
+}
+
+static void computeJob(void *data, unsigned int begin, unsigned int end)
+{
+  float *values = (float*)data;
+  for (unsigned int i = begin; i < end; i++)
+    values[i] = sqrtf(values[i] * 1.0001f + 0.5f) * sinf(values[i]);
+}
+
+int main(int argc, char *argv[])
+{
+  long cores = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned int maxThreads = cores > 0 ? (unsigned int)cores : 1;
+  if (maxThreads > 64) maxThreads = 64;
+  if (argc > 1) maxThreads = atoi(argv[1]) > 0 ? atoi(argv[1]) : 1;
+
+  float *values = new float[FOR_COUNT];
+  for (unsigned int i = 0; i < FOR_COUNT; i++)
+    values[i] = (float)i / FOR_COUNT;
+
+  std::cout << "threads   ns/job   parallelFor ms   speedup" << std::endl;
+
+  // powers of two, then the full machine if it is not one
+  std::vector<unsigned int> counts;
+  for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+    counts.push_back(threads);
+  if (counts.back() != maxThreads)
+    counts.push_back(maxThreads);
+
+  double baseline = 0.0;
+  for (size_t c = 0; c < counts.size(); c++) {
+    unsigned int threads = counts[c];
+    JobSystem jobs(threads);
+
+    // scheduling overhead: batches of empty jobs
+    double start = now();
+    for (unsigned int b = 0; b < EMPTY_BATCHES; b++) {
+      JobCounter counter;
+      for (unsigned int j = 0; j < EMPTY_JOBS; j++)
+        jobs.run(emptyJob, NULL, &counter);
+      jobs.wait(&counter);
+    }
+    double nsPerJob = (now() - start) * 1e9 / (EMPTY_JOBS * EMPTY_BATCHES);
+
+    // scaling: best of a few runs
+    double best = 1e9;
+    for (unsigned int r = 0; r < 5; r++) {
+      start = now();
+      JobCounter counter;
+      jobs.parallelFor(FOR_COUNT, 1024, computeJob, values, &counter);
+      jobs.wait(&counter);
+      double elapsed = now() - start;
+      if (elapsed < best) best = elapsed;
+    }
+    if (threads == 1) baseline = best;
+
+    std::cout << std::setw(7) << threads
+              << std::setw(9) << std::fixed << std::setprecision(1) << nsPerJob
+              << std::setw(17) << std::setprecision(2) << best * 1000.0
+              << std::setw(10) << std::setprecision(2) << baseline / best
+              << std::endl;
+  }
+
+  delete[] values;
+  return 0;
+}
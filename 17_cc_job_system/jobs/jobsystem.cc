@@ -0,0 +1,222 @@
+#include "jobsystem.h"
+
+#include <sched.h>
+#include <unistd.h>
+
+// index of the worker running on this thread
+static __thread int currentWorker = -1;
+
+JobSystem::JobSystem(unsigned int numThreads)
+{
+  if (numThreads == 0) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    numThreads = cores > 0 ? (unsigned int)cores : 1;
+  }
+
+  this->quit = false;
+  this->queued = 0;
+  this->sleeping = 0;
+  pthread_mutex_init(&this->mutex, NULL);
+  pthread_cond_init(&this->wakeCond, NULL);
+
+  for (unsigned int i = 0; i < numThreads; i++) {
+    Worker *worker = new Worker();
+    worker->system = this;
+    worker->index = i;
+    worker->pool = new Job[MAX_JOBS];
+    for (unsigned int j = 0; j < MAX_JOBS; j++)
+      worker->pool[j].done = 1;
+    worker->poolIndex = 0;
+    worker->random = 2463534242u + i * 7919u;
+    this->workers.push_back(worker);
+  }
+
+  currentWorker = 0;
+  for (unsigned int i = 1; i < numThreads; i++)
+    pthread_create(&this->workers[i]->thread, NULL, workerMain, this->workers[i]);
+}
+
+JobSystem::~JobSystem()
+{
+  pthread_mutex_lock(&this->mutex);
+  __atomic_store_n(&this->quit, true, __ATOMIC_SEQ_CST);
+  pthread_cond_broadcast(&this->wakeCond);
+  pthread_mutex_unlock(&this->mutex);
+
+  for (unsigned int i = 1; i < this->workers.size(); i++)
+    pthread_join(this->workers[i]->thread, NULL);
+
+  for (unsigned int i = 0; i < this->workers.size(); i++) {
+    delete[] this->workers[i]->pool;
+    delete this->workers[i];
+  }
+
+  pthread_cond_destroy(&this->wakeCond);
+  pthread_mutex_destroy(&this->mutex);
+}
+
+JobSystem::Worker* JobSystem::current()
+{
+  return this->workers[currentWorker];
+}
+
+// jobs come from a per-worker ring: no locks, no malloc;
+// a slot is reused after MAX_JOBS allocations, usually long done:
+// if it is still live (more than MAX_JOBS jobs in flight) help
+// executing jobs until it ends
+Job* JobSystem::allocate(Worker *worker)
+{
+  Job *job = &worker->pool[worker->poolIndex & (MAX_JOBS - 1)];
+  worker->poolIndex++;
+  while (!__atomic_load_n(&job->done, __ATOMIC_ACQUIRE)) {
+    Job *other = this->find(worker);
+    if (other != NULL)
+      this->execute(worker, other);
+    else
+      sched_yield();
+  }
+  job->done = 0;
+  return job;
+}
+
+void JobSystem::push(Worker *worker, Job *job)
+{
+  if (!worker->queue.push(job)) {
+    // deque full: run it now
+    this->execute(worker, job);
+    return;
+  }
+
+  __atomic_add_fetch(&this->queued, 1, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&this->sleeping, __ATOMIC_SEQ_CST) > 0) {
+    pthread_mutex_lock(&this->mutex);
+    pthread_cond_signal(&this->wakeCond);
+    pthread_mutex_unlock(&this->mutex);
+  }
+}
+
+// own deque first, then steal starting from a random victim
+Job* JobSystem::find(Worker *worker)
+{
+  Job *job = worker->queue.pop();
+  if (job == NULL) {
+    unsigned int n = this->workers.size();
+    worker->random ^= worker->random << 13;
+    worker->random ^= worker->random >> 17;
+    worker->random ^= worker->random << 5;
+    unsigned int start = worker->random % n;
+    for (unsigned int i = 0; i < n && job == NULL; i++) {
+      Worker *victim = this->workers[(start + i) % n];
+      if (victim != worker)
+        job = victim->queue.steal();
+    }
+  }
+  if (job != NULL)
+    __atomic_sub_fetch(&this->queued, 1, __ATOMIC_SEQ_CST);
+  return job;
+}
+
+void JobSystem::execute(Worker *worker, Job *job)
+{
+  // parallelFor: keep half of the range, give the other half away
+  while (job->end - job->begin > job->grain) {
+    unsigned int middle = job->begin + (job->end - job->begin) / 2;
+    Job *right = this->allocate(worker);
+    *right = *job;
+    right->begin = middle;
+    job->end = middle;
+    __atomic_add_fetch(&job->counter->value, 1, __ATOMIC_RELAXED);
+    this->push(worker, right);
+  }
+
+  job->function(job->data, job->begin, job->end);
+  __atomic_sub_fetch(&job->counter->value, 1, __ATOMIC_RELEASE);
+  __atomic_store_n(&job->done, 1, __ATOMIC_RELEASE);
+}
+
+void JobSystem::run(JobFunction function, void *data, JobCounter *counter)
+{
+  Worker *worker = this->current();
+  Job *job = this->allocate(worker);
+  job->function = function;
+  job->data = data;
+  job->begin = 0;
+  job->end = 0;
+  job->grain = 0;
+  job->counter = counter;
+  __atomic_add_fetch(&counter->value, 1, __ATOMIC_RELAXED);
+  this->push(worker, job);
+}
+
+void JobSystem::parallelFor(unsigned int count, unsigned int minChunk,
+                            JobFunction function, void *data, JobCounter *counter)
+{
+  if (count == 0) return;
+
+  // aim at a few chunks per worker, never below minChunk
+  unsigned int grain = count / (this->workers.size() * 4);
+  if (grain < minChunk) grain = minChunk;
+  if (grain == 0) grain = 1;
+
+  Worker *worker = this->current();
+  Job *job = this->allocate(worker);
+  job->function = function;
+  job->data = data;
+  job->begin = 0;
+  job->end = count;
+  job->grain = grain;
+  job->counter = counter;
+  __atomic_add_fetch(&counter->value, 1, __ATOMIC_RELAXED);
+  this->push(worker, job);
+}
+
+void JobSystem::wait(JobCounter *counter)
+{
+  Worker *worker = this->current();
+  while (__atomic_load_n(&counter->value, __ATOMIC_ACQUIRE) > 0) {
+    Job *job = this->find(worker);
+    if (job != NULL)
+      this->execute(worker, job);
+    else
+      sched_yield();
+  }
+}
+
+unsigned int JobSystem::size() const
+{
+  return this->workers.size();
+}
+
+void* JobSystem::workerMain(void *arg)
+{
+  Worker *worker = (Worker*)arg;
+  JobSystem *system = worker->system;
+  currentWorker = worker->index;
+
+  unsigned int idle = 0;
+  while (!__atomic_load_n(&system->quit, __ATOMIC_SEQ_CST)) {
+    Job *job = system->find(worker);
+    if (job != NULL) {
+      system->execute(worker, job);
+      idle = 0;
+      continue;
+    }
+
+    // spin a little before going to sleep
+    if (++idle < 64) {
+      sched_yield();
+      continue;
+    }
+
+    pthread_mutex_lock(&system->mutex);
+    __atomic_add_fetch(&system->sleeping, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&system->queued, __ATOMIC_SEQ_CST) == 0 &&
+        !__atomic_load_n(&system->quit, __ATOMIC_SEQ_CST))
+      pthread_cond_wait(&system->wakeCond, &system->mutex);
+    __atomic_sub_fetch(&system->sleeping, 1, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&system->mutex);
+    idle = 0;
+  }
+
+  return NULL;
+}
@@ -0,0 +1,252 @@
+// main.cc
+
+// job system: simulation, culling and instance packing run as jobs
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <cmath>
+
+#include "shader.h"
+#include "jobsystem.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define NUM_OBJECTS 65536
+#define CHUNK_SIZE 1024
+#define NUM_CHUNKS (NUM_OBJECTS / CHUNK_SIZE)
+
+struct Scene
+{
+  float dt;
+  float x[NUM_OBJECTS], y[NUM_OBJECTS];
+  float vx[NUM_OBJECTS], vy[NUM_OBJECTS];
+  unsigned int visibleIndex[NUM_OBJECTS];
+  unsigned int chunkVisible[NUM_CHUNKS];
+  unsigned int chunkOffset[NUM_CHUNKS];
+  float instances[NUM_OBJECTS * 2];
+};
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+void simulate(void *data, unsigned int begin, unsigned int end);
+void cull(void *data, unsigned int begin, unsigned int end);
+void pack(void *data, unsigned int begin, unsigned int end);
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Job System", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  GLuint triangleVAO, triangleVBO, triangleEBO;
+  glGenVertexArrays(1, &triangleVAO);
+  glGenBuffers(1, &triangleVBO);
+  glGenBuffers(1, &triangleEBO);
+
+  // bind triangle data
+  glBindVertexArray(triangleVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, triangleVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0,                  // vertex attribute to configure (loc = 0)
+                          3,                // size of vertex attribute, 3 coords
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glVertexAttribPointer(1,                  // vertex attribute to configure (loc = 1)
+                          3,                // size of vertex attribute, rgb
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)(3*sizeof(GL_FLOAT))  // start at
+  );
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  // per instance offsets, filled every frame by the jobs
+  GLuint instanceVBO;
+  glGenBuffers(1, &instanceVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, NUM_OBJECTS * 2 * sizeof(float), NULL, GL_STREAM_DRAW);
+  glVertexAttribPointer(2,                  // vertex attribute to configure (loc = 2)
+                          2,                // size of vertex attribute, x y offset
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          2*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glEnableVertexAttribArray(2);
+  glVertexAttribDivisor(2, 1);              // advance once per instance
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  ourShader.use();
+  ourShader.setFloat("scale", 0.02f);
+
+  // the scene lives in a larger area than the screen, so culling has work to do
+  static Scene scene;
+  unsigned int seed = 1;
+  for (unsigned int i = 0; i < NUM_OBJECTS; i++) {
+    seed = seed * 1103515245u + 12345u;
+    scene.x[i] = ((seed >> 8) % 3000) / 1000.0f - 1.5f;
+    seed = seed * 1103515245u + 12345u;
+    scene.y[i] = ((seed >> 8) % 3000) / 1000.0f - 1.5f;
+    seed = seed * 1103515245u + 12345u;
+    scene.vx[i] = ((seed >> 8) % 1000) / 1000.0f - 0.5f;
+    seed = seed * 1103515245u + 12345u;
+    scene.vy[i] = ((seed >> 8) % 1000) / 1000.0f - 0.5f;
+  }
+
+  JobSystem jobs;
+  std::cout << "job system: " << jobs.size() << " workers" << std::endl;
+
+  float lastTime = glfwGetTime();
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    float t = glfwGetTime();
+    scene.dt = t - lastTime;
+    lastTime = t;
+
+    // simulation
+    JobCounter simulated;
+    jobs.parallelFor(NUM_OBJECTS, 256, simulate, &scene, &simulated);
+    jobs.wait(&simulated);
+
+    // culling, each chunk compacts its visible objects
+    JobCounter culled;
+    jobs.parallelFor(NUM_CHUNKS, 1, cull, &scene, &culled);
+    jobs.wait(&culled);
+
+    unsigned int visible = 0;
+    for (unsigned int c = 0; c < NUM_CHUNKS; c++) {
+      scene.chunkOffset[c] = visible;
+      visible += scene.chunkVisible[c];
+    }
+
+    // instance buffer packing
+    JobCounter packed;
+    jobs.parallelFor(NUM_CHUNKS, 1, pack, &scene, &packed);
+    jobs.wait(&packed);
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // upload and draw all the visible objects at once
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, visible * 2 * sizeof(float), scene.instances);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    ourShader.use();
+    glBindVertexArray(triangleVAO);
+    glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, visible);
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// move the objects, bounce on the border of the world
+void simulate(void *data, unsigned int begin, unsigned int end)
+{
+  Scene *scene = (Scene*)data;
+  for (unsigned int i = begin; i < end; i++) {
+    scene->x[i] += scene->vx[i] * scene->dt;
+    scene->y[i] += scene->vy[i] * scene->dt;
+    if (scene->x[i] < -1.5f || scene->x[i] > 1.5f) scene->vx[i] = -scene->vx[i];
+    if (scene->y[i] < -1.5f || scene->y[i] > 1.5f) scene->vy[i] = -scene->vy[i];
+  }
+}
+
+// keep the objects on the screen, compacted at the start of their chunk
+void cull(void *data, unsigned int begin, unsigned int end)
+{
+  Scene *scene = (Scene*)data;
+  for (unsigned int c = begin; c < end; c++) {
+    unsigned int n = 0;
+    for (unsigned int i = c * CHUNK_SIZE; i < (c + 1) * CHUNK_SIZE; i++) {
+      if (scene->x[i] > -1.05f && scene->x[i] < 1.05f &&
+          scene->y[i] > -1.05f && scene->y[i] < 1.05f)
+        scene->visibleIndex[c * CHUNK_SIZE + n++] = i;
+    }
+    scene->chunkVisible[c] = n;
+  }
+}
+
+// write the visible offsets contiguously in the instance array
+void pack(void *data, unsigned int begin, unsigned int end)
+{
+  Scene *scene = (Scene*)data;
+  for (unsigned int c = begin; c < end; c++) {
+    float *out = scene->instances + scene->chunkOffset[c] * 2;
+    for (unsigned int k = 0; k < scene->chunkVisible[c]; k++) {
+      unsigned int i = scene->visibleIndex[c * CHUNK_SIZE + k];
+      *out++ = scene->x[i];
+      *out++ = scene->y[i];
+    }
+  }
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
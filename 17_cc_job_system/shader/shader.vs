@@ -0,0 +1,15 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec2 aOffset;    // per instance
+
+uniform float scale;
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = vec4(aPos.x * scale + aOffset.x, aPos.y * scale + aOffset.y, aPos.z, 1.0f);
+  vertexColor = aColor;
+}
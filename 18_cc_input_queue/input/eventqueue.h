@@ -0,0 +1,56 @@
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+// Single producer / single consumer lock-free ring buffer.
+// push() from one thread only, pop() from one thread only;
+// CAPACITY must be a power of two.
+template <typename T, unsigned int CAPACITY>
+class EventQueue
+{
+  public:
+    EventQueue()
+    {
+      this->head = 0;
+      this->tail = 0;
+    }
+
+    // false if full (the event is dropped)
+    bool push(const T &item)
+    {
+      unsigned int t = __atomic_load_n(&this->tail, __ATOMIC_RELAXED);
+      unsigned int h = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE);
+      if (t - h == CAPACITY)
+        return false;
+      this->items[t & (CAPACITY - 1)] = item;
+      __atomic_store_n(&this->tail, t + 1, __ATOMIC_RELEASE);
+      return true;
+    }
+
+    // oldest item, without removing it
+    bool peek(T &item) const
+    {
+      unsigned int h = __atomic_load_n(&this->head, __ATOMIC_RELAXED);
+      unsigned int t = __atomic_load_n(&this->tail, __ATOMIC_ACQUIRE);
+      if (h == t)
+        return false;
+      item = this->items[h & (CAPACITY - 1)];
+      return true;
+    }
+
+    bool pop(T &item)
+    {
+      if (!this->peek(item))
+        return false;
+      unsigned int h = __atomic_load_n(&this->head, __ATOMIC_RELAXED);
+      __atomic_store_n(&this->head, h + 1, __ATOMIC_RELEASE);
+      return true;
+    }
+
+  private:
+    unsigned int head;       // consumer
+    char padding[64];
+    unsigned int tail;       // producer
+    T items[CAPACITY];
+};
+
+#endif
@@ -0,0 +1,144 @@
+#include "input.h"
+
+#include <iostream>
+
+Input::Input(GLFWwindow* window)
+{
+  for (int i = 0; i <= GLFW_KEY_LAST; i++) {
+    this->keys[i] = false;
+    this->presses[i] = 0;
+  }
+  for (int i = 0; i <= GLFW_MOUSE_BUTTON_LAST; i++)
+    this->buttons[i] = false;
+  this->cursorX = 0.0;
+  this->cursorY = 0.0;
+  this->droppedEvents = 0;
+  this->oldestUnpresented = 0.0;
+  this->newestUnpresented = 0.0;
+  this->unpresented = 0;
+  this->latencySamples = 0;
+  this->latencyTotal = 0.0;
+  this->latencyMax = 0.0;
+
+  glfwSetWindowUserPointer(window, this);
+  glfwSetKeyCallback(window, keyCallback);
+  glfwSetMouseButtonCallback(window, mouseButtonCallback);
+  glfwSetCursorPosCallback(window, cursorPosCallback);
+}
+
+void Input::push(const InputEvent &event)
+{
+  if (!this->queue.push(event))
+    __atomic_add_fetch(&this->droppedEvents, 1, __ATOMIC_RELAXED);
+}
+
+void Input::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+  if (key < 0 || key > GLFW_KEY_LAST) return;
+  InputEvent event = { INPUT_KEY, glfwGetTime(), key, action, 0.0, 0.0 };
+  ((Input*)glfwGetWindowUserPointer(window))->push(event);
+}
+
+void Input::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+{
+  if (button < 0 || button > GLFW_MOUSE_BUTTON_LAST) return;
+  InputEvent event = { INPUT_MOUSE_BUTTON, glfwGetTime(), button, action, 0.0, 0.0 };
+  ((Input*)glfwGetWindowUserPointer(window))->push(event);
+}
+
+void Input::cursorPosCallback(GLFWwindow* window, double x, double y)
+{
+  InputEvent event = { INPUT_CURSOR, glfwGetTime(), 0, 0, x, y };
+  ((Input*)glfwGetWindowUserPointer(window))->push(event);
+}
+
+unsigned int Input::update(double until)
+{
+  for (int i = 0; i <= GLFW_KEY_LAST; i++)
+    this->presses[i] = 0;
+
+  unsigned int consumed = 0;
+  InputEvent event;
+  while (this->queue.peek(event) && event.time <= until) {
+    this->queue.pop(event);
+    consumed++;
+
+    switch (event.type) {
+      case INPUT_KEY:
+        this->keys[event.code] = event.action != GLFW_RELEASE;
+        if (event.action != GLFW_RELEASE)
+          this->presses[event.code]++;
+        break;
+      case INPUT_MOUSE_BUTTON:
+        this->buttons[event.code] = event.action != GLFW_RELEASE;
+        break;
+      case INPUT_CURSOR:
+        this->cursorX = event.x;
+        this->cursorY = event.y;
+        break;
+    }
+
+    if (this->unpresented == 0)
+      this->oldestUnpresented = event.time;
+    this->newestUnpresented = event.time;
+    this->unpresented++;
+  }
+
+  return consumed;
+}
+
+bool Input::isDown(int key) const
+{
+  return key >= 0 && key <= GLFW_KEY_LAST && this->keys[key];
+}
+
+unsigned int Input::pressed(int key) const
+{
+  return (key >= 0 && key <= GLFW_KEY_LAST) ? this->presses[key] : 0;
+}
+
+bool Input::mouseDown(int button) const
+{
+  return button >= 0 && button <= GLFW_MOUSE_BUTTON_LAST && this->buttons[button];
+}
+
+double Input::mouseX() const
+{
+  return this->cursorX;
+}
+
+double Input::mouseY() const
+{
+  return this->cursorY;
+}
+
+void Input::presented(double time)
+{
+  if (this->unpresented == 0) return;
+
+  // the newest event gives the typical latency, the oldest the worst one
+  double latency = time - this->newestUnpresented;
+  this->latencyTotal += latency;
+  this->latencySamples++;
+  if (time - this->oldestUnpresented > this->latencyMax)
+    this->latencyMax = time - this->oldestUnpresented;
+  this->unpresented = 0;
+}
+
+void Input::reportLatency() const
+{
+  if (this->latencySamples == 0) {
+    std::cout << "input latency: no events" << std::endl;
+    return;
+  }
+  std::cout << "input to present latency: avg "
+            << this->latencyTotal / this->latencySamples * 1000.0 << " ms, max "
+            << this->latencyMax * 1000.0 << " ms ("
+            << this->latencySamples << " frames with input, "
+            << this->dropped() << " events dropped)" << std::endl;
+}
+
+unsigned int Input::dropped() const
+{
+  return __atomic_load_n(&this->droppedEvents, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,84 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <GLFW/glfw3.h>
+
+#include "eventqueue.h"
+
+enum InputEventType
+{
+  INPUT_KEY,
+  INPUT_MOUSE_BUTTON,
+  INPUT_CURSOR
+};
+
+struct InputEvent
+{
+  InputEventType type;
+  double time;        // glfwGetTime() when the event arrived
+  int code;           // key or mouse button
+  int action;         // GLFW_PRESS, GLFW_RELEASE, GLFW_REPEAT
+  double x, y;        // cursor position
+};
+
+// Input: GLFW callbacks push timestamped events into a lock-free queue,
+// the simulation drains them one fixed step at a time, so every
+// press is seen (even if released before the end of the frame)
+// and it is applied to the step it happened in.
+// The callbacks run on the thread pumping the events (the producer),
+// which should do nothing else so the stamps are arrival times;
+// update() and the queries belong to the simulation thread (the consumer).
+class Input
+{
+  public:
+    static const unsigned int QUEUE_SIZE = 1024;
+
+    // installs the key, mouse button and cursor callbacks
+    Input(GLFWwindow* window);
+
+    // apply the events that happened before 'until';
+    // returns the number of events consumed
+    unsigned int update(double until);
+
+    bool isDown(int key) const;
+    // presses (and repeats) seen by the last update()
+    unsigned int pressed(int key) const;
+    bool mouseDown(int button) const;
+    double mouseX() const;
+    double mouseY() const;
+
+    // the frame with the events consumed so far has been presented:
+    // accumulate the input to present latency
+    void presented(double time);
+    void reportLatency() const;
+
+    // any thread
+    unsigned int dropped() const;
+
+  private:
+    EventQueue<InputEvent, QUEUE_SIZE> queue;
+    unsigned int droppedEvents;
+
+    bool keys[GLFW_KEY_LAST + 1];
+    unsigned int presses[GLFW_KEY_LAST + 1];
+    bool buttons[GLFW_MOUSE_BUTTON_LAST + 1];
+    double cursorX, cursorY;
+
+    // events waiting to be on screen
+    double oldestUnpresented;
+    double newestUnpresented;
+    unsigned int unpresented;
+
+    // latency statistics
+    unsigned int latencySamples;
+    double latencyTotal;
+    double latencyMax;
+
+    void push(const InputEvent &event);
+
+    static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void cursorPosCallback(GLFWwindow* window, double x, double y);
+};
+
+#endif
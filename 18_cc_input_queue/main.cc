@@ -0,0 +1,215 @@
+// main.cc
+
+// input events queue, drained by a fixed step simulation
+// the main thread only pumps events (glfwWaitEvents), so the callbacks
+// stamp every event when it arrives instead of once per frame; the GL
+// context, the simulation and the rendering live on a render thread
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <pthread.h>
+
+#include "shader.h"
+#include "input.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define SIM_STEP (1.0 / 120.0)
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window, const Input &input, float &offsetX, float &offsetY);
+void* renderMain(void *arg);
+
+struct RenderThread
+{
+  GLFWwindow* window;
+  Input* input;
+  int result;
+};
+
+// written by the callback on the main thread, applied by the render thread
+static int framebufferWidth = SCREEN_WIDTH;
+static int framebufferHeight = SCREEN_HEIGHT;
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Input Queue", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // callbacks are installed (and run) on the main thread
+  Input input(window);
+
+  RenderThread render;
+  render.window = window;
+  render.input = &input;
+  render.result = 0;
+  pthread_t renderThread;
+  if (pthread_create(&renderThread, NULL, renderMain, &render) != 0)
+  {
+    std::cout << "Failed to create the render thread" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+
+  // event pump: sleeps until an event arrives, the render thread
+  // wakes it up (glfwPostEmptyEvent) when it ends
+  while(!glfwWindowShouldClose(window))
+    glfwWaitEvents();
+
+  pthread_join(renderThread, NULL);
+  input.reportLatency();
+
+  glfwTerminate();
+  return render.result;
+}
+
+void* renderMain(void *arg)
+{
+  RenderThread *render = (RenderThread*)arg;
+  GLFWwindow* window = render->window;
+  Input &input = *render->input;
+
+  glfwMakeContextCurrent(window);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    render->result = -1;
+    glfwSetWindowShouldClose(window, true);
+    glfwPostEmptyEvent();
+    return NULL;
+  }
+
+  int viewportWidth = SCREEN_WIDTH, viewportHeight = SCREEN_HEIGHT;
+  glViewport(0, 0, viewportWidth, viewportHeight);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  GLuint triangleVAO, triangleVBO, triangleEBO;
+  glGenVertexArrays(1, &triangleVAO);
+  glGenBuffers(1, &triangleVBO);
+  glGenBuffers(1, &triangleEBO);
+
+  // bind triangle data
+  glBindVertexArray(triangleVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, triangleVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0,                  // vertex attribute to configure (loc = 0)
+                          3,                // size of vertex attribute, 3 coords
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glVertexAttribPointer(1,                  // vertex attribute to configure (loc = 1)
+                          3,                // size of vertex attribute, rgb
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)(3*sizeof(GL_FLOAT))  // start at
+  );
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  GLint offsetLocation = glGetUniformLocation(ourShader.ID, "offset");
+
+  // the simulation runs at a fixed rate, independent from the frame rate
+  float offsetX = 0.0f, offsetY = 0.0f;
+  double simTime = glfwGetTime();
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    int width = __atomic_load_n(&framebufferWidth, __ATOMIC_RELAXED);
+    int height = __atomic_load_n(&framebufferHeight, __ATOMIC_RELAXED);
+    if (width != viewportWidth || height != viewportHeight) {
+      viewportWidth = width;
+      viewportHeight = height;
+      glViewport(0, 0, width, height);
+    }
+
+    // each step consumes only the events that arrived before its end
+    double now = glfwGetTime();
+    while (simTime + SIM_STEP <= now) {
+      simTime += SIM_STEP;
+      input.update(simTime);
+      processInput(window, input, offsetX, offsetY);
+    }
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ourShader.use();
+    glUniform2f(offsetLocation, offsetX, offsetY);
+    glBindVertexArray(triangleVAO);
+    glDrawElements(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0);
+
+    glfwSwapBuffers(window);
+    // wait for the GPU so that the measure includes the whole frame
+    glFinish();
+    input.presented(glfwGetTime());
+  }
+
+  glfwMakeContextCurrent(NULL);
+  glfwSetWindowShouldClose(window, true);
+  glfwPostEmptyEvent();
+  return NULL;
+}
+
+// handler for window resizing (called ad startup); no context on this
+// thread, the render thread sets the viewport
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  __atomic_store_n(&framebufferWidth, width, __ATOMIC_RELAXED);
+  __atomic_store_n(&framebufferHeight, height, __ATOMIC_RELAXED);
+}
+
+// one simulation step: every key press moves the triangle,
+// holding the key moves it continuously
+void processInput(GLFWwindow* window, const Input &input, float &offsetX, float &offsetY)
+{
+  if (input.pressed(GLFW_KEY_ESCAPE))
+    glfwSetWindowShouldClose(window, true);
+
+  const float step = 0.01f;
+  offsetX += step * (input.pressed(GLFW_KEY_RIGHT) + input.isDown(GLFW_KEY_RIGHT));
+  offsetX -= step * (input.pressed(GLFW_KEY_LEFT) + input.isDown(GLFW_KEY_LEFT));
+  offsetY += step * (input.pressed(GLFW_KEY_UP) + input.isDown(GLFW_KEY_UP));
+  offsetY -= step * (input.pressed(GLFW_KEY_DOWN) + input.isDown(GLFW_KEY_DOWN));
+}
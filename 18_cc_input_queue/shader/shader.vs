@@ -0,0 +1,14 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+uniform vec2 offset;
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = vec4(aPos.x + offset.x, aPos.y + offset.y, aPos.z, 1.0f);
+  vertexColor = aColor;
+}
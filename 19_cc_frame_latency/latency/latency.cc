@@ -0,0 +1,147 @@
+#include "latency.h"
+
+#include <iostream>
+#include <unistd.h>
+
+// keep a bit of margin when sleeping before the input sampling
+#define JIT_MARGIN 0.002
+
+LatencyController::LatencyController(int swapInterval, unsigned int maxFramesInFlight, bool justInTime)
+{
+  if (maxFramesInFlight < 1) maxFramesInFlight = 1;
+  if (maxFramesInFlight > MAX_FENCES) maxFramesInFlight = MAX_FENCES;
+
+  this->swapInterval = swapInterval;
+  this->maxFramesInFlight = maxFramesInFlight;
+  this->justInTime = justInTime;
+  this->first = 0;
+  this->count = 0;
+  this->lastSwap = glfwGetTime();
+  this->framePeriod = 0.0;
+  this->workTime = 0.0;
+  this->inputTime = this->lastSwap;
+  this->submitTime = this->lastSwap;
+  this->frames = 0;
+  this->depth = 0;
+  this->depthTotal = 0.0;
+  this->fenceWaitTotal = 0.0;
+  this->sleepTotal = 0.0;
+
+  // the current context's swap chain
+  glfwSwapInterval(swapInterval);
+}
+
+LatencyController::~LatencyController()
+{
+  while (this->count > 0) {
+    glDeleteSync(this->fences[this->first]);
+    this->first = (this->first + 1) % MAX_FENCES;
+    this->count--;
+  }
+}
+
+// drop the fences already signaled (does not block)
+void LatencyController::retire()
+{
+  while (this->count > 0) {
+    GLint status = GL_UNSIGNALED;
+    glGetSynciv(this->fences[this->first], GL_SYNC_STATUS, sizeof(status), NULL, &status);
+    if (status != GL_SIGNALED)
+      break;
+    glDeleteSync(this->fences[this->first]);
+    this->first = (this->first + 1) % MAX_FENCES;
+    this->count--;
+  }
+}
+
+void LatencyController::beginFrame()
+{
+  this->retire();
+
+  // too many frames queued: wait for the oldest one
+  double start = glfwGetTime();
+  while (this->count >= this->maxFramesInFlight) {
+    GLsync fence = this->fences[this->first];
+    GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000 /* 100 ms */);
+    if (result == GL_WAIT_FAILED) {
+      std::cout << "ERROR::LATENCY::WAIT_FAILED" << std::endl;
+    } else if (result == GL_TIMEOUT_EXPIRED) {
+      continue;
+    }
+    glDeleteSync(fence);
+    this->first = (this->first + 1) % MAX_FENCES;
+    this->count--;
+  }
+  this->fenceWaitTotal += glfwGetTime() - start;
+}
+
+void LatencyController::waitForInput()
+{
+  if (this->justInTime && this->framePeriod > 0.0) {
+    // sample the input as late as possible: next swap minus the usual work
+    double wakeUp = this->lastSwap + this->framePeriod - this->workTime - JIT_MARGIN;
+    double now = glfwGetTime();
+    if (wakeUp > now) {
+      usleep((useconds_t)((wakeUp - now) * 1e6));
+      this->sleepTotal += glfwGetTime() - now;
+    }
+  }
+  this->inputTime = glfwGetTime();
+}
+
+void LatencyController::submit()
+{
+  this->submitTime = glfwGetTime();
+}
+
+void LatencyController::endFrame()
+{
+  double now = glfwGetTime();
+
+  // moving averages
+  double period = now - this->lastSwap;
+  double work = this->submitTime - this->inputTime;
+  if (this->frames == 0) {
+    this->framePeriod = period;
+    this->workTime = work;
+  } else {
+    this->framePeriod = this->framePeriod * 0.9 + period * 0.1;
+    // react fast when the work grows, slowly when it shrinks
+    if (work > this->workTime)
+      this->workTime = work;
+    else
+      this->workTime = this->workTime * 0.95 + work * 0.05;
+  }
+  this->lastSwap = now;
+
+  if (this->count == MAX_FENCES) {
+    glDeleteSync(this->fences[this->first]);
+    this->first = (this->first + 1) % MAX_FENCES;
+    this->count--;
+  }
+  this->fences[(this->first + this->count) % MAX_FENCES] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  this->count++;
+
+  this->retire();
+  this->depth = this->count;
+  this->depthTotal += this->depth;
+  this->frames++;
+}
+
+unsigned int LatencyController::queueDepth() const
+{
+  return this->depth;
+}
+
+void LatencyController::report() const
+{
+  if (this->frames == 0) return;
+  std::cout << "swap interval " << this->swapInterval
+            << ", max frames in flight " << this->maxFramesInFlight
+            << (this->justInTime ? ", just in time" : "") << std::endl;
+  std::cout << "  frame time " << this->framePeriod * 1000.0 << " ms"
+            << ", input to submit " << this->workTime * 1000.0 << " ms" << std::endl;
+  std::cout << "  queue depth avg " << this->depthTotal / this->frames
+            << ", fence wait " << this->fenceWaitTotal / this->frames * 1000.0 << " ms/frame"
+            << ", jit sleep " << this->sleepTotal / this->frames * 1000.0 << " ms/frame" << std::endl;
+}
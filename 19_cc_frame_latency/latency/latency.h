@@ -0,0 +1,64 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Latency controller: limits how many frames the CPU can queue
+// ahead of the GPU, using one fence per frame.
+//
+// game loop:
+//   latency.beginFrame();     // waits for the GPU if too many frames are queued
+//   latency.waitForInput();   // just in time mode: sleep, then sample the input
+//   ... poll input, simulate, draw ...
+//   latency.submit();         // end of the CPU work
+//   glfwSwapBuffers(window);
+//   latency.endFrame();       // fence for this frame
+class LatencyController
+{
+  public:
+    static const unsigned int MAX_FENCES = 8;
+
+    // swapInterval: 0 = no vsync, 1 = vsync, ...
+    // maxFramesInFlight: 1 = the CPU never runs ahead of the GPU
+    // justInTime: delay the input sampling as much as possible
+    LatencyController(int swapInterval, unsigned int maxFramesInFlight, bool justInTime);
+    ~LatencyController();
+
+    void beginFrame();
+    void waitForInput();
+    void submit();
+    void endFrame();
+
+    // frames submitted but not yet finished by the GPU (last frame)
+    unsigned int queueDepth() const;
+    void report() const;
+
+  private:
+    int swapInterval;
+    unsigned int maxFramesInFlight;
+    bool justInTime;
+
+    // ring of fences, oldest first
+    GLsync fences[MAX_FENCES];
+    unsigned int first;
+    unsigned int count;
+
+    // timings (seconds)
+    double lastSwap;
+    double framePeriod;     // average time between two swaps
+    double workTime;        // time from input sampling to submit (peak, slowly decaying)
+    double inputTime;
+    double submitTime;
+
+    // statistics
+    unsigned int frames;
+    unsigned int depth;
+    double depthTotal;
+    double fenceWaitTotal;
+    double sleepTotal;
+
+    void retire();
+};
+
+#endif
@@ -0,0 +1,343 @@
+// bench_draw.cc
+
+// draw submission benchmark (headless):
+// draws/sec and triangles/sec for several mesh sizes and object counts
+// with each way of submitting the draws used in the samples
+// - glDrawArrays per object         (05_cc_TWO_VAO)
+// - glDrawElements per object       (07_cc_EBO)
+// - uniform update + draw per object (13_cc_shader_class)
+// - one instanced draw
+// - one glMultiDrawElements
+// results are printed as JSON on stdout
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <vector>
+
+#define WINDOW_SIZE 64          // tiny framebuffer: measure submission, not fill rate
+#define MIN_SECONDS 0.25
+#define WARMUP_FRAMES 2
+
+enum Strategy
+{
+  DRAW_ARRAYS,
+  DRAW_ELEMENTS,
+  UNIFORM_PER_OBJECT,
+  INSTANCED,
+  MULTI_DRAW,
+  NUM_STRATEGIES
+};
+
+static const char* strategyNames[NUM_STRATEGIES] = {
+  "draw_arrays", "draw_elements", "uniform_per_object", "instanced", "multi_draw"
+};
+
+struct Mesh
+{
+  unsigned int triangles;
+  GLuint arraysVAO, elementsVAO, instancedVAO;
+  GLuint arraysVBO, elementsVBO, EBO;
+};
+
+struct Scene
+{
+  GLuint uniformProgram, instancedProgram;
+  GLint offsetLocation;
+  GLuint instanceVBO;
+  std::vector<float> offsets;               // 2 floats per object
+  std::vector<GLsizei> multiCounts;
+  std::vector<const GLvoid*> multiIndices;
+};
+
+static const char* uniformVertexShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec3 aPos;\n"
+  "uniform vec2 offset;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = vec4(aPos.xy + offset, aPos.z, 1.0f);\n"
+  "}\n";
+
+static const char* instancedVertexShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec3 aPos;\n"
+  "layout (location = 2) in vec2 aOffset;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = vec4(aPos.xy + aOffset, aPos.z, 1.0f);\n"
+  "}\n";
+
+static const char* fragmentShaderSource = "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
+  "}\n";
+
+static GLuint compileProgram(const char* vertexSource, const char* fragmentSource)
+{
+  int success;
+  char infoLog[512];
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &vertexSource, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &fragmentSource, NULL);
+  glCompileShader(fragment);
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  glAttachShader(program, fragment);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+// a strip of tiny quads (2 triangles each)
+static Mesh createMesh(unsigned int triangles, GLuint instanceVBO)
+{
+  Mesh mesh;
+  mesh.triangles = triangles;
+
+  unsigned int quads = (triangles + 1) / 2;
+  std::vector<float> vertices;       // indexed: 4 vertices per quad
+  std::vector<GLuint> indices;
+  for (unsigned int q = 0; q < quads; q++) {
+    float x = -0.01f + 0.02f * q / quads;
+    float w = 0.02f / quads;
+    float quad[] = { x, -0.01f, 0.0f,  x, 0.01f, 0.0f,  x + w, -0.01f, 0.0f,  x + w, 0.01f, 0.0f };
+    vertices.insert(vertices.end(), quad, quad + 12);
+    GLuint base = q * 4;
+    GLuint quadIndices[] = { base, base + 1, base + 2,  base + 1, base + 2, base + 3 };
+    indices.insert(indices.end(), quadIndices, quadIndices + 6);
+  }
+  indices.resize(triangles * 3);
+
+  // the same triangles, without indices
+  std::vector<float> expanded;
+  for (unsigned int i = 0; i < indices.size(); i++)
+    expanded.insert(expanded.end(), &vertices[indices[i] * 3], &vertices[indices[i] * 3] + 3);
+
+  glGenVertexArrays(1, &mesh.arraysVAO);
+  glGenBuffers(1, &mesh.arraysVBO);
+  glBindVertexArray(mesh.arraysVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.arraysVBO);
+  glBufferData(GL_ARRAY_BUFFER, expanded.size() * sizeof(float), &expanded[0], GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  glGenBuffers(1, &mesh.elementsVBO);
+  glGenBuffers(1, &mesh.EBO);
+  glBindBuffer(GL_ARRAY_BUFFER, mesh.elementsVBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
+
+  glGenVertexArrays(1, &mesh.elementsVAO);
+  glBindVertexArray(mesh.elementsVAO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), &indices[0], GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  // indexed mesh + per instance offset
+  glGenVertexArrays(1, &mesh.instancedVAO);
+  glBindVertexArray(mesh.instancedVAO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 2*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(2);
+  glVertexAttribDivisor(2, 1);
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+  return mesh;
+}
+
+static void deleteMesh(Mesh &mesh)
+{
+  glDeleteVertexArrays(1, &mesh.arraysVAO);
+  glDeleteVertexArrays(1, &mesh.elementsVAO);
+  glDeleteVertexArrays(1, &mesh.instancedVAO);
+  glDeleteBuffers(1, &mesh.arraysVBO);
+  glDeleteBuffers(1, &mesh.elementsVBO);
+  glDeleteBuffers(1, &mesh.EBO);
+}
+
+// one frame: submit 'objects' copies of the mesh; returns the number of draw calls
+static unsigned int drawFrame(Strategy strategy, const Mesh &mesh, unsigned int objects, const Scene &scene)
+{
+  GLsizei count = mesh.triangles * 3;
+
+  switch (strategy) {
+    case DRAW_ARRAYS:
+      glUseProgram(scene.uniformProgram);
+      glBindVertexArray(mesh.arraysVAO);
+      for (unsigned int i = 0; i < objects; i++)
+        glDrawArrays(GL_TRIANGLES, 0, count);
+      return objects;
+
+    case DRAW_ELEMENTS:
+      glUseProgram(scene.uniformProgram);
+      glBindVertexArray(mesh.elementsVAO);
+      for (unsigned int i = 0; i < objects; i++)
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, 0);
+      return objects;
+
+    case UNIFORM_PER_OBJECT:
+      glUseProgram(scene.uniformProgram);
+      glBindVertexArray(mesh.elementsVAO);
+      for (unsigned int i = 0; i < objects; i++) {
+        glUniform2f(scene.offsetLocation, scene.offsets[i * 2], scene.offsets[i * 2 + 1]);
+        glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, 0);
+      }
+      return objects;
+
+    case INSTANCED:
+      glUseProgram(scene.instancedProgram);
+      glBindVertexArray(mesh.instancedVAO);
+      glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, 0, objects);
+      return 1;
+
+    case MULTI_DRAW:
+      glUseProgram(scene.uniformProgram);
+      glBindVertexArray(mesh.elementsVAO);
+      glMultiDrawElements(GL_TRIANGLES, &scene.multiCounts[0], GL_UNSIGNED_INT,
+                          &scene.multiIndices[0], objects);
+      return 1;
+
+    default:
+      return 0;
+  }
+}
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(WINDOW_SIZE, WINDOW_SIZE, "bench_draw", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cerr << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cerr << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, WINDOW_SIZE, WINDOW_SIZE);
+
+  const unsigned int meshSizes[] = { 2, 64, 1024 };
+  const unsigned int objectCounts[] = { 100, 1000, 10000 };
+  const unsigned int maxObjects = 10000;
+
+  Scene scene;
+  scene.uniformProgram = compileProgram(uniformVertexShaderSource, fragmentShaderSource);
+  scene.instancedProgram = compileProgram(instancedVertexShaderSource, fragmentShaderSource);
+  scene.offsetLocation = glGetUniformLocation(scene.uniformProgram, "offset");
+  glUseProgram(scene.uniformProgram);
+  glUniform2f(scene.offsetLocation, 0.0f, 0.0f);
+
+  for (unsigned int i = 0; i < maxObjects; i++) {
+    scene.offsets.push_back(-0.9f + 1.8f * (i % 100) / 100.0f);
+    scene.offsets.push_back(-0.9f + 1.8f * (i / 100 % 100) / 100.0f);
+  }
+  glGenBuffers(1, &scene.instanceVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, scene.instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, scene.offsets.size() * sizeof(float), &scene.offsets[0], GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  scene.multiIndices.assign(maxObjects, (const GLvoid*)0);
+
+  std::cout << "{\n  \"renderer\": \"" << (const char*)glGetString(GL_RENDERER) << "\",\n"
+            << "  \"version\": \"" << (const char*)glGetString(GL_VERSION) << "\",\n"
+            << "  \"results\": [";
+
+  bool firstResult = true;
+  for (unsigned int m = 0; m < sizeof(meshSizes) / sizeof(meshSizes[0]); m++) {
+    Mesh mesh = createMesh(meshSizes[m], scene.instanceVBO);
+    scene.multiCounts.assign(maxObjects, mesh.triangles * 3);
+
+    for (unsigned int o = 0; o < sizeof(objectCounts) / sizeof(objectCounts[0]); o++) {
+      unsigned int objects = objectCounts[o];
+
+      for (unsigned int s = 0; s < NUM_STRATEGIES; s++) {
+        Strategy strategy = (Strategy)s;
+
+        for (unsigned int f = 0; f < WARMUP_FRAMES; f++)
+          drawFrame(strategy, mesh, objects, scene);
+        glFinish();
+
+        unsigned int frames = 0;
+        unsigned long drawCalls = 0;
+        double start = glfwGetTime();
+        double elapsed = 0.0;
+        while (elapsed < MIN_SECONDS) {
+          glClear(GL_COLOR_BUFFER_BIT);
+          drawCalls += drawFrame(strategy, mesh, objects, scene);
+          glFlush();
+          frames++;
+          if (frames % 8 == 0) glFinish();
+          elapsed = glfwGetTime() - start;
+        }
+        glFinish();
+        elapsed = glfwGetTime() - start;
+
+        double objectsDrawn = (double)objects * frames;
+        std::cout << (firstResult ? "\n" : ",\n")
+                  << "    { \"strategy\": \"" << strategyNames[s] << "\""
+                  << ", \"triangles_per_mesh\": " << mesh.triangles
+                  << ", \"objects\": " << objects
+                  << ", \"frames\": " << frames
+                  << ", \"seconds\": " << elapsed
+                  << ", \"draw_calls_per_sec\": " << drawCalls / elapsed
+                  << ", \"objects_per_sec\": " << objectsDrawn / elapsed
+                  << ", \"triangles_per_sec\": " << objectsDrawn * mesh.triangles / elapsed
+                  << " }";
+        firstResult = false;
+      }
+    }
+
+    deleteMesh(mesh);
+  }
+  std::cout << "\n  ]\n}" << std::endl;
+
+  glDeleteBuffers(1, &scene.instanceVBO);
+  glDeleteProgram(scene.uniformProgram);
+  glDeleteProgram(scene.instancedProgram);
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,222 @@
+// bench_shader.cc
+
+// shader startup cost benchmark (headless):
+// builds Shader objects from generated GLSL of increasing size and
+// times file read, vertex/fragment compile, link and first draw
+// - cold:   sources never seen by the driver (unique constant in each)
+// - warm:   the same sources again (driver shader cache hit, if any)
+// - binary: glProgramBinary of the warm program (if the driver supports it)
+// generated files go in ./corpus (created in the working directory)
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "shader.h"
+
+// program binaries are core only since 4.1, our loader is 3.3
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+typedef void (APIENTRYP PFNGETPROGRAMBINARY)(GLuint program, GLsizei bufSize, GLsizei *length,
+                                              GLenum *binaryFormat, void *binary);
+typedef void (APIENTRYP PFNPROGRAMBINARY)(GLuint program, GLenum binaryFormat,
+                                           const void *binary, GLsizei length);
+
+static PFNGETPROGRAMBINARY getProgramBinary = NULL;
+static PFNPROGRAMBINARY programBinary = NULL;
+
+struct Result
+{
+  const char *mode;
+  unsigned int statements;
+  ShaderTimings timings;
+  double firstDraw;
+};
+
+// a shader with 'statements' dependent math statements
+static void generate(unsigned int statements, unsigned int nonce,
+                     std::string &vertexPath, std::string &fragmentPath)
+{
+  std::stringstream name;
+  name << "corpus/shader_" << statements << "_" << nonce;
+  vertexPath = name.str() + ".vs";
+  fragmentPath = name.str() + ".fs";
+
+  std::ofstream vs(vertexPath.c_str());
+  vs << "#version 330 core\n"
+     << "layout (location = 0) in vec3 aPos;\n"
+     << "uniform vec4 u[8];\n"
+     << "out vec4 value;\n"
+     << "const float nonce = " << nonce << ".0;\n"
+     << "void main()\n{\n"
+     << "  vec4 v = vec4(aPos, nonce);\n";
+  for (unsigned int i = 0; i < statements; i++)
+    vs << "  v = v * u[" << i % 8 << "] + sin(v.yzwx * " << (i + 1) << ".0);\n";
+  vs << "  value = v;\n"
+     << "  gl_Position = vec4(aPos, 1.0f);\n}\n";
+
+  std::ofstream fs(fragmentPath.c_str());
+  fs << "#version 330 core\n"
+     << "in vec4 value;\n"
+     << "uniform vec4 k[8];\n"
+     << "out vec4 FragColor;\n"
+     << "const float nonce = " << nonce << ".0;\n"
+     << "void main()\n{\n"
+     << "  vec4 c = value + vec4(nonce);\n";
+  for (unsigned int i = 0; i < statements; i++)
+    fs << "  c = fract(c * k[" << i % 8 << "] + cos(c.wxyz + " << i << ".0));\n";
+  fs << "  FragColor = c;\n}\n";
+}
+
+// the driver may finish its work at the first draw
+static double firstDraw(GLuint program, GLuint vao)
+{
+  double start = glfwGetTime();
+  glUseProgram(program);
+  glBindVertexArray(vao);
+  glDrawArrays(GL_TRIANGLES, 0, 3);
+  glFinish();
+  return glfwGetTime() - start;
+}
+
+static void print(const Result &r)
+{
+  std::cout << std::setw(8) << r.mode
+            << std::setw(12) << r.statements
+            << std::fixed << std::setprecision(3)
+            << std::setw(10) << r.timings.read * 1000.0
+            << std::setw(12) << r.timings.compileVertex * 1000.0
+            << std::setw(12) << r.timings.compileFragment * 1000.0
+            << std::setw(10) << r.timings.link * 1000.0
+            << std::setw(12) << r.firstDraw * 1000.0
+            << std::endl;
+}
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(64, 64, "bench_shader", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  GLint binaryFormats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+  glGetError();   // not an enum on pure 3.3 drivers
+  getProgramBinary = (PFNGETPROGRAMBINARY)glfwGetProcAddress("glGetProgramBinary");
+  programBinary = (PFNPROGRAMBINARY)glfwGetProcAddress("glProgramBinary");
+  bool binarySupported = binaryFormats > 0 && getProgramBinary != NULL && programBinary != NULL;
+
+  // a triangle for the first draw
+  float triangleVertices[] = {
+    -0.5f,  -0.5f,  0.0f,
+     0.5f,  -0.5f,  0.0f,
+     0.0f,   0.5f,  0.0f
+  };
+  GLuint VAO, VBO;
+  glGenVertexArrays(1, &VAO);
+  glGenBuffers(1, &VBO);
+  glBindVertexArray(VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  glBindVertexArray(0);
+
+  mkdir("corpus", 0755);
+
+  std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+  std::cout << "times in ms" << (binarySupported ? "" : " (program binaries not supported)") << std::endl;
+  std::cout << "    mode  statements      read  compile vs  compile fs      link  first draw" << std::endl;
+
+  const unsigned int sizes[] = { 1, 8, 32, 128, 256 };
+  unsigned int nonce = (unsigned int)getpid() * 1000u + (unsigned int)(glfwGetTime() * 1000.0) % 1000u;
+
+  for (unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    std::string vertexPath, fragmentPath;
+    generate(sizes[s], nonce + s, vertexPath, fragmentPath);
+
+    // cold: first time these sources are compiled
+    Result cold;
+    cold.mode = "cold";
+    cold.statements = sizes[s];
+    Shader coldShader(vertexPath.c_str(), fragmentPath.c_str(), &cold.timings);
+    cold.firstDraw = firstDraw(coldShader.ID, VAO);
+    print(cold);
+
+    // warm: same sources again
+    Result warm;
+    warm.mode = "warm";
+    warm.statements = sizes[s];
+    Shader warmShader(vertexPath.c_str(), fragmentPath.c_str(), &warm.timings);
+    warm.firstDraw = firstDraw(warmShader.ID, VAO);
+    print(warm);
+
+    // binary: no source at all, the link time is glProgramBinary
+    if (binarySupported) {
+      GLint length = 0;
+      glGetProgramiv(warmShader.ID, GL_PROGRAM_BINARY_LENGTH, &length);
+      if (length > 0) {
+        std::vector<char> binary(length);
+        GLenum format;
+        getProgramBinary(warmShader.ID, length, NULL, &format, &binary[0]);
+
+        Result bin;
+        bin.mode = "binary";
+        bin.statements = sizes[s];
+        bin.timings.read = 0.0;
+        bin.timings.compileVertex = 0.0;
+        bin.timings.compileFragment = 0.0;
+        double start = glfwGetTime();
+        GLuint program = glCreateProgram();
+        programBinary(program, format, &binary[0], length);
+        GLint success;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        bin.timings.link = glfwGetTime() - start;
+        if (!success)
+          std::cout << "ERROR::SHADER::PROGRAM::BINARY_REJECTED" << std::endl;
+        bin.firstDraw = firstDraw(program, VAO);
+        print(bin);
+        glDeleteProgram(program);
+      }
+    }
+
+    glDeleteProgram(coldShader.ID);
+    glDeleteProgram(warmShader.ID);
+    unlink(vertexPath.c_str());
+    unlink(fragmentPath.c_str());
+  }
+
+  glDeleteVertexArrays(1, &VAO);
+  glDeleteBuffers(1, &VBO);
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,31 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+
+#include <string>
+
+// time spent in each stage of the constructor (seconds)
+struct ShaderTimings
+{
+  double read;
+  double compileVertex;     // glCompileShader + status query
+  double compileFragment;
+  double link;              // glLinkProgram + status query
+};
+
+class Shader
+{
+  public:
+    GLuint ID;
+
+    Shader(const GLchar* vertexPath, const GLchar* fragmentPath, ShaderTimings *timings = NULL);
+
+    void use();
+
+    void setBool(const std::string &name, bool value) const;
+    void setInt(const std::string &name, int value) const;
+    void setFloat(const std::string &name, float value) const;
+};
+
+#endif
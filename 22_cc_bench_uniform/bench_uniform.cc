@@ -0,0 +1,370 @@
+// bench_uniform.cc
+
+// uniform upload benchmark (headless):
+// N vec4 uniforms updated for each of M draws, CPU ns per uniform update
+// - lookup:  glGetUniformLocation every call (09_cc_Uniform, Shader::setFloat)
+// - cached:  locations looked up once
+// - dirty:   cached location + last value, upload only what changed
+// - ubo:     one uniform block per draw, glBufferSubData
+// - ring:    uniform blocks written in a mapped ring, glBindBufferRange per draw
+// each draw changes about 1/4 of the values, like a typical material switch
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define FRAMES 20
+#define RING_FRAMES 3
+
+enum Strategy
+{
+  LOOKUP,
+  CACHED,
+  DIRTY,
+  UBO,
+  RING,
+  NUM_STRATEGIES
+};
+
+static const char* strategyNames[NUM_STRATEGIES] = {
+  "lookup", "cached", "dirty", "ubo", "ring"
+};
+
+// a uniform handle with the value last sent to GL
+struct UniformHandle
+{
+  GLint location;
+  float value[4];
+  bool dirty;
+};
+
+struct Setup
+{
+  unsigned int uniforms;      // N
+  unsigned int draws;         // M
+  GLuint program, uboProgram;
+  GLuint VAO;
+  std::vector<std::string> names;
+  std::vector<GLint> locations;
+  std::vector<UniformHandle> handles;
+  GLuint ubo, ringBuffer;
+  GLint alignment;
+  GLsizeiptr blockSize, blockStride;
+  GLsync ringFences[RING_FRAMES];
+  std::vector<float> block;
+};
+
+static GLuint compileProgram(const std::string &vertexSource, const char* fragmentSource)
+{
+  int success;
+  char infoLog[512];
+  const char *vs = vertexSource.c_str();
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &vs, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &fragmentSource, NULL);
+  glCompileShader(fragment);
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  glAttachShader(program, fragment);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+static const char* fragmentShaderSource = "#version 330 core\n"
+  "in vec4 value;\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = value;\n"
+  "}\n";
+
+// the shader sums all the uniforms, so none is optimized away
+static std::string vertexShaderSource(unsigned int uniforms, bool block)
+{
+  std::stringstream s;
+  s << "#version 330 core\n"
+    << "layout (location = 0) in vec3 aPos;\n";
+  if (block)
+    s << "layout (std140) uniform Block { vec4 u[" << uniforms << "]; };\n";
+  else
+    s << "uniform vec4 u[" << uniforms << "];\n";
+  s << "out vec4 value;\n"
+    << "void main()\n{\n"
+    << "  value = vec4(0.0);\n"
+    << "  for (int i = 0; i < " << uniforms << "; i++) value += u[i];\n"
+    << "  gl_Position = vec4(aPos, 1.0f);\n}\n";
+  return s.str();
+}
+
+// value of uniform i at draw d: about 1/4 of them change at each draw
+static float uniformValue(unsigned int i, unsigned int d)
+{
+  return (float)((d + i) / 4) * 0.001f;
+}
+
+static void setup(Setup &s)
+{
+  s.program = compileProgram(vertexShaderSource(s.uniforms, false), fragmentShaderSource);
+  s.uboProgram = compileProgram(vertexShaderSource(s.uniforms, true), fragmentShaderSource);
+
+  s.names.clear();
+  s.locations.clear();
+  s.handles.clear();
+  for (unsigned int i = 0; i < s.uniforms; i++) {
+    std::stringstream name;
+    name << "u[" << i << "]";
+    s.names.push_back(name.str());
+    GLint location = glGetUniformLocation(s.program, name.str().c_str());
+    s.locations.push_back(location);
+    UniformHandle handle = { location, { -1.0f, -1.0f, -1.0f, -1.0f }, true };
+    s.handles.push_back(handle);
+  }
+
+  // std140: a vec4 array has a 16 byte stride
+  s.blockSize = s.uniforms * 4 * sizeof(float);
+  s.block.assign(s.uniforms * 4, 0.0f);
+  glUniformBlockBinding(s.uboProgram, glGetUniformBlockIndex(s.uboProgram, "Block"), 0);
+
+  glGenBuffers(1, &s.ubo);
+  glBindBuffer(GL_UNIFORM_BUFFER, s.ubo);
+  glBufferData(GL_UNIFORM_BUFFER, s.blockSize, NULL, GL_DYNAMIC_DRAW);
+
+  glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &s.alignment);
+  s.blockStride = (s.blockSize + s.alignment - 1) / s.alignment * s.alignment;
+  glGenBuffers(1, &s.ringBuffer);
+  glBindBuffer(GL_UNIFORM_BUFFER, s.ringBuffer);
+  glBufferData(GL_UNIFORM_BUFFER, s.blockStride * s.draws * RING_FRAMES, NULL, GL_DYNAMIC_DRAW);
+  glBindBuffer(GL_UNIFORM_BUFFER, 0);
+  for (unsigned int f = 0; f < RING_FRAMES; f++)
+    s.ringFences[f] = 0;
+}
+
+static void cleanup(Setup &s)
+{
+  for (unsigned int f = 0; f < RING_FRAMES; f++)
+    if (s.ringFences[f]) glDeleteSync(s.ringFences[f]);
+  glDeleteBuffers(1, &s.ubo);
+  glDeleteBuffers(1, &s.ringBuffer);
+  glDeleteProgram(s.program);
+  glDeleteProgram(s.uboProgram);
+}
+
+static void frame(Strategy strategy, Setup &s, unsigned int frameIndex)
+{
+  glBindVertexArray(s.VAO);
+
+  switch (strategy) {
+    case LOOKUP:
+      glUseProgram(s.program);
+      for (unsigned int d = 0; d < s.draws; d++) {
+        for (unsigned int i = 0; i < s.uniforms; i++)
+          glUniform4f(glGetUniformLocation(s.program, s.names[i].c_str()),
+                      uniformValue(i, d), 0.0f, 0.0f, 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+      break;
+
+    case CACHED:
+      glUseProgram(s.program);
+      for (unsigned int d = 0; d < s.draws; d++) {
+        for (unsigned int i = 0; i < s.uniforms; i++)
+          glUniform4f(s.locations[i], uniformValue(i, d), 0.0f, 0.0f, 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+      break;
+
+    case DIRTY:
+      glUseProgram(s.program);
+      for (unsigned int d = 0; d < s.draws; d++) {
+        // set: compare with the last value
+        for (unsigned int i = 0; i < s.uniforms; i++) {
+          UniformHandle &h = s.handles[i];
+          float v = uniformValue(i, d);
+          if (h.value[0] != v) {
+            h.value[0] = v;
+            h.value[1] = 0.0f;
+            h.value[2] = 0.0f;
+            h.value[3] = 1.0f;
+            h.dirty = true;
+          }
+        }
+        // flush: upload only the changed ones
+        for (unsigned int i = 0; i < s.uniforms; i++) {
+          UniformHandle &h = s.handles[i];
+          if (h.dirty) {
+            glUniform4fv(h.location, 1, h.value);
+            h.dirty = false;
+          }
+        }
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+      break;
+
+    case UBO:
+      glUseProgram(s.uboProgram);
+      glBindBufferBase(GL_UNIFORM_BUFFER, 0, s.ubo);
+      glBindBuffer(GL_UNIFORM_BUFFER, s.ubo);
+      for (unsigned int d = 0; d < s.draws; d++) {
+        for (unsigned int i = 0; i < s.uniforms; i++) {
+          s.block[i * 4] = uniformValue(i, d);
+          s.block[i * 4 + 3] = 1.0f;
+        }
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, s.blockSize, &s.block[0]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+      break;
+
+    case RING: {
+      glUseProgram(s.uboProgram);
+      unsigned int segment = frameIndex % RING_FRAMES;
+      GLintptr base = segment * s.blockStride * s.draws;
+
+      // the GPU may still read this segment from RING_FRAMES frames ago
+      if (s.ringFences[segment]) {
+        glClientWaitSync(s.ringFences[segment], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        glDeleteSync(s.ringFences[segment]);
+        s.ringFences[segment] = 0;
+      }
+
+      glBindBuffer(GL_UNIFORM_BUFFER, s.ringBuffer);
+      char *p = (char*)glMapBufferRange(GL_UNIFORM_BUFFER, base, s.blockStride * s.draws,
+                                        GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                                        GL_MAP_INVALIDATE_RANGE_BIT);
+      for (unsigned int d = 0; d < s.draws; d++) {
+        float *block = (float*)(p + d * s.blockStride);
+        for (unsigned int i = 0; i < s.uniforms; i++) {
+          block[i * 4] = uniformValue(i, d);
+          block[i * 4 + 1] = 0.0f;
+          block[i * 4 + 2] = 0.0f;
+          block[i * 4 + 3] = 1.0f;
+        }
+      }
+      glUnmapBuffer(GL_UNIFORM_BUFFER);
+
+      for (unsigned int d = 0; d < s.draws; d++) {
+        glBindBufferRange(GL_UNIFORM_BUFFER, 0, s.ringBuffer, base + d * s.blockStride, s.blockSize);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+      }
+      s.ringFences[segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      break;
+    }
+
+    default:
+      break;
+  }
+}
+
+int main()
+{
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(16, 16, "bench_uniform", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  // a degenerate triangle: nothing to rasterize, only submission is measured
+  float vertices[] = { 0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f,  0.0f, 0.0f, 0.0f };
+  GLuint VAO, VBO;
+  glGenVertexArrays(1, &VAO);
+  glGenBuffers(1, &VBO);
+  glBindVertexArray(VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, VBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+  std::cout << "CPU ns per uniform update (submission only, GPU wait excluded)" << std::endl;
+  std::cout << "    N      M";
+  for (unsigned int st = 0; st < NUM_STRATEGIES; st++)
+    std::cout << std::setw(10) << strategyNames[st];
+  std::cout << std::endl;
+
+  const unsigned int uniformCounts[] = { 4, 16, 64 };
+  const unsigned int drawCounts[] = { 100, 1000 };
+
+  for (unsigned int n = 0; n < sizeof(uniformCounts) / sizeof(uniformCounts[0]); n++) {
+    for (unsigned int m = 0; m < sizeof(drawCounts) / sizeof(drawCounts[0]); m++) {
+      Setup s;
+      s.uniforms = uniformCounts[n];
+      s.draws = drawCounts[m];
+      s.VAO = VAO;
+      setup(s);
+
+      std::cout << std::setw(5) << s.uniforms << std::setw(7) << s.draws;
+      for (unsigned int st = 0; st < NUM_STRATEGIES; st++) {
+        Strategy strategy = (Strategy)st;
+        frame(strategy, s, 0);
+        glFinish();
+
+        double cpu = 0.0;
+        for (unsigned int f = 1; f <= FRAMES; f++) {
+          double start = glfwGetTime();
+          frame(strategy, s, f);
+          cpu += glfwGetTime() - start;
+          glFinish();
+        }
+        double ns = cpu * 1e9 / ((double)FRAMES * s.draws * s.uniforms);
+        std::cout << std::setw(10) << std::fixed << std::setprecision(1) << ns;
+      }
+      std::cout << std::endl;
+
+      cleanup(s);
+    }
+  }
+
+  glDeleteVertexArrays(1, &VAO);
+  glDeleteBuffers(1, &VBO);
+  glfwTerminate();
+  return 0;
+}
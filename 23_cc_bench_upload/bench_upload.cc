@@ -0,0 +1,372 @@
+// bench_upload.cc
+
+// vertex upload benchmark (headless):
+// streams K MB of vertices per frame into a VBO and draws them,
+// reports sustained throughput and frame time spread for
+// - buffer_data:     glBufferData every frame (what the samples do)
+// - sub_data:        glBufferSubData into the same storage
+// - orphan:          glBufferData(NULL) then glBufferSubData
+// - map_invalidate:  glMapBufferRange with GL_MAP_INVALIDATE_BUFFER_BIT
+// - unsync_ring:     3 regions, unsynchronized maps, a fence per region
+// - persistent:      glBufferStorage + persistent coherent map (if available)
+// usage: bench_upload [frames]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#define RING_REGIONS 3
+#define MAX_FRAMES_IN_FLIGHT 2
+
+// GL 4.4 / ARB_buffer_storage, not in our 3.3 loader
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+typedef void (APIENTRYP PFNBUFFERSTORAGE)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags);
+
+enum Strategy
+{
+  BUFFER_DATA,
+  SUB_DATA,
+  ORPHAN,
+  MAP_INVALIDATE,
+  UNSYNC_RING,
+  PERSISTENT,
+  NUM_STRATEGIES
+};
+
+static const char* strategyNames[NUM_STRATEGIES] = {
+  "buffer_data", "sub_data", "orphan", "map_invalidate", "unsync_ring", "persistent"
+};
+
+static PFNBUFFERSTORAGE bufferStorage = NULL;
+
+struct Stream
+{
+  Strategy strategy;
+  GLsizeiptr size;          // bytes per frame
+  GLuint VAO, VBO;
+  char *persistent;         // persistent mapping
+  GLsync fences[RING_REGIONS];
+};
+
+static const char* vertexShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec4 aPos;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = aPos;\n"
+  "}\n";
+
+static const char* fragmentShaderSource = "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = vec4(1.0f);\n"
+  "}\n";
+
+static GLuint compileProgram()
+{
+  int success;
+  char infoLog[512];
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &vertexShaderSource, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &fragmentShaderSource, NULL);
+  glCompileShader(fragment);
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  glAttachShader(program, fragment);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+static bool hasExtension(const char *name)
+{
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; i++)
+    if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), name) == 0)
+      return true;
+  return false;
+}
+
+// false if the persistent mapping failed
+static bool createStream(Stream &s)
+{
+  GLsizeiptr storage = s.size;
+  if (s.strategy == UNSYNC_RING || s.strategy == PERSISTENT)
+    storage = s.size * RING_REGIONS;
+
+  glGenVertexArrays(1, &s.VAO);
+  glGenBuffers(1, &s.VBO);
+  glBindVertexArray(s.VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, s.VBO);
+  if (s.strategy == PERSISTENT) {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    bufferStorage(GL_ARRAY_BUFFER, storage, NULL, flags);
+    s.persistent = (char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, storage, flags);
+  } else {
+    glBufferData(GL_ARRAY_BUFFER, storage, NULL, GL_STREAM_DRAW);
+    s.persistent = NULL;
+  }
+  glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  glBindVertexArray(0);
+
+  for (unsigned int r = 0; r < RING_REGIONS; r++)
+    s.fences[r] = 0;
+  return s.strategy != PERSISTENT || s.persistent != NULL;
+}
+
+static void deleteStream(Stream &s)
+{
+  for (unsigned int r = 0; r < RING_REGIONS; r++)
+    if (s.fences[r]) glDeleteSync(s.fences[r]);
+  glBindBuffer(GL_ARRAY_BUFFER, s.VBO);
+  if (s.persistent)
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glDeleteBuffers(1, &s.VBO);
+  glDeleteVertexArrays(1, &s.VAO);
+}
+
+static void waitFence(GLsync &fence)
+{
+  if (fence == 0) return;
+  glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+  glDeleteSync(fence);
+  fence = 0;
+}
+
+// upload this frame's vertices and draw them; false if a map failed
+static bool frame(Stream &s, const char *data, unsigned int frameIndex)
+{
+  GLintptr offset = 0;
+  unsigned int region = frameIndex % RING_REGIONS;
+
+  glBindBuffer(GL_ARRAY_BUFFER, s.VBO);
+  switch (s.strategy) {
+    case BUFFER_DATA:
+      glBufferData(GL_ARRAY_BUFFER, s.size, data, GL_STREAM_DRAW);
+      break;
+
+    case SUB_DATA:
+      glBufferSubData(GL_ARRAY_BUFFER, 0, s.size, data);
+      break;
+
+    case ORPHAN:
+      glBufferData(GL_ARRAY_BUFFER, s.size, NULL, GL_STREAM_DRAW);
+      glBufferSubData(GL_ARRAY_BUFFER, 0, s.size, data);
+      break;
+
+    case MAP_INVALIDATE: {
+      void *p = glMapBufferRange(GL_ARRAY_BUFFER, 0, s.size,
+                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+      if (p == NULL) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return false;
+      }
+      memcpy(p, data, s.size);
+      glUnmapBuffer(GL_ARRAY_BUFFER);
+      break;
+    }
+
+    case UNSYNC_RING: {
+      offset = region * s.size;
+      waitFence(s.fences[region]);
+      void *p = glMapBufferRange(GL_ARRAY_BUFFER, offset, s.size,
+                                 GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+                                 GL_MAP_INVALIDATE_RANGE_BIT);
+      if (p == NULL) {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return false;
+      }
+      memcpy(p, data, s.size);
+      glUnmapBuffer(GL_ARRAY_BUFFER);
+      break;
+    }
+
+    case PERSISTENT:
+      offset = region * s.size;
+      waitFence(s.fences[region]);
+      memcpy(s.persistent + offset, data, s.size);
+      break;
+
+    default:
+      break;
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glBindVertexArray(s.VAO);
+  glDrawArrays(GL_POINTS, offset / (4 * sizeof(float)), s.size / (4 * sizeof(float)));
+
+  if (s.strategy == UNSYNC_RING || s.strategy == PERSISTENT)
+    s.fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int frames = 60;
+  if (argc > 1) {
+    if (atoi(argv[1]) < 1) {
+      std::cout << "usage: bench_upload [frames], at least 1 frame" << std::endl;
+      return -1;
+    }
+    frames = atoi(argv[1]);
+  }
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(16, 16, "bench_upload", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 4) ||
+      hasExtension("GL_ARB_buffer_storage"))
+    bufferStorage = (PFNBUFFERSTORAGE)glfwGetProcAddress("glBufferStorage");
+
+  GLuint program = compileProgram();
+  glUseProgram(program);
+
+  std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+  std::cout << frames << " frames per run, frame times in ms" << std::endl;
+  std::cout << "  MB/frame        strategy      MB/s      mean    stddev       max" << std::endl;
+
+  const unsigned int megabytes[] = { 1, 4, 16 };
+  for (unsigned int k = 0; k < sizeof(megabytes) / sizeof(megabytes[0]); k++) {
+    GLsizeiptr size = (GLsizeiptr)megabytes[k] * 1024 * 1024;
+
+    // vertices outside the clip volume: read by the GPU, never rasterized
+    std::vector<float> data(size / sizeof(float));
+    for (size_t i = 0; i < data.size(); i += 4) {
+      data[i] = 2.0f;
+      data[i + 1] = 2.0f;
+      data[i + 2] = 0.0f;
+      data[i + 3] = 1.0f;
+    }
+
+    for (unsigned int st = 0; st < NUM_STRATEGIES; st++) {
+      if (st == PERSISTENT && bufferStorage == NULL) {
+        std::cout << std::setw(10) << megabytes[k] << std::setw(16) << strategyNames[st]
+                  << "  not available" << std::endl;
+        continue;
+      }
+
+      Stream s;
+      s.strategy = (Strategy)st;
+      s.size = size;
+      // warm up
+      if (!createStream(s) || !frame(s, (const char*)&data[0], 0)) {
+        std::cout << "ERROR::BENCH_UPLOAD::MAP_FAILED " << strategyNames[st] << std::endl;
+        deleteStream(s);
+        continue;
+      }
+      glFinish();
+
+      std::vector<double> times;
+      GLsync inFlight[MAX_FRAMES_IN_FLIGHT] = { 0 };
+      bool mapped = true;
+      double start = glfwGetTime();
+      double last = start;
+      for (unsigned int f = 1; f <= frames && mapped; f++) {
+        // the data changes every frame
+        data[(f * 4) % data.size()] = 2.0f + f * 1e-6f;
+
+        // like a real game loop: the CPU does not run ahead forever
+        waitFence(inFlight[f % MAX_FRAMES_IN_FLIGHT]);
+        mapped = frame(s, (const char*)&data[0], f);
+        inFlight[f % MAX_FRAMES_IN_FLIGHT] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        double now = glfwGetTime();
+        times.push_back(now - last);
+        last = now;
+      }
+      for (unsigned int i = 0; i < MAX_FRAMES_IN_FLIGHT; i++)
+        waitFence(inFlight[i]);
+      glFinish();
+      double elapsed = glfwGetTime() - start;
+      if (!mapped || times.empty()) {
+        if (!mapped)
+          std::cout << "ERROR::BENCH_UPLOAD::MAP_FAILED " << strategyNames[st] << std::endl;
+        deleteStream(s);
+        continue;
+      }
+
+      double mean = 0.0, variance = 0.0, worst = 0.0;
+      for (size_t i = 0; i < times.size(); i++) {
+        mean += times[i];
+        if (times[i] > worst) worst = times[i];
+      }
+      mean /= times.size();
+      for (size_t i = 0; i < times.size(); i++)
+        variance += (times[i] - mean) * (times[i] - mean);
+      variance /= times.size();
+
+      std::cout << std::setw(10) << megabytes[k]
+                << std::setw(16) << strategyNames[st]
+                << std::fixed << std::setprecision(1)
+                << std::setw(10) << megabytes[k] * frames / elapsed
+                << std::setprecision(3)
+                << std::setw(10) << mean * 1000.0
+                << std::setw(10) << sqrt(variance) * 1000.0
+                << std::setw(10) << worst * 1000.0
+                << std::endl;
+
+      deleteStream(s);
+    }
+  }
+
+  glDeleteProgram(program);
+  glfwTerminate();
+  return 0;
+}
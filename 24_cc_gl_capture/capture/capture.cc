@@ -0,0 +1,464 @@
+#include "capture.h"
+#include "trace.h"
+#include "glad_debug.h"
+
+#include <glad/glad.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+static FILE *traceFile = NULL;
+static std::vector<char> record;
+static unsigned long callCount = 0;
+static unsigned long byteCount = 0;
+static unsigned long frameCount = 0;
+static unsigned long notCapturedCount = 0;
+
+// names of the hooked entry points; the pre-call callback caches its
+// answer by name pointer (one literal per glad debug wrapper)
+static std::set<std::string> hooked;
+static std::map<const char*, bool> markedNames;
+
+// record helpers
+
+static void begin(TraceOpcode opcode)
+{
+  record.clear();
+  unsigned short op = (unsigned short)opcode;
+  record.insert(record.end(), (const char*)&op, (const char*)&op + sizeof(op));
+  unsigned int size = 0;
+  record.insert(record.end(), (const char*)&size, (const char*)&size + sizeof(size));
+}
+
+static void put(unsigned int value)
+{
+  record.insert(record.end(), (const char*)&value, (const char*)&value + sizeof(value));
+}
+
+static void put(int value)
+{
+  put((unsigned int)value);
+}
+
+static void put(float value)
+{
+  record.insert(record.end(), (const char*)&value, (const char*)&value + sizeof(value));
+}
+
+static void putBlob(const void *data, unsigned int size)
+{
+  put(size);
+  if (size > 0)
+    record.insert(record.end(), (const char*)data, (const char*)data + size);
+}
+
+static void end()
+{
+  unsigned int size = record.size() - sizeof(unsigned short) - sizeof(unsigned int);
+  memcpy(&record[sizeof(unsigned short)], &size, sizeof(size));
+  fwrite(&record[0], 1, record.size(), traceFile);
+  callCount++;
+  byteCount += record.size();
+}
+
+// real entry points
+static PFNGLVIEWPORTPROC real_glViewport;
+static PFNGLCLEARCOLORPROC real_glClearColor;
+static PFNGLCLEARPROC real_glClear;
+static PFNGLGENBUFFERSPROC real_glGenBuffers;
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers;
+static PFNGLBINDBUFFERPROC real_glBindBuffer;
+static PFNGLBUFFERDATAPROC real_glBufferData;
+static PFNGLBUFFERSUBDATAPROC real_glBufferSubData;
+static PFNGLMAPBUFFERRANGEPROC real_glMapBufferRange;
+static PFNGLUNMAPBUFFERPROC real_glUnmapBuffer;
+static PFNGLGENVERTEXARRAYSPROC real_glGenVertexArrays;
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays;
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray;
+static PFNGLVERTEXATTRIBPOINTERPROC real_glVertexAttribPointer;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC real_glEnableVertexAttribArray;
+static PFNGLVERTEXATTRIBDIVISORPROC real_glVertexAttribDivisor;
+static PFNGLCREATESHADERPROC real_glCreateShader;
+static PFNGLSHADERSOURCEPROC real_glShaderSource;
+static PFNGLCOMPILESHADERPROC real_glCompileShader;
+static PFNGLDELETESHADERPROC real_glDeleteShader;
+static PFNGLCREATEPROGRAMPROC real_glCreateProgram;
+static PFNGLATTACHSHADERPROC real_glAttachShader;
+static PFNGLLINKPROGRAMPROC real_glLinkProgram;
+static PFNGLUSEPROGRAMPROC real_glUseProgram;
+static PFNGLDELETEPROGRAMPROC real_glDeleteProgram;
+static PFNGLGETUNIFORMLOCATIONPROC real_glGetUniformLocation;
+static PFNGLUNIFORM1IPROC real_glUniform1i;
+static PFNGLUNIFORM1FPROC real_glUniform1f;
+static PFNGLUNIFORM2FPROC real_glUniform2f;
+static PFNGLUNIFORM4FPROC real_glUniform4f;
+static PFNGLDRAWARRAYSPROC real_glDrawArrays;
+static PFNGLDRAWELEMENTSPROC real_glDrawElements;
+static PFNGLDRAWELEMENTSINSTANCEDPROC real_glDrawElementsInstanced;
+
+// currently mapped ranges, written to the trace at unmap
+struct Mapping
+{
+  void *pointer;
+  GLintptr offset;
+  GLsizeiptr length;
+  bool write;
+};
+static std::map<GLenum, Mapping> mappings;
+
+// wrappers
+
+static void APIENTRY capture_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  begin(OP_VIEWPORT); put(x); put(y); put(width); put(height); end();
+  real_glViewport(x, y, width, height);
+}
+
+static void APIENTRY capture_glClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a)
+{
+  begin(OP_CLEAR_COLOR); put(r); put(g); put(b); put(a); end();
+  real_glClearColor(r, g, b, a);
+}
+
+static void APIENTRY capture_glClear(GLbitfield mask)
+{
+  begin(OP_CLEAR); put(mask); end();
+  real_glClear(mask);
+}
+
+static void APIENTRY capture_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+  real_glGenBuffers(n, buffers);
+  begin(OP_GEN_BUFFERS); putBlob(buffers, n * sizeof(GLuint)); end();
+}
+
+static void APIENTRY capture_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+  begin(OP_DELETE_BUFFERS); putBlob(buffers, n * sizeof(GLuint)); end();
+  real_glDeleteBuffers(n, buffers);
+}
+
+static void APIENTRY capture_glBindBuffer(GLenum target, GLuint buffer)
+{
+  begin(OP_BIND_BUFFER); put(target); put(buffer); end();
+  real_glBindBuffer(target, buffer);
+}
+
+static void APIENTRY capture_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+  begin(OP_BUFFER_DATA); put(target); put((unsigned int)size); put(usage);
+  putBlob(data, data != NULL ? size : 0); end();
+  real_glBufferData(target, size, data, usage);
+}
+
+static void APIENTRY capture_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+  begin(OP_BUFFER_SUB_DATA); put(target); put((unsigned int)offset); putBlob(data, size); end();
+  real_glBufferSubData(target, offset, size, data);
+}
+
+static void* APIENTRY capture_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  void *pointer = real_glMapBufferRange(target, offset, length, access);
+  Mapping m = { pointer, offset, length, (access & GL_MAP_WRITE_BIT) != 0 };
+  mappings[target] = m;
+  return pointer;
+}
+
+static GLboolean APIENTRY capture_glUnmapBuffer(GLenum target)
+{
+  std::map<GLenum, Mapping>::iterator it = mappings.find(target);
+  if (it != mappings.end()) {
+    if (it->second.write && it->second.pointer != NULL) {
+      begin(OP_BUFFER_SUB_DATA); put(target); put((unsigned int)it->second.offset);
+      putBlob(it->second.pointer, it->second.length); end();
+    }
+    mappings.erase(it);
+  }
+  return real_glUnmapBuffer(target);
+}
+
+static void APIENTRY capture_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+  real_glGenVertexArrays(n, arrays);
+  begin(OP_GEN_VERTEX_ARRAYS); putBlob(arrays, n * sizeof(GLuint)); end();
+}
+
+static void APIENTRY capture_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+  begin(OP_DELETE_VERTEX_ARRAYS); putBlob(arrays, n * sizeof(GLuint)); end();
+  real_glDeleteVertexArrays(n, arrays);
+}
+
+static void APIENTRY capture_glBindVertexArray(GLuint array)
+{
+  begin(OP_BIND_VERTEX_ARRAY); put(array); end();
+  real_glBindVertexArray(array);
+}
+
+static void APIENTRY capture_glVertexAttribPointer(GLuint index, GLint size, GLenum type,
+                                                   GLboolean normalized, GLsizei stride, const void *pointer)
+{
+  // core profile: the pointer is an offset in the bound GL_ARRAY_BUFFER
+  begin(OP_VERTEX_ATTRIB_POINTER); put(index); put(size); put(type); put((unsigned int)normalized);
+  put(stride); put((unsigned int)(size_t)pointer); end();
+  real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+static void APIENTRY capture_glEnableVertexAttribArray(GLuint index)
+{
+  begin(OP_ENABLE_VERTEX_ATTRIB_ARRAY); put(index); end();
+  real_glEnableVertexAttribArray(index);
+}
+
+static void APIENTRY capture_glVertexAttribDivisor(GLuint index, GLuint divisor)
+{
+  begin(OP_VERTEX_ATTRIB_DIVISOR); put(index); put(divisor); end();
+  real_glVertexAttribDivisor(index, divisor);
+}
+
+static GLuint APIENTRY capture_glCreateShader(GLenum type)
+{
+  GLuint shader = real_glCreateShader(type);
+  begin(OP_CREATE_SHADER); put(type); put(shader); end();
+  return shader;
+}
+
+static void APIENTRY capture_glShaderSource(GLuint shader, GLsizei count,
+                                            const GLchar *const*string, const GLint *length)
+{
+  std::string source;
+  for (GLsizei i = 0; i < count; i++) {
+    if (length != NULL && length[i] >= 0)
+      source.append(string[i], length[i]);
+    else
+      source.append(string[i]);
+  }
+  begin(OP_SHADER_SOURCE); put(shader); putBlob(source.c_str(), source.size()); end();
+  real_glShaderSource(shader, count, string, length);
+}
+
+static void APIENTRY capture_glCompileShader(GLuint shader)
+{
+  begin(OP_COMPILE_SHADER); put(shader); end();
+  real_glCompileShader(shader);
+}
+
+static void APIENTRY capture_glDeleteShader(GLuint shader)
+{
+  begin(OP_DELETE_SHADER); put(shader); end();
+  real_glDeleteShader(shader);
+}
+
+static GLuint APIENTRY capture_glCreateProgram(void)
+{
+  GLuint program = real_glCreateProgram();
+  begin(OP_CREATE_PROGRAM); put(program); end();
+  return program;
+}
+
+static void APIENTRY capture_glAttachShader(GLuint program, GLuint shader)
+{
+  begin(OP_ATTACH_SHADER); put(program); put(shader); end();
+  real_glAttachShader(program, shader);
+}
+
+static void APIENTRY capture_glLinkProgram(GLuint program)
+{
+  begin(OP_LINK_PROGRAM); put(program); end();
+  real_glLinkProgram(program);
+}
+
+static void APIENTRY capture_glUseProgram(GLuint program)
+{
+  begin(OP_USE_PROGRAM); put(program); end();
+  real_glUseProgram(program);
+}
+
+static void APIENTRY capture_glDeleteProgram(GLuint program)
+{
+  begin(OP_DELETE_PROGRAM); put(program); end();
+  real_glDeleteProgram(program);
+}
+
+static GLint APIENTRY capture_glGetUniformLocation(GLuint program, const GLchar *name)
+{
+  GLint location = real_glGetUniformLocation(program, name);
+  begin(OP_GET_UNIFORM_LOCATION); put(program); put(location); putBlob(name, strlen(name)); end();
+  return location;
+}
+
+static void APIENTRY capture_glUniform1i(GLint location, GLint v0)
+{
+  begin(OP_UNIFORM_1I); put(location); put(v0); end();
+  real_glUniform1i(location, v0);
+}
+
+static void APIENTRY capture_glUniform1f(GLint location, GLfloat v0)
+{
+  begin(OP_UNIFORM_1F); put(location); put(v0); end();
+  real_glUniform1f(location, v0);
+}
+
+static void APIENTRY capture_glUniform2f(GLint location, GLfloat v0, GLfloat v1)
+{
+  begin(OP_UNIFORM_2F); put(location); put(v0); put(v1); end();
+  real_glUniform2f(location, v0, v1);
+}
+
+static void APIENTRY capture_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  begin(OP_UNIFORM_4F); put(location); put(v0); put(v1); put(v2); put(v3); end();
+  real_glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void APIENTRY capture_glDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+  begin(OP_DRAW_ARRAYS); put(mode); put(first); put(count); end();
+  real_glDrawArrays(mode, first, count);
+}
+
+static void APIENTRY capture_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+  // core profile: indices is an offset in the bound GL_ELEMENT_ARRAY_BUFFER
+  begin(OP_DRAW_ELEMENTS); put(mode); put(count); put(type); put((unsigned int)(size_t)indices); end();
+  real_glDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY capture_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
+                                                     const void *indices, GLsizei instancecount)
+{
+  begin(OP_DRAW_ELEMENTS_INSTANCED); put(mode); put(count); put(type);
+  put((unsigned int)(size_t)indices); put(instancecount); end();
+  real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+
+// every call through the glad pointers, the hooked ones included
+// (real_* are the glad debug wrappers)
+static void preCallback(const char *name, void *funcptr, int len_args, ...)
+{
+  std::map<const char*, bool>::iterator it = markedNames.find(name);
+  if (it == markedNames.end()) {
+    bool query = strncmp(name, "glGet", 5) == 0 || strncmp(name, "glIs", 4) == 0 ||
+                 strcmp(name, "glCheckFramebufferStatus") == 0;
+    it = markedNames.insert(std::make_pair(name, !query && hooked.count(name) == 0)).first;
+  }
+  if (!it->second)
+    return;
+  begin(OP_NOT_CAPTURED); putBlob(name, strlen(name)); end();
+  notCapturedCount++;
+}
+
+#define HOOK(name) real_##name = glad_##name; glad_##name = capture_##name; hooked.insert(#name)
+#define UNHOOK(name) glad_##name = real_##name
+
+bool captureBegin(const char *path)
+{
+  traceFile = fopen(path, "wb");
+  if (traceFile == NULL) {
+    std::cout << "ERROR::CAPTURE::CANNOT_OPEN " << path << std::endl;
+    return false;
+  }
+  fwrite(TRACE_MAGIC, 1, strlen(TRACE_MAGIC), traceFile);
+  callCount = 0;
+  byteCount = 0;
+  frameCount = 0;
+  notCapturedCount = 0;
+
+  HOOK(glViewport);
+  HOOK(glClearColor);
+  HOOK(glClear);
+  HOOK(glGenBuffers);
+  HOOK(glDeleteBuffers);
+  HOOK(glBindBuffer);
+  HOOK(glBufferData);
+  HOOK(glBufferSubData);
+  HOOK(glMapBufferRange);
+  HOOK(glUnmapBuffer);
+  HOOK(glGenVertexArrays);
+  HOOK(glDeleteVertexArrays);
+  HOOK(glBindVertexArray);
+  HOOK(glVertexAttribPointer);
+  HOOK(glEnableVertexAttribArray);
+  HOOK(glVertexAttribDivisor);
+  HOOK(glCreateShader);
+  HOOK(glShaderSource);
+  HOOK(glCompileShader);
+  HOOK(glDeleteShader);
+  HOOK(glCreateProgram);
+  HOOK(glAttachShader);
+  HOOK(glLinkProgram);
+  HOOK(glUseProgram);
+  HOOK(glDeleteProgram);
+  HOOK(glGetUniformLocation);
+  HOOK(glUniform1i);
+  HOOK(glUniform1f);
+  HOOK(glUniform2f);
+  HOOK(glUniform4f);
+  HOOK(glDrawArrays);
+  HOOK(glDrawElements);
+  HOOK(glDrawElementsInstanced);
+  glad_set_pre_callback(preCallback);
+  return true;
+}
+
+void captureFrame()
+{
+  if (traceFile == NULL) return;
+  begin(OP_FRAME_END); end();
+  frameCount++;
+}
+
+void captureEnd()
+{
+  if (traceFile == NULL) return;
+
+  UNHOOK(glViewport);
+  UNHOOK(glClearColor);
+  UNHOOK(glClear);
+  UNHOOK(glGenBuffers);
+  UNHOOK(glDeleteBuffers);
+  UNHOOK(glBindBuffer);
+  UNHOOK(glBufferData);
+  UNHOOK(glBufferSubData);
+  UNHOOK(glMapBufferRange);
+  UNHOOK(glUnmapBuffer);
+  UNHOOK(glGenVertexArrays);
+  UNHOOK(glDeleteVertexArrays);
+  UNHOOK(glBindVertexArray);
+  UNHOOK(glVertexAttribPointer);
+  UNHOOK(glEnableVertexAttribArray);
+  UNHOOK(glVertexAttribDivisor);
+  UNHOOK(glCreateShader);
+  UNHOOK(glShaderSource);
+  UNHOOK(glCompileShader);
+  UNHOOK(glDeleteShader);
+  UNHOOK(glCreateProgram);
+  UNHOOK(glAttachShader);
+  UNHOOK(glLinkProgram);
+  UNHOOK(glUseProgram);
+  UNHOOK(glDeleteProgram);
+  UNHOOK(glGetUniformLocation);
+  UNHOOK(glUniform1i);
+  UNHOOK(glUniform1f);
+  UNHOOK(glUniform2f);
+  UNHOOK(glUniform4f);
+  UNHOOK(glDrawArrays);
+  UNHOOK(glDrawElements);
+  UNHOOK(glDrawElementsInstanced);
+  glad_reset_pre_callback();
+  hooked.clear();
+  markedNames.clear();
+
+  fclose(traceFile);
+  traceFile = NULL;
+  std::cout << "capture: " << frameCount << " frames, " << callCount << " calls, "
+            << byteCount << " bytes" << std::endl;
+  if (notCapturedCount > 0)
+    std::cout << "WARNING: " << notCapturedCount << " calls not captured, the replay will differ" << std::endl;
+}
@@ -0,0 +1,26 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+// GL call capture on top of the glad function pointers:
+// captureBegin() swaps the glad_gl* pointers with wrappers that write
+// each call, its arguments and the data it uploads to a trace file
+// (see trace.h), then call the real function.
+//
+// captured: buffers, vertex arrays, shaders, programs, uniforms,
+// clears, viewport and draws (what the samples use);
+// any other GL call (glad.c built with GLAD_DEBUG, seen by the pre-call
+// callback) writes a "not captured" marker with its name, the replay
+// warns about them; queries (glGet*, glIs*) do not change the state
+// and are left out.
+// glMapBufferRange writes are captured at glUnmapBuffer.
+
+// call after gladLoadGLLoader; false if the file can't be opened
+bool captureBegin(const char *path);
+
+// end of a frame, call before glfwSwapBuffers
+void captureFrame();
+
+// restore the glad pointers, close the file and print a summary
+void captureEnd();
+
+#endif
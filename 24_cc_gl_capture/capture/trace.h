@@ -0,0 +1,56 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// GL trace file format
+//
+// header: "GLTRACE1"
+// then a list of records:
+//   uint16 opcode, uint32 payload size, payload
+// payload fields are 32 bit little endian integers / floats,
+// blobs (buffer data, shader sources, names) are a uint32 size + bytes.
+// Object names are the ones seen at capture time, the replayer
+// maps them to the names it gets.
+// OP_NOT_CAPTURED: a call the capture has no record for (its name as
+// a blob), the replay skips it and warns.
+
+#define TRACE_MAGIC "GLTRACE1"
+
+enum TraceOpcode
+{
+  OP_FRAME_END = 1,
+  OP_VIEWPORT,
+  OP_CLEAR_COLOR,
+  OP_CLEAR,
+  OP_GEN_BUFFERS,
+  OP_DELETE_BUFFERS,
+  OP_BIND_BUFFER,
+  OP_BUFFER_DATA,
+  OP_BUFFER_SUB_DATA,
+  OP_GEN_VERTEX_ARRAYS,
+  OP_DELETE_VERTEX_ARRAYS,
+  OP_BIND_VERTEX_ARRAY,
+  OP_VERTEX_ATTRIB_POINTER,
+  OP_ENABLE_VERTEX_ATTRIB_ARRAY,
+  OP_VERTEX_ATTRIB_DIVISOR,
+  OP_CREATE_SHADER,
+  OP_SHADER_SOURCE,
+  OP_COMPILE_SHADER,
+  OP_DELETE_SHADER,
+  OP_CREATE_PROGRAM,
+  OP_ATTACH_SHADER,
+  OP_LINK_PROGRAM,
+  OP_USE_PROGRAM,
+  OP_DELETE_PROGRAM,
+  OP_GET_UNIFORM_LOCATION,
+  OP_UNIFORM_1I,
+  OP_UNIFORM_1F,
+  OP_UNIFORM_2F,
+  OP_UNIFORM_4F,
+  OP_DRAW_ARRAYS,
+  OP_DRAW_ELEMENTS,
+  OP_DRAW_ELEMENTS_INSTANCED,
+  OP_NOT_CAPTURED,
+  OP_COUNT
+};
+
+#endif
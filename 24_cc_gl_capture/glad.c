@@ -0,0 +1,4200 @@
+/*
+
+    OpenGL loader generated by glad 0.1.14a0 on Tue Aug  1 22:04:36 2017.
+
+    Language/Generator: C/C++
+    Specification: gl
+    APIs: gl=3.3
+    Profile: core
+    Extensions:
+        
+    Loader: True
+    Local files: False
+    Omit khrplatform: False
+
+    Commandline:
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+    Online:
+        http://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+
+static void* get_proc(const char *namez);
+
+#ifdef _WIN32
+#include <windows.h>
+static HMODULE libGL;
+
+typedef void* (APIENTRYP PFNWGLGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+
+static
+int open_gl(void) {
+    libGL = LoadLibraryW(L"opengl32.dll");
+    if(libGL != NULL) {
+        gladGetProcAddressPtr = (PFNWGLGETPROCADDRESSPROC_PRIVATE)GetProcAddress(
+                libGL, "wglGetProcAddress");
+        return gladGetProcAddressPtr != NULL;
+    }
+
+    return 0;
+}
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        FreeLibrary(libGL);
+        libGL = NULL;
+    }
+}
+#else
+#include <dlfcn.h>
+static void* libGL;
+
+#ifndef __APPLE__
+typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+#endif
+
+static
+int open_gl(void) {
+#ifdef __APPLE__
+    static const char *NAMES[] = {
+        "../Frameworks/OpenGL.framework/OpenGL",
+        "/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+    };
+#else
+    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
+#endif
+
+    unsigned int index = 0;
+    for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
+        libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
+
+        if(libGL != NULL) {
+#ifdef __APPLE__
+            return 1;
+#else
+            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
+                "glXGetProcAddressARB");
+            return gladGetProcAddressPtr != NULL;
+#endif
+        }
+    }
+
+    return 0;
+}
+
+static
+void close_gl() {
+    if(libGL != NULL) {
+        dlclose(libGL);
+        libGL = NULL;
+    }
+}
+#endif
+
+static
+void* get_proc(const char *namez) {
+    void* result = NULL;
+    if(libGL == NULL) return NULL;
+
+#ifndef __APPLE__
+    if(gladGetProcAddressPtr != NULL) {
+        result = gladGetProcAddressPtr(namez);
+    }
+#endif
+    if(result == NULL) {
+#ifdef _WIN32
+        result = (void*)GetProcAddress(libGL, namez);
+#else
+        result = dlsym(libGL, namez);
+#endif
+    }
+
+    return result;
+}
+
+int gladLoadGL(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoader(&get_proc);
+        close_gl();
+    }
+
+    return status;
+}
+
+struct gladGLversionStruct GLVersion;
+
+#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+#define _GLAD_IS_SOME_NEW_VERSION 1
+#endif
+
+static int max_loaded_major;
+static int max_loaded_minor;
+
+static const char *exts = NULL;
+static int num_exts_i = 0;
+static const char **exts_i = NULL;
+
+static int get_exts(void) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        exts = (const char *)glGetString(GL_EXTENSIONS);
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        unsigned int index;
+
+        num_exts_i = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if (num_exts_i > 0) {
+            exts_i = (const char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
+        }
+
+        if (exts_i == NULL) {
+            return 0;
+        }
+
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            exts_i[index] = (const char*)glGetStringi(GL_EXTENSIONS, index);
+        }
+    }
+#endif
+    return 1;
+}
+
+static void free_exts(void) {
+    if (exts_i != NULL) {
+        free((void *)exts_i);
+        exts_i = NULL;
+    }
+}
+
+static int has_ext(const char *ext) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        const char *extensions;
+        const char *loc;
+        const char *terminator;
+        extensions = exts;
+        if(extensions == NULL || ext == NULL) {
+            return 0;
+        }
+
+        while(1) {
+            loc = strstr(extensions, ext);
+            if(loc == NULL) {
+                return 0;
+            }
+
+            terminator = loc + strlen(ext);
+            if((loc == extensions || *(loc - 1) == ' ') &&
+                (*terminator == ' ' || *terminator == '\0')) {
+                return 1;
+            }
+            extensions = terminator;
+        }
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        int index;
+
+        for(index = 0; index < num_exts_i; index++) {
+            const char *e = exts_i[index];
+
+            if(strcmp(e, ext) == 0) {
+                return 1;
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+int GLAD_GL_VERSION_1_0;
+int GLAD_GL_VERSION_1_1;
+int GLAD_GL_VERSION_1_2;
+int GLAD_GL_VERSION_1_3;
+int GLAD_GL_VERSION_1_4;
+int GLAD_GL_VERSION_1_5;
+int GLAD_GL_VERSION_2_0;
+int GLAD_GL_VERSION_2_1;
+int GLAD_GL_VERSION_3_0;
+int GLAD_GL_VERSION_3_1;
+int GLAD_GL_VERSION_3_2;
+int GLAD_GL_VERSION_3_3;
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
+PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
+PFNGLBINDSAMPLERPROC glad_glBindSampler;
+PFNGLLINEWIDTHPROC glad_glLineWidth;
+PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
+PFNGLCOMPILESHADERPROC glad_glCompileShader;
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
+PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
+PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
+PFNGLENABLEIPROC glad_glEnablei;
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
+PFNGLCREATESHADERPROC glad_glCreateShader;
+PFNGLISBUFFERPROC glad_glIsBuffer;
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
+PFNGLHINTPROC glad_glHint;
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
+PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
+PFNGLPOINTSIZEPROC glad_glPointSize;
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+PFNGLWAITSYNCPROC glad_glWaitSync;
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
+PFNGLUNIFORM3IPROC glad_glUniform3i;
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
+PFNGLUNIFORM3FPROC glad_glUniform3f;
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
+PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
+PFNGLCOLORMASKIPROC glad_glColorMaski;
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
+PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
+PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+PFNGLUNIFORM1UIPROC glad_glUniform1ui;
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
+PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
+PFNGLCLEARPROC glad_glClear;
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
+PFNGLISENABLEDPROC glad_glIsEnabled;
+PFNGLSTENCILOPPROC glad_glStencilOp;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
+PFNGLGETQUERYIVPROC glad_glGetQueryiv;
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
+PFNGLISSHADERPROC glad_glIsShader;
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
+PFNGLENABLEPROC glad_glEnable;
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
+PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
+PFNGLFLUSHPROC glad_glFlush;
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
+PFNGLFENCESYNCPROC glad_glFenceSync;
+PFNGLCOLORP3UIPROC glad_glColorP3ui;
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
+PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
+PFNGLGENSAMPLERSPROC glad_glGenSamplers;
+PFNGLCLAMPCOLORPROC glad_glClampColor;
+PFNGLUNIFORM4IVPROC glad_glUniform4iv;
+PFNGLCLEARSTENCILPROC glad_glClearStencil;
+PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
+PFNGLGENTEXTURESPROC glad_glGenTextures;
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
+PFNGLISSYNCPROC glad_glIsSync;
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
+PFNGLUNIFORM2IPROC glad_glUniform2i;
+PFNGLUNIFORM2FPROC glad_glUniform2f;
+PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
+PFNGLGENQUERIESPROC glad_glGenQueries;
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+PFNGLISENABLEDIPROC glad_glIsEnabledi;
+PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
+PFNGLUNIFORM2IVPROC glad_glUniform2iv;
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
+PFNGLGETSHADERIVPROC glad_glGetShaderiv;
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
+PFNGLGETDOUBLEVPROC glad_glGetDoublev;
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
+PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
+PFNGLUNIFORM3FVPROC glad_glUniform3fv;
+PFNGLDEPTHRANGEPROC glad_glDepthRange;
+PFNGLMAPBUFFERPROC glad_glMapBuffer;
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
+PFNGLDELETESYNCPROC glad_glDeleteSync;
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
+PFNGLUNIFORM3IVPROC glad_glUniform3iv;
+PFNGLPOLYGONMODEPROC glad_glPolygonMode;
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
+PFNGLUSEPROGRAMPROC glad_glUseProgram;
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
+PFNGLFINISHPROC glad_glFinish;
+PFNGLDELETESHADERPROC glad_glDeleteShader;
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
+PFNGLVIEWPORTPROC glad_glViewport;
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
+PFNGLUNIFORM2UIPROC glad_glUniform2ui;
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
+PFNGLCLEARDEPTHPROC glad_glClearDepth;
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
+PFNGLTEXBUFFERPROC glad_glTexBuffer;
+PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
+PFNGLPIXELSTOREFPROC glad_glPixelStoref;
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
+PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
+PFNGLLINKPROGRAMPROC glad_glLinkProgram;
+PFNGLBINDTEXTUREPROC glad_glBindTexture;
+PFNGLGETSTRINGPROC glad_glGetString;
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
+PFNGLDETACHSHADERPROC glad_glDetachShader;
+PFNGLENDQUERYPROC glad_glEndQuery;
+PFNGLNORMALP3UIPROC glad_glNormalP3ui;
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
+PFNGLUNIFORM1FPROC glad_glUniform1f;
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
+PFNGLUNIFORM1IPROC glad_glUniform1i;
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+PFNGLDISABLEPROC glad_glDisable;
+PFNGLLOGICOPPROC glad_glLogicOp;
+PFNGLUNIFORM4UIPROC glad_glUniform4ui;
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+PFNGLCULLFACEPROC glad_glCullFace;
+PFNGLGETSTRINGIPROC glad_glGetStringi;
+PFNGLATTACHSHADERPROC glad_glAttachShader;
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
+PFNGLDRAWELEMENTSPROC glad_glDrawElements;
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
+PFNGLUNIFORM1IVPROC glad_glUniform1iv;
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
+PFNGLREADBUFFERPROC glad_glReadBuffer;
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
+PFNGLBLENDCOLORPROC glad_glBlendColor;
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
+PFNGLISPROGRAMPROC glad_glIsProgram;
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
+PFNGLUNIFORM4IPROC glad_glUniform4i;
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
+PFNGLREADPIXELSPROC glad_glReadPixels;
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
+PFNGLUNIFORM4FPROC glad_glUniform4f;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
+PFNGLSTENCILFUNCPROC glad_glStencilFunc;
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
+PFNGLCOLORP4UIPROC glad_glColorP4ui;
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
+PFNGLGENBUFFERSPROC glad_glGenBuffers;
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
+PFNGLBLENDFUNCPROC glad_glBlendFunc;
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
+PFNGLSCISSORPROC glad_glScissor;
+PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
+PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
+PFNGLCLEARCOLORPROC glad_glClearColor;
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
+PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
+PFNGLUNIFORM3UIPROC glad_glUniform3ui;
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
+PFNGLUNIFORM2FVPROC glad_glUniform2fv;
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
+PFNGLDEPTHFUNCPROC glad_glDepthFunc;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
+PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
+PFNGLCOLORMASKPROC glad_glColorMask;
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
+PFNGLUNIFORM4FVPROC glad_glUniform4fv;
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
+PFNGLISSAMPLERPROC glad_glIsSampler;
+PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
+PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
+PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
+PFNGLDISABLEIPROC glad_glDisablei;
+PFNGLSHADERSOURCEPROC glad_glShaderSource;
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
+PFNGLGETSYNCIVPROC glad_glGetSynciv;
+PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
+PFNGLBEGINQUERYPROC glad_glBeginQuery;
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
+PFNGLBINDBUFFERPROC glad_glBindBuffer;
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
+PFNGLBUFFERDATAPROC glad_glBufferData;
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
+PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
+PFNGLGETERRORPROC glad_glGetError;
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
+PFNGLGETFLOATVPROC glad_glGetFloatv;
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
+PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
+PFNGLGETINTEGERVPROC glad_glGetIntegerv;
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
+PFNGLISQUERYPROC glad_glIsQuery;
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+PFNGLSTENCILMASKPROC glad_glStencilMask;
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
+PFNGLISTEXTUREPROC glad_glIsTexture;
+PFNGLUNIFORM1FVPROC glad_glUniform1fv;
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+PFNGLDEPTHMASKPROC glad_glDepthMask;
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
+PFNGLFRONTFACEPROC glad_glFrontFace;
+static void load_GL_VERSION_1_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	glad_glHint = (PFNGLHINTPROC)load("glHint");
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	glad_glClear = (PFNGLCLEARPROC)load("glClear");
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
+	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
+	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
+	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
+	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static int find_extensionsGL(void) {
+	if (!get_exts()) return 0;
+	(void)&has_ext;
+	free_exts();
+	return 1;
+}
+
+static void find_coreGL(void) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int i, major, minor;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    max_loaded_major = major; max_loaded_minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
+		max_loaded_major = 3;
+		max_loaded_minor = 3;
+	}
+}
+
+#ifdef GLAD_DEBUG
+#include "glad_debug.h"
+
+static PFNGLCULLFACEPROC glad_real_glCullFace;
+static PFNGLFRONTFACEPROC glad_real_glFrontFace;
+static PFNGLHINTPROC glad_real_glHint;
+static PFNGLLINEWIDTHPROC glad_real_glLineWidth;
+static PFNGLPOINTSIZEPROC glad_real_glPointSize;
+static PFNGLPOLYGONMODEPROC glad_real_glPolygonMode;
+static PFNGLSCISSORPROC glad_real_glScissor;
+static PFNGLTEXPARAMETERFPROC glad_real_glTexParameterf;
+static PFNGLTEXPARAMETERFVPROC glad_real_glTexParameterfv;
+static PFNGLTEXPARAMETERIPROC glad_real_glTexParameteri;
+static PFNGLTEXPARAMETERIVPROC glad_real_glTexParameteriv;
+static PFNGLTEXIMAGE1DPROC glad_real_glTexImage1D;
+static PFNGLTEXIMAGE2DPROC glad_real_glTexImage2D;
+static PFNGLDRAWBUFFERPROC glad_real_glDrawBuffer;
+static PFNGLCLEARPROC glad_real_glClear;
+static PFNGLCLEARCOLORPROC glad_real_glClearColor;
+static PFNGLCLEARSTENCILPROC glad_real_glClearStencil;
+static PFNGLCLEARDEPTHPROC glad_real_glClearDepth;
+static PFNGLSTENCILMASKPROC glad_real_glStencilMask;
+static PFNGLCOLORMASKPROC glad_real_glColorMask;
+static PFNGLDEPTHMASKPROC glad_real_glDepthMask;
+static PFNGLDISABLEPROC glad_real_glDisable;
+static PFNGLENABLEPROC glad_real_glEnable;
+static PFNGLFINISHPROC glad_real_glFinish;
+static PFNGLFLUSHPROC glad_real_glFlush;
+static PFNGLBLENDFUNCPROC glad_real_glBlendFunc;
+static PFNGLLOGICOPPROC glad_real_glLogicOp;
+static PFNGLSTENCILFUNCPROC glad_real_glStencilFunc;
+static PFNGLSTENCILOPPROC glad_real_glStencilOp;
+static PFNGLDEPTHFUNCPROC glad_real_glDepthFunc;
+static PFNGLPIXELSTOREFPROC glad_real_glPixelStoref;
+static PFNGLPIXELSTOREIPROC glad_real_glPixelStorei;
+static PFNGLREADBUFFERPROC glad_real_glReadBuffer;
+static PFNGLREADPIXELSPROC glad_real_glReadPixels;
+static PFNGLGETBOOLEANVPROC glad_real_glGetBooleanv;
+static PFNGLGETDOUBLEVPROC glad_real_glGetDoublev;
+static PFNGLGETERRORPROC glad_real_glGetError;
+static PFNGLGETFLOATVPROC glad_real_glGetFloatv;
+static PFNGLGETINTEGERVPROC glad_real_glGetIntegerv;
+static PFNGLGETSTRINGPROC glad_real_glGetString;
+static PFNGLGETTEXIMAGEPROC glad_real_glGetTexImage;
+static PFNGLGETTEXPARAMETERFVPROC glad_real_glGetTexParameterfv;
+static PFNGLGETTEXPARAMETERIVPROC glad_real_glGetTexParameteriv;
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_real_glGetTexLevelParameterfv;
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_real_glGetTexLevelParameteriv;
+static PFNGLISENABLEDPROC glad_real_glIsEnabled;
+static PFNGLDEPTHRANGEPROC glad_real_glDepthRange;
+static PFNGLVIEWPORTPROC glad_real_glViewport;
+static PFNGLDRAWARRAYSPROC glad_real_glDrawArrays;
+static PFNGLDRAWELEMENTSPROC glad_real_glDrawElements;
+static PFNGLPOLYGONOFFSETPROC glad_real_glPolygonOffset;
+static PFNGLCOPYTEXIMAGE1DPROC glad_real_glCopyTexImage1D;
+static PFNGLCOPYTEXIMAGE2DPROC glad_real_glCopyTexImage2D;
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_real_glCopyTexSubImage1D;
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_real_glCopyTexSubImage2D;
+static PFNGLTEXSUBIMAGE1DPROC glad_real_glTexSubImage1D;
+static PFNGLTEXSUBIMAGE2DPROC glad_real_glTexSubImage2D;
+static PFNGLBINDTEXTUREPROC glad_real_glBindTexture;
+static PFNGLDELETETEXTURESPROC glad_real_glDeleteTextures;
+static PFNGLGENTEXTURESPROC glad_real_glGenTextures;
+static PFNGLISTEXTUREPROC glad_real_glIsTexture;
+static PFNGLDRAWRANGEELEMENTSPROC glad_real_glDrawRangeElements;
+static PFNGLTEXIMAGE3DPROC glad_real_glTexImage3D;
+static PFNGLTEXSUBIMAGE3DPROC glad_real_glTexSubImage3D;
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_real_glCopyTexSubImage3D;
+static PFNGLACTIVETEXTUREPROC glad_real_glActiveTexture;
+static PFNGLSAMPLECOVERAGEPROC glad_real_glSampleCoverage;
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_real_glCompressedTexImage3D;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_real_glCompressedTexImage2D;
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_real_glCompressedTexImage1D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_real_glCompressedTexSubImage3D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_real_glCompressedTexSubImage2D;
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_real_glCompressedTexSubImage1D;
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_real_glGetCompressedTexImage;
+static PFNGLBLENDFUNCSEPARATEPROC glad_real_glBlendFuncSeparate;
+static PFNGLMULTIDRAWARRAYSPROC glad_real_glMultiDrawArrays;
+static PFNGLMULTIDRAWELEMENTSPROC glad_real_glMultiDrawElements;
+static PFNGLPOINTPARAMETERFPROC glad_real_glPointParameterf;
+static PFNGLPOINTPARAMETERFVPROC glad_real_glPointParameterfv;
+static PFNGLPOINTPARAMETERIPROC glad_real_glPointParameteri;
+static PFNGLPOINTPARAMETERIVPROC glad_real_glPointParameteriv;
+static PFNGLBLENDCOLORPROC glad_real_glBlendColor;
+static PFNGLBLENDEQUATIONPROC glad_real_glBlendEquation;
+static PFNGLGENQUERIESPROC glad_real_glGenQueries;
+static PFNGLDELETEQUERIESPROC glad_real_glDeleteQueries;
+static PFNGLISQUERYPROC glad_real_glIsQuery;
+static PFNGLBEGINQUERYPROC glad_real_glBeginQuery;
+static PFNGLENDQUERYPROC glad_real_glEndQuery;
+static PFNGLGETQUERYIVPROC glad_real_glGetQueryiv;
+static PFNGLGETQUERYOBJECTIVPROC glad_real_glGetQueryObjectiv;
+static PFNGLGETQUERYOBJECTUIVPROC glad_real_glGetQueryObjectuiv;
+static PFNGLBINDBUFFERPROC glad_real_glBindBuffer;
+static PFNGLDELETEBUFFERSPROC glad_real_glDeleteBuffers;
+static PFNGLGENBUFFERSPROC glad_real_glGenBuffers;
+static PFNGLISBUFFERPROC glad_real_glIsBuffer;
+static PFNGLBUFFERDATAPROC glad_real_glBufferData;
+static PFNGLBUFFERSUBDATAPROC glad_real_glBufferSubData;
+static PFNGLGETBUFFERSUBDATAPROC glad_real_glGetBufferSubData;
+static PFNGLMAPBUFFERPROC glad_real_glMapBuffer;
+static PFNGLUNMAPBUFFERPROC glad_real_glUnmapBuffer;
+static PFNGLGETBUFFERPARAMETERIVPROC glad_real_glGetBufferParameteriv;
+static PFNGLGETBUFFERPOINTERVPROC glad_real_glGetBufferPointerv;
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_real_glBlendEquationSeparate;
+static PFNGLDRAWBUFFERSPROC glad_real_glDrawBuffers;
+static PFNGLSTENCILOPSEPARATEPROC glad_real_glStencilOpSeparate;
+static PFNGLSTENCILFUNCSEPARATEPROC glad_real_glStencilFuncSeparate;
+static PFNGLSTENCILMASKSEPARATEPROC glad_real_glStencilMaskSeparate;
+static PFNGLATTACHSHADERPROC glad_real_glAttachShader;
+static PFNGLBINDATTRIBLOCATIONPROC glad_real_glBindAttribLocation;
+static PFNGLCOMPILESHADERPROC glad_real_glCompileShader;
+static PFNGLCREATEPROGRAMPROC glad_real_glCreateProgram;
+static PFNGLCREATESHADERPROC glad_real_glCreateShader;
+static PFNGLDELETEPROGRAMPROC glad_real_glDeleteProgram;
+static PFNGLDELETESHADERPROC glad_real_glDeleteShader;
+static PFNGLDETACHSHADERPROC glad_real_glDetachShader;
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_real_glDisableVertexAttribArray;
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_real_glEnableVertexAttribArray;
+static PFNGLGETACTIVEATTRIBPROC glad_real_glGetActiveAttrib;
+static PFNGLGETACTIVEUNIFORMPROC glad_real_glGetActiveUniform;
+static PFNGLGETATTACHEDSHADERSPROC glad_real_glGetAttachedShaders;
+static PFNGLGETATTRIBLOCATIONPROC glad_real_glGetAttribLocation;
+static PFNGLGETPROGRAMIVPROC glad_real_glGetProgramiv;
+static PFNGLGETPROGRAMINFOLOGPROC glad_real_glGetProgramInfoLog;
+static PFNGLGETSHADERIVPROC glad_real_glGetShaderiv;
+static PFNGLGETSHADERINFOLOGPROC glad_real_glGetShaderInfoLog;
+static PFNGLGETSHADERSOURCEPROC glad_real_glGetShaderSource;
+static PFNGLGETUNIFORMLOCATIONPROC glad_real_glGetUniformLocation;
+static PFNGLGETUNIFORMFVPROC glad_real_glGetUniformfv;
+static PFNGLGETUNIFORMIVPROC glad_real_glGetUniformiv;
+static PFNGLGETVERTEXATTRIBDVPROC glad_real_glGetVertexAttribdv;
+static PFNGLGETVERTEXATTRIBFVPROC glad_real_glGetVertexAttribfv;
+static PFNGLGETVERTEXATTRIBIVPROC glad_real_glGetVertexAttribiv;
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_real_glGetVertexAttribPointerv;
+static PFNGLISPROGRAMPROC glad_real_glIsProgram;
+static PFNGLISSHADERPROC glad_real_glIsShader;
+static PFNGLLINKPROGRAMPROC glad_real_glLinkProgram;
+static PFNGLSHADERSOURCEPROC glad_real_glShaderSource;
+static PFNGLUSEPROGRAMPROC glad_real_glUseProgram;
+static PFNGLUNIFORM1FPROC glad_real_glUniform1f;
+static PFNGLUNIFORM2FPROC glad_real_glUniform2f;
+static PFNGLUNIFORM3FPROC glad_real_glUniform3f;
+static PFNGLUNIFORM4FPROC glad_real_glUniform4f;
+static PFNGLUNIFORM1IPROC glad_real_glUniform1i;
+static PFNGLUNIFORM2IPROC glad_real_glUniform2i;
+static PFNGLUNIFORM3IPROC glad_real_glUniform3i;
+static PFNGLUNIFORM4IPROC glad_real_glUniform4i;
+static PFNGLUNIFORM1FVPROC glad_real_glUniform1fv;
+static PFNGLUNIFORM2FVPROC glad_real_glUniform2fv;
+static PFNGLUNIFORM3FVPROC glad_real_glUniform3fv;
+static PFNGLUNIFORM4FVPROC glad_real_glUniform4fv;
+static PFNGLUNIFORM1IVPROC glad_real_glUniform1iv;
+static PFNGLUNIFORM2IVPROC glad_real_glUniform2iv;
+static PFNGLUNIFORM3IVPROC glad_real_glUniform3iv;
+static PFNGLUNIFORM4IVPROC glad_real_glUniform4iv;
+static PFNGLUNIFORMMATRIX2FVPROC glad_real_glUniformMatrix2fv;
+static PFNGLUNIFORMMATRIX3FVPROC glad_real_glUniformMatrix3fv;
+static PFNGLUNIFORMMATRIX4FVPROC glad_real_glUniformMatrix4fv;
+static PFNGLVALIDATEPROGRAMPROC glad_real_glValidateProgram;
+static PFNGLVERTEXATTRIB1DPROC glad_real_glVertexAttrib1d;
+static PFNGLVERTEXATTRIB1DVPROC glad_real_glVertexAttrib1dv;
+static PFNGLVERTEXATTRIB1FPROC glad_real_glVertexAttrib1f;
+static PFNGLVERTEXATTRIB1FVPROC glad_real_glVertexAttrib1fv;
+static PFNGLVERTEXATTRIB1SPROC glad_real_glVertexAttrib1s;
+static PFNGLVERTEXATTRIB1SVPROC glad_real_glVertexAttrib1sv;
+static PFNGLVERTEXATTRIB2DPROC glad_real_glVertexAttrib2d;
+static PFNGLVERTEXATTRIB2DVPROC glad_real_glVertexAttrib2dv;
+static PFNGLVERTEXATTRIB2FPROC glad_real_glVertexAttrib2f;
+static PFNGLVERTEXATTRIB2FVPROC glad_real_glVertexAttrib2fv;
+static PFNGLVERTEXATTRIB2SPROC glad_real_glVertexAttrib2s;
+static PFNGLVERTEXATTRIB2SVPROC glad_real_glVertexAttrib2sv;
+static PFNGLVERTEXATTRIB3DPROC glad_real_glVertexAttrib3d;
+static PFNGLVERTEXATTRIB3DVPROC glad_real_glVertexAttrib3dv;
+static PFNGLVERTEXATTRIB3FPROC glad_real_glVertexAttrib3f;
+static PFNGLVERTEXATTRIB3FVPROC glad_real_glVertexAttrib3fv;
+static PFNGLVERTEXATTRIB3SPROC glad_real_glVertexAttrib3s;
+static PFNGLVERTEXATTRIB3SVPROC glad_real_glVertexAttrib3sv;
+static PFNGLVERTEXATTRIB4NBVPROC glad_real_glVertexAttrib4Nbv;
+static PFNGLVERTEXATTRIB4NIVPROC glad_real_glVertexAttrib4Niv;
+static PFNGLVERTEXATTRIB4NSVPROC glad_real_glVertexAttrib4Nsv;
+static PFNGLVERTEXATTRIB4NUBPROC glad_real_glVertexAttrib4Nub;
+static PFNGLVERTEXATTRIB4NUBVPROC glad_real_glVertexAttrib4Nubv;
+static PFNGLVERTEXATTRIB4NUIVPROC glad_real_glVertexAttrib4Nuiv;
+static PFNGLVERTEXATTRIB4NUSVPROC glad_real_glVertexAttrib4Nusv;
+static PFNGLVERTEXATTRIB4BVPROC glad_real_glVertexAttrib4bv;
+static PFNGLVERTEXATTRIB4DPROC glad_real_glVertexAttrib4d;
+static PFNGLVERTEXATTRIB4DVPROC glad_real_glVertexAttrib4dv;
+static PFNGLVERTEXATTRIB4FPROC glad_real_glVertexAttrib4f;
+static PFNGLVERTEXATTRIB4FVPROC glad_real_glVertexAttrib4fv;
+static PFNGLVERTEXATTRIB4IVPROC glad_real_glVertexAttrib4iv;
+static PFNGLVERTEXATTRIB4SPROC glad_real_glVertexAttrib4s;
+static PFNGLVERTEXATTRIB4SVPROC glad_real_glVertexAttrib4sv;
+static PFNGLVERTEXATTRIB4UBVPROC glad_real_glVertexAttrib4ubv;
+static PFNGLVERTEXATTRIB4UIVPROC glad_real_glVertexAttrib4uiv;
+static PFNGLVERTEXATTRIB4USVPROC glad_real_glVertexAttrib4usv;
+static PFNGLVERTEXATTRIBPOINTERPROC glad_real_glVertexAttribPointer;
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_real_glUniformMatrix2x3fv;
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_real_glUniformMatrix3x2fv;
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_real_glUniformMatrix2x4fv;
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_real_glUniformMatrix4x2fv;
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_real_glUniformMatrix3x4fv;
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_real_glUniformMatrix4x3fv;
+static PFNGLCOLORMASKIPROC glad_real_glColorMaski;
+static PFNGLGETBOOLEANI_VPROC glad_real_glGetBooleani_v;
+static PFNGLGETINTEGERI_VPROC glad_real_glGetIntegeri_v;
+static PFNGLENABLEIPROC glad_real_glEnablei;
+static PFNGLDISABLEIPROC glad_real_glDisablei;
+static PFNGLISENABLEDIPROC glad_real_glIsEnabledi;
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_real_glBeginTransformFeedback;
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_real_glEndTransformFeedback;
+static PFNGLBINDBUFFERRANGEPROC glad_real_glBindBufferRange;
+static PFNGLBINDBUFFERBASEPROC glad_real_glBindBufferBase;
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_real_glTransformFeedbackVaryings;
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_real_glGetTransformFeedbackVarying;
+static PFNGLCLAMPCOLORPROC glad_real_glClampColor;
+static PFNGLBEGINCONDITIONALRENDERPROC glad_real_glBeginConditionalRender;
+static PFNGLENDCONDITIONALRENDERPROC glad_real_glEndConditionalRender;
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_real_glVertexAttribIPointer;
+static PFNGLGETVERTEXATTRIBIIVPROC glad_real_glGetVertexAttribIiv;
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_real_glGetVertexAttribIuiv;
+static PFNGLVERTEXATTRIBI1IPROC glad_real_glVertexAttribI1i;
+static PFNGLVERTEXATTRIBI2IPROC glad_real_glVertexAttribI2i;
+static PFNGLVERTEXATTRIBI3IPROC glad_real_glVertexAttribI3i;
+static PFNGLVERTEXATTRIBI4IPROC glad_real_glVertexAttribI4i;
+static PFNGLVERTEXATTRIBI1UIPROC glad_real_glVertexAttribI1ui;
+static PFNGLVERTEXATTRIBI2UIPROC glad_real_glVertexAttribI2ui;
+static PFNGLVERTEXATTRIBI3UIPROC glad_real_glVertexAttribI3ui;
+static PFNGLVERTEXATTRIBI4UIPROC glad_real_glVertexAttribI4ui;
+static PFNGLVERTEXATTRIBI1IVPROC glad_real_glVertexAttribI1iv;
+static PFNGLVERTEXATTRIBI2IVPROC glad_real_glVertexAttribI2iv;
+static PFNGLVERTEXATTRIBI3IVPROC glad_real_glVertexAttribI3iv;
+static PFNGLVERTEXATTRIBI4IVPROC glad_real_glVertexAttribI4iv;
+static PFNGLVERTEXATTRIBI1UIVPROC glad_real_glVertexAttribI1uiv;
+static PFNGLVERTEXATTRIBI2UIVPROC glad_real_glVertexAttribI2uiv;
+static PFNGLVERTEXATTRIBI3UIVPROC glad_real_glVertexAttribI3uiv;
+static PFNGLVERTEXATTRIBI4UIVPROC glad_real_glVertexAttribI4uiv;
+static PFNGLVERTEXATTRIBI4BVPROC glad_real_glVertexAttribI4bv;
+static PFNGLVERTEXATTRIBI4SVPROC glad_real_glVertexAttribI4sv;
+static PFNGLVERTEXATTRIBI4UBVPROC glad_real_glVertexAttribI4ubv;
+static PFNGLVERTEXATTRIBI4USVPROC glad_real_glVertexAttribI4usv;
+static PFNGLGETUNIFORMUIVPROC glad_real_glGetUniformuiv;
+static PFNGLBINDFRAGDATALOCATIONPROC glad_real_glBindFragDataLocation;
+static PFNGLGETFRAGDATALOCATIONPROC glad_real_glGetFragDataLocation;
+static PFNGLUNIFORM1UIPROC glad_real_glUniform1ui;
+static PFNGLUNIFORM2UIPROC glad_real_glUniform2ui;
+static PFNGLUNIFORM3UIPROC glad_real_glUniform3ui;
+static PFNGLUNIFORM4UIPROC glad_real_glUniform4ui;
+static PFNGLUNIFORM1UIVPROC glad_real_glUniform1uiv;
+static PFNGLUNIFORM2UIVPROC glad_real_glUniform2uiv;
+static PFNGLUNIFORM3UIVPROC glad_real_glUniform3uiv;
+static PFNGLUNIFORM4UIVPROC glad_real_glUniform4uiv;
+static PFNGLTEXPARAMETERIIVPROC glad_real_glTexParameterIiv;
+static PFNGLTEXPARAMETERIUIVPROC glad_real_glTexParameterIuiv;
+static PFNGLGETTEXPARAMETERIIVPROC glad_real_glGetTexParameterIiv;
+static PFNGLGETTEXPARAMETERIUIVPROC glad_real_glGetTexParameterIuiv;
+static PFNGLCLEARBUFFERIVPROC glad_real_glClearBufferiv;
+static PFNGLCLEARBUFFERUIVPROC glad_real_glClearBufferuiv;
+static PFNGLCLEARBUFFERFVPROC glad_real_glClearBufferfv;
+static PFNGLCLEARBUFFERFIPROC glad_real_glClearBufferfi;
+static PFNGLGETSTRINGIPROC glad_real_glGetStringi;
+static PFNGLISRENDERBUFFERPROC glad_real_glIsRenderbuffer;
+static PFNGLBINDRENDERBUFFERPROC glad_real_glBindRenderbuffer;
+static PFNGLDELETERENDERBUFFERSPROC glad_real_glDeleteRenderbuffers;
+static PFNGLGENRENDERBUFFERSPROC glad_real_glGenRenderbuffers;
+static PFNGLRENDERBUFFERSTORAGEPROC glad_real_glRenderbufferStorage;
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_real_glGetRenderbufferParameteriv;
+static PFNGLISFRAMEBUFFERPROC glad_real_glIsFramebuffer;
+static PFNGLBINDFRAMEBUFFERPROC glad_real_glBindFramebuffer;
+static PFNGLDELETEFRAMEBUFFERSPROC glad_real_glDeleteFramebuffers;
+static PFNGLGENFRAMEBUFFERSPROC glad_real_glGenFramebuffers;
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_real_glCheckFramebufferStatus;
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_real_glFramebufferTexture1D;
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_real_glFramebufferTexture2D;
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_real_glFramebufferTexture3D;
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_real_glFramebufferRenderbuffer;
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_real_glGetFramebufferAttachmentParameteriv;
+static PFNGLGENERATEMIPMAPPROC glad_real_glGenerateMipmap;
+static PFNGLBLITFRAMEBUFFERPROC glad_real_glBlitFramebuffer;
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_real_glRenderbufferStorageMultisample;
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_real_glFramebufferTextureLayer;
+static PFNGLMAPBUFFERRANGEPROC glad_real_glMapBufferRange;
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_real_glFlushMappedBufferRange;
+static PFNGLBINDVERTEXARRAYPROC glad_real_glBindVertexArray;
+static PFNGLDELETEVERTEXARRAYSPROC glad_real_glDeleteVertexArrays;
+static PFNGLGENVERTEXARRAYSPROC glad_real_glGenVertexArrays;
+static PFNGLISVERTEXARRAYPROC glad_real_glIsVertexArray;
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_real_glDrawArraysInstanced;
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_real_glDrawElementsInstanced;
+static PFNGLTEXBUFFERPROC glad_real_glTexBuffer;
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_real_glPrimitiveRestartIndex;
+static PFNGLCOPYBUFFERSUBDATAPROC glad_real_glCopyBufferSubData;
+static PFNGLGETUNIFORMINDICESPROC glad_real_glGetUniformIndices;
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_real_glGetActiveUniformsiv;
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_real_glGetActiveUniformName;
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_real_glGetUniformBlockIndex;
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_real_glGetActiveUniformBlockiv;
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_real_glGetActiveUniformBlockName;
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_real_glUniformBlockBinding;
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_real_glDrawElementsBaseVertex;
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_real_glDrawRangeElementsBaseVertex;
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_real_glDrawElementsInstancedBaseVertex;
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_real_glMultiDrawElementsBaseVertex;
+static PFNGLPROVOKINGVERTEXPROC glad_real_glProvokingVertex;
+static PFNGLFENCESYNCPROC glad_real_glFenceSync;
+static PFNGLISSYNCPROC glad_real_glIsSync;
+static PFNGLDELETESYNCPROC glad_real_glDeleteSync;
+static PFNGLCLIENTWAITSYNCPROC glad_real_glClientWaitSync;
+static PFNGLWAITSYNCPROC glad_real_glWaitSync;
+static PFNGLGETINTEGER64VPROC glad_real_glGetInteger64v;
+static PFNGLGETSYNCIVPROC glad_real_glGetSynciv;
+static PFNGLGETINTEGER64I_VPROC glad_real_glGetInteger64i_v;
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_real_glGetBufferParameteri64v;
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_real_glFramebufferTexture;
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_real_glTexImage2DMultisample;
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_real_glTexImage3DMultisample;
+static PFNGLGETMULTISAMPLEFVPROC glad_real_glGetMultisamplefv;
+static PFNGLSAMPLEMASKIPROC glad_real_glSampleMaski;
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_real_glBindFragDataLocationIndexed;
+static PFNGLGETFRAGDATAINDEXPROC glad_real_glGetFragDataIndex;
+static PFNGLGENSAMPLERSPROC glad_real_glGenSamplers;
+static PFNGLDELETESAMPLERSPROC glad_real_glDeleteSamplers;
+static PFNGLISSAMPLERPROC glad_real_glIsSampler;
+static PFNGLBINDSAMPLERPROC glad_real_glBindSampler;
+static PFNGLSAMPLERPARAMETERIPROC glad_real_glSamplerParameteri;
+static PFNGLSAMPLERPARAMETERIVPROC glad_real_glSamplerParameteriv;
+static PFNGLSAMPLERPARAMETERFPROC glad_real_glSamplerParameterf;
+static PFNGLSAMPLERPARAMETERFVPROC glad_real_glSamplerParameterfv;
+static PFNGLSAMPLERPARAMETERIIVPROC glad_real_glSamplerParameterIiv;
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_real_glSamplerParameterIuiv;
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_real_glGetSamplerParameteriv;
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_real_glGetSamplerParameterIiv;
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_real_glGetSamplerParameterfv;
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_real_glGetSamplerParameterIuiv;
+static PFNGLQUERYCOUNTERPROC glad_real_glQueryCounter;
+static PFNGLGETQUERYOBJECTI64VPROC glad_real_glGetQueryObjecti64v;
+static PFNGLGETQUERYOBJECTUI64VPROC glad_real_glGetQueryObjectui64v;
+static PFNGLVERTEXATTRIBDIVISORPROC glad_real_glVertexAttribDivisor;
+static PFNGLVERTEXATTRIBP1UIPROC glad_real_glVertexAttribP1ui;
+static PFNGLVERTEXATTRIBP1UIVPROC glad_real_glVertexAttribP1uiv;
+static PFNGLVERTEXATTRIBP2UIPROC glad_real_glVertexAttribP2ui;
+static PFNGLVERTEXATTRIBP2UIVPROC glad_real_glVertexAttribP2uiv;
+static PFNGLVERTEXATTRIBP3UIPROC glad_real_glVertexAttribP3ui;
+static PFNGLVERTEXATTRIBP3UIVPROC glad_real_glVertexAttribP3uiv;
+static PFNGLVERTEXATTRIBP4UIPROC glad_real_glVertexAttribP4ui;
+static PFNGLVERTEXATTRIBP4UIVPROC glad_real_glVertexAttribP4uiv;
+static PFNGLVERTEXP2UIPROC glad_real_glVertexP2ui;
+static PFNGLVERTEXP2UIVPROC glad_real_glVertexP2uiv;
+static PFNGLVERTEXP3UIPROC glad_real_glVertexP3ui;
+static PFNGLVERTEXP3UIVPROC glad_real_glVertexP3uiv;
+static PFNGLVERTEXP4UIPROC glad_real_glVertexP4ui;
+static PFNGLVERTEXP4UIVPROC glad_real_glVertexP4uiv;
+static PFNGLTEXCOORDP1UIPROC glad_real_glTexCoordP1ui;
+static PFNGLTEXCOORDP1UIVPROC glad_real_glTexCoordP1uiv;
+static PFNGLTEXCOORDP2UIPROC glad_real_glTexCoordP2ui;
+static PFNGLTEXCOORDP2UIVPROC glad_real_glTexCoordP2uiv;
+static PFNGLTEXCOORDP3UIPROC glad_real_glTexCoordP3ui;
+static PFNGLTEXCOORDP3UIVPROC glad_real_glTexCoordP3uiv;
+static PFNGLTEXCOORDP4UIPROC glad_real_glTexCoordP4ui;
+static PFNGLTEXCOORDP4UIVPROC glad_real_glTexCoordP4uiv;
+static PFNGLMULTITEXCOORDP1UIPROC glad_real_glMultiTexCoordP1ui;
+static PFNGLMULTITEXCOORDP1UIVPROC glad_real_glMultiTexCoordP1uiv;
+static PFNGLMULTITEXCOORDP2UIPROC glad_real_glMultiTexCoordP2ui;
+static PFNGLMULTITEXCOORDP2UIVPROC glad_real_glMultiTexCoordP2uiv;
+static PFNGLMULTITEXCOORDP3UIPROC glad_real_glMultiTexCoordP3ui;
+static PFNGLMULTITEXCOORDP3UIVPROC glad_real_glMultiTexCoordP3uiv;
+static PFNGLMULTITEXCOORDP4UIPROC glad_real_glMultiTexCoordP4ui;
+static PFNGLMULTITEXCOORDP4UIVPROC glad_real_glMultiTexCoordP4uiv;
+static PFNGLNORMALP3UIPROC glad_real_glNormalP3ui;
+static PFNGLNORMALP3UIVPROC glad_real_glNormalP3uiv;
+static PFNGLCOLORP3UIPROC glad_real_glColorP3ui;
+static PFNGLCOLORP3UIVPROC glad_real_glColorP3uiv;
+static PFNGLCOLORP4UIPROC glad_real_glColorP4ui;
+static PFNGLCOLORP4UIVPROC glad_real_glColorP4uiv;
+static PFNGLSECONDARYCOLORP3UIPROC glad_real_glSecondaryColorP3ui;
+static PFNGLSECONDARYCOLORP3UIVPROC glad_real_glSecondaryColorP3uiv;
+/* debug wrappers (glad c-debug style), installed over the glad_gl* pointers
+ * at the end of gladLoadGLLoader: every call goes through
+ * _pre_call_callback / _post_call_callback */
+
+static void _pre_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    (void)name;
+    (void)funcptr;
+    (void)len_args;
+}
+static void _post_call_callback_default(const char *name, void *funcptr, int len_args, ...) {
+    GLenum error_code;
+    (void)funcptr;
+    (void)len_args;
+    /* glGetError itself is not checked */
+    if (glad_real_glGetError == NULL) return;
+    error_code = glad_real_glGetError();
+    if (error_code != GL_NO_ERROR) {
+        fprintf(stderr, "ERROR %d in %s\n", error_code, name);
+    }
+}
+
+/* the wrappers call the callbacks unchecked: never store NULL */
+static GLADcallback _pre_call_callback = _pre_call_callback_default;
+void glad_set_pre_callback(GLADcallback cb) {
+    _pre_call_callback = cb != NULL ? cb : _pre_call_callback_default;
+}
+void glad_reset_pre_callback(void) {
+    _pre_call_callback = _pre_call_callback_default;
+}
+
+static GLADcallback _post_call_callback = _post_call_callback_default;
+void glad_set_post_callback(GLADcallback cb) {
+    _post_call_callback = cb != NULL ? cb : _post_call_callback_default;
+}
+void glad_reset_post_callback(void) {
+    _post_call_callback = _post_call_callback_default;
+}
+static void APIENTRY glad_debug_impl_glCullFace(GLenum mode) {
+    _pre_call_callback("glCullFace", (void*)glad_real_glCullFace, 1, mode);
+    glad_real_glCullFace(mode);
+    _post_call_callback("glCullFace", (void*)glad_real_glCullFace, 1, mode);
+}
+static void APIENTRY glad_debug_impl_glFrontFace(GLenum mode) {
+    _pre_call_callback("glFrontFace", (void*)glad_real_glFrontFace, 1, mode);
+    glad_real_glFrontFace(mode);
+    _post_call_callback("glFrontFace", (void*)glad_real_glFrontFace, 1, mode);
+}
+static void APIENTRY glad_debug_impl_glHint(GLenum target, GLenum mode) {
+    _pre_call_callback("glHint", (void*)glad_real_glHint, 2, target, mode);
+    glad_real_glHint(target, mode);
+    _post_call_callback("glHint", (void*)glad_real_glHint, 2, target, mode);
+}
+static void APIENTRY glad_debug_impl_glLineWidth(GLfloat width) {
+    _pre_call_callback("glLineWidth", (void*)glad_real_glLineWidth, 1, width);
+    glad_real_glLineWidth(width);
+    _post_call_callback("glLineWidth", (void*)glad_real_glLineWidth, 1, width);
+}
+static void APIENTRY glad_debug_impl_glPointSize(GLfloat size) {
+    _pre_call_callback("glPointSize", (void*)glad_real_glPointSize, 1, size);
+    glad_real_glPointSize(size);
+    _post_call_callback("glPointSize", (void*)glad_real_glPointSize, 1, size);
+}
+static void APIENTRY glad_debug_impl_glPolygonMode(GLenum face, GLenum mode) {
+    _pre_call_callback("glPolygonMode", (void*)glad_real_glPolygonMode, 2, face, mode);
+    glad_real_glPolygonMode(face, mode);
+    _post_call_callback("glPolygonMode", (void*)glad_real_glPolygonMode, 2, face, mode);
+}
+static void APIENTRY glad_debug_impl_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    _pre_call_callback("glScissor", (void*)glad_real_glScissor, 4, x, y, width, height);
+    glad_real_glScissor(x, y, width, height);
+    _post_call_callback("glScissor", (void*)glad_real_glScissor, 4, x, y, width, height);
+}
+static void APIENTRY glad_debug_impl_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    _pre_call_callback("glTexParameterf", (void*)glad_real_glTexParameterf, 3, target, pname, param);
+    glad_real_glTexParameterf(target, pname, param);
+    _post_call_callback("glTexParameterf", (void*)glad_real_glTexParameterf, 3, target, pname, param);
+}
+static void APIENTRY glad_debug_impl_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    _pre_call_callback("glTexParameterfv", (void*)glad_real_glTexParameterfv, 3, target, pname, params);
+    glad_real_glTexParameterfv(target, pname, params);
+    _post_call_callback("glTexParameterfv", (void*)glad_real_glTexParameterfv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    _pre_call_callback("glTexParameteri", (void*)glad_real_glTexParameteri, 3, target, pname, param);
+    glad_real_glTexParameteri(target, pname, param);
+    _post_call_callback("glTexParameteri", (void*)glad_real_glTexParameteri, 3, target, pname, param);
+}
+static void APIENTRY glad_debug_impl_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    _pre_call_callback("glTexParameteriv", (void*)glad_real_glTexParameteriv, 3, target, pname, params);
+    glad_real_glTexParameteriv(target, pname, params);
+    _post_call_callback("glTexParameteriv", (void*)glad_real_glTexParameteriv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexImage1D", (void*)glad_real_glTexImage1D, 8, target, level, internalformat, width, border, format, type, pixels);
+    glad_real_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+    _post_call_callback("glTexImage1D", (void*)glad_real_glTexImage1D, 8, target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexImage2D", (void*)glad_real_glTexImage2D, 9, target, level, internalformat, width, height, border, format, type, pixels);
+    glad_real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+    _post_call_callback("glTexImage2D", (void*)glad_real_glTexImage2D, 9, target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glDrawBuffer(GLenum buf) {
+    _pre_call_callback("glDrawBuffer", (void*)glad_real_glDrawBuffer, 1, buf);
+    glad_real_glDrawBuffer(buf);
+    _post_call_callback("glDrawBuffer", (void*)glad_real_glDrawBuffer, 1, buf);
+}
+static void APIENTRY glad_debug_impl_glClear(GLbitfield mask) {
+    _pre_call_callback("glClear", (void*)glad_real_glClear, 1, mask);
+    glad_real_glClear(mask);
+    _post_call_callback("glClear", (void*)glad_real_glClear, 1, mask);
+}
+static void APIENTRY glad_debug_impl_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    _pre_call_callback("glClearColor", (void*)glad_real_glClearColor, 4, red, green, blue, alpha);
+    glad_real_glClearColor(red, green, blue, alpha);
+    _post_call_callback("glClearColor", (void*)glad_real_glClearColor, 4, red, green, blue, alpha);
+}
+static void APIENTRY glad_debug_impl_glClearStencil(GLint s) {
+    _pre_call_callback("glClearStencil", (void*)glad_real_glClearStencil, 1, s);
+    glad_real_glClearStencil(s);
+    _post_call_callback("glClearStencil", (void*)glad_real_glClearStencil, 1, s);
+}
+static void APIENTRY glad_debug_impl_glClearDepth(GLdouble depth) {
+    _pre_call_callback("glClearDepth", (void*)glad_real_glClearDepth, 1, depth);
+    glad_real_glClearDepth(depth);
+    _post_call_callback("glClearDepth", (void*)glad_real_glClearDepth, 1, depth);
+}
+static void APIENTRY glad_debug_impl_glStencilMask(GLuint mask) {
+    _pre_call_callback("glStencilMask", (void*)glad_real_glStencilMask, 1, mask);
+    glad_real_glStencilMask(mask);
+    _post_call_callback("glStencilMask", (void*)glad_real_glStencilMask, 1, mask);
+}
+static void APIENTRY glad_debug_impl_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    _pre_call_callback("glColorMask", (void*)glad_real_glColorMask, 4, red, green, blue, alpha);
+    glad_real_glColorMask(red, green, blue, alpha);
+    _post_call_callback("glColorMask", (void*)glad_real_glColorMask, 4, red, green, blue, alpha);
+}
+static void APIENTRY glad_debug_impl_glDepthMask(GLboolean flag) {
+    _pre_call_callback("glDepthMask", (void*)glad_real_glDepthMask, 1, flag);
+    glad_real_glDepthMask(flag);
+    _post_call_callback("glDepthMask", (void*)glad_real_glDepthMask, 1, flag);
+}
+static void APIENTRY glad_debug_impl_glDisable(GLenum cap) {
+    _pre_call_callback("glDisable", (void*)glad_real_glDisable, 1, cap);
+    glad_real_glDisable(cap);
+    _post_call_callback("glDisable", (void*)glad_real_glDisable, 1, cap);
+}
+static void APIENTRY glad_debug_impl_glEnable(GLenum cap) {
+    _pre_call_callback("glEnable", (void*)glad_real_glEnable, 1, cap);
+    glad_real_glEnable(cap);
+    _post_call_callback("glEnable", (void*)glad_real_glEnable, 1, cap);
+}
+static void APIENTRY glad_debug_impl_glFinish(void) {
+    _pre_call_callback("glFinish", (void*)glad_real_glFinish, 0);
+    glad_real_glFinish();
+    _post_call_callback("glFinish", (void*)glad_real_glFinish, 0);
+}
+static void APIENTRY glad_debug_impl_glFlush(void) {
+    _pre_call_callback("glFlush", (void*)glad_real_glFlush, 0);
+    glad_real_glFlush();
+    _post_call_callback("glFlush", (void*)glad_real_glFlush, 0);
+}
+static void APIENTRY glad_debug_impl_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    _pre_call_callback("glBlendFunc", (void*)glad_real_glBlendFunc, 2, sfactor, dfactor);
+    glad_real_glBlendFunc(sfactor, dfactor);
+    _post_call_callback("glBlendFunc", (void*)glad_real_glBlendFunc, 2, sfactor, dfactor);
+}
+static void APIENTRY glad_debug_impl_glLogicOp(GLenum opcode) {
+    _pre_call_callback("glLogicOp", (void*)glad_real_glLogicOp, 1, opcode);
+    glad_real_glLogicOp(opcode);
+    _post_call_callback("glLogicOp", (void*)glad_real_glLogicOp, 1, opcode);
+}
+static void APIENTRY glad_debug_impl_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    _pre_call_callback("glStencilFunc", (void*)glad_real_glStencilFunc, 3, func, ref, mask);
+    glad_real_glStencilFunc(func, ref, mask);
+    _post_call_callback("glStencilFunc", (void*)glad_real_glStencilFunc, 3, func, ref, mask);
+}
+static void APIENTRY glad_debug_impl_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    _pre_call_callback("glStencilOp", (void*)glad_real_glStencilOp, 3, fail, zfail, zpass);
+    glad_real_glStencilOp(fail, zfail, zpass);
+    _post_call_callback("glStencilOp", (void*)glad_real_glStencilOp, 3, fail, zfail, zpass);
+}
+static void APIENTRY glad_debug_impl_glDepthFunc(GLenum func) {
+    _pre_call_callback("glDepthFunc", (void*)glad_real_glDepthFunc, 1, func);
+    glad_real_glDepthFunc(func);
+    _post_call_callback("glDepthFunc", (void*)glad_real_glDepthFunc, 1, func);
+}
+static void APIENTRY glad_debug_impl_glPixelStoref(GLenum pname, GLfloat param) {
+    _pre_call_callback("glPixelStoref", (void*)glad_real_glPixelStoref, 2, pname, param);
+    glad_real_glPixelStoref(pname, param);
+    _post_call_callback("glPixelStoref", (void*)glad_real_glPixelStoref, 2, pname, param);
+}
+static void APIENTRY glad_debug_impl_glPixelStorei(GLenum pname, GLint param) {
+    _pre_call_callback("glPixelStorei", (void*)glad_real_glPixelStorei, 2, pname, param);
+    glad_real_glPixelStorei(pname, param);
+    _post_call_callback("glPixelStorei", (void*)glad_real_glPixelStorei, 2, pname, param);
+}
+static void APIENTRY glad_debug_impl_glReadBuffer(GLenum src) {
+    _pre_call_callback("glReadBuffer", (void*)glad_real_glReadBuffer, 1, src);
+    glad_real_glReadBuffer(src);
+    _post_call_callback("glReadBuffer", (void*)glad_real_glReadBuffer, 1, src);
+}
+static void APIENTRY glad_debug_impl_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    _pre_call_callback("glReadPixels", (void*)glad_real_glReadPixels, 7, x, y, width, height, format, type, pixels);
+    glad_real_glReadPixels(x, y, width, height, format, type, pixels);
+    _post_call_callback("glReadPixels", (void*)glad_real_glReadPixels, 7, x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glGetBooleanv(GLenum pname, GLboolean *data) {
+    _pre_call_callback("glGetBooleanv", (void*)glad_real_glGetBooleanv, 2, pname, data);
+    glad_real_glGetBooleanv(pname, data);
+    _post_call_callback("glGetBooleanv", (void*)glad_real_glGetBooleanv, 2, pname, data);
+}
+static void APIENTRY glad_debug_impl_glGetDoublev(GLenum pname, GLdouble *data) {
+    _pre_call_callback("glGetDoublev", (void*)glad_real_glGetDoublev, 2, pname, data);
+    glad_real_glGetDoublev(pname, data);
+    _post_call_callback("glGetDoublev", (void*)glad_real_glGetDoublev, 2, pname, data);
+}
+static GLenum APIENTRY glad_debug_impl_glGetError(void) {
+    GLenum ret;
+    _pre_call_callback("glGetError", (void*)glad_real_glGetError, 0);
+    ret = glad_real_glGetError();
+    _post_call_callback("glGetError", (void*)glad_real_glGetError, 0);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetFloatv(GLenum pname, GLfloat *data) {
+    _pre_call_callback("glGetFloatv", (void*)glad_real_glGetFloatv, 2, pname, data);
+    glad_real_glGetFloatv(pname, data);
+    _post_call_callback("glGetFloatv", (void*)glad_real_glGetFloatv, 2, pname, data);
+}
+static void APIENTRY glad_debug_impl_glGetIntegerv(GLenum pname, GLint *data) {
+    _pre_call_callback("glGetIntegerv", (void*)glad_real_glGetIntegerv, 2, pname, data);
+    glad_real_glGetIntegerv(pname, data);
+    _post_call_callback("glGetIntegerv", (void*)glad_real_glGetIntegerv, 2, pname, data);
+}
+static const GLubyte * APIENTRY glad_debug_impl_glGetString(GLenum name) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetString", (void*)glad_real_glGetString, 1, name);
+    ret = glad_real_glGetString(name);
+    _post_call_callback("glGetString", (void*)glad_real_glGetString, 1, name);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    _pre_call_callback("glGetTexImage", (void*)glad_real_glGetTexImage, 5, target, level, format, type, pixels);
+    glad_real_glGetTexImage(target, level, format, type, pixels);
+    _post_call_callback("glGetTexImage", (void*)glad_real_glGetTexImage, 5, target, level, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    _pre_call_callback("glGetTexParameterfv", (void*)glad_real_glGetTexParameterfv, 3, target, pname, params);
+    glad_real_glGetTexParameterfv(target, pname, params);
+    _post_call_callback("glGetTexParameterfv", (void*)glad_real_glGetTexParameterfv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetTexParameteriv", (void*)glad_real_glGetTexParameteriv, 3, target, pname, params);
+    glad_real_glGetTexParameteriv(target, pname, params);
+    _post_call_callback("glGetTexParameteriv", (void*)glad_real_glGetTexParameteriv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    _pre_call_callback("glGetTexLevelParameterfv", (void*)glad_real_glGetTexLevelParameterfv, 4, target, level, pname, params);
+    glad_real_glGetTexLevelParameterfv(target, level, pname, params);
+    _post_call_callback("glGetTexLevelParameterfv", (void*)glad_real_glGetTexLevelParameterfv, 4, target, level, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetTexLevelParameteriv", (void*)glad_real_glGetTexLevelParameteriv, 4, target, level, pname, params);
+    glad_real_glGetTexLevelParameteriv(target, level, pname, params);
+    _post_call_callback("glGetTexLevelParameteriv", (void*)glad_real_glGetTexLevelParameteriv, 4, target, level, pname, params);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsEnabled(GLenum cap) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabled", (void*)glad_real_glIsEnabled, 1, cap);
+    ret = glad_real_glIsEnabled(cap);
+    _post_call_callback("glIsEnabled", (void*)glad_real_glIsEnabled, 1, cap);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glDepthRange(GLdouble near, GLdouble far) {
+    _pre_call_callback("glDepthRange", (void*)glad_real_glDepthRange, 2, near, far);
+    glad_real_glDepthRange(near, far);
+    _post_call_callback("glDepthRange", (void*)glad_real_glDepthRange, 2, near, far);
+}
+static void APIENTRY glad_debug_impl_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    _pre_call_callback("glViewport", (void*)glad_real_glViewport, 4, x, y, width, height);
+    glad_real_glViewport(x, y, width, height);
+    _post_call_callback("glViewport", (void*)glad_real_glViewport, 4, x, y, width, height);
+}
+static void APIENTRY glad_debug_impl_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    _pre_call_callback("glDrawArrays", (void*)glad_real_glDrawArrays, 3, mode, first, count);
+    glad_real_glDrawArrays(mode, first, count);
+    _post_call_callback("glDrawArrays", (void*)glad_real_glDrawArrays, 3, mode, first, count);
+}
+static void APIENTRY glad_debug_impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    _pre_call_callback("glDrawElements", (void*)glad_real_glDrawElements, 4, mode, count, type, indices);
+    glad_real_glDrawElements(mode, count, type, indices);
+    _post_call_callback("glDrawElements", (void*)glad_real_glDrawElements, 4, mode, count, type, indices);
+}
+static void APIENTRY glad_debug_impl_glPolygonOffset(GLfloat factor, GLfloat units) {
+    _pre_call_callback("glPolygonOffset", (void*)glad_real_glPolygonOffset, 2, factor, units);
+    glad_real_glPolygonOffset(factor, units);
+    _post_call_callback("glPolygonOffset", (void*)glad_real_glPolygonOffset, 2, factor, units);
+}
+static void APIENTRY glad_debug_impl_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    _pre_call_callback("glCopyTexImage1D", (void*)glad_real_glCopyTexImage1D, 7, target, level, internalformat, x, y, width, border);
+    glad_real_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+    _post_call_callback("glCopyTexImage1D", (void*)glad_real_glCopyTexImage1D, 7, target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_debug_impl_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    _pre_call_callback("glCopyTexImage2D", (void*)glad_real_glCopyTexImage2D, 8, target, level, internalformat, x, y, width, height, border);
+    glad_real_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+    _post_call_callback("glCopyTexImage2D", (void*)glad_real_glCopyTexImage2D, 8, target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_debug_impl_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    _pre_call_callback("glCopyTexSubImage1D", (void*)glad_real_glCopyTexSubImage1D, 6, target, level, xoffset, x, y, width);
+    glad_real_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+    _post_call_callback("glCopyTexSubImage1D", (void*)glad_real_glCopyTexSubImage1D, 6, target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_debug_impl_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    _pre_call_callback("glCopyTexSubImage2D", (void*)glad_real_glCopyTexSubImage2D, 8, target, level, xoffset, yoffset, x, y, width, height);
+    glad_real_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+    _post_call_callback("glCopyTexSubImage2D", (void*)glad_real_glCopyTexSubImage2D, 8, target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_debug_impl_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexSubImage1D", (void*)glad_real_glTexSubImage1D, 7, target, level, xoffset, width, format, type, pixels);
+    glad_real_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+    _post_call_callback("glTexSubImage1D", (void*)glad_real_glTexSubImage1D, 7, target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexSubImage2D", (void*)glad_real_glTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, type, pixels);
+    glad_real_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+    _post_call_callback("glTexSubImage2D", (void*)glad_real_glTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glBindTexture(GLenum target, GLuint texture) {
+    _pre_call_callback("glBindTexture", (void*)glad_real_glBindTexture, 2, target, texture);
+    glad_real_glBindTexture(target, texture);
+    _post_call_callback("glBindTexture", (void*)glad_real_glBindTexture, 2, target, texture);
+}
+static void APIENTRY glad_debug_impl_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    _pre_call_callback("glDeleteTextures", (void*)glad_real_glDeleteTextures, 2, n, textures);
+    glad_real_glDeleteTextures(n, textures);
+    _post_call_callback("glDeleteTextures", (void*)glad_real_glDeleteTextures, 2, n, textures);
+}
+static void APIENTRY glad_debug_impl_glGenTextures(GLsizei n, GLuint *textures) {
+    _pre_call_callback("glGenTextures", (void*)glad_real_glGenTextures, 2, n, textures);
+    glad_real_glGenTextures(n, textures);
+    _post_call_callback("glGenTextures", (void*)glad_real_glGenTextures, 2, n, textures);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsTexture(GLuint texture) {
+    GLboolean ret;
+    _pre_call_callback("glIsTexture", (void*)glad_real_glIsTexture, 1, texture);
+    ret = glad_real_glIsTexture(texture);
+    _post_call_callback("glIsTexture", (void*)glad_real_glIsTexture, 1, texture);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    _pre_call_callback("glDrawRangeElements", (void*)glad_real_glDrawRangeElements, 6, mode, start, end, count, type, indices);
+    glad_real_glDrawRangeElements(mode, start, end, count, type, indices);
+    _post_call_callback("glDrawRangeElements", (void*)glad_real_glDrawRangeElements, 6, mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_debug_impl_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexImage3D", (void*)glad_real_glTexImage3D, 10, target, level, internalformat, width, height, depth, border, format, type, pixels);
+    glad_real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+    _post_call_callback("glTexImage3D", (void*)glad_real_glTexImage3D, 10, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    _pre_call_callback("glTexSubImage3D", (void*)glad_real_glTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    glad_real_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+    _post_call_callback("glTexSubImage3D", (void*)glad_real_glTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_debug_impl_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    _pre_call_callback("glCopyTexSubImage3D", (void*)glad_real_glCopyTexSubImage3D, 9, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    glad_real_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+    _post_call_callback("glCopyTexSubImage3D", (void*)glad_real_glCopyTexSubImage3D, 9, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_debug_impl_glActiveTexture(GLenum texture) {
+    _pre_call_callback("glActiveTexture", (void*)glad_real_glActiveTexture, 1, texture);
+    glad_real_glActiveTexture(texture);
+    _post_call_callback("glActiveTexture", (void*)glad_real_glActiveTexture, 1, texture);
+}
+static void APIENTRY glad_debug_impl_glSampleCoverage(GLfloat value, GLboolean invert) {
+    _pre_call_callback("glSampleCoverage", (void*)glad_real_glSampleCoverage, 2, value, invert);
+    glad_real_glSampleCoverage(value, invert);
+    _post_call_callback("glSampleCoverage", (void*)glad_real_glSampleCoverage, 2, value, invert);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexImage3D", (void*)glad_real_glCompressedTexImage3D, 9, target, level, internalformat, width, height, depth, border, imageSize, data);
+    glad_real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+    _post_call_callback("glCompressedTexImage3D", (void*)glad_real_glCompressedTexImage3D, 9, target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexImage2D", (void*)glad_real_glCompressedTexImage2D, 8, target, level, internalformat, width, height, border, imageSize, data);
+    glad_real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+    _post_call_callback("glCompressedTexImage2D", (void*)glad_real_glCompressedTexImage2D, 8, target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexImage1D", (void*)glad_real_glCompressedTexImage1D, 7, target, level, internalformat, width, border, imageSize, data);
+    glad_real_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+    _post_call_callback("glCompressedTexImage1D", (void*)glad_real_glCompressedTexImage1D, 7, target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexSubImage3D", (void*)glad_real_glCompressedTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    glad_real_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+    _post_call_callback("glCompressedTexSubImage3D", (void*)glad_real_glCompressedTexSubImage3D, 11, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexSubImage2D", (void*)glad_real_glCompressedTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    glad_real_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+    _post_call_callback("glCompressedTexSubImage2D", (void*)glad_real_glCompressedTexSubImage2D, 9, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    _pre_call_callback("glCompressedTexSubImage1D", (void*)glad_real_glCompressedTexSubImage1D, 7, target, level, xoffset, width, format, imageSize, data);
+    glad_real_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+    _post_call_callback("glCompressedTexSubImage1D", (void*)glad_real_glCompressedTexSubImage1D, 7, target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_debug_impl_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    _pre_call_callback("glGetCompressedTexImage", (void*)glad_real_glGetCompressedTexImage, 3, target, level, img);
+    glad_real_glGetCompressedTexImage(target, level, img);
+    _post_call_callback("glGetCompressedTexImage", (void*)glad_real_glGetCompressedTexImage, 3, target, level, img);
+}
+static void APIENTRY glad_debug_impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    _pre_call_callback("glBlendFuncSeparate", (void*)glad_real_glBlendFuncSeparate, 4, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    glad_real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+    _post_call_callback("glBlendFuncSeparate", (void*)glad_real_glBlendFuncSeparate, 4, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_debug_impl_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    _pre_call_callback("glMultiDrawArrays", (void*)glad_real_glMultiDrawArrays, 4, mode, first, count, drawcount);
+    glad_real_glMultiDrawArrays(mode, first, count, drawcount);
+    _post_call_callback("glMultiDrawArrays", (void*)glad_real_glMultiDrawArrays, 4, mode, first, count, drawcount);
+}
+static void APIENTRY glad_debug_impl_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    _pre_call_callback("glMultiDrawElements", (void*)glad_real_glMultiDrawElements, 5, mode, count, type, indices, drawcount);
+    glad_real_glMultiDrawElements(mode, count, type, indices, drawcount);
+    _post_call_callback("glMultiDrawElements", (void*)glad_real_glMultiDrawElements, 5, mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_debug_impl_glPointParameterf(GLenum pname, GLfloat param) {
+    _pre_call_callback("glPointParameterf", (void*)glad_real_glPointParameterf, 2, pname, param);
+    glad_real_glPointParameterf(pname, param);
+    _post_call_callback("glPointParameterf", (void*)glad_real_glPointParameterf, 2, pname, param);
+}
+static void APIENTRY glad_debug_impl_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    _pre_call_callback("glPointParameterfv", (void*)glad_real_glPointParameterfv, 2, pname, params);
+    glad_real_glPointParameterfv(pname, params);
+    _post_call_callback("glPointParameterfv", (void*)glad_real_glPointParameterfv, 2, pname, params);
+}
+static void APIENTRY glad_debug_impl_glPointParameteri(GLenum pname, GLint param) {
+    _pre_call_callback("glPointParameteri", (void*)glad_real_glPointParameteri, 2, pname, param);
+    glad_real_glPointParameteri(pname, param);
+    _post_call_callback("glPointParameteri", (void*)glad_real_glPointParameteri, 2, pname, param);
+}
+static void APIENTRY glad_debug_impl_glPointParameteriv(GLenum pname, const GLint *params) {
+    _pre_call_callback("glPointParameteriv", (void*)glad_real_glPointParameteriv, 2, pname, params);
+    glad_real_glPointParameteriv(pname, params);
+    _post_call_callback("glPointParameteriv", (void*)glad_real_glPointParameteriv, 2, pname, params);
+}
+static void APIENTRY glad_debug_impl_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    _pre_call_callback("glBlendColor", (void*)glad_real_glBlendColor, 4, red, green, blue, alpha);
+    glad_real_glBlendColor(red, green, blue, alpha);
+    _post_call_callback("glBlendColor", (void*)glad_real_glBlendColor, 4, red, green, blue, alpha);
+}
+static void APIENTRY glad_debug_impl_glBlendEquation(GLenum mode) {
+    _pre_call_callback("glBlendEquation", (void*)glad_real_glBlendEquation, 1, mode);
+    glad_real_glBlendEquation(mode);
+    _post_call_callback("glBlendEquation", (void*)glad_real_glBlendEquation, 1, mode);
+}
+static void APIENTRY glad_debug_impl_glGenQueries(GLsizei n, GLuint *ids) {
+    _pre_call_callback("glGenQueries", (void*)glad_real_glGenQueries, 2, n, ids);
+    glad_real_glGenQueries(n, ids);
+    _post_call_callback("glGenQueries", (void*)glad_real_glGenQueries, 2, n, ids);
+}
+static void APIENTRY glad_debug_impl_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    _pre_call_callback("glDeleteQueries", (void*)glad_real_glDeleteQueries, 2, n, ids);
+    glad_real_glDeleteQueries(n, ids);
+    _post_call_callback("glDeleteQueries", (void*)glad_real_glDeleteQueries, 2, n, ids);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsQuery(GLuint id) {
+    GLboolean ret;
+    _pre_call_callback("glIsQuery", (void*)glad_real_glIsQuery, 1, id);
+    ret = glad_real_glIsQuery(id);
+    _post_call_callback("glIsQuery", (void*)glad_real_glIsQuery, 1, id);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBeginQuery(GLenum target, GLuint id) {
+    _pre_call_callback("glBeginQuery", (void*)glad_real_glBeginQuery, 2, target, id);
+    glad_real_glBeginQuery(target, id);
+    _post_call_callback("glBeginQuery", (void*)glad_real_glBeginQuery, 2, target, id);
+}
+static void APIENTRY glad_debug_impl_glEndQuery(GLenum target) {
+    _pre_call_callback("glEndQuery", (void*)glad_real_glEndQuery, 1, target);
+    glad_real_glEndQuery(target);
+    _post_call_callback("glEndQuery", (void*)glad_real_glEndQuery, 1, target);
+}
+static void APIENTRY glad_debug_impl_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetQueryiv", (void*)glad_real_glGetQueryiv, 3, target, pname, params);
+    glad_real_glGetQueryiv(target, pname, params);
+    _post_call_callback("glGetQueryiv", (void*)glad_real_glGetQueryiv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetQueryObjectiv", (void*)glad_real_glGetQueryObjectiv, 3, id, pname, params);
+    glad_real_glGetQueryObjectiv(id, pname, params);
+    _post_call_callback("glGetQueryObjectiv", (void*)glad_real_glGetQueryObjectiv, 3, id, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    _pre_call_callback("glGetQueryObjectuiv", (void*)glad_real_glGetQueryObjectuiv, 3, id, pname, params);
+    glad_real_glGetQueryObjectuiv(id, pname, params);
+    _post_call_callback("glGetQueryObjectuiv", (void*)glad_real_glGetQueryObjectuiv, 3, id, pname, params);
+}
+static void APIENTRY glad_debug_impl_glBindBuffer(GLenum target, GLuint buffer) {
+    _pre_call_callback("glBindBuffer", (void*)glad_real_glBindBuffer, 2, target, buffer);
+    glad_real_glBindBuffer(target, buffer);
+    _post_call_callback("glBindBuffer", (void*)glad_real_glBindBuffer, 2, target, buffer);
+}
+static void APIENTRY glad_debug_impl_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    _pre_call_callback("glDeleteBuffers", (void*)glad_real_glDeleteBuffers, 2, n, buffers);
+    glad_real_glDeleteBuffers(n, buffers);
+    _post_call_callback("glDeleteBuffers", (void*)glad_real_glDeleteBuffers, 2, n, buffers);
+}
+static void APIENTRY glad_debug_impl_glGenBuffers(GLsizei n, GLuint *buffers) {
+    _pre_call_callback("glGenBuffers", (void*)glad_real_glGenBuffers, 2, n, buffers);
+    glad_real_glGenBuffers(n, buffers);
+    _post_call_callback("glGenBuffers", (void*)glad_real_glGenBuffers, 2, n, buffers);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsBuffer(GLuint buffer) {
+    GLboolean ret;
+    _pre_call_callback("glIsBuffer", (void*)glad_real_glIsBuffer, 1, buffer);
+    ret = glad_real_glIsBuffer(buffer);
+    _post_call_callback("glIsBuffer", (void*)glad_real_glIsBuffer, 1, buffer);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    _pre_call_callback("glBufferData", (void*)glad_real_glBufferData, 4, target, size, data, usage);
+    glad_real_glBufferData(target, size, data, usage);
+    _post_call_callback("glBufferData", (void*)glad_real_glBufferData, 4, target, size, data, usage);
+}
+static void APIENTRY glad_debug_impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    _pre_call_callback("glBufferSubData", (void*)glad_real_glBufferSubData, 4, target, offset, size, data);
+    glad_real_glBufferSubData(target, offset, size, data);
+    _post_call_callback("glBufferSubData", (void*)glad_real_glBufferSubData, 4, target, offset, size, data);
+}
+static void APIENTRY glad_debug_impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    _pre_call_callback("glGetBufferSubData", (void*)glad_real_glGetBufferSubData, 4, target, offset, size, data);
+    glad_real_glGetBufferSubData(target, offset, size, data);
+    _post_call_callback("glGetBufferSubData", (void*)glad_real_glGetBufferSubData, 4, target, offset, size, data);
+}
+static void * APIENTRY glad_debug_impl_glMapBuffer(GLenum target, GLenum access) {
+    void * ret;
+    _pre_call_callback("glMapBuffer", (void*)glad_real_glMapBuffer, 2, target, access);
+    ret = glad_real_glMapBuffer(target, access);
+    _post_call_callback("glMapBuffer", (void*)glad_real_glMapBuffer, 2, target, access);
+    return ret;
+}
+static GLboolean APIENTRY glad_debug_impl_glUnmapBuffer(GLenum target) {
+    GLboolean ret;
+    _pre_call_callback("glUnmapBuffer", (void*)glad_real_glUnmapBuffer, 1, target);
+    ret = glad_real_glUnmapBuffer(target);
+    _post_call_callback("glUnmapBuffer", (void*)glad_real_glUnmapBuffer, 1, target);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetBufferParameteriv", (void*)glad_real_glGetBufferParameteriv, 3, target, pname, params);
+    glad_real_glGetBufferParameteriv(target, pname, params);
+    _post_call_callback("glGetBufferParameteriv", (void*)glad_real_glGetBufferParameteriv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    _pre_call_callback("glGetBufferPointerv", (void*)glad_real_glGetBufferPointerv, 3, target, pname, params);
+    glad_real_glGetBufferPointerv(target, pname, params);
+    _post_call_callback("glGetBufferPointerv", (void*)glad_real_glGetBufferPointerv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    _pre_call_callback("glBlendEquationSeparate", (void*)glad_real_glBlendEquationSeparate, 2, modeRGB, modeAlpha);
+    glad_real_glBlendEquationSeparate(modeRGB, modeAlpha);
+    _post_call_callback("glBlendEquationSeparate", (void*)glad_real_glBlendEquationSeparate, 2, modeRGB, modeAlpha);
+}
+static void APIENTRY glad_debug_impl_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    _pre_call_callback("glDrawBuffers", (void*)glad_real_glDrawBuffers, 2, n, bufs);
+    glad_real_glDrawBuffers(n, bufs);
+    _post_call_callback("glDrawBuffers", (void*)glad_real_glDrawBuffers, 2, n, bufs);
+}
+static void APIENTRY glad_debug_impl_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    _pre_call_callback("glStencilOpSeparate", (void*)glad_real_glStencilOpSeparate, 4, face, sfail, dpfail, dppass);
+    glad_real_glStencilOpSeparate(face, sfail, dpfail, dppass);
+    _post_call_callback("glStencilOpSeparate", (void*)glad_real_glStencilOpSeparate, 4, face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_debug_impl_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    _pre_call_callback("glStencilFuncSeparate", (void*)glad_real_glStencilFuncSeparate, 4, face, func, ref, mask);
+    glad_real_glStencilFuncSeparate(face, func, ref, mask);
+    _post_call_callback("glStencilFuncSeparate", (void*)glad_real_glStencilFuncSeparate, 4, face, func, ref, mask);
+}
+static void APIENTRY glad_debug_impl_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    _pre_call_callback("glStencilMaskSeparate", (void*)glad_real_glStencilMaskSeparate, 2, face, mask);
+    glad_real_glStencilMaskSeparate(face, mask);
+    _post_call_callback("glStencilMaskSeparate", (void*)glad_real_glStencilMaskSeparate, 2, face, mask);
+}
+static void APIENTRY glad_debug_impl_glAttachShader(GLuint program, GLuint shader) {
+    _pre_call_callback("glAttachShader", (void*)glad_real_glAttachShader, 2, program, shader);
+    glad_real_glAttachShader(program, shader);
+    _post_call_callback("glAttachShader", (void*)glad_real_glAttachShader, 2, program, shader);
+}
+static void APIENTRY glad_debug_impl_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    _pre_call_callback("glBindAttribLocation", (void*)glad_real_glBindAttribLocation, 3, program, index, name);
+    glad_real_glBindAttribLocation(program, index, name);
+    _post_call_callback("glBindAttribLocation", (void*)glad_real_glBindAttribLocation, 3, program, index, name);
+}
+static void APIENTRY glad_debug_impl_glCompileShader(GLuint shader) {
+    _pre_call_callback("glCompileShader", (void*)glad_real_glCompileShader, 1, shader);
+    glad_real_glCompileShader(shader);
+    _post_call_callback("glCompileShader", (void*)glad_real_glCompileShader, 1, shader);
+}
+static GLuint APIENTRY glad_debug_impl_glCreateProgram(void) {
+    GLuint ret;
+    _pre_call_callback("glCreateProgram", (void*)glad_real_glCreateProgram, 0);
+    ret = glad_real_glCreateProgram();
+    _post_call_callback("glCreateProgram", (void*)glad_real_glCreateProgram, 0);
+    return ret;
+}
+static GLuint APIENTRY glad_debug_impl_glCreateShader(GLenum type) {
+    GLuint ret;
+    _pre_call_callback("glCreateShader", (void*)glad_real_glCreateShader, 1, type);
+    ret = glad_real_glCreateShader(type);
+    _post_call_callback("glCreateShader", (void*)glad_real_glCreateShader, 1, type);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glDeleteProgram(GLuint program) {
+    _pre_call_callback("glDeleteProgram", (void*)glad_real_glDeleteProgram, 1, program);
+    glad_real_glDeleteProgram(program);
+    _post_call_callback("glDeleteProgram", (void*)glad_real_glDeleteProgram, 1, program);
+}
+static void APIENTRY glad_debug_impl_glDeleteShader(GLuint shader) {
+    _pre_call_callback("glDeleteShader", (void*)glad_real_glDeleteShader, 1, shader);
+    glad_real_glDeleteShader(shader);
+    _post_call_callback("glDeleteShader", (void*)glad_real_glDeleteShader, 1, shader);
+}
+static void APIENTRY glad_debug_impl_glDetachShader(GLuint program, GLuint shader) {
+    _pre_call_callback("glDetachShader", (void*)glad_real_glDetachShader, 2, program, shader);
+    glad_real_glDetachShader(program, shader);
+    _post_call_callback("glDetachShader", (void*)glad_real_glDetachShader, 2, program, shader);
+}
+static void APIENTRY glad_debug_impl_glDisableVertexAttribArray(GLuint index) {
+    _pre_call_callback("glDisableVertexAttribArray", (void*)glad_real_glDisableVertexAttribArray, 1, index);
+    glad_real_glDisableVertexAttribArray(index);
+    _post_call_callback("glDisableVertexAttribArray", (void*)glad_real_glDisableVertexAttribArray, 1, index);
+}
+static void APIENTRY glad_debug_impl_glEnableVertexAttribArray(GLuint index) {
+    _pre_call_callback("glEnableVertexAttribArray", (void*)glad_real_glEnableVertexAttribArray, 1, index);
+    glad_real_glEnableVertexAttribArray(index);
+    _post_call_callback("glEnableVertexAttribArray", (void*)glad_real_glEnableVertexAttribArray, 1, index);
+}
+static void APIENTRY glad_debug_impl_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    _pre_call_callback("glGetActiveAttrib", (void*)glad_real_glGetActiveAttrib, 7, program, index, bufSize, length, size, type, name);
+    glad_real_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+    _post_call_callback("glGetActiveAttrib", (void*)glad_real_glGetActiveAttrib, 7, program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_debug_impl_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    _pre_call_callback("glGetActiveUniform", (void*)glad_real_glGetActiveUniform, 7, program, index, bufSize, length, size, type, name);
+    glad_real_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+    _post_call_callback("glGetActiveUniform", (void*)glad_real_glGetActiveUniform, 7, program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_debug_impl_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    _pre_call_callback("glGetAttachedShaders", (void*)glad_real_glGetAttachedShaders, 4, program, maxCount, count, shaders);
+    glad_real_glGetAttachedShaders(program, maxCount, count, shaders);
+    _post_call_callback("glGetAttachedShaders", (void*)glad_real_glGetAttachedShaders, 4, program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_debug_impl_glGetAttribLocation(GLuint program, const GLchar *name) {
+    GLint ret;
+    _pre_call_callback("glGetAttribLocation", (void*)glad_real_glGetAttribLocation, 2, program, name);
+    ret = glad_real_glGetAttribLocation(program, name);
+    _post_call_callback("glGetAttribLocation", (void*)glad_real_glGetAttribLocation, 2, program, name);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetProgramiv", (void*)glad_real_glGetProgramiv, 3, program, pname, params);
+    glad_real_glGetProgramiv(program, pname, params);
+    _post_call_callback("glGetProgramiv", (void*)glad_real_glGetProgramiv, 3, program, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    _pre_call_callback("glGetProgramInfoLog", (void*)glad_real_glGetProgramInfoLog, 4, program, bufSize, length, infoLog);
+    glad_real_glGetProgramInfoLog(program, bufSize, length, infoLog);
+    _post_call_callback("glGetProgramInfoLog", (void*)glad_real_glGetProgramInfoLog, 4, program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_debug_impl_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetShaderiv", (void*)glad_real_glGetShaderiv, 3, shader, pname, params);
+    glad_real_glGetShaderiv(shader, pname, params);
+    _post_call_callback("glGetShaderiv", (void*)glad_real_glGetShaderiv, 3, shader, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    _pre_call_callback("glGetShaderInfoLog", (void*)glad_real_glGetShaderInfoLog, 4, shader, bufSize, length, infoLog);
+    glad_real_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+    _post_call_callback("glGetShaderInfoLog", (void*)glad_real_glGetShaderInfoLog, 4, shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_debug_impl_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    _pre_call_callback("glGetShaderSource", (void*)glad_real_glGetShaderSource, 4, shader, bufSize, length, source);
+    glad_real_glGetShaderSource(shader, bufSize, length, source);
+    _post_call_callback("glGetShaderSource", (void*)glad_real_glGetShaderSource, 4, shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_debug_impl_glGetUniformLocation(GLuint program, const GLchar *name) {
+    GLint ret;
+    _pre_call_callback("glGetUniformLocation", (void*)glad_real_glGetUniformLocation, 2, program, name);
+    ret = glad_real_glGetUniformLocation(program, name);
+    _post_call_callback("glGetUniformLocation", (void*)glad_real_glGetUniformLocation, 2, program, name);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    _pre_call_callback("glGetUniformfv", (void*)glad_real_glGetUniformfv, 3, program, location, params);
+    glad_real_glGetUniformfv(program, location, params);
+    _post_call_callback("glGetUniformfv", (void*)glad_real_glGetUniformfv, 3, program, location, params);
+}
+static void APIENTRY glad_debug_impl_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    _pre_call_callback("glGetUniformiv", (void*)glad_real_glGetUniformiv, 3, program, location, params);
+    glad_real_glGetUniformiv(program, location, params);
+    _post_call_callback("glGetUniformiv", (void*)glad_real_glGetUniformiv, 3, program, location, params);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    _pre_call_callback("glGetVertexAttribdv", (void*)glad_real_glGetVertexAttribdv, 3, index, pname, params);
+    glad_real_glGetVertexAttribdv(index, pname, params);
+    _post_call_callback("glGetVertexAttribdv", (void*)glad_real_glGetVertexAttribdv, 3, index, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    _pre_call_callback("glGetVertexAttribfv", (void*)glad_real_glGetVertexAttribfv, 3, index, pname, params);
+    glad_real_glGetVertexAttribfv(index, pname, params);
+    _post_call_callback("glGetVertexAttribfv", (void*)glad_real_glGetVertexAttribfv, 3, index, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetVertexAttribiv", (void*)glad_real_glGetVertexAttribiv, 3, index, pname, params);
+    glad_real_glGetVertexAttribiv(index, pname, params);
+    _post_call_callback("glGetVertexAttribiv", (void*)glad_real_glGetVertexAttribiv, 3, index, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    _pre_call_callback("glGetVertexAttribPointerv", (void*)glad_real_glGetVertexAttribPointerv, 3, index, pname, pointer);
+    glad_real_glGetVertexAttribPointerv(index, pname, pointer);
+    _post_call_callback("glGetVertexAttribPointerv", (void*)glad_real_glGetVertexAttribPointerv, 3, index, pname, pointer);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsProgram(GLuint program) {
+    GLboolean ret;
+    _pre_call_callback("glIsProgram", (void*)glad_real_glIsProgram, 1, program);
+    ret = glad_real_glIsProgram(program);
+    _post_call_callback("glIsProgram", (void*)glad_real_glIsProgram, 1, program);
+    return ret;
+}
+static GLboolean APIENTRY glad_debug_impl_glIsShader(GLuint shader) {
+    GLboolean ret;
+    _pre_call_callback("glIsShader", (void*)glad_real_glIsShader, 1, shader);
+    ret = glad_real_glIsShader(shader);
+    _post_call_callback("glIsShader", (void*)glad_real_glIsShader, 1, shader);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glLinkProgram(GLuint program) {
+    _pre_call_callback("glLinkProgram", (void*)glad_real_glLinkProgram, 1, program);
+    glad_real_glLinkProgram(program);
+    _post_call_callback("glLinkProgram", (void*)glad_real_glLinkProgram, 1, program);
+}
+static void APIENTRY glad_debug_impl_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    _pre_call_callback("glShaderSource", (void*)glad_real_glShaderSource, 4, shader, count, string, length);
+    glad_real_glShaderSource(shader, count, string, length);
+    _post_call_callback("glShaderSource", (void*)glad_real_glShaderSource, 4, shader, count, string, length);
+}
+static void APIENTRY glad_debug_impl_glUseProgram(GLuint program) {
+    _pre_call_callback("glUseProgram", (void*)glad_real_glUseProgram, 1, program);
+    glad_real_glUseProgram(program);
+    _post_call_callback("glUseProgram", (void*)glad_real_glUseProgram, 1, program);
+}
+static void APIENTRY glad_debug_impl_glUniform1f(GLint location, GLfloat v0) {
+    _pre_call_callback("glUniform1f", (void*)glad_real_glUniform1f, 2, location, v0);
+    glad_real_glUniform1f(location, v0);
+    _post_call_callback("glUniform1f", (void*)glad_real_glUniform1f, 2, location, v0);
+}
+static void APIENTRY glad_debug_impl_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    _pre_call_callback("glUniform2f", (void*)glad_real_glUniform2f, 3, location, v0, v1);
+    glad_real_glUniform2f(location, v0, v1);
+    _post_call_callback("glUniform2f", (void*)glad_real_glUniform2f, 3, location, v0, v1);
+}
+static void APIENTRY glad_debug_impl_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    _pre_call_callback("glUniform3f", (void*)glad_real_glUniform3f, 4, location, v0, v1, v2);
+    glad_real_glUniform3f(location, v0, v1, v2);
+    _post_call_callback("glUniform3f", (void*)glad_real_glUniform3f, 4, location, v0, v1, v2);
+}
+static void APIENTRY glad_debug_impl_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    _pre_call_callback("glUniform4f", (void*)glad_real_glUniform4f, 5, location, v0, v1, v2, v3);
+    glad_real_glUniform4f(location, v0, v1, v2, v3);
+    _post_call_callback("glUniform4f", (void*)glad_real_glUniform4f, 5, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_debug_impl_glUniform1i(GLint location, GLint v0) {
+    _pre_call_callback("glUniform1i", (void*)glad_real_glUniform1i, 2, location, v0);
+    glad_real_glUniform1i(location, v0);
+    _post_call_callback("glUniform1i", (void*)glad_real_glUniform1i, 2, location, v0);
+}
+static void APIENTRY glad_debug_impl_glUniform2i(GLint location, GLint v0, GLint v1) {
+    _pre_call_callback("glUniform2i", (void*)glad_real_glUniform2i, 3, location, v0, v1);
+    glad_real_glUniform2i(location, v0, v1);
+    _post_call_callback("glUniform2i", (void*)glad_real_glUniform2i, 3, location, v0, v1);
+}
+static void APIENTRY glad_debug_impl_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    _pre_call_callback("glUniform3i", (void*)glad_real_glUniform3i, 4, location, v0, v1, v2);
+    glad_real_glUniform3i(location, v0, v1, v2);
+    _post_call_callback("glUniform3i", (void*)glad_real_glUniform3i, 4, location, v0, v1, v2);
+}
+static void APIENTRY glad_debug_impl_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    _pre_call_callback("glUniform4i", (void*)glad_real_glUniform4i, 5, location, v0, v1, v2, v3);
+    glad_real_glUniform4i(location, v0, v1, v2, v3);
+    _post_call_callback("glUniform4i", (void*)glad_real_glUniform4i, 5, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_debug_impl_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    _pre_call_callback("glUniform1fv", (void*)glad_real_glUniform1fv, 3, location, count, value);
+    glad_real_glUniform1fv(location, count, value);
+    _post_call_callback("glUniform1fv", (void*)glad_real_glUniform1fv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    _pre_call_callback("glUniform2fv", (void*)glad_real_glUniform2fv, 3, location, count, value);
+    glad_real_glUniform2fv(location, count, value);
+    _post_call_callback("glUniform2fv", (void*)glad_real_glUniform2fv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    _pre_call_callback("glUniform3fv", (void*)glad_real_glUniform3fv, 3, location, count, value);
+    glad_real_glUniform3fv(location, count, value);
+    _post_call_callback("glUniform3fv", (void*)glad_real_glUniform3fv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    _pre_call_callback("glUniform4fv", (void*)glad_real_glUniform4fv, 3, location, count, value);
+    glad_real_glUniform4fv(location, count, value);
+    _post_call_callback("glUniform4fv", (void*)glad_real_glUniform4fv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    _pre_call_callback("glUniform1iv", (void*)glad_real_glUniform1iv, 3, location, count, value);
+    glad_real_glUniform1iv(location, count, value);
+    _post_call_callback("glUniform1iv", (void*)glad_real_glUniform1iv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    _pre_call_callback("glUniform2iv", (void*)glad_real_glUniform2iv, 3, location, count, value);
+    glad_real_glUniform2iv(location, count, value);
+    _post_call_callback("glUniform2iv", (void*)glad_real_glUniform2iv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    _pre_call_callback("glUniform3iv", (void*)glad_real_glUniform3iv, 3, location, count, value);
+    glad_real_glUniform3iv(location, count, value);
+    _post_call_callback("glUniform3iv", (void*)glad_real_glUniform3iv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    _pre_call_callback("glUniform4iv", (void*)glad_real_glUniform4iv, 3, location, count, value);
+    glad_real_glUniform4iv(location, count, value);
+    _post_call_callback("glUniform4iv", (void*)glad_real_glUniform4iv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix2fv", (void*)glad_real_glUniformMatrix2fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix2fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix2fv", (void*)glad_real_glUniformMatrix2fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix3fv", (void*)glad_real_glUniformMatrix3fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix3fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix3fv", (void*)glad_real_glUniformMatrix3fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix4fv", (void*)glad_real_glUniformMatrix4fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix4fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix4fv", (void*)glad_real_glUniformMatrix4fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glValidateProgram(GLuint program) {
+    _pre_call_callback("glValidateProgram", (void*)glad_real_glValidateProgram, 1, program);
+    glad_real_glValidateProgram(program);
+    _post_call_callback("glValidateProgram", (void*)glad_real_glValidateProgram, 1, program);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1d(GLuint index, GLdouble x) {
+    _pre_call_callback("glVertexAttrib1d", (void*)glad_real_glVertexAttrib1d, 2, index, x);
+    glad_real_glVertexAttrib1d(index, x);
+    _post_call_callback("glVertexAttrib1d", (void*)glad_real_glVertexAttrib1d, 2, index, x);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    _pre_call_callback("glVertexAttrib1dv", (void*)glad_real_glVertexAttrib1dv, 2, index, v);
+    glad_real_glVertexAttrib1dv(index, v);
+    _post_call_callback("glVertexAttrib1dv", (void*)glad_real_glVertexAttrib1dv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1f(GLuint index, GLfloat x) {
+    _pre_call_callback("glVertexAttrib1f", (void*)glad_real_glVertexAttrib1f, 2, index, x);
+    glad_real_glVertexAttrib1f(index, x);
+    _post_call_callback("glVertexAttrib1f", (void*)glad_real_glVertexAttrib1f, 2, index, x);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    _pre_call_callback("glVertexAttrib1fv", (void*)glad_real_glVertexAttrib1fv, 2, index, v);
+    glad_real_glVertexAttrib1fv(index, v);
+    _post_call_callback("glVertexAttrib1fv", (void*)glad_real_glVertexAttrib1fv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1s(GLuint index, GLshort x) {
+    _pre_call_callback("glVertexAttrib1s", (void*)glad_real_glVertexAttrib1s, 2, index, x);
+    glad_real_glVertexAttrib1s(index, x);
+    _post_call_callback("glVertexAttrib1s", (void*)glad_real_glVertexAttrib1s, 2, index, x);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttrib1sv", (void*)glad_real_glVertexAttrib1sv, 2, index, v);
+    glad_real_glVertexAttrib1sv(index, v);
+    _post_call_callback("glVertexAttrib1sv", (void*)glad_real_glVertexAttrib1sv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    _pre_call_callback("glVertexAttrib2d", (void*)glad_real_glVertexAttrib2d, 3, index, x, y);
+    glad_real_glVertexAttrib2d(index, x, y);
+    _post_call_callback("glVertexAttrib2d", (void*)glad_real_glVertexAttrib2d, 3, index, x, y);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    _pre_call_callback("glVertexAttrib2dv", (void*)glad_real_glVertexAttrib2dv, 2, index, v);
+    glad_real_glVertexAttrib2dv(index, v);
+    _post_call_callback("glVertexAttrib2dv", (void*)glad_real_glVertexAttrib2dv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    _pre_call_callback("glVertexAttrib2f", (void*)glad_real_glVertexAttrib2f, 3, index, x, y);
+    glad_real_glVertexAttrib2f(index, x, y);
+    _post_call_callback("glVertexAttrib2f", (void*)glad_real_glVertexAttrib2f, 3, index, x, y);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    _pre_call_callback("glVertexAttrib2fv", (void*)glad_real_glVertexAttrib2fv, 2, index, v);
+    glad_real_glVertexAttrib2fv(index, v);
+    _post_call_callback("glVertexAttrib2fv", (void*)glad_real_glVertexAttrib2fv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    _pre_call_callback("glVertexAttrib2s", (void*)glad_real_glVertexAttrib2s, 3, index, x, y);
+    glad_real_glVertexAttrib2s(index, x, y);
+    _post_call_callback("glVertexAttrib2s", (void*)glad_real_glVertexAttrib2s, 3, index, x, y);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttrib2sv", (void*)glad_real_glVertexAttrib2sv, 2, index, v);
+    glad_real_glVertexAttrib2sv(index, v);
+    _post_call_callback("glVertexAttrib2sv", (void*)glad_real_glVertexAttrib2sv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    _pre_call_callback("glVertexAttrib3d", (void*)glad_real_glVertexAttrib3d, 4, index, x, y, z);
+    glad_real_glVertexAttrib3d(index, x, y, z);
+    _post_call_callback("glVertexAttrib3d", (void*)glad_real_glVertexAttrib3d, 4, index, x, y, z);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    _pre_call_callback("glVertexAttrib3dv", (void*)glad_real_glVertexAttrib3dv, 2, index, v);
+    glad_real_glVertexAttrib3dv(index, v);
+    _post_call_callback("glVertexAttrib3dv", (void*)glad_real_glVertexAttrib3dv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    _pre_call_callback("glVertexAttrib3f", (void*)glad_real_glVertexAttrib3f, 4, index, x, y, z);
+    glad_real_glVertexAttrib3f(index, x, y, z);
+    _post_call_callback("glVertexAttrib3f", (void*)glad_real_glVertexAttrib3f, 4, index, x, y, z);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    _pre_call_callback("glVertexAttrib3fv", (void*)glad_real_glVertexAttrib3fv, 2, index, v);
+    glad_real_glVertexAttrib3fv(index, v);
+    _post_call_callback("glVertexAttrib3fv", (void*)glad_real_glVertexAttrib3fv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    _pre_call_callback("glVertexAttrib3s", (void*)glad_real_glVertexAttrib3s, 4, index, x, y, z);
+    glad_real_glVertexAttrib3s(index, x, y, z);
+    _post_call_callback("glVertexAttrib3s", (void*)glad_real_glVertexAttrib3s, 4, index, x, y, z);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttrib3sv", (void*)glad_real_glVertexAttrib3sv, 2, index, v);
+    glad_real_glVertexAttrib3sv(index, v);
+    _post_call_callback("glVertexAttrib3sv", (void*)glad_real_glVertexAttrib3sv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    _pre_call_callback("glVertexAttrib4Nbv", (void*)glad_real_glVertexAttrib4Nbv, 2, index, v);
+    glad_real_glVertexAttrib4Nbv(index, v);
+    _post_call_callback("glVertexAttrib4Nbv", (void*)glad_real_glVertexAttrib4Nbv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttrib4Niv", (void*)glad_real_glVertexAttrib4Niv, 2, index, v);
+    glad_real_glVertexAttrib4Niv(index, v);
+    _post_call_callback("glVertexAttrib4Niv", (void*)glad_real_glVertexAttrib4Niv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttrib4Nsv", (void*)glad_real_glVertexAttrib4Nsv, 2, index, v);
+    glad_real_glVertexAttrib4Nsv(index, v);
+    _post_call_callback("glVertexAttrib4Nsv", (void*)glad_real_glVertexAttrib4Nsv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    _pre_call_callback("glVertexAttrib4Nub", (void*)glad_real_glVertexAttrib4Nub, 5, index, x, y, z, w);
+    glad_real_glVertexAttrib4Nub(index, x, y, z, w);
+    _post_call_callback("glVertexAttrib4Nub", (void*)glad_real_glVertexAttrib4Nub, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    _pre_call_callback("glVertexAttrib4Nubv", (void*)glad_real_glVertexAttrib4Nubv, 2, index, v);
+    glad_real_glVertexAttrib4Nubv(index, v);
+    _post_call_callback("glVertexAttrib4Nubv", (void*)glad_real_glVertexAttrib4Nubv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttrib4Nuiv", (void*)glad_real_glVertexAttrib4Nuiv, 2, index, v);
+    glad_real_glVertexAttrib4Nuiv(index, v);
+    _post_call_callback("glVertexAttrib4Nuiv", (void*)glad_real_glVertexAttrib4Nuiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    _pre_call_callback("glVertexAttrib4Nusv", (void*)glad_real_glVertexAttrib4Nusv, 2, index, v);
+    glad_real_glVertexAttrib4Nusv(index, v);
+    _post_call_callback("glVertexAttrib4Nusv", (void*)glad_real_glVertexAttrib4Nusv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    _pre_call_callback("glVertexAttrib4bv", (void*)glad_real_glVertexAttrib4bv, 2, index, v);
+    glad_real_glVertexAttrib4bv(index, v);
+    _post_call_callback("glVertexAttrib4bv", (void*)glad_real_glVertexAttrib4bv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    _pre_call_callback("glVertexAttrib4d", (void*)glad_real_glVertexAttrib4d, 5, index, x, y, z, w);
+    glad_real_glVertexAttrib4d(index, x, y, z, w);
+    _post_call_callback("glVertexAttrib4d", (void*)glad_real_glVertexAttrib4d, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    _pre_call_callback("glVertexAttrib4dv", (void*)glad_real_glVertexAttrib4dv, 2, index, v);
+    glad_real_glVertexAttrib4dv(index, v);
+    _post_call_callback("glVertexAttrib4dv", (void*)glad_real_glVertexAttrib4dv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    _pre_call_callback("glVertexAttrib4f", (void*)glad_real_glVertexAttrib4f, 5, index, x, y, z, w);
+    glad_real_glVertexAttrib4f(index, x, y, z, w);
+    _post_call_callback("glVertexAttrib4f", (void*)glad_real_glVertexAttrib4f, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    _pre_call_callback("glVertexAttrib4fv", (void*)glad_real_glVertexAttrib4fv, 2, index, v);
+    glad_real_glVertexAttrib4fv(index, v);
+    _post_call_callback("glVertexAttrib4fv", (void*)glad_real_glVertexAttrib4fv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttrib4iv", (void*)glad_real_glVertexAttrib4iv, 2, index, v);
+    glad_real_glVertexAttrib4iv(index, v);
+    _post_call_callback("glVertexAttrib4iv", (void*)glad_real_glVertexAttrib4iv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    _pre_call_callback("glVertexAttrib4s", (void*)glad_real_glVertexAttrib4s, 5, index, x, y, z, w);
+    glad_real_glVertexAttrib4s(index, x, y, z, w);
+    _post_call_callback("glVertexAttrib4s", (void*)glad_real_glVertexAttrib4s, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttrib4sv", (void*)glad_real_glVertexAttrib4sv, 2, index, v);
+    glad_real_glVertexAttrib4sv(index, v);
+    _post_call_callback("glVertexAttrib4sv", (void*)glad_real_glVertexAttrib4sv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    _pre_call_callback("glVertexAttrib4ubv", (void*)glad_real_glVertexAttrib4ubv, 2, index, v);
+    glad_real_glVertexAttrib4ubv(index, v);
+    _post_call_callback("glVertexAttrib4ubv", (void*)glad_real_glVertexAttrib4ubv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttrib4uiv", (void*)glad_real_glVertexAttrib4uiv, 2, index, v);
+    glad_real_glVertexAttrib4uiv(index, v);
+    _post_call_callback("glVertexAttrib4uiv", (void*)glad_real_glVertexAttrib4uiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    _pre_call_callback("glVertexAttrib4usv", (void*)glad_real_glVertexAttrib4usv, 2, index, v);
+    glad_real_glVertexAttrib4usv(index, v);
+    _post_call_callback("glVertexAttrib4usv", (void*)glad_real_glVertexAttrib4usv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    _pre_call_callback("glVertexAttribPointer", (void*)glad_real_glVertexAttribPointer, 6, index, size, type, normalized, stride, pointer);
+    glad_real_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+    _post_call_callback("glVertexAttribPointer", (void*)glad_real_glVertexAttribPointer, 6, index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix2x3fv", (void*)glad_real_glUniformMatrix2x3fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix2x3fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix2x3fv", (void*)glad_real_glUniformMatrix2x3fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix3x2fv", (void*)glad_real_glUniformMatrix3x2fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix3x2fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix3x2fv", (void*)glad_real_glUniformMatrix3x2fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix2x4fv", (void*)glad_real_glUniformMatrix2x4fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix2x4fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix2x4fv", (void*)glad_real_glUniformMatrix2x4fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix4x2fv", (void*)glad_real_glUniformMatrix4x2fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix4x2fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix4x2fv", (void*)glad_real_glUniformMatrix4x2fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix3x4fv", (void*)glad_real_glUniformMatrix3x4fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix3x4fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix3x4fv", (void*)glad_real_glUniformMatrix3x4fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    _pre_call_callback("glUniformMatrix4x3fv", (void*)glad_real_glUniformMatrix4x3fv, 4, location, count, transpose, value);
+    glad_real_glUniformMatrix4x3fv(location, count, transpose, value);
+    _post_call_callback("glUniformMatrix4x3fv", (void*)glad_real_glUniformMatrix4x3fv, 4, location, count, transpose, value);
+}
+static void APIENTRY glad_debug_impl_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    _pre_call_callback("glColorMaski", (void*)glad_real_glColorMaski, 5, index, r, g, b, a);
+    glad_real_glColorMaski(index, r, g, b, a);
+    _post_call_callback("glColorMaski", (void*)glad_real_glColorMaski, 5, index, r, g, b, a);
+}
+static void APIENTRY glad_debug_impl_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    _pre_call_callback("glGetBooleani_v", (void*)glad_real_glGetBooleani_v, 3, target, index, data);
+    glad_real_glGetBooleani_v(target, index, data);
+    _post_call_callback("glGetBooleani_v", (void*)glad_real_glGetBooleani_v, 3, target, index, data);
+}
+static void APIENTRY glad_debug_impl_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    _pre_call_callback("glGetIntegeri_v", (void*)glad_real_glGetIntegeri_v, 3, target, index, data);
+    glad_real_glGetIntegeri_v(target, index, data);
+    _post_call_callback("glGetIntegeri_v", (void*)glad_real_glGetIntegeri_v, 3, target, index, data);
+}
+static void APIENTRY glad_debug_impl_glEnablei(GLenum target, GLuint index) {
+    _pre_call_callback("glEnablei", (void*)glad_real_glEnablei, 2, target, index);
+    glad_real_glEnablei(target, index);
+    _post_call_callback("glEnablei", (void*)glad_real_glEnablei, 2, target, index);
+}
+static void APIENTRY glad_debug_impl_glDisablei(GLenum target, GLuint index) {
+    _pre_call_callback("glDisablei", (void*)glad_real_glDisablei, 2, target, index);
+    glad_real_glDisablei(target, index);
+    _post_call_callback("glDisablei", (void*)glad_real_glDisablei, 2, target, index);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsEnabledi(GLenum target, GLuint index) {
+    GLboolean ret;
+    _pre_call_callback("glIsEnabledi", (void*)glad_real_glIsEnabledi, 2, target, index);
+    ret = glad_real_glIsEnabledi(target, index);
+    _post_call_callback("glIsEnabledi", (void*)glad_real_glIsEnabledi, 2, target, index);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBeginTransformFeedback(GLenum primitiveMode) {
+    _pre_call_callback("glBeginTransformFeedback", (void*)glad_real_glBeginTransformFeedback, 1, primitiveMode);
+    glad_real_glBeginTransformFeedback(primitiveMode);
+    _post_call_callback("glBeginTransformFeedback", (void*)glad_real_glBeginTransformFeedback, 1, primitiveMode);
+}
+static void APIENTRY glad_debug_impl_glEndTransformFeedback(void) {
+    _pre_call_callback("glEndTransformFeedback", (void*)glad_real_glEndTransformFeedback, 0);
+    glad_real_glEndTransformFeedback();
+    _post_call_callback("glEndTransformFeedback", (void*)glad_real_glEndTransformFeedback, 0);
+}
+static void APIENTRY glad_debug_impl_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    _pre_call_callback("glBindBufferRange", (void*)glad_real_glBindBufferRange, 5, target, index, buffer, offset, size);
+    glad_real_glBindBufferRange(target, index, buffer, offset, size);
+    _post_call_callback("glBindBufferRange", (void*)glad_real_glBindBufferRange, 5, target, index, buffer, offset, size);
+}
+static void APIENTRY glad_debug_impl_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    _pre_call_callback("glBindBufferBase", (void*)glad_real_glBindBufferBase, 3, target, index, buffer);
+    glad_real_glBindBufferBase(target, index, buffer);
+    _post_call_callback("glBindBufferBase", (void*)glad_real_glBindBufferBase, 3, target, index, buffer);
+}
+static void APIENTRY glad_debug_impl_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    _pre_call_callback("glTransformFeedbackVaryings", (void*)glad_real_glTransformFeedbackVaryings, 4, program, count, varyings, bufferMode);
+    glad_real_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+    _post_call_callback("glTransformFeedbackVaryings", (void*)glad_real_glTransformFeedbackVaryings, 4, program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_debug_impl_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    _pre_call_callback("glGetTransformFeedbackVarying", (void*)glad_real_glGetTransformFeedbackVarying, 7, program, index, bufSize, length, size, type, name);
+    glad_real_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+    _post_call_callback("glGetTransformFeedbackVarying", (void*)glad_real_glGetTransformFeedbackVarying, 7, program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_debug_impl_glClampColor(GLenum target, GLenum clamp) {
+    _pre_call_callback("glClampColor", (void*)glad_real_glClampColor, 2, target, clamp);
+    glad_real_glClampColor(target, clamp);
+    _post_call_callback("glClampColor", (void*)glad_real_glClampColor, 2, target, clamp);
+}
+static void APIENTRY glad_debug_impl_glBeginConditionalRender(GLuint id, GLenum mode) {
+    _pre_call_callback("glBeginConditionalRender", (void*)glad_real_glBeginConditionalRender, 2, id, mode);
+    glad_real_glBeginConditionalRender(id, mode);
+    _post_call_callback("glBeginConditionalRender", (void*)glad_real_glBeginConditionalRender, 2, id, mode);
+}
+static void APIENTRY glad_debug_impl_glEndConditionalRender(void) {
+    _pre_call_callback("glEndConditionalRender", (void*)glad_real_glEndConditionalRender, 0);
+    glad_real_glEndConditionalRender();
+    _post_call_callback("glEndConditionalRender", (void*)glad_real_glEndConditionalRender, 0);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    _pre_call_callback("glVertexAttribIPointer", (void*)glad_real_glVertexAttribIPointer, 5, index, size, type, stride, pointer);
+    glad_real_glVertexAttribIPointer(index, size, type, stride, pointer);
+    _post_call_callback("glVertexAttribIPointer", (void*)glad_real_glVertexAttribIPointer, 5, index, size, type, stride, pointer);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetVertexAttribIiv", (void*)glad_real_glGetVertexAttribIiv, 3, index, pname, params);
+    glad_real_glGetVertexAttribIiv(index, pname, params);
+    _post_call_callback("glGetVertexAttribIiv", (void*)glad_real_glGetVertexAttribIiv, 3, index, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    _pre_call_callback("glGetVertexAttribIuiv", (void*)glad_real_glGetVertexAttribIuiv, 3, index, pname, params);
+    glad_real_glGetVertexAttribIuiv(index, pname, params);
+    _post_call_callback("glGetVertexAttribIuiv", (void*)glad_real_glGetVertexAttribIuiv, 3, index, pname, params);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI1i(GLuint index, GLint x) {
+    _pre_call_callback("glVertexAttribI1i", (void*)glad_real_glVertexAttribI1i, 2, index, x);
+    glad_real_glVertexAttribI1i(index, x);
+    _post_call_callback("glVertexAttribI1i", (void*)glad_real_glVertexAttribI1i, 2, index, x);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    _pre_call_callback("glVertexAttribI2i", (void*)glad_real_glVertexAttribI2i, 3, index, x, y);
+    glad_real_glVertexAttribI2i(index, x, y);
+    _post_call_callback("glVertexAttribI2i", (void*)glad_real_glVertexAttribI2i, 3, index, x, y);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    _pre_call_callback("glVertexAttribI3i", (void*)glad_real_glVertexAttribI3i, 4, index, x, y, z);
+    glad_real_glVertexAttribI3i(index, x, y, z);
+    _post_call_callback("glVertexAttribI3i", (void*)glad_real_glVertexAttribI3i, 4, index, x, y, z);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    _pre_call_callback("glVertexAttribI4i", (void*)glad_real_glVertexAttribI4i, 5, index, x, y, z, w);
+    glad_real_glVertexAttribI4i(index, x, y, z, w);
+    _post_call_callback("glVertexAttribI4i", (void*)glad_real_glVertexAttribI4i, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI1ui(GLuint index, GLuint x) {
+    _pre_call_callback("glVertexAttribI1ui", (void*)glad_real_glVertexAttribI1ui, 2, index, x);
+    glad_real_glVertexAttribI1ui(index, x);
+    _post_call_callback("glVertexAttribI1ui", (void*)glad_real_glVertexAttribI1ui, 2, index, x);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    _pre_call_callback("glVertexAttribI2ui", (void*)glad_real_glVertexAttribI2ui, 3, index, x, y);
+    glad_real_glVertexAttribI2ui(index, x, y);
+    _post_call_callback("glVertexAttribI2ui", (void*)glad_real_glVertexAttribI2ui, 3, index, x, y);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    _pre_call_callback("glVertexAttribI3ui", (void*)glad_real_glVertexAttribI3ui, 4, index, x, y, z);
+    glad_real_glVertexAttribI3ui(index, x, y, z);
+    _post_call_callback("glVertexAttribI3ui", (void*)glad_real_glVertexAttribI3ui, 4, index, x, y, z);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    _pre_call_callback("glVertexAttribI4ui", (void*)glad_real_glVertexAttribI4ui, 5, index, x, y, z, w);
+    glad_real_glVertexAttribI4ui(index, x, y, z, w);
+    _post_call_callback("glVertexAttribI4ui", (void*)glad_real_glVertexAttribI4ui, 5, index, x, y, z, w);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttribI1iv", (void*)glad_real_glVertexAttribI1iv, 2, index, v);
+    glad_real_glVertexAttribI1iv(index, v);
+    _post_call_callback("glVertexAttribI1iv", (void*)glad_real_glVertexAttribI1iv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttribI2iv", (void*)glad_real_glVertexAttribI2iv, 2, index, v);
+    glad_real_glVertexAttribI2iv(index, v);
+    _post_call_callback("glVertexAttribI2iv", (void*)glad_real_glVertexAttribI2iv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttribI3iv", (void*)glad_real_glVertexAttribI3iv, 2, index, v);
+    glad_real_glVertexAttribI3iv(index, v);
+    _post_call_callback("glVertexAttribI3iv", (void*)glad_real_glVertexAttribI3iv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    _pre_call_callback("glVertexAttribI4iv", (void*)glad_real_glVertexAttribI4iv, 2, index, v);
+    glad_real_glVertexAttribI4iv(index, v);
+    _post_call_callback("glVertexAttribI4iv", (void*)glad_real_glVertexAttribI4iv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttribI1uiv", (void*)glad_real_glVertexAttribI1uiv, 2, index, v);
+    glad_real_glVertexAttribI1uiv(index, v);
+    _post_call_callback("glVertexAttribI1uiv", (void*)glad_real_glVertexAttribI1uiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttribI2uiv", (void*)glad_real_glVertexAttribI2uiv, 2, index, v);
+    glad_real_glVertexAttribI2uiv(index, v);
+    _post_call_callback("glVertexAttribI2uiv", (void*)glad_real_glVertexAttribI2uiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttribI3uiv", (void*)glad_real_glVertexAttribI3uiv, 2, index, v);
+    glad_real_glVertexAttribI3uiv(index, v);
+    _post_call_callback("glVertexAttribI3uiv", (void*)glad_real_glVertexAttribI3uiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    _pre_call_callback("glVertexAttribI4uiv", (void*)glad_real_glVertexAttribI4uiv, 2, index, v);
+    glad_real_glVertexAttribI4uiv(index, v);
+    _post_call_callback("glVertexAttribI4uiv", (void*)glad_real_glVertexAttribI4uiv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    _pre_call_callback("glVertexAttribI4bv", (void*)glad_real_glVertexAttribI4bv, 2, index, v);
+    glad_real_glVertexAttribI4bv(index, v);
+    _post_call_callback("glVertexAttribI4bv", (void*)glad_real_glVertexAttribI4bv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    _pre_call_callback("glVertexAttribI4sv", (void*)glad_real_glVertexAttribI4sv, 2, index, v);
+    glad_real_glVertexAttribI4sv(index, v);
+    _post_call_callback("glVertexAttribI4sv", (void*)glad_real_glVertexAttribI4sv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    _pre_call_callback("glVertexAttribI4ubv", (void*)glad_real_glVertexAttribI4ubv, 2, index, v);
+    glad_real_glVertexAttribI4ubv(index, v);
+    _post_call_callback("glVertexAttribI4ubv", (void*)glad_real_glVertexAttribI4ubv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    _pre_call_callback("glVertexAttribI4usv", (void*)glad_real_glVertexAttribI4usv, 2, index, v);
+    glad_real_glVertexAttribI4usv(index, v);
+    _post_call_callback("glVertexAttribI4usv", (void*)glad_real_glVertexAttribI4usv, 2, index, v);
+}
+static void APIENTRY glad_debug_impl_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    _pre_call_callback("glGetUniformuiv", (void*)glad_real_glGetUniformuiv, 3, program, location, params);
+    glad_real_glGetUniformuiv(program, location, params);
+    _post_call_callback("glGetUniformuiv", (void*)glad_real_glGetUniformuiv, 3, program, location, params);
+}
+static void APIENTRY glad_debug_impl_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    _pre_call_callback("glBindFragDataLocation", (void*)glad_real_glBindFragDataLocation, 3, program, color, name);
+    glad_real_glBindFragDataLocation(program, color, name);
+    _post_call_callback("glBindFragDataLocation", (void*)glad_real_glBindFragDataLocation, 3, program, color, name);
+}
+static GLint APIENTRY glad_debug_impl_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataLocation", (void*)glad_real_glGetFragDataLocation, 2, program, name);
+    ret = glad_real_glGetFragDataLocation(program, name);
+    _post_call_callback("glGetFragDataLocation", (void*)glad_real_glGetFragDataLocation, 2, program, name);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glUniform1ui(GLint location, GLuint v0) {
+    _pre_call_callback("glUniform1ui", (void*)glad_real_glUniform1ui, 2, location, v0);
+    glad_real_glUniform1ui(location, v0);
+    _post_call_callback("glUniform1ui", (void*)glad_real_glUniform1ui, 2, location, v0);
+}
+static void APIENTRY glad_debug_impl_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    _pre_call_callback("glUniform2ui", (void*)glad_real_glUniform2ui, 3, location, v0, v1);
+    glad_real_glUniform2ui(location, v0, v1);
+    _post_call_callback("glUniform2ui", (void*)glad_real_glUniform2ui, 3, location, v0, v1);
+}
+static void APIENTRY glad_debug_impl_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    _pre_call_callback("glUniform3ui", (void*)glad_real_glUniform3ui, 4, location, v0, v1, v2);
+    glad_real_glUniform3ui(location, v0, v1, v2);
+    _post_call_callback("glUniform3ui", (void*)glad_real_glUniform3ui, 4, location, v0, v1, v2);
+}
+static void APIENTRY glad_debug_impl_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    _pre_call_callback("glUniform4ui", (void*)glad_real_glUniform4ui, 5, location, v0, v1, v2, v3);
+    glad_real_glUniform4ui(location, v0, v1, v2, v3);
+    _post_call_callback("glUniform4ui", (void*)glad_real_glUniform4ui, 5, location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_debug_impl_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    _pre_call_callback("glUniform1uiv", (void*)glad_real_glUniform1uiv, 3, location, count, value);
+    glad_real_glUniform1uiv(location, count, value);
+    _post_call_callback("glUniform1uiv", (void*)glad_real_glUniform1uiv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    _pre_call_callback("glUniform2uiv", (void*)glad_real_glUniform2uiv, 3, location, count, value);
+    glad_real_glUniform2uiv(location, count, value);
+    _post_call_callback("glUniform2uiv", (void*)glad_real_glUniform2uiv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    _pre_call_callback("glUniform3uiv", (void*)glad_real_glUniform3uiv, 3, location, count, value);
+    glad_real_glUniform3uiv(location, count, value);
+    _post_call_callback("glUniform3uiv", (void*)glad_real_glUniform3uiv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    _pre_call_callback("glUniform4uiv", (void*)glad_real_glUniform4uiv, 3, location, count, value);
+    glad_real_glUniform4uiv(location, count, value);
+    _post_call_callback("glUniform4uiv", (void*)glad_real_glUniform4uiv, 3, location, count, value);
+}
+static void APIENTRY glad_debug_impl_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    _pre_call_callback("glTexParameterIiv", (void*)glad_real_glTexParameterIiv, 3, target, pname, params);
+    glad_real_glTexParameterIiv(target, pname, params);
+    _post_call_callback("glTexParameterIiv", (void*)glad_real_glTexParameterIiv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    _pre_call_callback("glTexParameterIuiv", (void*)glad_real_glTexParameterIuiv, 3, target, pname, params);
+    glad_real_glTexParameterIuiv(target, pname, params);
+    _post_call_callback("glTexParameterIuiv", (void*)glad_real_glTexParameterIuiv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetTexParameterIiv", (void*)glad_real_glGetTexParameterIiv, 3, target, pname, params);
+    glad_real_glGetTexParameterIiv(target, pname, params);
+    _post_call_callback("glGetTexParameterIiv", (void*)glad_real_glGetTexParameterIiv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    _pre_call_callback("glGetTexParameterIuiv", (void*)glad_real_glGetTexParameterIuiv, 3, target, pname, params);
+    glad_real_glGetTexParameterIuiv(target, pname, params);
+    _post_call_callback("glGetTexParameterIuiv", (void*)glad_real_glGetTexParameterIuiv, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    _pre_call_callback("glClearBufferiv", (void*)glad_real_glClearBufferiv, 3, buffer, drawbuffer, value);
+    glad_real_glClearBufferiv(buffer, drawbuffer, value);
+    _post_call_callback("glClearBufferiv", (void*)glad_real_glClearBufferiv, 3, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_debug_impl_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    _pre_call_callback("glClearBufferuiv", (void*)glad_real_glClearBufferuiv, 3, buffer, drawbuffer, value);
+    glad_real_glClearBufferuiv(buffer, drawbuffer, value);
+    _post_call_callback("glClearBufferuiv", (void*)glad_real_glClearBufferuiv, 3, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_debug_impl_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    _pre_call_callback("glClearBufferfv", (void*)glad_real_glClearBufferfv, 3, buffer, drawbuffer, value);
+    glad_real_glClearBufferfv(buffer, drawbuffer, value);
+    _post_call_callback("glClearBufferfv", (void*)glad_real_glClearBufferfv, 3, buffer, drawbuffer, value);
+}
+static void APIENTRY glad_debug_impl_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    _pre_call_callback("glClearBufferfi", (void*)glad_real_glClearBufferfi, 4, buffer, drawbuffer, depth, stencil);
+    glad_real_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+    _post_call_callback("glClearBufferfi", (void*)glad_real_glClearBufferfi, 4, buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_debug_impl_glGetStringi(GLenum name, GLuint index) {
+    const GLubyte * ret;
+    _pre_call_callback("glGetStringi", (void*)glad_real_glGetStringi, 2, name, index);
+    ret = glad_real_glGetStringi(name, index);
+    _post_call_callback("glGetStringi", (void*)glad_real_glGetStringi, 2, name, index);
+    return ret;
+}
+static GLboolean APIENTRY glad_debug_impl_glIsRenderbuffer(GLuint renderbuffer) {
+    GLboolean ret;
+    _pre_call_callback("glIsRenderbuffer", (void*)glad_real_glIsRenderbuffer, 1, renderbuffer);
+    ret = glad_real_glIsRenderbuffer(renderbuffer);
+    _post_call_callback("glIsRenderbuffer", (void*)glad_real_glIsRenderbuffer, 1, renderbuffer);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    _pre_call_callback("glBindRenderbuffer", (void*)glad_real_glBindRenderbuffer, 2, target, renderbuffer);
+    glad_real_glBindRenderbuffer(target, renderbuffer);
+    _post_call_callback("glBindRenderbuffer", (void*)glad_real_glBindRenderbuffer, 2, target, renderbuffer);
+}
+static void APIENTRY glad_debug_impl_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    _pre_call_callback("glDeleteRenderbuffers", (void*)glad_real_glDeleteRenderbuffers, 2, n, renderbuffers);
+    glad_real_glDeleteRenderbuffers(n, renderbuffers);
+    _post_call_callback("glDeleteRenderbuffers", (void*)glad_real_glDeleteRenderbuffers, 2, n, renderbuffers);
+}
+static void APIENTRY glad_debug_impl_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    _pre_call_callback("glGenRenderbuffers", (void*)glad_real_glGenRenderbuffers, 2, n, renderbuffers);
+    glad_real_glGenRenderbuffers(n, renderbuffers);
+    _post_call_callback("glGenRenderbuffers", (void*)glad_real_glGenRenderbuffers, 2, n, renderbuffers);
+}
+static void APIENTRY glad_debug_impl_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    _pre_call_callback("glRenderbufferStorage", (void*)glad_real_glRenderbufferStorage, 4, target, internalformat, width, height);
+    glad_real_glRenderbufferStorage(target, internalformat, width, height);
+    _post_call_callback("glRenderbufferStorage", (void*)glad_real_glRenderbufferStorage, 4, target, internalformat, width, height);
+}
+static void APIENTRY glad_debug_impl_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetRenderbufferParameteriv", (void*)glad_real_glGetRenderbufferParameteriv, 3, target, pname, params);
+    glad_real_glGetRenderbufferParameteriv(target, pname, params);
+    _post_call_callback("glGetRenderbufferParameteriv", (void*)glad_real_glGetRenderbufferParameteriv, 3, target, pname, params);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsFramebuffer(GLuint framebuffer) {
+    GLboolean ret;
+    _pre_call_callback("glIsFramebuffer", (void*)glad_real_glIsFramebuffer, 1, framebuffer);
+    ret = glad_real_glIsFramebuffer(framebuffer);
+    _post_call_callback("glIsFramebuffer", (void*)glad_real_glIsFramebuffer, 1, framebuffer);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    _pre_call_callback("glBindFramebuffer", (void*)glad_real_glBindFramebuffer, 2, target, framebuffer);
+    glad_real_glBindFramebuffer(target, framebuffer);
+    _post_call_callback("glBindFramebuffer", (void*)glad_real_glBindFramebuffer, 2, target, framebuffer);
+}
+static void APIENTRY glad_debug_impl_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    _pre_call_callback("glDeleteFramebuffers", (void*)glad_real_glDeleteFramebuffers, 2, n, framebuffers);
+    glad_real_glDeleteFramebuffers(n, framebuffers);
+    _post_call_callback("glDeleteFramebuffers", (void*)glad_real_glDeleteFramebuffers, 2, n, framebuffers);
+}
+static void APIENTRY glad_debug_impl_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    _pre_call_callback("glGenFramebuffers", (void*)glad_real_glGenFramebuffers, 2, n, framebuffers);
+    glad_real_glGenFramebuffers(n, framebuffers);
+    _post_call_callback("glGenFramebuffers", (void*)glad_real_glGenFramebuffers, 2, n, framebuffers);
+}
+static GLenum APIENTRY glad_debug_impl_glCheckFramebufferStatus(GLenum target) {
+    GLenum ret;
+    _pre_call_callback("glCheckFramebufferStatus", (void*)glad_real_glCheckFramebufferStatus, 1, target);
+    ret = glad_real_glCheckFramebufferStatus(target);
+    _post_call_callback("glCheckFramebufferStatus", (void*)glad_real_glCheckFramebufferStatus, 1, target);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    _pre_call_callback("glFramebufferTexture1D", (void*)glad_real_glFramebufferTexture1D, 5, target, attachment, textarget, texture, level);
+    glad_real_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+    _post_call_callback("glFramebufferTexture1D", (void*)glad_real_glFramebufferTexture1D, 5, target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_debug_impl_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    _pre_call_callback("glFramebufferTexture2D", (void*)glad_real_glFramebufferTexture2D, 5, target, attachment, textarget, texture, level);
+    glad_real_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+    _post_call_callback("glFramebufferTexture2D", (void*)glad_real_glFramebufferTexture2D, 5, target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_debug_impl_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    _pre_call_callback("glFramebufferTexture3D", (void*)glad_real_glFramebufferTexture3D, 6, target, attachment, textarget, texture, level, zoffset);
+    glad_real_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+    _post_call_callback("glFramebufferTexture3D", (void*)glad_real_glFramebufferTexture3D, 6, target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_debug_impl_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    _pre_call_callback("glFramebufferRenderbuffer", (void*)glad_real_glFramebufferRenderbuffer, 4, target, attachment, renderbuffertarget, renderbuffer);
+    glad_real_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+    _post_call_callback("glFramebufferRenderbuffer", (void*)glad_real_glFramebufferRenderbuffer, 4, target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_real_glGetFramebufferAttachmentParameteriv, 4, target, attachment, pname, params);
+    glad_real_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+    _post_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_real_glGetFramebufferAttachmentParameteriv, 4, target, attachment, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGenerateMipmap(GLenum target) {
+    _pre_call_callback("glGenerateMipmap", (void*)glad_real_glGenerateMipmap, 1, target);
+    glad_real_glGenerateMipmap(target);
+    _post_call_callback("glGenerateMipmap", (void*)glad_real_glGenerateMipmap, 1, target);
+}
+static void APIENTRY glad_debug_impl_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    _pre_call_callback("glBlitFramebuffer", (void*)glad_real_glBlitFramebuffer, 10, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    glad_real_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+    _post_call_callback("glBlitFramebuffer", (void*)glad_real_glBlitFramebuffer, 10, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_debug_impl_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    _pre_call_callback("glRenderbufferStorageMultisample", (void*)glad_real_glRenderbufferStorageMultisample, 5, target, samples, internalformat, width, height);
+    glad_real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+    _post_call_callback("glRenderbufferStorageMultisample", (void*)glad_real_glRenderbufferStorageMultisample, 5, target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_debug_impl_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    _pre_call_callback("glFramebufferTextureLayer", (void*)glad_real_glFramebufferTextureLayer, 5, target, attachment, texture, level, layer);
+    glad_real_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+    _post_call_callback("glFramebufferTextureLayer", (void*)glad_real_glFramebufferTextureLayer, 5, target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_debug_impl_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    void * ret;
+    _pre_call_callback("glMapBufferRange", (void*)glad_real_glMapBufferRange, 4, target, offset, length, access);
+    ret = glad_real_glMapBufferRange(target, offset, length, access);
+    _post_call_callback("glMapBufferRange", (void*)glad_real_glMapBufferRange, 4, target, offset, length, access);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    _pre_call_callback("glFlushMappedBufferRange", (void*)glad_real_glFlushMappedBufferRange, 3, target, offset, length);
+    glad_real_glFlushMappedBufferRange(target, offset, length);
+    _post_call_callback("glFlushMappedBufferRange", (void*)glad_real_glFlushMappedBufferRange, 3, target, offset, length);
+}
+static void APIENTRY glad_debug_impl_glBindVertexArray(GLuint array) {
+    _pre_call_callback("glBindVertexArray", (void*)glad_real_glBindVertexArray, 1, array);
+    glad_real_glBindVertexArray(array);
+    _post_call_callback("glBindVertexArray", (void*)glad_real_glBindVertexArray, 1, array);
+}
+static void APIENTRY glad_debug_impl_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    _pre_call_callback("glDeleteVertexArrays", (void*)glad_real_glDeleteVertexArrays, 2, n, arrays);
+    glad_real_glDeleteVertexArrays(n, arrays);
+    _post_call_callback("glDeleteVertexArrays", (void*)glad_real_glDeleteVertexArrays, 2, n, arrays);
+}
+static void APIENTRY glad_debug_impl_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    _pre_call_callback("glGenVertexArrays", (void*)glad_real_glGenVertexArrays, 2, n, arrays);
+    glad_real_glGenVertexArrays(n, arrays);
+    _post_call_callback("glGenVertexArrays", (void*)glad_real_glGenVertexArrays, 2, n, arrays);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsVertexArray(GLuint array) {
+    GLboolean ret;
+    _pre_call_callback("glIsVertexArray", (void*)glad_real_glIsVertexArray, 1, array);
+    ret = glad_real_glIsVertexArray(array);
+    _post_call_callback("glIsVertexArray", (void*)glad_real_glIsVertexArray, 1, array);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    _pre_call_callback("glDrawArraysInstanced", (void*)glad_real_glDrawArraysInstanced, 4, mode, first, count, instancecount);
+    glad_real_glDrawArraysInstanced(mode, first, count, instancecount);
+    _post_call_callback("glDrawArraysInstanced", (void*)glad_real_glDrawArraysInstanced, 4, mode, first, count, instancecount);
+}
+static void APIENTRY glad_debug_impl_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    _pre_call_callback("glDrawElementsInstanced", (void*)glad_real_glDrawElementsInstanced, 5, mode, count, type, indices, instancecount);
+    glad_real_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+    _post_call_callback("glDrawElementsInstanced", (void*)glad_real_glDrawElementsInstanced, 5, mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_debug_impl_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    _pre_call_callback("glTexBuffer", (void*)glad_real_glTexBuffer, 3, target, internalformat, buffer);
+    glad_real_glTexBuffer(target, internalformat, buffer);
+    _post_call_callback("glTexBuffer", (void*)glad_real_glTexBuffer, 3, target, internalformat, buffer);
+}
+static void APIENTRY glad_debug_impl_glPrimitiveRestartIndex(GLuint index) {
+    _pre_call_callback("glPrimitiveRestartIndex", (void*)glad_real_glPrimitiveRestartIndex, 1, index);
+    glad_real_glPrimitiveRestartIndex(index);
+    _post_call_callback("glPrimitiveRestartIndex", (void*)glad_real_glPrimitiveRestartIndex, 1, index);
+}
+static void APIENTRY glad_debug_impl_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    _pre_call_callback("glCopyBufferSubData", (void*)glad_real_glCopyBufferSubData, 5, readTarget, writeTarget, readOffset, writeOffset, size);
+    glad_real_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+    _post_call_callback("glCopyBufferSubData", (void*)glad_real_glCopyBufferSubData, 5, readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_debug_impl_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    _pre_call_callback("glGetUniformIndices", (void*)glad_real_glGetUniformIndices, 4, program, uniformCount, uniformNames, uniformIndices);
+    glad_real_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+    _post_call_callback("glGetUniformIndices", (void*)glad_real_glGetUniformIndices, 4, program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_debug_impl_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetActiveUniformsiv", (void*)glad_real_glGetActiveUniformsiv, 5, program, uniformCount, uniformIndices, pname, params);
+    glad_real_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+    _post_call_callback("glGetActiveUniformsiv", (void*)glad_real_glGetActiveUniformsiv, 5, program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    _pre_call_callback("glGetActiveUniformName", (void*)glad_real_glGetActiveUniformName, 5, program, uniformIndex, bufSize, length, uniformName);
+    glad_real_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+    _post_call_callback("glGetActiveUniformName", (void*)glad_real_glGetActiveUniformName, 5, program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_debug_impl_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    GLuint ret;
+    _pre_call_callback("glGetUniformBlockIndex", (void*)glad_real_glGetUniformBlockIndex, 2, program, uniformBlockName);
+    ret = glad_real_glGetUniformBlockIndex(program, uniformBlockName);
+    _post_call_callback("glGetUniformBlockIndex", (void*)glad_real_glGetUniformBlockIndex, 2, program, uniformBlockName);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetActiveUniformBlockiv", (void*)glad_real_glGetActiveUniformBlockiv, 4, program, uniformBlockIndex, pname, params);
+    glad_real_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+    _post_call_callback("glGetActiveUniformBlockiv", (void*)glad_real_glGetActiveUniformBlockiv, 4, program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    _pre_call_callback("glGetActiveUniformBlockName", (void*)glad_real_glGetActiveUniformBlockName, 5, program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    glad_real_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+    _post_call_callback("glGetActiveUniformBlockName", (void*)glad_real_glGetActiveUniformBlockName, 5, program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_debug_impl_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    _pre_call_callback("glUniformBlockBinding", (void*)glad_real_glUniformBlockBinding, 3, program, uniformBlockIndex, uniformBlockBinding);
+    glad_real_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+    _post_call_callback("glUniformBlockBinding", (void*)glad_real_glUniformBlockBinding, 3, program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_debug_impl_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    _pre_call_callback("glDrawElementsBaseVertex", (void*)glad_real_glDrawElementsBaseVertex, 5, mode, count, type, indices, basevertex);
+    glad_real_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+    _post_call_callback("glDrawElementsBaseVertex", (void*)glad_real_glDrawElementsBaseVertex, 5, mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    _pre_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_real_glDrawRangeElementsBaseVertex, 7, mode, start, end, count, type, indices, basevertex);
+    glad_real_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+    _post_call_callback("glDrawRangeElementsBaseVertex", (void*)glad_real_glDrawRangeElementsBaseVertex, 7, mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    _pre_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_real_glDrawElementsInstancedBaseVertex, 6, mode, count, type, indices, instancecount, basevertex);
+    glad_real_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+    _post_call_callback("glDrawElementsInstancedBaseVertex", (void*)glad_real_glDrawElementsInstancedBaseVertex, 6, mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    _pre_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_real_glMultiDrawElementsBaseVertex, 6, mode, count, type, indices, drawcount, basevertex);
+    glad_real_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+    _post_call_callback("glMultiDrawElementsBaseVertex", (void*)glad_real_glMultiDrawElementsBaseVertex, 6, mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_debug_impl_glProvokingVertex(GLenum mode) {
+    _pre_call_callback("glProvokingVertex", (void*)glad_real_glProvokingVertex, 1, mode);
+    glad_real_glProvokingVertex(mode);
+    _post_call_callback("glProvokingVertex", (void*)glad_real_glProvokingVertex, 1, mode);
+}
+static GLsync APIENTRY glad_debug_impl_glFenceSync(GLenum condition, GLbitfield flags) {
+    GLsync ret;
+    _pre_call_callback("glFenceSync", (void*)glad_real_glFenceSync, 2, condition, flags);
+    ret = glad_real_glFenceSync(condition, flags);
+    _post_call_callback("glFenceSync", (void*)glad_real_glFenceSync, 2, condition, flags);
+    return ret;
+}
+static GLboolean APIENTRY glad_debug_impl_glIsSync(GLsync sync) {
+    GLboolean ret;
+    _pre_call_callback("glIsSync", (void*)glad_real_glIsSync, 1, sync);
+    ret = glad_real_glIsSync(sync);
+    _post_call_callback("glIsSync", (void*)glad_real_glIsSync, 1, sync);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glDeleteSync(GLsync sync) {
+    _pre_call_callback("glDeleteSync", (void*)glad_real_glDeleteSync, 1, sync);
+    glad_real_glDeleteSync(sync);
+    _post_call_callback("glDeleteSync", (void*)glad_real_glDeleteSync, 1, sync);
+}
+static GLenum APIENTRY glad_debug_impl_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    GLenum ret;
+    _pre_call_callback("glClientWaitSync", (void*)glad_real_glClientWaitSync, 3, sync, flags, timeout);
+    ret = glad_real_glClientWaitSync(sync, flags, timeout);
+    _post_call_callback("glClientWaitSync", (void*)glad_real_glClientWaitSync, 3, sync, flags, timeout);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    _pre_call_callback("glWaitSync", (void*)glad_real_glWaitSync, 3, sync, flags, timeout);
+    glad_real_glWaitSync(sync, flags, timeout);
+    _post_call_callback("glWaitSync", (void*)glad_real_glWaitSync, 3, sync, flags, timeout);
+}
+static void APIENTRY glad_debug_impl_glGetInteger64v(GLenum pname, GLint64 *data) {
+    _pre_call_callback("glGetInteger64v", (void*)glad_real_glGetInteger64v, 2, pname, data);
+    glad_real_glGetInteger64v(pname, data);
+    _post_call_callback("glGetInteger64v", (void*)glad_real_glGetInteger64v, 2, pname, data);
+}
+static void APIENTRY glad_debug_impl_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+    _pre_call_callback("glGetSynciv", (void*)glad_real_glGetSynciv, 5, sync, pname, bufSize, length, values);
+    glad_real_glGetSynciv(sync, pname, bufSize, length, values);
+    _post_call_callback("glGetSynciv", (void*)glad_real_glGetSynciv, 5, sync, pname, bufSize, length, values);
+}
+static void APIENTRY glad_debug_impl_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    _pre_call_callback("glGetInteger64i_v", (void*)glad_real_glGetInteger64i_v, 3, target, index, data);
+    glad_real_glGetInteger64i_v(target, index, data);
+    _post_call_callback("glGetInteger64i_v", (void*)glad_real_glGetInteger64i_v, 3, target, index, data);
+}
+static void APIENTRY glad_debug_impl_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    _pre_call_callback("glGetBufferParameteri64v", (void*)glad_real_glGetBufferParameteri64v, 3, target, pname, params);
+    glad_real_glGetBufferParameteri64v(target, pname, params);
+    _post_call_callback("glGetBufferParameteri64v", (void*)glad_real_glGetBufferParameteri64v, 3, target, pname, params);
+}
+static void APIENTRY glad_debug_impl_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    _pre_call_callback("glFramebufferTexture", (void*)glad_real_glFramebufferTexture, 4, target, attachment, texture, level);
+    glad_real_glFramebufferTexture(target, attachment, texture, level);
+    _post_call_callback("glFramebufferTexture", (void*)glad_real_glFramebufferTexture, 4, target, attachment, texture, level);
+}
+static void APIENTRY glad_debug_impl_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    _pre_call_callback("glTexImage2DMultisample", (void*)glad_real_glTexImage2DMultisample, 6, target, samples, internalformat, width, height, fixedsamplelocations);
+    glad_real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+    _post_call_callback("glTexImage2DMultisample", (void*)glad_real_glTexImage2DMultisample, 6, target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_debug_impl_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    _pre_call_callback("glTexImage3DMultisample", (void*)glad_real_glTexImage3DMultisample, 7, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    glad_real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+    _post_call_callback("glTexImage3DMultisample", (void*)glad_real_glTexImage3DMultisample, 7, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_debug_impl_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    _pre_call_callback("glGetMultisamplefv", (void*)glad_real_glGetMultisamplefv, 3, pname, index, val);
+    glad_real_glGetMultisamplefv(pname, index, val);
+    _post_call_callback("glGetMultisamplefv", (void*)glad_real_glGetMultisamplefv, 3, pname, index, val);
+}
+static void APIENTRY glad_debug_impl_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    _pre_call_callback("glSampleMaski", (void*)glad_real_glSampleMaski, 2, maskNumber, mask);
+    glad_real_glSampleMaski(maskNumber, mask);
+    _post_call_callback("glSampleMaski", (void*)glad_real_glSampleMaski, 2, maskNumber, mask);
+}
+static void APIENTRY glad_debug_impl_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    _pre_call_callback("glBindFragDataLocationIndexed", (void*)glad_real_glBindFragDataLocationIndexed, 4, program, colorNumber, index, name);
+    glad_real_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+    _post_call_callback("glBindFragDataLocationIndexed", (void*)glad_real_glBindFragDataLocationIndexed, 4, program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_debug_impl_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    GLint ret;
+    _pre_call_callback("glGetFragDataIndex", (void*)glad_real_glGetFragDataIndex, 2, program, name);
+    ret = glad_real_glGetFragDataIndex(program, name);
+    _post_call_callback("glGetFragDataIndex", (void*)glad_real_glGetFragDataIndex, 2, program, name);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glGenSamplers(GLsizei count, GLuint *samplers) {
+    _pre_call_callback("glGenSamplers", (void*)glad_real_glGenSamplers, 2, count, samplers);
+    glad_real_glGenSamplers(count, samplers);
+    _post_call_callback("glGenSamplers", (void*)glad_real_glGenSamplers, 2, count, samplers);
+}
+static void APIENTRY glad_debug_impl_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    _pre_call_callback("glDeleteSamplers", (void*)glad_real_glDeleteSamplers, 2, count, samplers);
+    glad_real_glDeleteSamplers(count, samplers);
+    _post_call_callback("glDeleteSamplers", (void*)glad_real_glDeleteSamplers, 2, count, samplers);
+}
+static GLboolean APIENTRY glad_debug_impl_glIsSampler(GLuint sampler) {
+    GLboolean ret;
+    _pre_call_callback("glIsSampler", (void*)glad_real_glIsSampler, 1, sampler);
+    ret = glad_real_glIsSampler(sampler);
+    _post_call_callback("glIsSampler", (void*)glad_real_glIsSampler, 1, sampler);
+    return ret;
+}
+static void APIENTRY glad_debug_impl_glBindSampler(GLuint unit, GLuint sampler) {
+    _pre_call_callback("glBindSampler", (void*)glad_real_glBindSampler, 2, unit, sampler);
+    glad_real_glBindSampler(unit, sampler);
+    _post_call_callback("glBindSampler", (void*)glad_real_glBindSampler, 2, unit, sampler);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    _pre_call_callback("glSamplerParameteri", (void*)glad_real_glSamplerParameteri, 3, sampler, pname, param);
+    glad_real_glSamplerParameteri(sampler, pname, param);
+    _post_call_callback("glSamplerParameteri", (void*)glad_real_glSamplerParameteri, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    _pre_call_callback("glSamplerParameteriv", (void*)glad_real_glSamplerParameteriv, 3, sampler, pname, param);
+    glad_real_glSamplerParameteriv(sampler, pname, param);
+    _post_call_callback("glSamplerParameteriv", (void*)glad_real_glSamplerParameteriv, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    _pre_call_callback("glSamplerParameterf", (void*)glad_real_glSamplerParameterf, 3, sampler, pname, param);
+    glad_real_glSamplerParameterf(sampler, pname, param);
+    _post_call_callback("glSamplerParameterf", (void*)glad_real_glSamplerParameterf, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    _pre_call_callback("glSamplerParameterfv", (void*)glad_real_glSamplerParameterfv, 3, sampler, pname, param);
+    glad_real_glSamplerParameterfv(sampler, pname, param);
+    _post_call_callback("glSamplerParameterfv", (void*)glad_real_glSamplerParameterfv, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    _pre_call_callback("glSamplerParameterIiv", (void*)glad_real_glSamplerParameterIiv, 3, sampler, pname, param);
+    glad_real_glSamplerParameterIiv(sampler, pname, param);
+    _post_call_callback("glSamplerParameterIiv", (void*)glad_real_glSamplerParameterIiv, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    _pre_call_callback("glSamplerParameterIuiv", (void*)glad_real_glSamplerParameterIuiv, 3, sampler, pname, param);
+    glad_real_glSamplerParameterIuiv(sampler, pname, param);
+    _post_call_callback("glSamplerParameterIuiv", (void*)glad_real_glSamplerParameterIuiv, 3, sampler, pname, param);
+}
+static void APIENTRY glad_debug_impl_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetSamplerParameteriv", (void*)glad_real_glGetSamplerParameteriv, 3, sampler, pname, params);
+    glad_real_glGetSamplerParameteriv(sampler, pname, params);
+    _post_call_callback("glGetSamplerParameteriv", (void*)glad_real_glGetSamplerParameteriv, 3, sampler, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    _pre_call_callback("glGetSamplerParameterIiv", (void*)glad_real_glGetSamplerParameterIiv, 3, sampler, pname, params);
+    glad_real_glGetSamplerParameterIiv(sampler, pname, params);
+    _post_call_callback("glGetSamplerParameterIiv", (void*)glad_real_glGetSamplerParameterIiv, 3, sampler, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    _pre_call_callback("glGetSamplerParameterfv", (void*)glad_real_glGetSamplerParameterfv, 3, sampler, pname, params);
+    glad_real_glGetSamplerParameterfv(sampler, pname, params);
+    _post_call_callback("glGetSamplerParameterfv", (void*)glad_real_glGetSamplerParameterfv, 3, sampler, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    _pre_call_callback("glGetSamplerParameterIuiv", (void*)glad_real_glGetSamplerParameterIuiv, 3, sampler, pname, params);
+    glad_real_glGetSamplerParameterIuiv(sampler, pname, params);
+    _post_call_callback("glGetSamplerParameterIuiv", (void*)glad_real_glGetSamplerParameterIuiv, 3, sampler, pname, params);
+}
+static void APIENTRY glad_debug_impl_glQueryCounter(GLuint id, GLenum target) {
+    _pre_call_callback("glQueryCounter", (void*)glad_real_glQueryCounter, 2, id, target);
+    glad_real_glQueryCounter(id, target);
+    _post_call_callback("glQueryCounter", (void*)glad_real_glQueryCounter, 2, id, target);
+}
+static void APIENTRY glad_debug_impl_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    _pre_call_callback("glGetQueryObjecti64v", (void*)glad_real_glGetQueryObjecti64v, 3, id, pname, params);
+    glad_real_glGetQueryObjecti64v(id, pname, params);
+    _post_call_callback("glGetQueryObjecti64v", (void*)glad_real_glGetQueryObjecti64v, 3, id, pname, params);
+}
+static void APIENTRY glad_debug_impl_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    _pre_call_callback("glGetQueryObjectui64v", (void*)glad_real_glGetQueryObjectui64v, 3, id, pname, params);
+    glad_real_glGetQueryObjectui64v(id, pname, params);
+    _post_call_callback("glGetQueryObjectui64v", (void*)glad_real_glGetQueryObjectui64v, 3, id, pname, params);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    _pre_call_callback("glVertexAttribDivisor", (void*)glad_real_glVertexAttribDivisor, 2, index, divisor);
+    glad_real_glVertexAttribDivisor(index, divisor);
+    _post_call_callback("glVertexAttribDivisor", (void*)glad_real_glVertexAttribDivisor, 2, index, divisor);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    _pre_call_callback("glVertexAttribP1ui", (void*)glad_real_glVertexAttribP1ui, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP1ui(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP1ui", (void*)glad_real_glVertexAttribP1ui, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    _pre_call_callback("glVertexAttribP1uiv", (void*)glad_real_glVertexAttribP1uiv, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP1uiv(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP1uiv", (void*)glad_real_glVertexAttribP1uiv, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    _pre_call_callback("glVertexAttribP2ui", (void*)glad_real_glVertexAttribP2ui, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP2ui(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP2ui", (void*)glad_real_glVertexAttribP2ui, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    _pre_call_callback("glVertexAttribP2uiv", (void*)glad_real_glVertexAttribP2uiv, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP2uiv(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP2uiv", (void*)glad_real_glVertexAttribP2uiv, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    _pre_call_callback("glVertexAttribP3ui", (void*)glad_real_glVertexAttribP3ui, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP3ui(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP3ui", (void*)glad_real_glVertexAttribP3ui, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    _pre_call_callback("glVertexAttribP3uiv", (void*)glad_real_glVertexAttribP3uiv, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP3uiv(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP3uiv", (void*)glad_real_glVertexAttribP3uiv, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    _pre_call_callback("glVertexAttribP4ui", (void*)glad_real_glVertexAttribP4ui, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP4ui(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP4ui", (void*)glad_real_glVertexAttribP4ui, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    _pre_call_callback("glVertexAttribP4uiv", (void*)glad_real_glVertexAttribP4uiv, 4, index, type, normalized, value);
+    glad_real_glVertexAttribP4uiv(index, type, normalized, value);
+    _post_call_callback("glVertexAttribP4uiv", (void*)glad_real_glVertexAttribP4uiv, 4, index, type, normalized, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP2ui(GLenum type, GLuint value) {
+    _pre_call_callback("glVertexP2ui", (void*)glad_real_glVertexP2ui, 2, type, value);
+    glad_real_glVertexP2ui(type, value);
+    _post_call_callback("glVertexP2ui", (void*)glad_real_glVertexP2ui, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP2uiv(GLenum type, const GLuint *value) {
+    _pre_call_callback("glVertexP2uiv", (void*)glad_real_glVertexP2uiv, 2, type, value);
+    glad_real_glVertexP2uiv(type, value);
+    _post_call_callback("glVertexP2uiv", (void*)glad_real_glVertexP2uiv, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP3ui(GLenum type, GLuint value) {
+    _pre_call_callback("glVertexP3ui", (void*)glad_real_glVertexP3ui, 2, type, value);
+    glad_real_glVertexP3ui(type, value);
+    _post_call_callback("glVertexP3ui", (void*)glad_real_glVertexP3ui, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP3uiv(GLenum type, const GLuint *value) {
+    _pre_call_callback("glVertexP3uiv", (void*)glad_real_glVertexP3uiv, 2, type, value);
+    glad_real_glVertexP3uiv(type, value);
+    _post_call_callback("glVertexP3uiv", (void*)glad_real_glVertexP3uiv, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP4ui(GLenum type, GLuint value) {
+    _pre_call_callback("glVertexP4ui", (void*)glad_real_glVertexP4ui, 2, type, value);
+    glad_real_glVertexP4ui(type, value);
+    _post_call_callback("glVertexP4ui", (void*)glad_real_glVertexP4ui, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glVertexP4uiv(GLenum type, const GLuint *value) {
+    _pre_call_callback("glVertexP4uiv", (void*)glad_real_glVertexP4uiv, 2, type, value);
+    glad_real_glVertexP4uiv(type, value);
+    _post_call_callback("glVertexP4uiv", (void*)glad_real_glVertexP4uiv, 2, type, value);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP1ui(GLenum type, GLuint coords) {
+    _pre_call_callback("glTexCoordP1ui", (void*)glad_real_glTexCoordP1ui, 2, type, coords);
+    glad_real_glTexCoordP1ui(type, coords);
+    _post_call_callback("glTexCoordP1ui", (void*)glad_real_glTexCoordP1ui, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    _pre_call_callback("glTexCoordP1uiv", (void*)glad_real_glTexCoordP1uiv, 2, type, coords);
+    glad_real_glTexCoordP1uiv(type, coords);
+    _post_call_callback("glTexCoordP1uiv", (void*)glad_real_glTexCoordP1uiv, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP2ui(GLenum type, GLuint coords) {
+    _pre_call_callback("glTexCoordP2ui", (void*)glad_real_glTexCoordP2ui, 2, type, coords);
+    glad_real_glTexCoordP2ui(type, coords);
+    _post_call_callback("glTexCoordP2ui", (void*)glad_real_glTexCoordP2ui, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    _pre_call_callback("glTexCoordP2uiv", (void*)glad_real_glTexCoordP2uiv, 2, type, coords);
+    glad_real_glTexCoordP2uiv(type, coords);
+    _post_call_callback("glTexCoordP2uiv", (void*)glad_real_glTexCoordP2uiv, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP3ui(GLenum type, GLuint coords) {
+    _pre_call_callback("glTexCoordP3ui", (void*)glad_real_glTexCoordP3ui, 2, type, coords);
+    glad_real_glTexCoordP3ui(type, coords);
+    _post_call_callback("glTexCoordP3ui", (void*)glad_real_glTexCoordP3ui, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    _pre_call_callback("glTexCoordP3uiv", (void*)glad_real_glTexCoordP3uiv, 2, type, coords);
+    glad_real_glTexCoordP3uiv(type, coords);
+    _post_call_callback("glTexCoordP3uiv", (void*)glad_real_glTexCoordP3uiv, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP4ui(GLenum type, GLuint coords) {
+    _pre_call_callback("glTexCoordP4ui", (void*)glad_real_glTexCoordP4ui, 2, type, coords);
+    glad_real_glTexCoordP4ui(type, coords);
+    _post_call_callback("glTexCoordP4ui", (void*)glad_real_glTexCoordP4ui, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    _pre_call_callback("glTexCoordP4uiv", (void*)glad_real_glTexCoordP4uiv, 2, type, coords);
+    glad_real_glTexCoordP4uiv(type, coords);
+    _post_call_callback("glTexCoordP4uiv", (void*)glad_real_glTexCoordP4uiv, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    _pre_call_callback("glMultiTexCoordP1ui", (void*)glad_real_glMultiTexCoordP1ui, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP1ui(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP1ui", (void*)glad_real_glMultiTexCoordP1ui, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    _pre_call_callback("glMultiTexCoordP1uiv", (void*)glad_real_glMultiTexCoordP1uiv, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP1uiv(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP1uiv", (void*)glad_real_glMultiTexCoordP1uiv, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    _pre_call_callback("glMultiTexCoordP2ui", (void*)glad_real_glMultiTexCoordP2ui, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP2ui(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP2ui", (void*)glad_real_glMultiTexCoordP2ui, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    _pre_call_callback("glMultiTexCoordP2uiv", (void*)glad_real_glMultiTexCoordP2uiv, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP2uiv(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP2uiv", (void*)glad_real_glMultiTexCoordP2uiv, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    _pre_call_callback("glMultiTexCoordP3ui", (void*)glad_real_glMultiTexCoordP3ui, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP3ui(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP3ui", (void*)glad_real_glMultiTexCoordP3ui, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    _pre_call_callback("glMultiTexCoordP3uiv", (void*)glad_real_glMultiTexCoordP3uiv, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP3uiv(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP3uiv", (void*)glad_real_glMultiTexCoordP3uiv, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    _pre_call_callback("glMultiTexCoordP4ui", (void*)glad_real_glMultiTexCoordP4ui, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP4ui(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP4ui", (void*)glad_real_glMultiTexCoordP4ui, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    _pre_call_callback("glMultiTexCoordP4uiv", (void*)glad_real_glMultiTexCoordP4uiv, 3, texture, type, coords);
+    glad_real_glMultiTexCoordP4uiv(texture, type, coords);
+    _post_call_callback("glMultiTexCoordP4uiv", (void*)glad_real_glMultiTexCoordP4uiv, 3, texture, type, coords);
+}
+static void APIENTRY glad_debug_impl_glNormalP3ui(GLenum type, GLuint coords) {
+    _pre_call_callback("glNormalP3ui", (void*)glad_real_glNormalP3ui, 2, type, coords);
+    glad_real_glNormalP3ui(type, coords);
+    _post_call_callback("glNormalP3ui", (void*)glad_real_glNormalP3ui, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    _pre_call_callback("glNormalP3uiv", (void*)glad_real_glNormalP3uiv, 2, type, coords);
+    glad_real_glNormalP3uiv(type, coords);
+    _post_call_callback("glNormalP3uiv", (void*)glad_real_glNormalP3uiv, 2, type, coords);
+}
+static void APIENTRY glad_debug_impl_glColorP3ui(GLenum type, GLuint color) {
+    _pre_call_callback("glColorP3ui", (void*)glad_real_glColorP3ui, 2, type, color);
+    glad_real_glColorP3ui(type, color);
+    _post_call_callback("glColorP3ui", (void*)glad_real_glColorP3ui, 2, type, color);
+}
+static void APIENTRY glad_debug_impl_glColorP3uiv(GLenum type, const GLuint *color) {
+    _pre_call_callback("glColorP3uiv", (void*)glad_real_glColorP3uiv, 2, type, color);
+    glad_real_glColorP3uiv(type, color);
+    _post_call_callback("glColorP3uiv", (void*)glad_real_glColorP3uiv, 2, type, color);
+}
+static void APIENTRY glad_debug_impl_glColorP4ui(GLenum type, GLuint color) {
+    _pre_call_callback("glColorP4ui", (void*)glad_real_glColorP4ui, 2, type, color);
+    glad_real_glColorP4ui(type, color);
+    _post_call_callback("glColorP4ui", (void*)glad_real_glColorP4ui, 2, type, color);
+}
+static void APIENTRY glad_debug_impl_glColorP4uiv(GLenum type, const GLuint *color) {
+    _pre_call_callback("glColorP4uiv", (void*)glad_real_glColorP4uiv, 2, type, color);
+    glad_real_glColorP4uiv(type, color);
+    _post_call_callback("glColorP4uiv", (void*)glad_real_glColorP4uiv, 2, type, color);
+}
+static void APIENTRY glad_debug_impl_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    _pre_call_callback("glSecondaryColorP3ui", (void*)glad_real_glSecondaryColorP3ui, 2, type, color);
+    glad_real_glSecondaryColorP3ui(type, color);
+    _post_call_callback("glSecondaryColorP3ui", (void*)glad_real_glSecondaryColorP3ui, 2, type, color);
+}
+static void APIENTRY glad_debug_impl_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    _pre_call_callback("glSecondaryColorP3uiv", (void*)glad_real_glSecondaryColorP3uiv, 2, type, color);
+    glad_real_glSecondaryColorP3uiv(type, color);
+    _post_call_callback("glSecondaryColorP3uiv", (void*)glad_real_glSecondaryColorP3uiv, 2, type, color);
+}
+static void glad_install_debug(void) {
+    glad_real_glCullFace = glad_glCullFace;
+    if (glad_glCullFace != NULL) glad_glCullFace = glad_debug_impl_glCullFace;
+    glad_real_glFrontFace = glad_glFrontFace;
+    if (glad_glFrontFace != NULL) glad_glFrontFace = glad_debug_impl_glFrontFace;
+    glad_real_glHint = glad_glHint;
+    if (glad_glHint != NULL) glad_glHint = glad_debug_impl_glHint;
+    glad_real_glLineWidth = glad_glLineWidth;
+    if (glad_glLineWidth != NULL) glad_glLineWidth = glad_debug_impl_glLineWidth;
+    glad_real_glPointSize = glad_glPointSize;
+    if (glad_glPointSize != NULL) glad_glPointSize = glad_debug_impl_glPointSize;
+    glad_real_glPolygonMode = glad_glPolygonMode;
+    if (glad_glPolygonMode != NULL) glad_glPolygonMode = glad_debug_impl_glPolygonMode;
+    glad_real_glScissor = glad_glScissor;
+    if (glad_glScissor != NULL) glad_glScissor = glad_debug_impl_glScissor;
+    glad_real_glTexParameterf = glad_glTexParameterf;
+    if (glad_glTexParameterf != NULL) glad_glTexParameterf = glad_debug_impl_glTexParameterf;
+    glad_real_glTexParameterfv = glad_glTexParameterfv;
+    if (glad_glTexParameterfv != NULL) glad_glTexParameterfv = glad_debug_impl_glTexParameterfv;
+    glad_real_glTexParameteri = glad_glTexParameteri;
+    if (glad_glTexParameteri != NULL) glad_glTexParameteri = glad_debug_impl_glTexParameteri;
+    glad_real_glTexParameteriv = glad_glTexParameteriv;
+    if (glad_glTexParameteriv != NULL) glad_glTexParameteriv = glad_debug_impl_glTexParameteriv;
+    glad_real_glTexImage1D = glad_glTexImage1D;
+    if (glad_glTexImage1D != NULL) glad_glTexImage1D = glad_debug_impl_glTexImage1D;
+    glad_real_glTexImage2D = glad_glTexImage2D;
+    if (glad_glTexImage2D != NULL) glad_glTexImage2D = glad_debug_impl_glTexImage2D;
+    glad_real_glDrawBuffer = glad_glDrawBuffer;
+    if (glad_glDrawBuffer != NULL) glad_glDrawBuffer = glad_debug_impl_glDrawBuffer;
+    glad_real_glClear = glad_glClear;
+    if (glad_glClear != NULL) glad_glClear = glad_debug_impl_glClear;
+    glad_real_glClearColor = glad_glClearColor;
+    if (glad_glClearColor != NULL) glad_glClearColor = glad_debug_impl_glClearColor;
+    glad_real_glClearStencil = glad_glClearStencil;
+    if (glad_glClearStencil != NULL) glad_glClearStencil = glad_debug_impl_glClearStencil;
+    glad_real_glClearDepth = glad_glClearDepth;
+    if (glad_glClearDepth != NULL) glad_glClearDepth = glad_debug_impl_glClearDepth;
+    glad_real_glStencilMask = glad_glStencilMask;
+    if (glad_glStencilMask != NULL) glad_glStencilMask = glad_debug_impl_glStencilMask;
+    glad_real_glColorMask = glad_glColorMask;
+    if (glad_glColorMask != NULL) glad_glColorMask = glad_debug_impl_glColorMask;
+    glad_real_glDepthMask = glad_glDepthMask;
+    if (glad_glDepthMask != NULL) glad_glDepthMask = glad_debug_impl_glDepthMask;
+    glad_real_glDisable = glad_glDisable;
+    if (glad_glDisable != NULL) glad_glDisable = glad_debug_impl_glDisable;
+    glad_real_glEnable = glad_glEnable;
+    if (glad_glEnable != NULL) glad_glEnable = glad_debug_impl_glEnable;
+    glad_real_glFinish = glad_glFinish;
+    if (glad_glFinish != NULL) glad_glFinish = glad_debug_impl_glFinish;
+    glad_real_glFlush = glad_glFlush;
+    if (glad_glFlush != NULL) glad_glFlush = glad_debug_impl_glFlush;
+    glad_real_glBlendFunc = glad_glBlendFunc;
+    if (glad_glBlendFunc != NULL) glad_glBlendFunc = glad_debug_impl_glBlendFunc;
+    glad_real_glLogicOp = glad_glLogicOp;
+    if (glad_glLogicOp != NULL) glad_glLogicOp = glad_debug_impl_glLogicOp;
+    glad_real_glStencilFunc = glad_glStencilFunc;
+    if (glad_glStencilFunc != NULL) glad_glStencilFunc = glad_debug_impl_glStencilFunc;
+    glad_real_glStencilOp = glad_glStencilOp;
+    if (glad_glStencilOp != NULL) glad_glStencilOp = glad_debug_impl_glStencilOp;
+    glad_real_glDepthFunc = glad_glDepthFunc;
+    if (glad_glDepthFunc != NULL) glad_glDepthFunc = glad_debug_impl_glDepthFunc;
+    glad_real_glPixelStoref = glad_glPixelStoref;
+    if (glad_glPixelStoref != NULL) glad_glPixelStoref = glad_debug_impl_glPixelStoref;
+    glad_real_glPixelStorei = glad_glPixelStorei;
+    if (glad_glPixelStorei != NULL) glad_glPixelStorei = glad_debug_impl_glPixelStorei;
+    glad_real_glReadBuffer = glad_glReadBuffer;
+    if (glad_glReadBuffer != NULL) glad_glReadBuffer = glad_debug_impl_glReadBuffer;
+    glad_real_glReadPixels = glad_glReadPixels;
+    if (glad_glReadPixels != NULL) glad_glReadPixels = glad_debug_impl_glReadPixels;
+    glad_real_glGetBooleanv = glad_glGetBooleanv;
+    if (glad_glGetBooleanv != NULL) glad_glGetBooleanv = glad_debug_impl_glGetBooleanv;
+    glad_real_glGetDoublev = glad_glGetDoublev;
+    if (glad_glGetDoublev != NULL) glad_glGetDoublev = glad_debug_impl_glGetDoublev;
+    glad_real_glGetError = glad_glGetError;
+    if (glad_glGetError != NULL) glad_glGetError = glad_debug_impl_glGetError;
+    glad_real_glGetFloatv = glad_glGetFloatv;
+    if (glad_glGetFloatv != NULL) glad_glGetFloatv = glad_debug_impl_glGetFloatv;
+    glad_real_glGetIntegerv = glad_glGetIntegerv;
+    if (glad_glGetIntegerv != NULL) glad_glGetIntegerv = glad_debug_impl_glGetIntegerv;
+    glad_real_glGetString = glad_glGetString;
+    if (glad_glGetString != NULL) glad_glGetString = glad_debug_impl_glGetString;
+    glad_real_glGetTexImage = glad_glGetTexImage;
+    if (glad_glGetTexImage != NULL) glad_glGetTexImage = glad_debug_impl_glGetTexImage;
+    glad_real_glGetTexParameterfv = glad_glGetTexParameterfv;
+    if (glad_glGetTexParameterfv != NULL) glad_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
+    glad_real_glGetTexParameteriv = glad_glGetTexParameteriv;
+    if (glad_glGetTexParameteriv != NULL) glad_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
+    glad_real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+    if (glad_glGetTexLevelParameterfv != NULL) glad_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
+    glad_real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+    if (glad_glGetTexLevelParameteriv != NULL) glad_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
+    glad_real_glIsEnabled = glad_glIsEnabled;
+    if (glad_glIsEnabled != NULL) glad_glIsEnabled = glad_debug_impl_glIsEnabled;
+    glad_real_glDepthRange = glad_glDepthRange;
+    if (glad_glDepthRange != NULL) glad_glDepthRange = glad_debug_impl_glDepthRange;
+    glad_real_glViewport = glad_glViewport;
+    if (glad_glViewport != NULL) glad_glViewport = glad_debug_impl_glViewport;
+    glad_real_glDrawArrays = glad_glDrawArrays;
+    if (glad_glDrawArrays != NULL) glad_glDrawArrays = glad_debug_impl_glDrawArrays;
+    glad_real_glDrawElements = glad_glDrawElements;
+    if (glad_glDrawElements != NULL) glad_glDrawElements = glad_debug_impl_glDrawElements;
+    glad_real_glPolygonOffset = glad_glPolygonOffset;
+    if (glad_glPolygonOffset != NULL) glad_glPolygonOffset = glad_debug_impl_glPolygonOffset;
+    glad_real_glCopyTexImage1D = glad_glCopyTexImage1D;
+    if (glad_glCopyTexImage1D != NULL) glad_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
+    glad_real_glCopyTexImage2D = glad_glCopyTexImage2D;
+    if (glad_glCopyTexImage2D != NULL) glad_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
+    glad_real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D;
+    if (glad_glCopyTexSubImage1D != NULL) glad_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
+    glad_real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D;
+    if (glad_glCopyTexSubImage2D != NULL) glad_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
+    glad_real_glTexSubImage1D = glad_glTexSubImage1D;
+    if (glad_glTexSubImage1D != NULL) glad_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
+    glad_real_glTexSubImage2D = glad_glTexSubImage2D;
+    if (glad_glTexSubImage2D != NULL) glad_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
+    glad_real_glBindTexture = glad_glBindTexture;
+    if (glad_glBindTexture != NULL) glad_glBindTexture = glad_debug_impl_glBindTexture;
+    glad_real_glDeleteTextures = glad_glDeleteTextures;
+    if (glad_glDeleteTextures != NULL) glad_glDeleteTextures = glad_debug_impl_glDeleteTextures;
+    glad_real_glGenTextures = glad_glGenTextures;
+    if (glad_glGenTextures != NULL) glad_glGenTextures = glad_debug_impl_glGenTextures;
+    glad_real_glIsTexture = glad_glIsTexture;
+    if (glad_glIsTexture != NULL) glad_glIsTexture = glad_debug_impl_glIsTexture;
+    glad_real_glDrawRangeElements = glad_glDrawRangeElements;
+    if (glad_glDrawRangeElements != NULL) glad_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
+    glad_real_glTexImage3D = glad_glTexImage3D;
+    if (glad_glTexImage3D != NULL) glad_glTexImage3D = glad_debug_impl_glTexImage3D;
+    glad_real_glTexSubImage3D = glad_glTexSubImage3D;
+    if (glad_glTexSubImage3D != NULL) glad_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
+    glad_real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D;
+    if (glad_glCopyTexSubImage3D != NULL) glad_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
+    glad_real_glActiveTexture = glad_glActiveTexture;
+    if (glad_glActiveTexture != NULL) glad_glActiveTexture = glad_debug_impl_glActiveTexture;
+    glad_real_glSampleCoverage = glad_glSampleCoverage;
+    if (glad_glSampleCoverage != NULL) glad_glSampleCoverage = glad_debug_impl_glSampleCoverage;
+    glad_real_glCompressedTexImage3D = glad_glCompressedTexImage3D;
+    if (glad_glCompressedTexImage3D != NULL) glad_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
+    glad_real_glCompressedTexImage2D = glad_glCompressedTexImage2D;
+    if (glad_glCompressedTexImage2D != NULL) glad_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
+    glad_real_glCompressedTexImage1D = glad_glCompressedTexImage1D;
+    if (glad_glCompressedTexImage1D != NULL) glad_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
+    glad_real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+    if (glad_glCompressedTexSubImage3D != NULL) glad_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
+    glad_real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+    if (glad_glCompressedTexSubImage2D != NULL) glad_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
+    glad_real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+    if (glad_glCompressedTexSubImage1D != NULL) glad_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
+    glad_real_glGetCompressedTexImage = glad_glGetCompressedTexImage;
+    if (glad_glGetCompressedTexImage != NULL) glad_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+    glad_real_glBlendFuncSeparate = glad_glBlendFuncSeparate;
+    if (glad_glBlendFuncSeparate != NULL) glad_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
+    glad_real_glMultiDrawArrays = glad_glMultiDrawArrays;
+    if (glad_glMultiDrawArrays != NULL) glad_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
+    glad_real_glMultiDrawElements = glad_glMultiDrawElements;
+    if (glad_glMultiDrawElements != NULL) glad_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
+    glad_real_glPointParameterf = glad_glPointParameterf;
+    if (glad_glPointParameterf != NULL) glad_glPointParameterf = glad_debug_impl_glPointParameterf;
+    glad_real_glPointParameterfv = glad_glPointParameterfv;
+    if (glad_glPointParameterfv != NULL) glad_glPointParameterfv = glad_debug_impl_glPointParameterfv;
+    glad_real_glPointParameteri = glad_glPointParameteri;
+    if (glad_glPointParameteri != NULL) glad_glPointParameteri = glad_debug_impl_glPointParameteri;
+    glad_real_glPointParameteriv = glad_glPointParameteriv;
+    if (glad_glPointParameteriv != NULL) glad_glPointParameteriv = glad_debug_impl_glPointParameteriv;
+    glad_real_glBlendColor = glad_glBlendColor;
+    if (glad_glBlendColor != NULL) glad_glBlendColor = glad_debug_impl_glBlendColor;
+    glad_real_glBlendEquation = glad_glBlendEquation;
+    if (glad_glBlendEquation != NULL) glad_glBlendEquation = glad_debug_impl_glBlendEquation;
+    glad_real_glGenQueries = glad_glGenQueries;
+    if (glad_glGenQueries != NULL) glad_glGenQueries = glad_debug_impl_glGenQueries;
+    glad_real_glDeleteQueries = glad_glDeleteQueries;
+    if (glad_glDeleteQueries != NULL) glad_glDeleteQueries = glad_debug_impl_glDeleteQueries;
+    glad_real_glIsQuery = glad_glIsQuery;
+    if (glad_glIsQuery != NULL) glad_glIsQuery = glad_debug_impl_glIsQuery;
+    glad_real_glBeginQuery = glad_glBeginQuery;
+    if (glad_glBeginQuery != NULL) glad_glBeginQuery = glad_debug_impl_glBeginQuery;
+    glad_real_glEndQuery = glad_glEndQuery;
+    if (glad_glEndQuery != NULL) glad_glEndQuery = glad_debug_impl_glEndQuery;
+    glad_real_glGetQueryiv = glad_glGetQueryiv;
+    if (glad_glGetQueryiv != NULL) glad_glGetQueryiv = glad_debug_impl_glGetQueryiv;
+    glad_real_glGetQueryObjectiv = glad_glGetQueryObjectiv;
+    if (glad_glGetQueryObjectiv != NULL) glad_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
+    glad_real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv;
+    if (glad_glGetQueryObjectuiv != NULL) glad_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
+    glad_real_glBindBuffer = glad_glBindBuffer;
+    if (glad_glBindBuffer != NULL) glad_glBindBuffer = glad_debug_impl_glBindBuffer;
+    glad_real_glDeleteBuffers = glad_glDeleteBuffers;
+    if (glad_glDeleteBuffers != NULL) glad_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
+    glad_real_glGenBuffers = glad_glGenBuffers;
+    if (glad_glGenBuffers != NULL) glad_glGenBuffers = glad_debug_impl_glGenBuffers;
+    glad_real_glIsBuffer = glad_glIsBuffer;
+    if (glad_glIsBuffer != NULL) glad_glIsBuffer = glad_debug_impl_glIsBuffer;
+    glad_real_glBufferData = glad_glBufferData;
+    if (glad_glBufferData != NULL) glad_glBufferData = glad_debug_impl_glBufferData;
+    glad_real_glBufferSubData = glad_glBufferSubData;
+    if (glad_glBufferSubData != NULL) glad_glBufferSubData = glad_debug_impl_glBufferSubData;
+    glad_real_glGetBufferSubData = glad_glGetBufferSubData;
+    if (glad_glGetBufferSubData != NULL) glad_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
+    glad_real_glMapBuffer = glad_glMapBuffer;
+    if (glad_glMapBuffer != NULL) glad_glMapBuffer = glad_debug_impl_glMapBuffer;
+    glad_real_glUnmapBuffer = glad_glUnmapBuffer;
+    if (glad_glUnmapBuffer != NULL) glad_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
+    glad_real_glGetBufferParameteriv = glad_glGetBufferParameteriv;
+    if (glad_glGetBufferParameteriv != NULL) glad_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
+    glad_real_glGetBufferPointerv = glad_glGetBufferPointerv;
+    if (glad_glGetBufferPointerv != NULL) glad_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
+    glad_real_glBlendEquationSeparate = glad_glBlendEquationSeparate;
+    if (glad_glBlendEquationSeparate != NULL) glad_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
+    glad_real_glDrawBuffers = glad_glDrawBuffers;
+    if (glad_glDrawBuffers != NULL) glad_glDrawBuffers = glad_debug_impl_glDrawBuffers;
+    glad_real_glStencilOpSeparate = glad_glStencilOpSeparate;
+    if (glad_glStencilOpSeparate != NULL) glad_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
+    glad_real_glStencilFuncSeparate = glad_glStencilFuncSeparate;
+    if (glad_glStencilFuncSeparate != NULL) glad_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
+    glad_real_glStencilMaskSeparate = glad_glStencilMaskSeparate;
+    if (glad_glStencilMaskSeparate != NULL) glad_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
+    glad_real_glAttachShader = glad_glAttachShader;
+    if (glad_glAttachShader != NULL) glad_glAttachShader = glad_debug_impl_glAttachShader;
+    glad_real_glBindAttribLocation = glad_glBindAttribLocation;
+    if (glad_glBindAttribLocation != NULL) glad_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
+    glad_real_glCompileShader = glad_glCompileShader;
+    if (glad_glCompileShader != NULL) glad_glCompileShader = glad_debug_impl_glCompileShader;
+    glad_real_glCreateProgram = glad_glCreateProgram;
+    if (glad_glCreateProgram != NULL) glad_glCreateProgram = glad_debug_impl_glCreateProgram;
+    glad_real_glCreateShader = glad_glCreateShader;
+    if (glad_glCreateShader != NULL) glad_glCreateShader = glad_debug_impl_glCreateShader;
+    glad_real_glDeleteProgram = glad_glDeleteProgram;
+    if (glad_glDeleteProgram != NULL) glad_glDeleteProgram = glad_debug_impl_glDeleteProgram;
+    glad_real_glDeleteShader = glad_glDeleteShader;
+    if (glad_glDeleteShader != NULL) glad_glDeleteShader = glad_debug_impl_glDeleteShader;
+    glad_real_glDetachShader = glad_glDetachShader;
+    if (glad_glDetachShader != NULL) glad_glDetachShader = glad_debug_impl_glDetachShader;
+    glad_real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray;
+    if (glad_glDisableVertexAttribArray != NULL) glad_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
+    glad_real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray;
+    if (glad_glEnableVertexAttribArray != NULL) glad_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
+    glad_real_glGetActiveAttrib = glad_glGetActiveAttrib;
+    if (glad_glGetActiveAttrib != NULL) glad_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
+    glad_real_glGetActiveUniform = glad_glGetActiveUniform;
+    if (glad_glGetActiveUniform != NULL) glad_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
+    glad_real_glGetAttachedShaders = glad_glGetAttachedShaders;
+    if (glad_glGetAttachedShaders != NULL) glad_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
+    glad_real_glGetAttribLocation = glad_glGetAttribLocation;
+    if (glad_glGetAttribLocation != NULL) glad_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
+    glad_real_glGetProgramiv = glad_glGetProgramiv;
+    if (glad_glGetProgramiv != NULL) glad_glGetProgramiv = glad_debug_impl_glGetProgramiv;
+    glad_real_glGetProgramInfoLog = glad_glGetProgramInfoLog;
+    if (glad_glGetProgramInfoLog != NULL) glad_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
+    glad_real_glGetShaderiv = glad_glGetShaderiv;
+    if (glad_glGetShaderiv != NULL) glad_glGetShaderiv = glad_debug_impl_glGetShaderiv;
+    glad_real_glGetShaderInfoLog = glad_glGetShaderInfoLog;
+    if (glad_glGetShaderInfoLog != NULL) glad_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
+    glad_real_glGetShaderSource = glad_glGetShaderSource;
+    if (glad_glGetShaderSource != NULL) glad_glGetShaderSource = glad_debug_impl_glGetShaderSource;
+    glad_real_glGetUniformLocation = glad_glGetUniformLocation;
+    if (glad_glGetUniformLocation != NULL) glad_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
+    glad_real_glGetUniformfv = glad_glGetUniformfv;
+    if (glad_glGetUniformfv != NULL) glad_glGetUniformfv = glad_debug_impl_glGetUniformfv;
+    glad_real_glGetUniformiv = glad_glGetUniformiv;
+    if (glad_glGetUniformiv != NULL) glad_glGetUniformiv = glad_debug_impl_glGetUniformiv;
+    glad_real_glGetVertexAttribdv = glad_glGetVertexAttribdv;
+    if (glad_glGetVertexAttribdv != NULL) glad_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
+    glad_real_glGetVertexAttribfv = glad_glGetVertexAttribfv;
+    if (glad_glGetVertexAttribfv != NULL) glad_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
+    glad_real_glGetVertexAttribiv = glad_glGetVertexAttribiv;
+    if (glad_glGetVertexAttribiv != NULL) glad_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
+    glad_real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+    if (glad_glGetVertexAttribPointerv != NULL) glad_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
+    glad_real_glIsProgram = glad_glIsProgram;
+    if (glad_glIsProgram != NULL) glad_glIsProgram = glad_debug_impl_glIsProgram;
+    glad_real_glIsShader = glad_glIsShader;
+    if (glad_glIsShader != NULL) glad_glIsShader = glad_debug_impl_glIsShader;
+    glad_real_glLinkProgram = glad_glLinkProgram;
+    if (glad_glLinkProgram != NULL) glad_glLinkProgram = glad_debug_impl_glLinkProgram;
+    glad_real_glShaderSource = glad_glShaderSource;
+    if (glad_glShaderSource != NULL) glad_glShaderSource = glad_debug_impl_glShaderSource;
+    glad_real_glUseProgram = glad_glUseProgram;
+    if (glad_glUseProgram != NULL) glad_glUseProgram = glad_debug_impl_glUseProgram;
+    glad_real_glUniform1f = glad_glUniform1f;
+    if (glad_glUniform1f != NULL) glad_glUniform1f = glad_debug_impl_glUniform1f;
+    glad_real_glUniform2f = glad_glUniform2f;
+    if (glad_glUniform2f != NULL) glad_glUniform2f = glad_debug_impl_glUniform2f;
+    glad_real_glUniform3f = glad_glUniform3f;
+    if (glad_glUniform3f != NULL) glad_glUniform3f = glad_debug_impl_glUniform3f;
+    glad_real_glUniform4f = glad_glUniform4f;
+    if (glad_glUniform4f != NULL) glad_glUniform4f = glad_debug_impl_glUniform4f;
+    glad_real_glUniform1i = glad_glUniform1i;
+    if (glad_glUniform1i != NULL) glad_glUniform1i = glad_debug_impl_glUniform1i;
+    glad_real_glUniform2i = glad_glUniform2i;
+    if (glad_glUniform2i != NULL) glad_glUniform2i = glad_debug_impl_glUniform2i;
+    glad_real_glUniform3i = glad_glUniform3i;
+    if (glad_glUniform3i != NULL) glad_glUniform3i = glad_debug_impl_glUniform3i;
+    glad_real_glUniform4i = glad_glUniform4i;
+    if (glad_glUniform4i != NULL) glad_glUniform4i = glad_debug_impl_glUniform4i;
+    glad_real_glUniform1fv = glad_glUniform1fv;
+    if (glad_glUniform1fv != NULL) glad_glUniform1fv = glad_debug_impl_glUniform1fv;
+    glad_real_glUniform2fv = glad_glUniform2fv;
+    if (glad_glUniform2fv != NULL) glad_glUniform2fv = glad_debug_impl_glUniform2fv;
+    glad_real_glUniform3fv = glad_glUniform3fv;
+    if (glad_glUniform3fv != NULL) glad_glUniform3fv = glad_debug_impl_glUniform3fv;
+    glad_real_glUniform4fv = glad_glUniform4fv;
+    if (glad_glUniform4fv != NULL) glad_glUniform4fv = glad_debug_impl_glUniform4fv;
+    glad_real_glUniform1iv = glad_glUniform1iv;
+    if (glad_glUniform1iv != NULL) glad_glUniform1iv = glad_debug_impl_glUniform1iv;
+    glad_real_glUniform2iv = glad_glUniform2iv;
+    if (glad_glUniform2iv != NULL) glad_glUniform2iv = glad_debug_impl_glUniform2iv;
+    glad_real_glUniform3iv = glad_glUniform3iv;
+    if (glad_glUniform3iv != NULL) glad_glUniform3iv = glad_debug_impl_glUniform3iv;
+    glad_real_glUniform4iv = glad_glUniform4iv;
+    if (glad_glUniform4iv != NULL) glad_glUniform4iv = glad_debug_impl_glUniform4iv;
+    glad_real_glUniformMatrix2fv = glad_glUniformMatrix2fv;
+    if (glad_glUniformMatrix2fv != NULL) glad_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
+    glad_real_glUniformMatrix3fv = glad_glUniformMatrix3fv;
+    if (glad_glUniformMatrix3fv != NULL) glad_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
+    glad_real_glUniformMatrix4fv = glad_glUniformMatrix4fv;
+    if (glad_glUniformMatrix4fv != NULL) glad_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
+    glad_real_glValidateProgram = glad_glValidateProgram;
+    if (glad_glValidateProgram != NULL) glad_glValidateProgram = glad_debug_impl_glValidateProgram;
+    glad_real_glVertexAttrib1d = glad_glVertexAttrib1d;
+    if (glad_glVertexAttrib1d != NULL) glad_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
+    glad_real_glVertexAttrib1dv = glad_glVertexAttrib1dv;
+    if (glad_glVertexAttrib1dv != NULL) glad_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
+    glad_real_glVertexAttrib1f = glad_glVertexAttrib1f;
+    if (glad_glVertexAttrib1f != NULL) glad_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
+    glad_real_glVertexAttrib1fv = glad_glVertexAttrib1fv;
+    if (glad_glVertexAttrib1fv != NULL) glad_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
+    glad_real_glVertexAttrib1s = glad_glVertexAttrib1s;
+    if (glad_glVertexAttrib1s != NULL) glad_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
+    glad_real_glVertexAttrib1sv = glad_glVertexAttrib1sv;
+    if (glad_glVertexAttrib1sv != NULL) glad_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
+    glad_real_glVertexAttrib2d = glad_glVertexAttrib2d;
+    if (glad_glVertexAttrib2d != NULL) glad_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
+    glad_real_glVertexAttrib2dv = glad_glVertexAttrib2dv;
+    if (glad_glVertexAttrib2dv != NULL) glad_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
+    glad_real_glVertexAttrib2f = glad_glVertexAttrib2f;
+    if (glad_glVertexAttrib2f != NULL) glad_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
+    glad_real_glVertexAttrib2fv = glad_glVertexAttrib2fv;
+    if (glad_glVertexAttrib2fv != NULL) glad_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
+    glad_real_glVertexAttrib2s = glad_glVertexAttrib2s;
+    if (glad_glVertexAttrib2s != NULL) glad_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
+    glad_real_glVertexAttrib2sv = glad_glVertexAttrib2sv;
+    if (glad_glVertexAttrib2sv != NULL) glad_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
+    glad_real_glVertexAttrib3d = glad_glVertexAttrib3d;
+    if (glad_glVertexAttrib3d != NULL) glad_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
+    glad_real_glVertexAttrib3dv = glad_glVertexAttrib3dv;
+    if (glad_glVertexAttrib3dv != NULL) glad_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
+    glad_real_glVertexAttrib3f = glad_glVertexAttrib3f;
+    if (glad_glVertexAttrib3f != NULL) glad_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
+    glad_real_glVertexAttrib3fv = glad_glVertexAttrib3fv;
+    if (glad_glVertexAttrib3fv != NULL) glad_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
+    glad_real_glVertexAttrib3s = glad_glVertexAttrib3s;
+    if (glad_glVertexAttrib3s != NULL) glad_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
+    glad_real_glVertexAttrib3sv = glad_glVertexAttrib3sv;
+    if (glad_glVertexAttrib3sv != NULL) glad_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
+    glad_real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+    if (glad_glVertexAttrib4Nbv != NULL) glad_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
+    glad_real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv;
+    if (glad_glVertexAttrib4Niv != NULL) glad_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
+    glad_real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+    if (glad_glVertexAttrib4Nsv != NULL) glad_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
+    glad_real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub;
+    if (glad_glVertexAttrib4Nub != NULL) glad_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
+    glad_real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+    if (glad_glVertexAttrib4Nubv != NULL) glad_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
+    glad_real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+    if (glad_glVertexAttrib4Nuiv != NULL) glad_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
+    glad_real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+    if (glad_glVertexAttrib4Nusv != NULL) glad_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
+    glad_real_glVertexAttrib4bv = glad_glVertexAttrib4bv;
+    if (glad_glVertexAttrib4bv != NULL) glad_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
+    glad_real_glVertexAttrib4d = glad_glVertexAttrib4d;
+    if (glad_glVertexAttrib4d != NULL) glad_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
+    glad_real_glVertexAttrib4dv = glad_glVertexAttrib4dv;
+    if (glad_glVertexAttrib4dv != NULL) glad_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
+    glad_real_glVertexAttrib4f = glad_glVertexAttrib4f;
+    if (glad_glVertexAttrib4f != NULL) glad_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
+    glad_real_glVertexAttrib4fv = glad_glVertexAttrib4fv;
+    if (glad_glVertexAttrib4fv != NULL) glad_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
+    glad_real_glVertexAttrib4iv = glad_glVertexAttrib4iv;
+    if (glad_glVertexAttrib4iv != NULL) glad_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
+    glad_real_glVertexAttrib4s = glad_glVertexAttrib4s;
+    if (glad_glVertexAttrib4s != NULL) glad_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
+    glad_real_glVertexAttrib4sv = glad_glVertexAttrib4sv;
+    if (glad_glVertexAttrib4sv != NULL) glad_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
+    glad_real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv;
+    if (glad_glVertexAttrib4ubv != NULL) glad_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
+    glad_real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv;
+    if (glad_glVertexAttrib4uiv != NULL) glad_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
+    glad_real_glVertexAttrib4usv = glad_glVertexAttrib4usv;
+    if (glad_glVertexAttrib4usv != NULL) glad_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
+    glad_real_glVertexAttribPointer = glad_glVertexAttribPointer;
+    if (glad_glVertexAttribPointer != NULL) glad_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
+    glad_real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+    if (glad_glUniformMatrix2x3fv != NULL) glad_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
+    glad_real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+    if (glad_glUniformMatrix3x2fv != NULL) glad_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
+    glad_real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+    if (glad_glUniformMatrix2x4fv != NULL) glad_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
+    glad_real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+    if (glad_glUniformMatrix4x2fv != NULL) glad_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
+    glad_real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+    if (glad_glUniformMatrix3x4fv != NULL) glad_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
+    glad_real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+    if (glad_glUniformMatrix4x3fv != NULL) glad_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
+    glad_real_glColorMaski = glad_glColorMaski;
+    if (glad_glColorMaski != NULL) glad_glColorMaski = glad_debug_impl_glColorMaski;
+    glad_real_glGetBooleani_v = glad_glGetBooleani_v;
+    if (glad_glGetBooleani_v != NULL) glad_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
+    glad_real_glGetIntegeri_v = glad_glGetIntegeri_v;
+    if (glad_glGetIntegeri_v != NULL) glad_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
+    glad_real_glEnablei = glad_glEnablei;
+    if (glad_glEnablei != NULL) glad_glEnablei = glad_debug_impl_glEnablei;
+    glad_real_glDisablei = glad_glDisablei;
+    if (glad_glDisablei != NULL) glad_glDisablei = glad_debug_impl_glDisablei;
+    glad_real_glIsEnabledi = glad_glIsEnabledi;
+    if (glad_glIsEnabledi != NULL) glad_glIsEnabledi = glad_debug_impl_glIsEnabledi;
+    glad_real_glBeginTransformFeedback = glad_glBeginTransformFeedback;
+    if (glad_glBeginTransformFeedback != NULL) glad_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
+    glad_real_glEndTransformFeedback = glad_glEndTransformFeedback;
+    if (glad_glEndTransformFeedback != NULL) glad_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
+    glad_real_glBindBufferRange = glad_glBindBufferRange;
+    if (glad_glBindBufferRange != NULL) glad_glBindBufferRange = glad_debug_impl_glBindBufferRange;
+    glad_real_glBindBufferBase = glad_glBindBufferBase;
+    if (glad_glBindBufferBase != NULL) glad_glBindBufferBase = glad_debug_impl_glBindBufferBase;
+    glad_real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+    if (glad_glTransformFeedbackVaryings != NULL) glad_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
+    glad_real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+    if (glad_glGetTransformFeedbackVarying != NULL) glad_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
+    glad_real_glClampColor = glad_glClampColor;
+    if (glad_glClampColor != NULL) glad_glClampColor = glad_debug_impl_glClampColor;
+    glad_real_glBeginConditionalRender = glad_glBeginConditionalRender;
+    if (glad_glBeginConditionalRender != NULL) glad_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
+    glad_real_glEndConditionalRender = glad_glEndConditionalRender;
+    if (glad_glEndConditionalRender != NULL) glad_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
+    glad_real_glVertexAttribIPointer = glad_glVertexAttribIPointer;
+    if (glad_glVertexAttribIPointer != NULL) glad_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
+    glad_real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv;
+    if (glad_glGetVertexAttribIiv != NULL) glad_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
+    glad_real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+    if (glad_glGetVertexAttribIuiv != NULL) glad_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
+    glad_real_glVertexAttribI1i = glad_glVertexAttribI1i;
+    if (glad_glVertexAttribI1i != NULL) glad_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
+    glad_real_glVertexAttribI2i = glad_glVertexAttribI2i;
+    if (glad_glVertexAttribI2i != NULL) glad_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
+    glad_real_glVertexAttribI3i = glad_glVertexAttribI3i;
+    if (glad_glVertexAttribI3i != NULL) glad_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
+    glad_real_glVertexAttribI4i = glad_glVertexAttribI4i;
+    if (glad_glVertexAttribI4i != NULL) glad_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
+    glad_real_glVertexAttribI1ui = glad_glVertexAttribI1ui;
+    if (glad_glVertexAttribI1ui != NULL) glad_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
+    glad_real_glVertexAttribI2ui = glad_glVertexAttribI2ui;
+    if (glad_glVertexAttribI2ui != NULL) glad_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
+    glad_real_glVertexAttribI3ui = glad_glVertexAttribI3ui;
+    if (glad_glVertexAttribI3ui != NULL) glad_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
+    glad_real_glVertexAttribI4ui = glad_glVertexAttribI4ui;
+    if (glad_glVertexAttribI4ui != NULL) glad_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
+    glad_real_glVertexAttribI1iv = glad_glVertexAttribI1iv;
+    if (glad_glVertexAttribI1iv != NULL) glad_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
+    glad_real_glVertexAttribI2iv = glad_glVertexAttribI2iv;
+    if (glad_glVertexAttribI2iv != NULL) glad_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
+    glad_real_glVertexAttribI3iv = glad_glVertexAttribI3iv;
+    if (glad_glVertexAttribI3iv != NULL) glad_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
+    glad_real_glVertexAttribI4iv = glad_glVertexAttribI4iv;
+    if (glad_glVertexAttribI4iv != NULL) glad_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
+    glad_real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv;
+    if (glad_glVertexAttribI1uiv != NULL) glad_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
+    glad_real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv;
+    if (glad_glVertexAttribI2uiv != NULL) glad_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
+    glad_real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv;
+    if (glad_glVertexAttribI3uiv != NULL) glad_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
+    glad_real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv;
+    if (glad_glVertexAttribI4uiv != NULL) glad_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
+    glad_real_glVertexAttribI4bv = glad_glVertexAttribI4bv;
+    if (glad_glVertexAttribI4bv != NULL) glad_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
+    glad_real_glVertexAttribI4sv = glad_glVertexAttribI4sv;
+    if (glad_glVertexAttribI4sv != NULL) glad_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
+    glad_real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv;
+    if (glad_glVertexAttribI4ubv != NULL) glad_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
+    glad_real_glVertexAttribI4usv = glad_glVertexAttribI4usv;
+    if (glad_glVertexAttribI4usv != NULL) glad_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
+    glad_real_glGetUniformuiv = glad_glGetUniformuiv;
+    if (glad_glGetUniformuiv != NULL) glad_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
+    glad_real_glBindFragDataLocation = glad_glBindFragDataLocation;
+    if (glad_glBindFragDataLocation != NULL) glad_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
+    glad_real_glGetFragDataLocation = glad_glGetFragDataLocation;
+    if (glad_glGetFragDataLocation != NULL) glad_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
+    glad_real_glUniform1ui = glad_glUniform1ui;
+    if (glad_glUniform1ui != NULL) glad_glUniform1ui = glad_debug_impl_glUniform1ui;
+    glad_real_glUniform2ui = glad_glUniform2ui;
+    if (glad_glUniform2ui != NULL) glad_glUniform2ui = glad_debug_impl_glUniform2ui;
+    glad_real_glUniform3ui = glad_glUniform3ui;
+    if (glad_glUniform3ui != NULL) glad_glUniform3ui = glad_debug_impl_glUniform3ui;
+    glad_real_glUniform4ui = glad_glUniform4ui;
+    if (glad_glUniform4ui != NULL) glad_glUniform4ui = glad_debug_impl_glUniform4ui;
+    glad_real_glUniform1uiv = glad_glUniform1uiv;
+    if (glad_glUniform1uiv != NULL) glad_glUniform1uiv = glad_debug_impl_glUniform1uiv;
+    glad_real_glUniform2uiv = glad_glUniform2uiv;
+    if (glad_glUniform2uiv != NULL) glad_glUniform2uiv = glad_debug_impl_glUniform2uiv;
+    glad_real_glUniform3uiv = glad_glUniform3uiv;
+    if (glad_glUniform3uiv != NULL) glad_glUniform3uiv = glad_debug_impl_glUniform3uiv;
+    glad_real_glUniform4uiv = glad_glUniform4uiv;
+    if (glad_glUniform4uiv != NULL) glad_glUniform4uiv = glad_debug_impl_glUniform4uiv;
+    glad_real_glTexParameterIiv = glad_glTexParameterIiv;
+    if (glad_glTexParameterIiv != NULL) glad_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
+    glad_real_glTexParameterIuiv = glad_glTexParameterIuiv;
+    if (glad_glTexParameterIuiv != NULL) glad_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
+    glad_real_glGetTexParameterIiv = glad_glGetTexParameterIiv;
+    if (glad_glGetTexParameterIiv != NULL) glad_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
+    glad_real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv;
+    if (glad_glGetTexParameterIuiv != NULL) glad_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
+    glad_real_glClearBufferiv = glad_glClearBufferiv;
+    if (glad_glClearBufferiv != NULL) glad_glClearBufferiv = glad_debug_impl_glClearBufferiv;
+    glad_real_glClearBufferuiv = glad_glClearBufferuiv;
+    if (glad_glClearBufferuiv != NULL) glad_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
+    glad_real_glClearBufferfv = glad_glClearBufferfv;
+    if (glad_glClearBufferfv != NULL) glad_glClearBufferfv = glad_debug_impl_glClearBufferfv;
+    glad_real_glClearBufferfi = glad_glClearBufferfi;
+    if (glad_glClearBufferfi != NULL) glad_glClearBufferfi = glad_debug_impl_glClearBufferfi;
+    glad_real_glGetStringi = glad_glGetStringi;
+    if (glad_glGetStringi != NULL) glad_glGetStringi = glad_debug_impl_glGetStringi;
+    glad_real_glIsRenderbuffer = glad_glIsRenderbuffer;
+    if (glad_glIsRenderbuffer != NULL) glad_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
+    glad_real_glBindRenderbuffer = glad_glBindRenderbuffer;
+    if (glad_glBindRenderbuffer != NULL) glad_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
+    glad_real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers;
+    if (glad_glDeleteRenderbuffers != NULL) glad_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
+    glad_real_glGenRenderbuffers = glad_glGenRenderbuffers;
+    if (glad_glGenRenderbuffers != NULL) glad_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
+    glad_real_glRenderbufferStorage = glad_glRenderbufferStorage;
+    if (glad_glRenderbufferStorage != NULL) glad_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
+    glad_real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+    if (glad_glGetRenderbufferParameteriv != NULL) glad_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
+    glad_real_glIsFramebuffer = glad_glIsFramebuffer;
+    if (glad_glIsFramebuffer != NULL) glad_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
+    glad_real_glBindFramebuffer = glad_glBindFramebuffer;
+    if (glad_glBindFramebuffer != NULL) glad_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
+    glad_real_glDeleteFramebuffers = glad_glDeleteFramebuffers;
+    if (glad_glDeleteFramebuffers != NULL) glad_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
+    glad_real_glGenFramebuffers = glad_glGenFramebuffers;
+    if (glad_glGenFramebuffers != NULL) glad_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
+    glad_real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus;
+    if (glad_glCheckFramebufferStatus != NULL) glad_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
+    glad_real_glFramebufferTexture1D = glad_glFramebufferTexture1D;
+    if (glad_glFramebufferTexture1D != NULL) glad_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
+    glad_real_glFramebufferTexture2D = glad_glFramebufferTexture2D;
+    if (glad_glFramebufferTexture2D != NULL) glad_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
+    glad_real_glFramebufferTexture3D = glad_glFramebufferTexture3D;
+    if (glad_glFramebufferTexture3D != NULL) glad_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
+    glad_real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+    if (glad_glFramebufferRenderbuffer != NULL) glad_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
+    glad_real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+    if (glad_glGetFramebufferAttachmentParameteriv != NULL) glad_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
+    glad_real_glGenerateMipmap = glad_glGenerateMipmap;
+    if (glad_glGenerateMipmap != NULL) glad_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
+    glad_real_glBlitFramebuffer = glad_glBlitFramebuffer;
+    if (glad_glBlitFramebuffer != NULL) glad_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
+    glad_real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+    if (glad_glRenderbufferStorageMultisample != NULL) glad_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
+    glad_real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer;
+    if (glad_glFramebufferTextureLayer != NULL) glad_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
+    glad_real_glMapBufferRange = glad_glMapBufferRange;
+    if (glad_glMapBufferRange != NULL) glad_glMapBufferRange = glad_debug_impl_glMapBufferRange;
+    glad_real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange;
+    if (glad_glFlushMappedBufferRange != NULL) glad_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
+    glad_real_glBindVertexArray = glad_glBindVertexArray;
+    if (glad_glBindVertexArray != NULL) glad_glBindVertexArray = glad_debug_impl_glBindVertexArray;
+    glad_real_glDeleteVertexArrays = glad_glDeleteVertexArrays;
+    if (glad_glDeleteVertexArrays != NULL) glad_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
+    glad_real_glGenVertexArrays = glad_glGenVertexArrays;
+    if (glad_glGenVertexArrays != NULL) glad_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
+    glad_real_glIsVertexArray = glad_glIsVertexArray;
+    if (glad_glIsVertexArray != NULL) glad_glIsVertexArray = glad_debug_impl_glIsVertexArray;
+    glad_real_glDrawArraysInstanced = glad_glDrawArraysInstanced;
+    if (glad_glDrawArraysInstanced != NULL) glad_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
+    glad_real_glDrawElementsInstanced = glad_glDrawElementsInstanced;
+    if (glad_glDrawElementsInstanced != NULL) glad_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
+    glad_real_glTexBuffer = glad_glTexBuffer;
+    if (glad_glTexBuffer != NULL) glad_glTexBuffer = glad_debug_impl_glTexBuffer;
+    glad_real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+    if (glad_glPrimitiveRestartIndex != NULL) glad_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
+    glad_real_glCopyBufferSubData = glad_glCopyBufferSubData;
+    if (glad_glCopyBufferSubData != NULL) glad_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
+    glad_real_glGetUniformIndices = glad_glGetUniformIndices;
+    if (glad_glGetUniformIndices != NULL) glad_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
+    glad_real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv;
+    if (glad_glGetActiveUniformsiv != NULL) glad_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
+    glad_real_glGetActiveUniformName = glad_glGetActiveUniformName;
+    if (glad_glGetActiveUniformName != NULL) glad_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
+    glad_real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex;
+    if (glad_glGetUniformBlockIndex != NULL) glad_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
+    glad_real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+    if (glad_glGetActiveUniformBlockiv != NULL) glad_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
+    glad_real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+    if (glad_glGetActiveUniformBlockName != NULL) glad_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
+    glad_real_glUniformBlockBinding = glad_glUniformBlockBinding;
+    if (glad_glUniformBlockBinding != NULL) glad_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
+    glad_real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+    if (glad_glDrawElementsBaseVertex != NULL) glad_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
+    glad_real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+    if (glad_glDrawRangeElementsBaseVertex != NULL) glad_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
+    glad_real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+    if (glad_glDrawElementsInstancedBaseVertex != NULL) glad_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
+    glad_real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+    if (glad_glMultiDrawElementsBaseVertex != NULL) glad_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
+    glad_real_glProvokingVertex = glad_glProvokingVertex;
+    if (glad_glProvokingVertex != NULL) glad_glProvokingVertex = glad_debug_impl_glProvokingVertex;
+    glad_real_glFenceSync = glad_glFenceSync;
+    if (glad_glFenceSync != NULL) glad_glFenceSync = glad_debug_impl_glFenceSync;
+    glad_real_glIsSync = glad_glIsSync;
+    if (glad_glIsSync != NULL) glad_glIsSync = glad_debug_impl_glIsSync;
+    glad_real_glDeleteSync = glad_glDeleteSync;
+    if (glad_glDeleteSync != NULL) glad_glDeleteSync = glad_debug_impl_glDeleteSync;
+    glad_real_glClientWaitSync = glad_glClientWaitSync;
+    if (glad_glClientWaitSync != NULL) glad_glClientWaitSync = glad_debug_impl_glClientWaitSync;
+    glad_real_glWaitSync = glad_glWaitSync;
+    if (glad_glWaitSync != NULL) glad_glWaitSync = glad_debug_impl_glWaitSync;
+    glad_real_glGetInteger64v = glad_glGetInteger64v;
+    if (glad_glGetInteger64v != NULL) glad_glGetInteger64v = glad_debug_impl_glGetInteger64v;
+    glad_real_glGetSynciv = glad_glGetSynciv;
+    if (glad_glGetSynciv != NULL) glad_glGetSynciv = glad_debug_impl_glGetSynciv;
+    glad_real_glGetInteger64i_v = glad_glGetInteger64i_v;
+    if (glad_glGetInteger64i_v != NULL) glad_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
+    glad_real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v;
+    if (glad_glGetBufferParameteri64v != NULL) glad_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
+    glad_real_glFramebufferTexture = glad_glFramebufferTexture;
+    if (glad_glFramebufferTexture != NULL) glad_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
+    glad_real_glTexImage2DMultisample = glad_glTexImage2DMultisample;
+    if (glad_glTexImage2DMultisample != NULL) glad_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
+    glad_real_glTexImage3DMultisample = glad_glTexImage3DMultisample;
+    if (glad_glTexImage3DMultisample != NULL) glad_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
+    glad_real_glGetMultisamplefv = glad_glGetMultisamplefv;
+    if (glad_glGetMultisamplefv != NULL) glad_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+    glad_real_glSampleMaski = glad_glSampleMaski;
+    if (glad_glSampleMaski != NULL) glad_glSampleMaski = glad_debug_impl_glSampleMaski;
+    glad_real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+    if (glad_glBindFragDataLocationIndexed != NULL) glad_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
+    glad_real_glGetFragDataIndex = glad_glGetFragDataIndex;
+    if (glad_glGetFragDataIndex != NULL) glad_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
+    glad_real_glGenSamplers = glad_glGenSamplers;
+    if (glad_glGenSamplers != NULL) glad_glGenSamplers = glad_debug_impl_glGenSamplers;
+    glad_real_glDeleteSamplers = glad_glDeleteSamplers;
+    if (glad_glDeleteSamplers != NULL) glad_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
+    glad_real_glIsSampler = glad_glIsSampler;
+    if (glad_glIsSampler != NULL) glad_glIsSampler = glad_debug_impl_glIsSampler;
+    glad_real_glBindSampler = glad_glBindSampler;
+    if (glad_glBindSampler != NULL) glad_glBindSampler = glad_debug_impl_glBindSampler;
+    glad_real_glSamplerParameteri = glad_glSamplerParameteri;
+    if (glad_glSamplerParameteri != NULL) glad_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
+    glad_real_glSamplerParameteriv = glad_glSamplerParameteriv;
+    if (glad_glSamplerParameteriv != NULL) glad_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
+    glad_real_glSamplerParameterf = glad_glSamplerParameterf;
+    if (glad_glSamplerParameterf != NULL) glad_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
+    glad_real_glSamplerParameterfv = glad_glSamplerParameterfv;
+    if (glad_glSamplerParameterfv != NULL) glad_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
+    glad_real_glSamplerParameterIiv = glad_glSamplerParameterIiv;
+    if (glad_glSamplerParameterIiv != NULL) glad_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
+    glad_real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv;
+    if (glad_glSamplerParameterIuiv != NULL) glad_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
+    glad_real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv;
+    if (glad_glGetSamplerParameteriv != NULL) glad_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
+    glad_real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+    if (glad_glGetSamplerParameterIiv != NULL) glad_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
+    glad_real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv;
+    if (glad_glGetSamplerParameterfv != NULL) glad_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
+    glad_real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+    if (glad_glGetSamplerParameterIuiv != NULL) glad_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
+    glad_real_glQueryCounter = glad_glQueryCounter;
+    if (glad_glQueryCounter != NULL) glad_glQueryCounter = glad_debug_impl_glQueryCounter;
+    glad_real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v;
+    if (glad_glGetQueryObjecti64v != NULL) glad_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
+    glad_real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v;
+    if (glad_glGetQueryObjectui64v != NULL) glad_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
+    glad_real_glVertexAttribDivisor = glad_glVertexAttribDivisor;
+    if (glad_glVertexAttribDivisor != NULL) glad_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
+    glad_real_glVertexAttribP1ui = glad_glVertexAttribP1ui;
+    if (glad_glVertexAttribP1ui != NULL) glad_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
+    glad_real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv;
+    if (glad_glVertexAttribP1uiv != NULL) glad_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
+    glad_real_glVertexAttribP2ui = glad_glVertexAttribP2ui;
+    if (glad_glVertexAttribP2ui != NULL) glad_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
+    glad_real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv;
+    if (glad_glVertexAttribP2uiv != NULL) glad_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
+    glad_real_glVertexAttribP3ui = glad_glVertexAttribP3ui;
+    if (glad_glVertexAttribP3ui != NULL) glad_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
+    glad_real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv;
+    if (glad_glVertexAttribP3uiv != NULL) glad_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
+    glad_real_glVertexAttribP4ui = glad_glVertexAttribP4ui;
+    if (glad_glVertexAttribP4ui != NULL) glad_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
+    glad_real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv;
+    if (glad_glVertexAttribP4uiv != NULL) glad_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
+    glad_real_glVertexP2ui = glad_glVertexP2ui;
+    if (glad_glVertexP2ui != NULL) glad_glVertexP2ui = glad_debug_impl_glVertexP2ui;
+    glad_real_glVertexP2uiv = glad_glVertexP2uiv;
+    if (glad_glVertexP2uiv != NULL) glad_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
+    glad_real_glVertexP3ui = glad_glVertexP3ui;
+    if (glad_glVertexP3ui != NULL) glad_glVertexP3ui = glad_debug_impl_glVertexP3ui;
+    glad_real_glVertexP3uiv = glad_glVertexP3uiv;
+    if (glad_glVertexP3uiv != NULL) glad_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
+    glad_real_glVertexP4ui = glad_glVertexP4ui;
+    if (glad_glVertexP4ui != NULL) glad_glVertexP4ui = glad_debug_impl_glVertexP4ui;
+    glad_real_glVertexP4uiv = glad_glVertexP4uiv;
+    if (glad_glVertexP4uiv != NULL) glad_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
+    glad_real_glTexCoordP1ui = glad_glTexCoordP1ui;
+    if (glad_glTexCoordP1ui != NULL) glad_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
+    glad_real_glTexCoordP1uiv = glad_glTexCoordP1uiv;
+    if (glad_glTexCoordP1uiv != NULL) glad_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
+    glad_real_glTexCoordP2ui = glad_glTexCoordP2ui;
+    if (glad_glTexCoordP2ui != NULL) glad_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
+    glad_real_glTexCoordP2uiv = glad_glTexCoordP2uiv;
+    if (glad_glTexCoordP2uiv != NULL) glad_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
+    glad_real_glTexCoordP3ui = glad_glTexCoordP3ui;
+    if (glad_glTexCoordP3ui != NULL) glad_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
+    glad_real_glTexCoordP3uiv = glad_glTexCoordP3uiv;
+    if (glad_glTexCoordP3uiv != NULL) glad_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
+    glad_real_glTexCoordP4ui = glad_glTexCoordP4ui;
+    if (glad_glTexCoordP4ui != NULL) glad_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
+    glad_real_glTexCoordP4uiv = glad_glTexCoordP4uiv;
+    if (glad_glTexCoordP4uiv != NULL) glad_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
+    glad_real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+    if (glad_glMultiTexCoordP1ui != NULL) glad_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
+    glad_real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+    if (glad_glMultiTexCoordP1uiv != NULL) glad_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
+    glad_real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+    if (glad_glMultiTexCoordP2ui != NULL) glad_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
+    glad_real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+    if (glad_glMultiTexCoordP2uiv != NULL) glad_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
+    glad_real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+    if (glad_glMultiTexCoordP3ui != NULL) glad_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
+    glad_real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+    if (glad_glMultiTexCoordP3uiv != NULL) glad_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
+    glad_real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+    if (glad_glMultiTexCoordP4ui != NULL) glad_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
+    glad_real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+    if (glad_glMultiTexCoordP4uiv != NULL) glad_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
+    glad_real_glNormalP3ui = glad_glNormalP3ui;
+    if (glad_glNormalP3ui != NULL) glad_glNormalP3ui = glad_debug_impl_glNormalP3ui;
+    glad_real_glNormalP3uiv = glad_glNormalP3uiv;
+    if (glad_glNormalP3uiv != NULL) glad_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
+    glad_real_glColorP3ui = glad_glColorP3ui;
+    if (glad_glColorP3ui != NULL) glad_glColorP3ui = glad_debug_impl_glColorP3ui;
+    glad_real_glColorP3uiv = glad_glColorP3uiv;
+    if (glad_glColorP3uiv != NULL) glad_glColorP3uiv = glad_debug_impl_glColorP3uiv;
+    glad_real_glColorP4ui = glad_glColorP4ui;
+    if (glad_glColorP4ui != NULL) glad_glColorP4ui = glad_debug_impl_glColorP4ui;
+    glad_real_glColorP4uiv = glad_glColorP4uiv;
+    if (glad_glColorP4uiv != NULL) glad_glColorP4uiv = glad_debug_impl_glColorP4uiv;
+    glad_real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui;
+    if (glad_glSecondaryColorP3ui != NULL) glad_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
+    glad_real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+    if (glad_glSecondaryColorP3uiv != NULL) glad_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
+}
+#endif /* GLAD_DEBUG */
+
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+
+	if (!find_extensionsGL()) return 0;
+#ifdef GLAD_DEBUG
+	glad_install_debug();
+#endif
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
@@ -0,0 +1,398 @@
+// replay.cc
+
+// re-issues a GL trace written by main (see capture/trace.h)
+// as fast as possible, in a hidden window, with the time of each frame
+// usage: replay [trace file]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "trace.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+// reads the payload of a record
+class Reader
+{
+  public:
+    Reader(const char *data, unsigned int size) : data(data), size(size), pos(0), bad(false) {}
+
+    unsigned int u32()
+    {
+      unsigned int v = 0;
+      if (this->pos + sizeof(v) <= this->size) memcpy(&v, this->data + this->pos, sizeof(v));
+      this->pos += sizeof(v);
+      return v;
+    }
+
+    int i32() { return (int)this->u32(); }
+
+    float f32()
+    {
+      float v = 0.0f;
+      if (this->pos + sizeof(v) <= this->size) memcpy(&v, this->data + this->pos, sizeof(v));
+      this->pos += sizeof(v);
+      return v;
+    }
+
+    // returns a pointer in the trace, NULL if the blob is empty;
+    // a blob longer than what is left of the record is rejected
+    const char* blob(unsigned int &length)
+    {
+      length = this->u32();
+      if (this->pos > this->size || length > this->size - this->pos) {
+        length = 0;
+        this->pos = this->size;
+        this->bad = true;
+        return NULL;
+      }
+      const char *p = length > 0 ? this->data + this->pos : NULL;
+      this->pos += length;
+      return p;
+    }
+
+    // a blob was rejected: the record is corrupt
+    bool corrupt() const { return this->bad; }
+
+  private:
+    const char *data;
+    unsigned int size;
+    unsigned int pos;
+    bool bad;
+};
+
+// calls the capture had no record for, by name
+static std::map<std::string, unsigned long> notCaptured;
+
+// capture time names -> replay time names
+static std::map<GLuint, GLuint> buffers, vertexArrays, shaders, programs;
+static std::map<GLuint, std::map<GLint, GLint> > locations;
+static GLuint currentProgram = 0;
+
+static GLuint remap(std::map<GLuint, GLuint> &names, GLuint name)
+{
+  if (name == 0) return 0;
+  std::map<GLuint, GLuint>::iterator it = names.find(name);
+  return it != names.end() ? it->second : 0;
+}
+
+static GLint remapLocation(GLint location)
+{
+  if (location < 0) return location;
+  std::map<GLint, GLint> &l = locations[currentProgram];
+  std::map<GLint, GLint>::iterator it = l.find(location);
+  return it != l.end() ? it->second : -1;
+}
+
+static void replayRecord(unsigned short opcode, const char *payload, unsigned int size)
+{
+  Reader r(payload, size);
+  unsigned int length;
+  const char *data;
+
+  switch (opcode) {
+    case OP_VIEWPORT: {
+      GLint x = r.i32(), y = r.i32(), w = r.i32(), h = r.i32();
+      glViewport(x, y, w, h);
+      break;
+    }
+    case OP_CLEAR_COLOR: {
+      float cr = r.f32(), cg = r.f32(), cb = r.f32(), ca = r.f32();
+      glClearColor(cr, cg, cb, ca);
+      break;
+    }
+    case OP_CLEAR:
+      glClear(r.u32());
+      break;
+    case OP_GEN_BUFFERS:
+    case OP_GEN_VERTEX_ARRAYS: {
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      unsigned int n = length / sizeof(GLuint);
+      std::vector<GLuint> names(n);
+      if (n == 0) break;
+      if (opcode == OP_GEN_BUFFERS) glGenBuffers(n, &names[0]);
+      else glGenVertexArrays(n, &names[0]);
+      for (unsigned int i = 0; i < n; i++) {
+        GLuint captured;
+        memcpy(&captured, data + i * sizeof(GLuint), sizeof(GLuint));
+        (opcode == OP_GEN_BUFFERS ? buffers : vertexArrays)[captured] = names[i];
+      }
+      break;
+    }
+    case OP_DELETE_BUFFERS:
+    case OP_DELETE_VERTEX_ARRAYS: {
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      std::map<GLuint, GLuint> &names = opcode == OP_DELETE_BUFFERS ? buffers : vertexArrays;
+      for (unsigned int i = 0; i < length / sizeof(GLuint); i++) {
+        GLuint captured;
+        memcpy(&captured, data + i * sizeof(GLuint), sizeof(GLuint));
+        GLuint name = remap(names, captured);
+        if (opcode == OP_DELETE_BUFFERS) glDeleteBuffers(1, &name);
+        else glDeleteVertexArrays(1, &name);
+        names.erase(captured);
+      }
+      break;
+    }
+    case OP_BIND_BUFFER: {
+      GLenum target = r.u32();
+      glBindBuffer(target, remap(buffers, r.u32()));
+      break;
+    }
+    case OP_BUFFER_DATA: {
+      GLenum target = r.u32();
+      GLsizeiptr bytes = r.u32();
+      GLenum usage = r.u32();
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      glBufferData(target, bytes, data, usage);
+      break;
+    }
+    case OP_BUFFER_SUB_DATA: {
+      GLenum target = r.u32();
+      GLintptr offset = r.u32();
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      glBufferSubData(target, offset, length, data);
+      break;
+    }
+    case OP_BIND_VERTEX_ARRAY:
+      glBindVertexArray(remap(vertexArrays, r.u32()));
+      break;
+    case OP_VERTEX_ATTRIB_POINTER: {
+      GLuint index = r.u32();
+      GLint components = r.i32();
+      GLenum type = r.u32();
+      GLboolean normalized = (GLboolean)r.u32();
+      GLsizei stride = r.i32();
+      size_t offset = r.u32();
+      glVertexAttribPointer(index, components, type, normalized, stride, (void*)offset);
+      break;
+    }
+    case OP_ENABLE_VERTEX_ATTRIB_ARRAY:
+      glEnableVertexAttribArray(r.u32());
+      break;
+    case OP_VERTEX_ATTRIB_DIVISOR: {
+      GLuint index = r.u32();
+      glVertexAttribDivisor(index, r.u32());
+      break;
+    }
+    case OP_CREATE_SHADER: {
+      GLenum type = r.u32();
+      GLuint captured = r.u32();
+      shaders[captured] = glCreateShader(type);
+      break;
+    }
+    case OP_SHADER_SOURCE: {
+      GLuint shader = remap(shaders, r.u32());
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      GLint len = length;
+      glShaderSource(shader, 1, &data, &len);
+      break;
+    }
+    case OP_COMPILE_SHADER:
+      glCompileShader(remap(shaders, r.u32()));
+      break;
+    case OP_DELETE_SHADER: {
+      GLuint captured = r.u32();
+      glDeleteShader(remap(shaders, captured));
+      shaders.erase(captured);
+      break;
+    }
+    case OP_CREATE_PROGRAM: {
+      GLuint captured = r.u32();
+      programs[captured] = glCreateProgram();
+      break;
+    }
+    case OP_ATTACH_SHADER: {
+      GLuint program = remap(programs, r.u32());
+      glAttachShader(program, remap(shaders, r.u32()));
+      break;
+    }
+    case OP_LINK_PROGRAM:
+      glLinkProgram(remap(programs, r.u32()));
+      break;
+    case OP_USE_PROGRAM:
+      currentProgram = r.u32();
+      glUseProgram(remap(programs, currentProgram));
+      break;
+    case OP_DELETE_PROGRAM: {
+      GLuint captured = r.u32();
+      glDeleteProgram(remap(programs, captured));
+      programs.erase(captured);
+      locations.erase(captured);
+      break;
+    }
+    case OP_GET_UNIFORM_LOCATION: {
+      GLuint captured = r.u32();
+      GLint location = r.i32();
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      std::string name(data != NULL ? data : "", length);
+      locations[captured][location] = glGetUniformLocation(remap(programs, captured), name.c_str());
+      break;
+    }
+    case OP_UNIFORM_1I: {
+      GLint location = remapLocation(r.i32());
+      glUniform1i(location, r.i32());
+      break;
+    }
+    case OP_UNIFORM_1F: {
+      GLint location = remapLocation(r.i32());
+      glUniform1f(location, r.f32());
+      break;
+    }
+    case OP_UNIFORM_2F: {
+      GLint location = remapLocation(r.i32());
+      float v0 = r.f32(), v1 = r.f32();
+      glUniform2f(location, v0, v1);
+      break;
+    }
+    case OP_UNIFORM_4F: {
+      GLint location = remapLocation(r.i32());
+      float v0 = r.f32(), v1 = r.f32(), v2 = r.f32(), v3 = r.f32();
+      glUniform4f(location, v0, v1, v2, v3);
+      break;
+    }
+    case OP_DRAW_ARRAYS: {
+      GLenum mode = r.u32();
+      GLint first = r.i32();
+      glDrawArrays(mode, first, r.i32());
+      break;
+    }
+    case OP_DRAW_ELEMENTS: {
+      GLenum mode = r.u32();
+      GLsizei count = r.i32();
+      GLenum type = r.u32();
+      size_t offset = r.u32();
+      glDrawElements(mode, count, type, (void*)offset);
+      break;
+    }
+    case OP_DRAW_ELEMENTS_INSTANCED: {
+      GLenum mode = r.u32();
+      GLsizei count = r.i32();
+      GLenum type = r.u32();
+      size_t offset = r.u32();
+      glDrawElementsInstanced(mode, count, type, (void*)offset, r.i32());
+      break;
+    }
+    case OP_NOT_CAPTURED:
+      data = r.blob(length);
+      if (r.corrupt()) break;
+      notCaptured[std::string(data != NULL ? data : "", length)]++;
+      break;
+    default:
+      // unknown record: skipped
+      break;
+  }
+  if (r.corrupt())
+    std::cout << "ERROR::REPLAY::CORRUPT_RECORD opcode " << opcode << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *path = argc > 1 ? argv[1] : "trace.bin";
+
+  // load the whole trace in memory, so the replay does no I/O
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    std::cout << "ERROR::REPLAY::CANNOT_OPEN " << path << std::endl;
+    return -1;
+  }
+  std::vector<char> trace;
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    trace.insert(trace.end(), chunk, chunk + n);
+  fclose(file);
+
+  size_t magic = strlen(TRACE_MAGIC);
+  if (trace.size() < magic || memcmp(&trace[0], TRACE_MAGIC, magic) != 0) {
+    std::cout << "ERROR::REPLAY::NOT_A_TRACE " << path << std::endl;
+    return -1;
+  }
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Replay", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  std::vector<double> frameTimes;
+  unsigned long calls = 0;
+  size_t pos = magic;
+  double start = glfwGetTime();
+  double frameStart = start;
+  const size_t headerSize = sizeof(unsigned short) + sizeof(unsigned int);
+
+  while (pos + headerSize <= trace.size()) {
+    unsigned short opcode;
+    unsigned int size;
+    memcpy(&opcode, &trace[pos], sizeof(opcode));
+    memcpy(&size, &trace[pos + sizeof(opcode)], sizeof(size));
+    pos += headerSize;
+    if (pos + size > trace.size()) {
+      std::cout << "ERROR::REPLAY::TRUNCATED_TRACE" << std::endl;
+      break;
+    }
+
+    if (opcode == OP_FRAME_END) {
+      glFinish();
+      double now = glfwGetTime();
+      frameTimes.push_back(now - frameStart);
+      frameStart = now;
+    } else {
+      replayRecord(opcode, &trace[pos], size);
+      calls += opcode != OP_NOT_CAPTURED;
+    }
+    pos += size;
+  }
+  glFinish();
+  double total = glfwGetTime() - start;
+
+  std::cout << "replayed " << calls << " calls, " << frameTimes.size() << " frames in "
+            << total * 1000.0 << " ms" << std::endl;
+  for (size_t i = 0; i < frameTimes.size(); i++)
+    std::cout << "frame " << std::setw(5) << i << "  "
+              << std::fixed << std::setprecision(3) << frameTimes[i] * 1000.0 << " ms" << std::endl;
+
+  for (std::map<std::string, unsigned long>::iterator it = notCaptured.begin(); it != notCaptured.end(); ++it)
+    std::cout << "WARNING: " << it->first << " not captured (" << it->second
+              << " calls skipped), the replay differs from the capture" << std::endl;
+
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef GLAD_DEBUG_H
+#define GLAD_DEBUG_H
+
+/* glad debug callbacks (glad.c built with GLAD_DEBUG)
+ * the callbacks get the entry point name, the real function pointer,
+ * the number of arguments and the arguments themselves (default
+ * promotions apply: GLfloat arrives as double) */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...);
+
+/* NULL restores the default callback */
+void glad_set_pre_callback(GLADcallback cb);
+void glad_set_post_callback(GLADcallback cb);
+
+/* the defaults: nothing before, glGetError after */
+void glad_reset_pre_callback(void);
+void glad_reset_post_callback(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,322 @@
+#include "glstats.h"
+#include "glad_debug.h"
+
+#include <glad/glad.h>
+
+#include <stdarg.h>
+#include <string.h>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <vector>
+
+enum CallKind
+{
+  CALL_OTHER,
+  CALL_DRAW,
+  CALL_QUERY,
+  CALL_BIND_BUFFER,
+  CALL_BIND_VERTEX_ARRAY,
+  CALL_DELETE_VERTEX_ARRAYS,
+  CALL_USE_PROGRAM,
+  CALL_ACTIVE_TEXTURE,
+  CALL_BIND_TEXTURE,
+  CALL_BUFFER_DATA,
+  CALL_BUFFER_SUB_DATA,
+  CALL_TEX_IMAGE_2D,
+  CALL_TEX_SUB_IMAGE_2D
+};
+
+struct EntryStats
+{
+  const char *name;
+  CallKind kind;
+  unsigned long total;
+  unsigned long frame;
+  unsigned long hotQueries;
+};
+
+struct FrameStats
+{
+  unsigned long calls;
+  unsigned long draws;
+  unsigned long stateChanges;
+  unsigned long redundantBinds;
+  unsigned long bytesUploaded;
+  unsigned long hotQueries;
+};
+
+// entry points, by real function pointer
+static std::map<void*, EntryStats> entries;
+
+static FrameStats frame;
+static FrameStats total;
+static unsigned long frameIndex = 0;
+static bool printPerFrame = true;
+
+// bound state as seen through the calls
+static std::map<GLenum, GLuint> boundBuffers;
+static std::map<GLuint, GLuint> elementBuffers;   // element array binding per vertex array
+static std::map<std::pair<GLenum, GLenum>, GLuint> boundTextures;   // (unit, target)
+static GLuint boundVertexArray = 0;
+static GLuint boundProgram = 0;
+static GLenum activeTexture = GL_TEXTURE0;
+
+static CallKind classify(const char *name)
+{
+  // not glDrawBuffer(s): render target state
+  if (strncmp(name, "glDrawArrays", 12) == 0 || strncmp(name, "glDrawElements", 14) == 0 ||
+      strncmp(name, "glDrawRangeElements", 19) == 0 || strncmp(name, "glMultiDraw", 11) == 0)
+    return CALL_DRAW;
+  if (strcmp(name, "glBindBuffer") == 0) return CALL_BIND_BUFFER;
+  if (strcmp(name, "glBindVertexArray") == 0) return CALL_BIND_VERTEX_ARRAY;
+  if (strcmp(name, "glDeleteVertexArrays") == 0) return CALL_DELETE_VERTEX_ARRAYS;
+  if (strcmp(name, "glUseProgram") == 0) return CALL_USE_PROGRAM;
+  if (strcmp(name, "glActiveTexture") == 0) return CALL_ACTIVE_TEXTURE;
+  if (strcmp(name, "glBindTexture") == 0) return CALL_BIND_TEXTURE;
+  if (strcmp(name, "glBufferData") == 0) return CALL_BUFFER_DATA;
+  if (strcmp(name, "glBufferSubData") == 0) return CALL_BUFFER_SUB_DATA;
+  if (strcmp(name, "glTexImage2D") == 0) return CALL_TEX_IMAGE_2D;
+  if (strcmp(name, "glTexSubImage2D") == 0) return CALL_TEX_SUB_IMAGE_2D;
+  // queries stall or cost a driver round trip
+  if (strncmp(name, "glGet", 5) == 0) return CALL_QUERY;
+  return CALL_OTHER;
+}
+
+static unsigned int bytesPerPixel(GLenum format, GLenum type)
+{
+  unsigned int components = 4;
+  switch (format) {
+    case GL_RED: components = 1; break;
+    case GL_RG: components = 2; break;
+    case GL_RGB: case GL_BGR: components = 3; break;
+    default: break;
+  }
+  if (type == GL_FLOAT) return components * 4;
+  if (type == GL_UNSIGNED_SHORT || type == GL_SHORT || type == GL_HALF_FLOAT) return components * 2;
+  return components;
+}
+
+// a bind: redundant if the same object is already bound
+template <typename K>
+static void bind(std::map<K, GLuint> &bound, const K &key, GLuint name)
+{
+  typename std::map<K, GLuint>::iterator it = bound.find(key);
+  if (it != bound.end() && it->second == name) {
+    frame.redundantBinds++;
+  } else {
+    bound[key] = name;
+    frame.stateChanges++;
+  }
+}
+
+static void bind(GLuint &bound, GLuint name)
+{
+  if (bound == name) {
+    frame.redundantBinds++;
+  } else {
+    bound = name;
+    frame.stateChanges++;
+  }
+}
+
+static void postCallback(const char *name, void *funcptr, int len_args, ...)
+{
+  std::map<void*, EntryStats>::iterator it = entries.find(funcptr);
+  if (it == entries.end()) {
+    EntryStats e = { name, classify(name), 0, 0, 0 };
+    it = entries.insert(std::make_pair(funcptr, e)).first;
+  }
+  EntryStats &entry = it->second;
+  entry.total++;
+  entry.frame++;
+  frame.calls++;
+
+  va_list args;
+  va_start(args, len_args);
+  switch (entry.kind) {
+    case CALL_DRAW:
+      frame.draws++;
+      break;
+    case CALL_QUERY:
+      // the first frame also runs the setup code, queries are fine there
+      if (frameIndex > 0) {
+        if (entry.hotQueries == 0)
+          std::cout << "glstats: " << name << " on the hot path (frame " << frameIndex << ")" << std::endl;
+        entry.hotQueries++;
+        frame.hotQueries++;
+      }
+      break;
+    case CALL_BIND_BUFFER: {
+      GLenum target = va_arg(args, GLenum);
+      GLuint buffer = va_arg(args, GLuint);
+      // the element array binding belongs to the bound vertex array
+      if (target == GL_ELEMENT_ARRAY_BUFFER)
+        bind(elementBuffers, boundVertexArray, buffer);
+      else
+        bind(boundBuffers, target, buffer);
+      break;
+    }
+    case CALL_BIND_VERTEX_ARRAY:
+      bind(boundVertexArray, va_arg(args, GLuint));
+      break;
+    case CALL_DELETE_VERTEX_ARRAYS: {
+      // a recycled name starts with no element buffer
+      GLsizei n = va_arg(args, GLsizei);
+      const GLuint *arrays = va_arg(args, const GLuint*);
+      for (GLsizei i = 0; i < n; i++) {
+        elementBuffers.erase(arrays[i]);
+        if (boundVertexArray == arrays[i]) boundVertexArray = 0;
+      }
+      break;
+    }
+    case CALL_USE_PROGRAM:
+      bind(boundProgram, va_arg(args, GLuint));
+      break;
+    case CALL_ACTIVE_TEXTURE:
+      activeTexture = va_arg(args, GLenum);
+      break;
+    case CALL_BIND_TEXTURE: {
+      GLenum target = va_arg(args, GLenum);
+      GLuint texture = va_arg(args, GLuint);
+      bind(boundTextures, std::make_pair(activeTexture, target), texture);
+      break;
+    }
+    case CALL_BUFFER_DATA: {
+      va_arg(args, GLenum);
+      GLsizeiptr size = va_arg(args, GLsizeiptr);
+      const void *data = va_arg(args, const void*);
+      if (data != NULL)
+        frame.bytesUploaded += size;
+      break;
+    }
+    case CALL_BUFFER_SUB_DATA: {
+      va_arg(args, GLenum);
+      va_arg(args, GLintptr);
+      frame.bytesUploaded += va_arg(args, GLsizeiptr);
+      break;
+    }
+    case CALL_TEX_IMAGE_2D: {
+      // target, level, internalformat, width, height, border, format, type, pixels
+      va_arg(args, GLenum);
+      va_arg(args, GLint);
+      va_arg(args, GLint);
+      GLsizei width = va_arg(args, GLsizei);
+      GLsizei height = va_arg(args, GLsizei);
+      va_arg(args, GLint);
+      GLenum format = va_arg(args, GLenum);
+      GLenum type = va_arg(args, GLenum);
+      const void *pixels = va_arg(args, const void*);
+      if (pixels != NULL)
+        frame.bytesUploaded += (unsigned long)width * height * bytesPerPixel(format, type);
+      break;
+    }
+    case CALL_TEX_SUB_IMAGE_2D: {
+      // target, level, xoffset, yoffset, width, height, format, type, pixels
+      va_arg(args, GLenum);
+      va_arg(args, GLint);
+      va_arg(args, GLint);
+      va_arg(args, GLint);
+      GLsizei width = va_arg(args, GLsizei);
+      GLsizei height = va_arg(args, GLsizei);
+      GLenum format = va_arg(args, GLenum);
+      GLenum type = va_arg(args, GLenum);
+      frame.bytesUploaded += (unsigned long)width * height * bytesPerPixel(format, type);
+      break;
+    }
+    default:
+      break;
+  }
+  va_end(args);
+}
+
+static bool byFrame(const EntryStats &a, const EntryStats &b)
+{
+  return a.frame > b.frame;
+}
+
+static void clear(FrameStats &s)
+{
+  FrameStats zero = { 0, 0, 0, 0, 0, 0 };
+  s = zero;
+}
+
+void statsBegin(bool perFrame)
+{
+  printPerFrame = perFrame;
+  frameIndex = 0;
+  clear(frame);
+  clear(total);
+  glad_set_post_callback(postCallback);
+}
+
+void statsFrame()
+{
+  if (printPerFrame) {
+    std::cout << "frame " << frameIndex << ": "
+              << frame.calls << " calls, "
+              << frame.draws << " draws, "
+              << frame.stateChanges << " state changes, "
+              << frame.redundantBinds << " redundant binds, "
+              << frame.bytesUploaded << " bytes uploaded, "
+              << frame.hotQueries << " queries" << std::endl;
+
+    std::vector<EntryStats> called;
+    for (std::map<void*, EntryStats>::iterator it = entries.begin(); it != entries.end(); ++it)
+      if (it->second.frame > 0)
+        called.push_back(it->second);
+    std::sort(called.begin(), called.end(), byFrame);
+    std::cout << "  calls per entry point:";
+    for (size_t i = 0; i < called.size(); i++)
+      std::cout << (i > 0 ? ", " : " ") << called[i].name << " " << called[i].frame;
+    std::cout << std::endl;
+  }
+
+  total.calls += frame.calls;
+  total.draws += frame.draws;
+  total.stateChanges += frame.stateChanges;
+  total.redundantBinds += frame.redundantBinds;
+  total.bytesUploaded += frame.bytesUploaded;
+  total.hotQueries += frame.hotQueries;
+  clear(frame);
+
+  for (std::map<void*, EntryStats>::iterator it = entries.begin(); it != entries.end(); ++it)
+    it->second.frame = 0;
+  frameIndex++;
+}
+
+static bool byTotal(const EntryStats &a, const EntryStats &b)
+{
+  return a.total > b.total;
+}
+
+void statsEnd()
+{
+  glad_reset_post_callback();
+  if (frameIndex == 0) return;
+
+  std::cout << "\n--- GL statistics: " << frameIndex << " frames ---" << std::endl;
+  std::cout << "per frame: " << (double)total.calls / frameIndex << " calls, "
+            << (double)total.draws / frameIndex << " draws, "
+            << (double)total.stateChanges / frameIndex << " state changes, "
+            << (double)total.redundantBinds / frameIndex << " redundant binds, "
+            << (double)total.bytesUploaded / frameIndex << " bytes uploaded" << std::endl;
+
+  std::vector<EntryStats> sorted;
+  for (std::map<void*, EntryStats>::iterator it = entries.begin(); it != entries.end(); ++it)
+    sorted.push_back(it->second);
+  std::sort(sorted.begin(), sorted.end(), byTotal);
+
+  std::cout << "calls per entry point (total, per frame):" << std::endl;
+  for (size_t i = 0; i < sorted.size(); i++)
+    std::cout << "  " << sorted[i].name << " " << sorted[i].total << " "
+              << (double)sorted[i].total / frameIndex << std::endl;
+
+  if (total.redundantBinds > 0)
+    std::cout << "WARNING: " << total.redundantBinds << " redundant binds" << std::endl;
+  for (size_t i = 0; i < sorted.size(); i++) {
+    if (sorted[i].hotQueries > 0)
+      std::cout << "WARNING: " << sorted[i].name << " called " << sorted[i].hotQueries
+                << " times on the hot path" << std::endl;
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef GLSTATS_H
+#define GLSTATS_H
+
+// GL statistics mode, built on the glad debug post-call callback
+// (glad.c compiled with GLAD_DEBUG).
+// For each frame it counts the calls per entry point, draw calls,
+// bound state changes and bytes uploaded, and it flags:
+// - redundant binds (binding what is already bound)
+// - glGet* queries (glGetUniformLocation too) issued after the first frame
+//
+// statsBegin();        // after gladLoadGLLoader
+// ... game loop: statsFrame() before glfwSwapBuffers ...
+// statsEnd();          // end of run report
+
+// perFrame: print a summary line at every statsFrame()
+void statsBegin(bool perFrame = true);
+void statsFrame();
+void statsEnd();
+
+#endif
@@ -0,0 +1,3060 @@
+/*
+
+    OpenGL loader generated by glad 0.1.14a0 on Tue Aug  1 22:04:36 2017.
+
+    Language/Generator: C/C++
+    Specification: gl
+    APIs: gl=3.3
+    Profile: core
+    Extensions:
+        
+    Loader: True
+    Local files: False
+    Omit khrplatform: False
+
+    Commandline:
+        --profile="core" --api="gl=3.3" --generator="c" --spec="gl" --extensions=""
+    Online:
+        http://glad.dav1d.de/#profile=core&language=c&specification=gl&loader=on&api=gl%3D3.3
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad.h>
+
+static void* get_proc(const char *namez);
+
+#ifdef _WIN32
+#include <windows.h>
+static HMODULE libGL;
+
+typedef void* (APIENTRYP PFNWGLGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+
+static
+int open_gl(void) {
+    libGL = LoadLibraryW(L"opengl32.dll");
+    if(libGL != NULL) {
+        gladGetProcAddressPtr = (PFNWGLGETPROCADDRESSPROC_PRIVATE)GetProcAddress(
+                libGL, "wglGetProcAddress");
+        return gladGetProcAddressPtr != NULL;
+    }
+
+    return 0;
+}
+
+static
+void close_gl(void) {
+    if(libGL != NULL) {
+        FreeLibrary(libGL);
+        libGL = NULL;
+    }
+}
+#else
+#include <dlfcn.h>
+static void* libGL;
+
+#ifndef __APPLE__
+typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
+static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+#endif
+
+static
+int open_gl(void) {
+#ifdef __APPLE__
+    static const char *NAMES[] = {
+        "../Frameworks/OpenGL.framework/OpenGL",
+        "/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+    };
+#else
+    static const char *NAMES[] = {"libGL.so.1", "libGL.so"};
+#endif
+
+    unsigned int index = 0;
+    for(index = 0; index < (sizeof(NAMES) / sizeof(NAMES[0])); index++) {
+        libGL = dlopen(NAMES[index], RTLD_NOW | RTLD_GLOBAL);
+
+        if(libGL != NULL) {
+#ifdef __APPLE__
+            return 1;
+#else
+            gladGetProcAddressPtr = (PFNGLXGETPROCADDRESSPROC_PRIVATE)dlsym(libGL,
+                "glXGetProcAddressARB");
+            return gladGetProcAddressPtr != NULL;
+#endif
+        }
+    }
+
+    return 0;
+}
+
+static
+void close_gl() {
+    if(libGL != NULL) {
+        dlclose(libGL);
+        libGL = NULL;
+    }
+}
+#endif
+
+static
+void* get_proc(const char *namez) {
+    void* result = NULL;
+    if(libGL == NULL) return NULL;
+
+#ifndef __APPLE__
+    if(gladGetProcAddressPtr != NULL) {
+        result = gladGetProcAddressPtr(namez);
+    }
+#endif
+    if(result == NULL) {
+#ifdef _WIN32
+        result = (void*)GetProcAddress(libGL, namez);
+#else
+        result = dlsym(libGL, namez);
+#endif
+    }
+
+    return result;
+}
+
+int gladLoadGL(void) {
+    int status = 0;
+
+    if(open_gl()) {
+        status = gladLoadGLLoader(&get_proc);
+        close_gl();
+    }
+
+    return status;
+}
+
+struct gladGLversionStruct GLVersion;
+
+#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+#define _GLAD_IS_SOME_NEW_VERSION 1
+#endif
+
+static int max_loaded_major;
+static int max_loaded_minor;
+
+static const char *exts = NULL;
+static int num_exts_i = 0;
+static const char **exts_i = NULL;
+
+static int get_exts(void) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        exts = (const char *)glGetString(GL_EXTENSIONS);
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        unsigned int index;
+
+        num_exts_i = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+        if (num_exts_i > 0) {
+            exts_i = (const char **)realloc((void *)exts_i, (size_t)num_exts_i * (sizeof *exts_i));
+        }
+
+        if (exts_i == NULL) {
+            return 0;
+        }
+
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            exts_i[index] = (const char*)glGetStringi(GL_EXTENSIONS, index);
+        }
+    }
+#endif
+    return 1;
+}
+
+static void free_exts(void) {
+    if (exts_i != NULL) {
+        free((void *)exts_i);
+        exts_i = NULL;
+    }
+}
+
+static int has_ext(const char *ext) {
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    if(max_loaded_major < 3) {
+#endif
+        const char *extensions;
+        const char *loc;
+        const char *terminator;
+        extensions = exts;
+        if(extensions == NULL || ext == NULL) {
+            return 0;
+        }
+
+        while(1) {
+            loc = strstr(extensions, ext);
+            if(loc == NULL) {
+                return 0;
+            }
+
+            terminator = loc + strlen(ext);
+            if((loc == extensions || *(loc - 1) == ' ') &&
+                (*terminator == ' ' || *terminator == '\0')) {
+                return 1;
+            }
+            extensions = terminator;
+        }
+#ifdef _GLAD_IS_SOME_NEW_VERSION
+    } else {
+        int index;
+
+        for(index = 0; index < num_exts_i; index++) {
+            const char *e = exts_i[index];
+
+            if(strcmp(e, ext) == 0) {
+                return 1;
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+int GLAD_GL_VERSION_1_0;
+int GLAD_GL_VERSION_1_1;
+int GLAD_GL_VERSION_1_2;
+int GLAD_GL_VERSION_1_3;
+int GLAD_GL_VERSION_1_4;
+int GLAD_GL_VERSION_1_5;
+int GLAD_GL_VERSION_2_0;
+int GLAD_GL_VERSION_2_1;
+int GLAD_GL_VERSION_3_0;
+int GLAD_GL_VERSION_3_1;
+int GLAD_GL_VERSION_3_2;
+int GLAD_GL_VERSION_3_3;
+PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D;
+PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui;
+PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D;
+PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv;
+PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv;
+PFNGLBINDSAMPLERPROC glad_glBindSampler;
+PFNGLLINEWIDTHPROC glad_glLineWidth;
+PFNGLCOLORP3UIVPROC glad_glColorP3uiv;
+PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v;
+PFNGLCOMPILESHADERPROC glad_glCompileShader;
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying;
+PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer;
+PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui;
+PFNGLVERTEXP4UIPROC glad_glVertexP4ui;
+PFNGLENABLEIPROC glad_glEnablei;
+PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui;
+PFNGLCREATESHADERPROC glad_glCreateShader;
+PFNGLISBUFFERPROC glad_glIsBuffer;
+PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv;
+PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers;
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D;
+PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f;
+PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate;
+PFNGLHINTPROC glad_glHint;
+PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s;
+PFNGLSAMPLEMASKIPROC glad_glSampleMaski;
+PFNGLVERTEXP2UIPROC glad_glVertexP2ui;
+PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv;
+PFNGLPOINTSIZEPROC glad_glPointSize;
+PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv;
+PFNGLDELETEPROGRAMPROC glad_glDeleteProgram;
+PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv;
+PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage;
+PFNGLWAITSYNCPROC glad_glWaitSync;
+PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv;
+PFNGLUNIFORM3IPROC glad_glUniform3i;
+PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv;
+PFNGLUNIFORM3FPROC glad_glUniform3f;
+PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv;
+PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv;
+PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui;
+PFNGLCOLORMASKIPROC glad_glColorMaski;
+PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi;
+PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays;
+PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui;
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv;
+PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex;
+PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv;
+PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv;
+PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui;
+PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers;
+PFNGLDRAWARRAYSPROC glad_glDrawArrays;
+PFNGLUNIFORM1UIPROC glad_glUniform1ui;
+PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i;
+PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui;
+PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d;
+PFNGLCLEARPROC glad_glClear;
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName;
+PFNGLISENABLEDPROC glad_glIsEnabled;
+PFNGLSTENCILOPPROC glad_glStencilOp;
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv;
+PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub;
+PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation;
+PFNGLTEXIMAGE1DPROC glad_glTexImage1D;
+PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv;
+PFNGLGETTEXIMAGEPROC glad_glGetTexImage;
+PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v;
+PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers;
+PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders;
+PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer;
+PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays;
+PFNGLISVERTEXARRAYPROC glad_glIsVertexArray;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray;
+PFNGLGETQUERYIVPROC glad_glGetQueryiv;
+PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv;
+PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices;
+PFNGLISSHADERPROC glad_glIsShader;
+PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv;
+PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv;
+PFNGLENABLEPROC glad_glEnable;
+PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv;
+PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation;
+PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv;
+PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv;
+PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui;
+PFNGLGETUNIFORMFVPROC glad_glGetUniformfv;
+PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv;
+PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv;
+PFNGLDRAWBUFFERPROC glad_glDrawBuffer;
+PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv;
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced;
+PFNGLFLUSHPROC glad_glFlush;
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv;
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv;
+PFNGLFENCESYNCPROC glad_glFenceSync;
+PFNGLCOLORP3UIPROC glad_glColorP3ui;
+PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv;
+PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender;
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv;
+PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv;
+PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate;
+PFNGLGENSAMPLERSPROC glad_glGenSamplers;
+PFNGLCLAMPCOLORPROC glad_glClampColor;
+PFNGLUNIFORM4IVPROC glad_glUniform4iv;
+PFNGLCLEARSTENCILPROC glad_glClearStencil;
+PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv;
+PFNGLGENTEXTURESPROC glad_glGenTextures;
+PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv;
+PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv;
+PFNGLISSYNCPROC glad_glIsSync;
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName;
+PFNGLUNIFORM2IPROC glad_glUniform2i;
+PFNGLUNIFORM2FPROC glad_glUniform2f;
+PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui;
+PFNGLGETPROGRAMIVPROC glad_glGetProgramiv;
+PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer;
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange;
+PFNGLGENQUERIESPROC glad_glGenQueries;
+PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui;
+PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D;
+PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v;
+PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers;
+PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D;
+PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer;
+PFNGLISENABLEDIPROC glad_glIsEnabledi;
+PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui;
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed;
+PFNGLUNIFORM2IVPROC glad_glUniform2iv;
+PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv;
+PFNGLUNIFORM4UIVPROC glad_glUniform4uiv;
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D;
+PFNGLGETSHADERIVPROC glad_glGetShaderiv;
+PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation;
+PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset;
+PFNGLGETDOUBLEVPROC glad_glGetDoublev;
+PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d;
+PFNGLGETUNIFORMIVPROC glad_glGetUniformiv;
+PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv;
+PFNGLUNIFORM3FVPROC glad_glUniform3fv;
+PFNGLDEPTHRANGEPROC glad_glDepthRange;
+PFNGLMAPBUFFERPROC glad_glMapBuffer;
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D;
+PFNGLDELETESYNCPROC glad_glDeleteSync;
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D;
+PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv;
+PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements;
+PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv;
+PFNGLUNIFORM3IVPROC glad_glUniform3iv;
+PFNGLPOLYGONMODEPROC glad_glPolygonMode;
+PFNGLDRAWBUFFERSPROC glad_glDrawBuffers;
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv;
+PFNGLUSEPROGRAMPROC glad_glUseProgram;
+PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog;
+PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray;
+PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers;
+PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex;
+PFNGLUNIFORM2UIVPROC glad_glUniform2uiv;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D;
+PFNGLFINISHPROC glad_glFinish;
+PFNGLDELETESHADERPROC glad_glDeleteShader;
+PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv;
+PFNGLVIEWPORTPROC glad_glViewport;
+PFNGLUNIFORM1UIVPROC glad_glUniform1uiv;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings;
+PFNGLUNIFORM2UIPROC glad_glUniform2ui;
+PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i;
+PFNGLCLEARDEPTHPROC glad_glClearDepth;
+PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv;
+PFNGLTEXPARAMETERFPROC glad_glTexParameterf;
+PFNGLTEXPARAMETERIPROC glad_glTexParameteri;
+PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource;
+PFNGLTEXBUFFERPROC glad_glTexBuffer;
+PFNGLPIXELSTOREIPROC glad_glPixelStorei;
+PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram;
+PFNGLPIXELSTOREFPROC glad_glPixelStoref;
+PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v;
+PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv;
+PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv;
+PFNGLLINKPROGRAMPROC glad_glLinkProgram;
+PFNGLBINDTEXTUREPROC glad_glBindTexture;
+PFNGLGETSTRINGPROC glad_glGetString;
+PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv;
+PFNGLDETACHSHADERPROC glad_glDetachShader;
+PFNGLENDQUERYPROC glad_glEndQuery;
+PFNGLNORMALP3UIPROC glad_glNormalP3ui;
+PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui;
+PFNGLDELETETEXTURESPROC glad_glDeleteTextures;
+PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate;
+PFNGLDELETEQUERIESPROC glad_glDeleteQueries;
+PFNGLNORMALP3UIVPROC glad_glNormalP3uiv;
+PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f;
+PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d;
+PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv;
+PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s;
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex;
+PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage;
+PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri;
+PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf;
+PFNGLUNIFORM1FPROC glad_glUniform1f;
+PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv;
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage;
+PFNGLUNIFORM1IPROC glad_glUniform1i;
+PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib;
+PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D;
+PFNGLDISABLEPROC glad_glDisable;
+PFNGLLOGICOPPROC glad_glLogicOp;
+PFNGLUNIFORM4UIPROC glad_glUniform4ui;
+PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer;
+PFNGLCULLFACEPROC glad_glCullFace;
+PFNGLGETSTRINGIPROC glad_glGetStringi;
+PFNGLATTACHSHADERPROC glad_glAttachShader;
+PFNGLQUERYCOUNTERPROC glad_glQueryCounter;
+PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex;
+PFNGLDRAWELEMENTSPROC glad_glDrawElements;
+PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv;
+PFNGLUNIFORM1IVPROC glad_glUniform1iv;
+PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv;
+PFNGLREADBUFFERPROC glad_glReadBuffer;
+PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv;
+PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced;
+PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap;
+PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv;
+PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f;
+PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv;
+PFNGLPOINTPARAMETERIPROC glad_glPointParameteri;
+PFNGLBLENDCOLORPROC glad_glBlendColor;
+PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv;
+PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer;
+PFNGLPOINTPARAMETERFPROC glad_glPointParameterf;
+PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s;
+PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer;
+PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv;
+PFNGLISPROGRAMPROC glad_glIsProgram;
+PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv;
+PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv;
+PFNGLUNIFORM4IPROC glad_glUniform4i;
+PFNGLACTIVETEXTUREPROC glad_glActiveTexture;
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray;
+PFNGLREADPIXELSPROC glad_glReadPixels;
+PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv;
+PFNGLUNIFORM4FPROC glad_glUniform4f;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample;
+PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex;
+PFNGLSTENCILFUNCPROC glad_glStencilFunc;
+PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding;
+PFNGLCOLORP4UIPROC glad_glColorP4ui;
+PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv;
+PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog;
+PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i;
+PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData;
+PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate;
+PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui;
+PFNGLGENBUFFERSPROC glad_glGenBuffers;
+PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv;
+PFNGLBLENDFUNCPROC glad_glBlendFunc;
+PFNGLCREATEPROGRAMPROC glad_glCreateProgram;
+PFNGLTEXIMAGE3DPROC glad_glTexImage3D;
+PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer;
+PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex;
+PFNGLGETINTEGER64VPROC glad_glGetInteger64v;
+PFNGLSCISSORPROC glad_glScissor;
+PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv;
+PFNGLGETBOOLEANVPROC glad_glGetBooleanv;
+PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv;
+PFNGLUNIFORM3UIVPROC glad_glUniform3uiv;
+PFNGLCLEARCOLORPROC glad_glClearColor;
+PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv;
+PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv;
+PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v;
+PFNGLCOLORP4UIVPROC glad_glColorP4uiv;
+PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv;
+PFNGLUNIFORM3UIPROC glad_glUniform3ui;
+PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv;
+PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv;
+PFNGLUNIFORM2FVPROC glad_glUniform2fv;
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv;
+PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange;
+PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv;
+PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv;
+PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv;
+PFNGLDEPTHFUNCPROC glad_glDepthFunc;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D;
+PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv;
+PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv;
+PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui;
+PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync;
+PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui;
+PFNGLCOLORMASKPROC glad_glColorMask;
+PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv;
+PFNGLBLENDEQUATIONPROC glad_glBlendEquation;
+PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation;
+PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback;
+PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv;
+PFNGLUNIFORM4FVPROC glad_glUniform4fv;
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback;
+PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv;
+PFNGLISSAMPLERPROC glad_glIsSampler;
+PFNGLVERTEXP3UIPROC glad_glVertexP3ui;
+PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor;
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D;
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D;
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus;
+PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender;
+PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv;
+PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation;
+PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv;
+PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv;
+PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements;
+PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv;
+PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase;
+PFNGLBUFFERSUBDATAPROC glad_glBufferSubData;
+PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv;
+PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange;
+PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture;
+PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays;
+PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv;
+PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv;
+PFNGLDISABLEIPROC glad_glDisablei;
+PFNGLSHADERSOURCEPROC glad_glShaderSource;
+PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers;
+PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv;
+PFNGLGETSYNCIVPROC glad_glGetSynciv;
+PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv;
+PFNGLBEGINQUERYPROC glad_glBeginQuery;
+PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv;
+PFNGLBINDBUFFERPROC glad_glBindBuffer;
+PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv;
+PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv;
+PFNGLBUFFERDATAPROC glad_glBufferData;
+PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv;
+PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui;
+PFNGLGETERRORPROC glad_glGetError;
+PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui;
+PFNGLGETFLOATVPROC glad_glGetFloatv;
+PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D;
+PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv;
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv;
+PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i;
+PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv;
+PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv;
+PFNGLGETINTEGERVPROC glad_glGetIntegerv;
+PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv;
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D;
+PFNGLISQUERYPROC glad_glIsQuery;
+PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv;
+PFNGLTEXIMAGE2DPROC glad_glTexImage2D;
+PFNGLSTENCILMASKPROC glad_glStencilMask;
+PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv;
+PFNGLISTEXTUREPROC glad_glIsTexture;
+PFNGLUNIFORM1FVPROC glad_glUniform1fv;
+PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv;
+PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv;
+PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv;
+PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData;
+PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv;
+PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d;
+PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f;
+PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv;
+PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v;
+PFNGLDEPTHMASKPROC glad_glDepthMask;
+PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s;
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample;
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex;
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample;
+PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform;
+PFNGLFRONTFACEPROC glad_glFrontFace;
+static void load_GL_VERSION_1_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)load("glFrontFace");
+	glad_glHint = (PFNGLHINTPROC)load("glHint");
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)load("glLineWidth");
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)load("glPointSize");
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)load("glPolygonMode");
+	glad_glScissor = (PFNGLSCISSORPROC)load("glScissor");
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)load("glTexParameterf");
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)load("glTexParameterfv");
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)load("glTexParameteri");
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)load("glTexParameteriv");
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)load("glTexImage1D");
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)load("glTexImage2D");
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)load("glDrawBuffer");
+	glad_glClear = (PFNGLCLEARPROC)load("glClear");
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)load("glClearColor");
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)load("glClearStencil");
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)load("glClearDepth");
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)load("glStencilMask");
+	glad_glColorMask = (PFNGLCOLORMASKPROC)load("glColorMask");
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)load("glDepthMask");
+	glad_glDisable = (PFNGLDISABLEPROC)load("glDisable");
+	glad_glEnable = (PFNGLENABLEPROC)load("glEnable");
+	glad_glFinish = (PFNGLFINISHPROC)load("glFinish");
+	glad_glFlush = (PFNGLFLUSHPROC)load("glFlush");
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)load("glBlendFunc");
+	glad_glLogicOp = (PFNGLLOGICOPPROC)load("glLogicOp");
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)load("glStencilFunc");
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)load("glStencilOp");
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)load("glDepthFunc");
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)load("glPixelStoref");
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)load("glPixelStorei");
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)load("glReadBuffer");
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)load("glReadPixels");
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)load("glGetBooleanv");
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)load("glGetDoublev");
+	glad_glGetError = (PFNGLGETERRORPROC)load("glGetError");
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)load("glGetFloatv");
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)load("glGetIntegerv");
+	glad_glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)load("glGetTexImage");
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)load("glGetTexParameterfv");
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)load("glGetTexParameteriv");
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)load("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)load("glGetTexLevelParameteriv");
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)load("glIsEnabled");
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)load("glDepthRange");
+	glad_glViewport = (PFNGLVIEWPORTPROC)load("glViewport");
+}
+static void load_GL_VERSION_1_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)load("glDrawArrays");
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)load("glDrawElements");
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)load("glPolygonOffset");
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)load("glCopyTexImage1D");
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)load("glCopyTexImage2D");
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)load("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)load("glCopyTexSubImage2D");
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)load("glTexSubImage1D");
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)load("glTexSubImage2D");
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)load("glBindTexture");
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)load("glDeleteTextures");
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)load("glGenTextures");
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)load("glIsTexture");
+}
+static void load_GL_VERSION_1_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)load("glDrawRangeElements");
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)load("glTexImage3D");
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)load("glTexSubImage3D");
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)load("glCopyTexSubImage3D");
+}
+static void load_GL_VERSION_1_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)load("glActiveTexture");
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)load("glSampleCoverage");
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)load("glCompressedTexImage3D");
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)load("glCompressedTexImage2D");
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)load("glCompressedTexImage1D");
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)load("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)load("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)load("glCompressedTexSubImage1D");
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)load("glGetCompressedTexImage");
+}
+static void load_GL_VERSION_1_4(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)load("glBlendFuncSeparate");
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)load("glMultiDrawArrays");
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)load("glMultiDrawElements");
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)load("glPointParameterf");
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)load("glPointParameterfv");
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)load("glPointParameteri");
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)load("glPointParameteriv");
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)load("glBlendColor");
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)load("glBlendEquation");
+}
+static void load_GL_VERSION_1_5(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)load("glGenQueries");
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)load("glDeleteQueries");
+	glad_glIsQuery = (PFNGLISQUERYPROC)load("glIsQuery");
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)load("glBeginQuery");
+	glad_glEndQuery = (PFNGLENDQUERYPROC)load("glEndQuery");
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)load("glGetQueryiv");
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)load("glGetQueryObjectiv");
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)load("glGetQueryObjectuiv");
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)load("glBindBuffer");
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)load("glDeleteBuffers");
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)load("glGenBuffers");
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)load("glIsBuffer");
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)load("glBufferData");
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)load("glBufferSubData");
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)load("glGetBufferSubData");
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)load("glMapBuffer");
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)load("glUnmapBuffer");
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)load("glGetBufferParameteriv");
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)load("glGetBufferPointerv");
+}
+static void load_GL_VERSION_2_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)load("glBlendEquationSeparate");
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)load("glDrawBuffers");
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)load("glStencilOpSeparate");
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)load("glStencilFuncSeparate");
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)load("glStencilMaskSeparate");
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)load("glAttachShader");
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)load("glBindAttribLocation");
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)load("glCompileShader");
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)load("glCreateProgram");
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)load("glCreateShader");
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)load("glDeleteProgram");
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)load("glDeleteShader");
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)load("glDetachShader");
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)load("glDisableVertexAttribArray");
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)load("glEnableVertexAttribArray");
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)load("glGetActiveAttrib");
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)load("glGetActiveUniform");
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)load("glGetAttachedShaders");
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)load("glGetAttribLocation");
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)load("glGetProgramiv");
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)load("glGetProgramInfoLog");
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)load("glGetShaderiv");
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)load("glGetShaderInfoLog");
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)load("glGetShaderSource");
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)load("glGetUniformLocation");
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)load("glGetUniformfv");
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)load("glGetUniformiv");
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)load("glGetVertexAttribdv");
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)load("glGetVertexAttribfv");
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)load("glGetVertexAttribiv");
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)load("glGetVertexAttribPointerv");
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)load("glIsProgram");
+	glad_glIsShader = (PFNGLISSHADERPROC)load("glIsShader");
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)load("glLinkProgram");
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)load("glShaderSource");
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)load("glUseProgram");
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)load("glUniform1f");
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)load("glUniform2f");
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)load("glUniform3f");
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)load("glUniform4f");
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)load("glUniform1i");
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)load("glUniform2i");
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)load("glUniform3i");
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)load("glUniform4i");
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)load("glUniform1fv");
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)load("glUniform2fv");
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)load("glUniform3fv");
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)load("glUniform4fv");
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)load("glUniform1iv");
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)load("glUniform2iv");
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)load("glUniform3iv");
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)load("glUniform4iv");
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)load("glUniformMatrix2fv");
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)load("glUniformMatrix3fv");
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)load("glUniformMatrix4fv");
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)load("glValidateProgram");
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)load("glVertexAttrib1d");
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)load("glVertexAttrib1dv");
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)load("glVertexAttrib1f");
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)load("glVertexAttrib1fv");
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)load("glVertexAttrib1s");
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)load("glVertexAttrib1sv");
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)load("glVertexAttrib2d");
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)load("glVertexAttrib2dv");
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)load("glVertexAttrib2f");
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)load("glVertexAttrib2fv");
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)load("glVertexAttrib2s");
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)load("glVertexAttrib2sv");
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)load("glVertexAttrib3d");
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)load("glVertexAttrib3dv");
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)load("glVertexAttrib3f");
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)load("glVertexAttrib3fv");
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)load("glVertexAttrib3s");
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)load("glVertexAttrib3sv");
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)load("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)load("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)load("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)load("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)load("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)load("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)load("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)load("glVertexAttrib4bv");
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)load("glVertexAttrib4d");
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)load("glVertexAttrib4dv");
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)load("glVertexAttrib4f");
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)load("glVertexAttrib4fv");
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)load("glVertexAttrib4iv");
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)load("glVertexAttrib4s");
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)load("glVertexAttrib4sv");
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)load("glVertexAttrib4ubv");
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)load("glVertexAttrib4uiv");
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)load("glVertexAttrib4usv");
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)load("glVertexAttribPointer");
+}
+static void load_GL_VERSION_2_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)load("glUniformMatrix2x3fv");
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)load("glUniformMatrix3x2fv");
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)load("glUniformMatrix2x4fv");
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)load("glUniformMatrix4x2fv");
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)load("glUniformMatrix3x4fv");
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)load("glUniformMatrix4x3fv");
+}
+static void load_GL_VERSION_3_0(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)load("glColorMaski");
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)load("glGetBooleani_v");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+	glad_glEnablei = (PFNGLENABLEIPROC)load("glEnablei");
+	glad_glDisablei = (PFNGLDISABLEIPROC)load("glDisablei");
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)load("glIsEnabledi");
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)load("glBeginTransformFeedback");
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)load("glEndTransformFeedback");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)load("glTransformFeedbackVaryings");
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)load("glGetTransformFeedbackVarying");
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)load("glClampColor");
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)load("glBeginConditionalRender");
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)load("glEndConditionalRender");
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)load("glVertexAttribIPointer");
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)load("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)load("glGetVertexAttribIuiv");
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)load("glVertexAttribI1i");
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)load("glVertexAttribI2i");
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)load("glVertexAttribI3i");
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)load("glVertexAttribI4i");
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)load("glVertexAttribI1ui");
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)load("glVertexAttribI2ui");
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)load("glVertexAttribI3ui");
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)load("glVertexAttribI4ui");
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)load("glVertexAttribI1iv");
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)load("glVertexAttribI2iv");
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)load("glVertexAttribI3iv");
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)load("glVertexAttribI4iv");
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)load("glVertexAttribI1uiv");
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)load("glVertexAttribI2uiv");
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)load("glVertexAttribI3uiv");
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)load("glVertexAttribI4uiv");
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)load("glVertexAttribI4bv");
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)load("glVertexAttribI4sv");
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)load("glVertexAttribI4ubv");
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)load("glVertexAttribI4usv");
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)load("glGetUniformuiv");
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)load("glBindFragDataLocation");
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)load("glGetFragDataLocation");
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)load("glUniform1ui");
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)load("glUniform2ui");
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)load("glUniform3ui");
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)load("glUniform4ui");
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)load("glUniform1uiv");
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)load("glUniform2uiv");
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)load("glUniform3uiv");
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)load("glUniform4uiv");
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)load("glTexParameterIiv");
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)load("glTexParameterIuiv");
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)load("glGetTexParameterIiv");
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)load("glGetTexParameterIuiv");
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)load("glClearBufferiv");
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)load("glClearBufferuiv");
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)load("glClearBufferfv");
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)load("glClearBufferfi");
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)load("glGetStringi");
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)load("glIsRenderbuffer");
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)load("glBindRenderbuffer");
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)load("glDeleteRenderbuffers");
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)load("glGenRenderbuffers");
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)load("glRenderbufferStorage");
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)load("glGetRenderbufferParameteriv");
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)load("glIsFramebuffer");
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)load("glBindFramebuffer");
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)load("glDeleteFramebuffers");
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)load("glGenFramebuffers");
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)load("glCheckFramebufferStatus");
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)load("glFramebufferTexture1D");
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)load("glFramebufferTexture2D");
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)load("glFramebufferTexture3D");
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)load("glFramebufferRenderbuffer");
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)load("glGetFramebufferAttachmentParameteriv");
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)load("glGenerateMipmap");
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)load("glBlitFramebuffer");
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)load("glRenderbufferStorageMultisample");
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)load("glFramebufferTextureLayer");
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)load("glMapBufferRange");
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)load("glFlushMappedBufferRange");
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)load("glBindVertexArray");
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)load("glDeleteVertexArrays");
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)load("glGenVertexArrays");
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)load("glIsVertexArray");
+}
+static void load_GL_VERSION_3_1(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)load("glDrawArraysInstanced");
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)load("glDrawElementsInstanced");
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)load("glTexBuffer");
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)load("glPrimitiveRestartIndex");
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)load("glCopyBufferSubData");
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)load("glGetUniformIndices");
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)load("glGetActiveUniformsiv");
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)load("glGetActiveUniformName");
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)load("glGetUniformBlockIndex");
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)load("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)load("glGetActiveUniformBlockName");
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)load("glUniformBlockBinding");
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)load("glBindBufferRange");
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)load("glBindBufferBase");
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)load("glGetIntegeri_v");
+}
+static void load_GL_VERSION_3_2(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)load("glDrawElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)load("glDrawRangeElementsBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)load("glDrawElementsInstancedBaseVertex");
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)load("glMultiDrawElementsBaseVertex");
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)load("glProvokingVertex");
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)load("glFenceSync");
+	glad_glIsSync = (PFNGLISSYNCPROC)load("glIsSync");
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)load("glDeleteSync");
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)load("glClientWaitSync");
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)load("glWaitSync");
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)load("glGetInteger64v");
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)load("glGetSynciv");
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)load("glGetInteger64i_v");
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)load("glGetBufferParameteri64v");
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)load("glFramebufferTexture");
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)load("glTexImage2DMultisample");
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)load("glTexImage3DMultisample");
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)load("glGetMultisamplefv");
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)load("glSampleMaski");
+}
+static void load_GL_VERSION_3_3(GLADloadproc load) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)load("glBindFragDataLocationIndexed");
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)load("glGetFragDataIndex");
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)load("glGenSamplers");
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)load("glDeleteSamplers");
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)load("glIsSampler");
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)load("glBindSampler");
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)load("glSamplerParameteri");
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)load("glSamplerParameteriv");
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)load("glSamplerParameterf");
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)load("glSamplerParameterfv");
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)load("glSamplerParameterIiv");
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)load("glSamplerParameterIuiv");
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)load("glGetSamplerParameteriv");
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)load("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)load("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)load("glGetSamplerParameterIuiv");
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)load("glQueryCounter");
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)load("glGetQueryObjecti64v");
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)load("glGetQueryObjectui64v");
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)load("glVertexAttribDivisor");
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)load("glVertexAttribP1ui");
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)load("glVertexAttribP1uiv");
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)load("glVertexAttribP2ui");
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)load("glVertexAttribP2uiv");
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)load("glVertexAttribP3ui");
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)load("glVertexAttribP3uiv");
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)load("glVertexAttribP4ui");
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)load("glVertexAttribP4uiv");
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)load("glVertexP2ui");
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)load("glVertexP2uiv");
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)load("glVertexP3ui");
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)load("glVertexP3uiv");
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)load("glVertexP4ui");
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)load("glVertexP4uiv");
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)load("glTexCoordP1ui");
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)load("glTexCoordP1uiv");
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)load("glTexCoordP2ui");
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)load("glTexCoordP2uiv");
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)load("glTexCoordP3ui");
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)load("glTexCoordP3uiv");
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)load("glTexCoordP4ui");
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)load("glTexCoordP4uiv");
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)load("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)load("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)load("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)load("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)load("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)load("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)load("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)load("glMultiTexCoordP4uiv");
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)load("glNormalP3ui");
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)load("glNormalP3uiv");
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)load("glColorP3ui");
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)load("glColorP3uiv");
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)load("glColorP4ui");
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)load("glColorP4uiv");
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)load("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)load("glSecondaryColorP3uiv");
+}
+static int find_extensionsGL(void) {
+	if (!get_exts()) return 0;
+	(void)&has_ext;
+	free_exts();
+	return 1;
+}
+
+static void find_coreGL(void) {
+
+    /* Thank you @elmindreda
+     * https://github.com/elmindreda/greg/blob/master/templates/greg.c.in#L176
+     * https://github.com/glfw/glfw/blob/master/src/context.c#L36
+     */
+    int i, major, minor;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+/* PR #18 */
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+    max_loaded_major = major; max_loaded_minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	if (GLVersion.major > 3 || (GLVersion.major >= 3 && GLVersion.minor >= 3)) {
+		max_loaded_major = 3;
+		max_loaded_minor = 3;
+	}
+}
+
+#ifdef GLAD_LAZY
+/* lazy loading: gladLoadGLLoader only resolves glGetString and points
+ * the glad_gl* pointers of the versions the context supports at
+ * trampolines (the others stay NULL, as with eager loading). On its
+ * first call the trampoline resolves the real function, patches the
+ * pointer and forwards the call, so later calls go straight to the
+ * driver.
+ * Threads racing on a first call all resolve the same address; the
+ * patch is an atomic compare and swap from the trampoline, so one of
+ * them stores it and counts it. The calls read the pointers with plain
+ * loads, which see either the trampoline or the real function. */
+
+static GLADloadproc glad_lazy_loader = NULL;
+static int glad_lazy_resolved = 0;
+
+static void* glad_lazy_resolve(const char *name, void **slot, void *trampoline) {
+    void *proc = glad_lazy_loader(name);
+    if (proc == NULL) {
+        fprintf(stderr, "glad: %s is not available\n", name);
+        abort();
+    }
+    if (__atomic_compare_exchange_n(slot, &trampoline, proc, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        __atomic_add_fetch(&glad_lazy_resolved, 1, __ATOMIC_RELAXED);
+    return proc;
+}
+
+int gladLazyResolvedCount(void) {
+    return __atomic_load_n(&glad_lazy_resolved, __ATOMIC_RELAXED);
+}
+static void APIENTRY glad_lazy_glCullFace(GLenum mode) {
+    PFNGLCULLFACEPROC glad_proc = (PFNGLCULLFACEPROC)glad_lazy_resolve("glCullFace", (void**)&glad_glCullFace, (void*)glad_lazy_glCullFace);
+    glad_proc(mode);
+}
+static void APIENTRY glad_lazy_glFrontFace(GLenum mode) {
+    PFNGLFRONTFACEPROC glad_proc = (PFNGLFRONTFACEPROC)glad_lazy_resolve("glFrontFace", (void**)&glad_glFrontFace, (void*)glad_lazy_glFrontFace);
+    glad_proc(mode);
+}
+static void APIENTRY glad_lazy_glHint(GLenum target, GLenum mode) {
+    PFNGLHINTPROC glad_proc = (PFNGLHINTPROC)glad_lazy_resolve("glHint", (void**)&glad_glHint, (void*)glad_lazy_glHint);
+    glad_proc(target, mode);
+}
+static void APIENTRY glad_lazy_glLineWidth(GLfloat width) {
+    PFNGLLINEWIDTHPROC glad_proc = (PFNGLLINEWIDTHPROC)glad_lazy_resolve("glLineWidth", (void**)&glad_glLineWidth, (void*)glad_lazy_glLineWidth);
+    glad_proc(width);
+}
+static void APIENTRY glad_lazy_glPointSize(GLfloat size) {
+    PFNGLPOINTSIZEPROC glad_proc = (PFNGLPOINTSIZEPROC)glad_lazy_resolve("glPointSize", (void**)&glad_glPointSize, (void*)glad_lazy_glPointSize);
+    glad_proc(size);
+}
+static void APIENTRY glad_lazy_glPolygonMode(GLenum face, GLenum mode) {
+    PFNGLPOLYGONMODEPROC glad_proc = (PFNGLPOLYGONMODEPROC)glad_lazy_resolve("glPolygonMode", (void**)&glad_glPolygonMode, (void*)glad_lazy_glPolygonMode);
+    glad_proc(face, mode);
+}
+static void APIENTRY glad_lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLSCISSORPROC glad_proc = (PFNGLSCISSORPROC)glad_lazy_resolve("glScissor", (void**)&glad_glScissor, (void*)glad_lazy_glScissor);
+    glad_proc(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+    PFNGLTEXPARAMETERFPROC glad_proc = (PFNGLTEXPARAMETERFPROC)glad_lazy_resolve("glTexParameterf", (void**)&glad_glTexParameterf, (void*)glad_lazy_glTexParameterf);
+    glad_proc(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+    PFNGLTEXPARAMETERFVPROC glad_proc = (PFNGLTEXPARAMETERFVPROC)glad_lazy_resolve("glTexParameterfv", (void**)&glad_glTexParameterfv, (void*)glad_lazy_glTexParameterfv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+    PFNGLTEXPARAMETERIPROC glad_proc = (PFNGLTEXPARAMETERIPROC)glad_lazy_resolve("glTexParameteri", (void**)&glad_glTexParameteri, (void*)glad_lazy_glTexParameteri);
+    glad_proc(target, pname, param);
+}
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+    PFNGLTEXPARAMETERIVPROC glad_proc = (PFNGLTEXPARAMETERIVPROC)glad_lazy_resolve("glTexParameteriv", (void**)&glad_glTexParameteriv, (void*)glad_lazy_glTexParameteriv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXIMAGE1DPROC glad_proc = (PFNGLTEXIMAGE1DPROC)glad_lazy_resolve("glTexImage1D", (void**)&glad_glTexImage1D, (void*)glad_lazy_glTexImage1D);
+    glad_proc(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXIMAGE2DPROC glad_proc = (PFNGLTEXIMAGE2DPROC)glad_lazy_resolve("glTexImage2D", (void**)&glad_glTexImage2D, (void*)glad_lazy_glTexImage2D);
+    glad_proc(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum buf) {
+    PFNGLDRAWBUFFERPROC glad_proc = (PFNGLDRAWBUFFERPROC)glad_lazy_resolve("glDrawBuffer", (void**)&glad_glDrawBuffer, (void*)glad_lazy_glDrawBuffer);
+    glad_proc(buf);
+}
+static void APIENTRY glad_lazy_glClear(GLbitfield mask) {
+    PFNGLCLEARPROC glad_proc = (PFNGLCLEARPROC)glad_lazy_resolve("glClear", (void**)&glad_glClear, (void*)glad_lazy_glClear);
+    glad_proc(mask);
+}
+static void APIENTRY glad_lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    PFNGLCLEARCOLORPROC glad_proc = (PFNGLCLEARCOLORPROC)glad_lazy_resolve("glClearColor", (void**)&glad_glClearColor, (void*)glad_lazy_glClearColor);
+    glad_proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glClearStencil(GLint s) {
+    PFNGLCLEARSTENCILPROC glad_proc = (PFNGLCLEARSTENCILPROC)glad_lazy_resolve("glClearStencil", (void**)&glad_glClearStencil, (void*)glad_lazy_glClearStencil);
+    glad_proc(s);
+}
+static void APIENTRY glad_lazy_glClearDepth(GLdouble depth) {
+    PFNGLCLEARDEPTHPROC glad_proc = (PFNGLCLEARDEPTHPROC)glad_lazy_resolve("glClearDepth", (void**)&glad_glClearDepth, (void*)glad_lazy_glClearDepth);
+    glad_proc(depth);
+}
+static void APIENTRY glad_lazy_glStencilMask(GLuint mask) {
+    PFNGLSTENCILMASKPROC glad_proc = (PFNGLSTENCILMASKPROC)glad_lazy_resolve("glStencilMask", (void**)&glad_glStencilMask, (void*)glad_lazy_glStencilMask);
+    glad_proc(mask);
+}
+static void APIENTRY glad_lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    PFNGLCOLORMASKPROC glad_proc = (PFNGLCOLORMASKPROC)glad_lazy_resolve("glColorMask", (void**)&glad_glColorMask, (void*)glad_lazy_glColorMask);
+    glad_proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glDepthMask(GLboolean flag) {
+    PFNGLDEPTHMASKPROC glad_proc = (PFNGLDEPTHMASKPROC)glad_lazy_resolve("glDepthMask", (void**)&glad_glDepthMask, (void*)glad_lazy_glDepthMask);
+    glad_proc(flag);
+}
+static void APIENTRY glad_lazy_glDisable(GLenum cap) {
+    PFNGLDISABLEPROC glad_proc = (PFNGLDISABLEPROC)glad_lazy_resolve("glDisable", (void**)&glad_glDisable, (void*)glad_lazy_glDisable);
+    glad_proc(cap);
+}
+static void APIENTRY glad_lazy_glEnable(GLenum cap) {
+    PFNGLENABLEPROC glad_proc = (PFNGLENABLEPROC)glad_lazy_resolve("glEnable", (void**)&glad_glEnable, (void*)glad_lazy_glEnable);
+    glad_proc(cap);
+}
+static void APIENTRY glad_lazy_glFinish(void) {
+    PFNGLFINISHPROC glad_proc = (PFNGLFINISHPROC)glad_lazy_resolve("glFinish", (void**)&glad_glFinish, (void*)glad_lazy_glFinish);
+    glad_proc();
+}
+static void APIENTRY glad_lazy_glFlush(void) {
+    PFNGLFLUSHPROC glad_proc = (PFNGLFLUSHPROC)glad_lazy_resolve("glFlush", (void**)&glad_glFlush, (void*)glad_lazy_glFlush);
+    glad_proc();
+}
+static void APIENTRY glad_lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+    PFNGLBLENDFUNCPROC glad_proc = (PFNGLBLENDFUNCPROC)glad_lazy_resolve("glBlendFunc", (void**)&glad_glBlendFunc, (void*)glad_lazy_glBlendFunc);
+    glad_proc(sfactor, dfactor);
+}
+static void APIENTRY glad_lazy_glLogicOp(GLenum opcode) {
+    PFNGLLOGICOPPROC glad_proc = (PFNGLLOGICOPPROC)glad_lazy_resolve("glLogicOp", (void**)&glad_glLogicOp, (void*)glad_lazy_glLogicOp);
+    glad_proc(opcode);
+}
+static void APIENTRY glad_lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+    PFNGLSTENCILFUNCPROC glad_proc = (PFNGLSTENCILFUNCPROC)glad_lazy_resolve("glStencilFunc", (void**)&glad_glStencilFunc, (void*)glad_lazy_glStencilFunc);
+    glad_proc(func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+    PFNGLSTENCILOPPROC glad_proc = (PFNGLSTENCILOPPROC)glad_lazy_resolve("glStencilOp", (void**)&glad_glStencilOp, (void*)glad_lazy_glStencilOp);
+    glad_proc(fail, zfail, zpass);
+}
+static void APIENTRY glad_lazy_glDepthFunc(GLenum func) {
+    PFNGLDEPTHFUNCPROC glad_proc = (PFNGLDEPTHFUNCPROC)glad_lazy_resolve("glDepthFunc", (void**)&glad_glDepthFunc, (void*)glad_lazy_glDepthFunc);
+    glad_proc(func);
+}
+static void APIENTRY glad_lazy_glPixelStoref(GLenum pname, GLfloat param) {
+    PFNGLPIXELSTOREFPROC glad_proc = (PFNGLPIXELSTOREFPROC)glad_lazy_resolve("glPixelStoref", (void**)&glad_glPixelStoref, (void*)glad_lazy_glPixelStoref);
+    glad_proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPixelStorei(GLenum pname, GLint param) {
+    PFNGLPIXELSTOREIPROC glad_proc = (PFNGLPIXELSTOREIPROC)glad_lazy_resolve("glPixelStorei", (void**)&glad_glPixelStorei, (void*)glad_lazy_glPixelStorei);
+    glad_proc(pname, param);
+}
+static void APIENTRY glad_lazy_glReadBuffer(GLenum src) {
+    PFNGLREADBUFFERPROC glad_proc = (PFNGLREADBUFFERPROC)glad_lazy_resolve("glReadBuffer", (void**)&glad_glReadBuffer, (void*)glad_lazy_glReadBuffer);
+    glad_proc(src);
+}
+static void APIENTRY glad_lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+    PFNGLREADPIXELSPROC glad_proc = (PFNGLREADPIXELSPROC)glad_lazy_resolve("glReadPixels", (void**)&glad_glReadPixels, (void*)glad_lazy_glReadPixels);
+    glad_proc(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+    PFNGLGETBOOLEANVPROC glad_proc = (PFNGLGETBOOLEANVPROC)glad_lazy_resolve("glGetBooleanv", (void**)&glad_glGetBooleanv, (void*)glad_lazy_glGetBooleanv);
+    glad_proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+    PFNGLGETDOUBLEVPROC glad_proc = (PFNGLGETDOUBLEVPROC)glad_lazy_resolve("glGetDoublev", (void**)&glad_glGetDoublev, (void*)glad_lazy_glGetDoublev);
+    glad_proc(pname, data);
+}
+static GLenum APIENTRY glad_lazy_glGetError(void) {
+    PFNGLGETERRORPROC glad_proc = (PFNGLGETERRORPROC)glad_lazy_resolve("glGetError", (void**)&glad_glGetError, (void*)glad_lazy_glGetError);
+    return glad_proc();
+}
+static void APIENTRY glad_lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+    PFNGLGETFLOATVPROC glad_proc = (PFNGLGETFLOATVPROC)glad_lazy_resolve("glGetFloatv", (void**)&glad_glGetFloatv, (void*)glad_lazy_glGetFloatv);
+    glad_proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum pname, GLint *data) {
+    PFNGLGETINTEGERVPROC glad_proc = (PFNGLGETINTEGERVPROC)glad_lazy_resolve("glGetIntegerv", (void**)&glad_glGetIntegerv, (void*)glad_lazy_glGetIntegerv);
+    glad_proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+    PFNGLGETTEXIMAGEPROC glad_proc = (PFNGLGETTEXIMAGEPROC)glad_lazy_resolve("glGetTexImage", (void**)&glad_glGetTexImage, (void*)glad_lazy_glGetTexImage);
+    glad_proc(target, level, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+    PFNGLGETTEXPARAMETERFVPROC glad_proc = (PFNGLGETTEXPARAMETERFVPROC)glad_lazy_resolve("glGetTexParameterfv", (void**)&glad_glGetTexParameterfv, (void*)glad_lazy_glGetTexParameterfv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+    PFNGLGETTEXPARAMETERIVPROC glad_proc = (PFNGLGETTEXPARAMETERIVPROC)glad_lazy_resolve("glGetTexParameteriv", (void**)&glad_glGetTexParameteriv, (void*)glad_lazy_glGetTexParameteriv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+    PFNGLGETTEXLEVELPARAMETERFVPROC glad_proc = (PFNGLGETTEXLEVELPARAMETERFVPROC)glad_lazy_resolve("glGetTexLevelParameterfv", (void**)&glad_glGetTexLevelParameterfv, (void*)glad_lazy_glGetTexLevelParameterfv);
+    glad_proc(target, level, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+    PFNGLGETTEXLEVELPARAMETERIVPROC glad_proc = (PFNGLGETTEXLEVELPARAMETERIVPROC)glad_lazy_resolve("glGetTexLevelParameteriv", (void**)&glad_glGetTexLevelParameteriv, (void*)glad_lazy_glGetTexLevelParameteriv);
+    glad_proc(target, level, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum cap) {
+    PFNGLISENABLEDPROC glad_proc = (PFNGLISENABLEDPROC)glad_lazy_resolve("glIsEnabled", (void**)&glad_glIsEnabled, (void*)glad_lazy_glIsEnabled);
+    return glad_proc(cap);
+}
+static void APIENTRY glad_lazy_glDepthRange(GLdouble near, GLdouble far) {
+    PFNGLDEPTHRANGEPROC glad_proc = (PFNGLDEPTHRANGEPROC)glad_lazy_resolve("glDepthRange", (void**)&glad_glDepthRange, (void*)glad_lazy_glDepthRange);
+    glad_proc(near, far);
+}
+static void APIENTRY glad_lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLVIEWPORTPROC glad_proc = (PFNGLVIEWPORTPROC)glad_lazy_resolve("glViewport", (void**)&glad_glViewport, (void*)glad_lazy_glViewport);
+    glad_proc(x, y, width, height);
+}
+static void APIENTRY glad_lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    PFNGLDRAWARRAYSPROC glad_proc = (PFNGLDRAWARRAYSPROC)glad_lazy_resolve("glDrawArrays", (void**)&glad_glDrawArrays, (void*)glad_lazy_glDrawArrays);
+    glad_proc(mode, first, count);
+}
+static void APIENTRY glad_lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+    PFNGLDRAWELEMENTSPROC glad_proc = (PFNGLDRAWELEMENTSPROC)glad_lazy_resolve("glDrawElements", (void**)&glad_glDrawElements, (void*)glad_lazy_glDrawElements);
+    glad_proc(mode, count, type, indices);
+}
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+    PFNGLPOLYGONOFFSETPROC glad_proc = (PFNGLPOLYGONOFFSETPROC)glad_lazy_resolve("glPolygonOffset", (void**)&glad_glPolygonOffset, (void*)glad_lazy_glPolygonOffset);
+    glad_proc(factor, units);
+}
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+    PFNGLCOPYTEXIMAGE1DPROC glad_proc = (PFNGLCOPYTEXIMAGE1DPROC)glad_lazy_resolve("glCopyTexImage1D", (void**)&glad_glCopyTexImage1D, (void*)glad_lazy_glCopyTexImage1D);
+    glad_proc(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+    PFNGLCOPYTEXIMAGE2DPROC glad_proc = (PFNGLCOPYTEXIMAGE2DPROC)glad_lazy_resolve("glCopyTexImage2D", (void**)&glad_glCopyTexImage2D, (void*)glad_lazy_glCopyTexImage2D);
+    glad_proc(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+    PFNGLCOPYTEXSUBIMAGE1DPROC glad_proc = (PFNGLCOPYTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCopyTexSubImage1D", (void**)&glad_glCopyTexSubImage1D, (void*)glad_lazy_glCopyTexSubImage1D);
+    glad_proc(target, level, xoffset, x, y, width);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLCOPYTEXSUBIMAGE2DPROC glad_proc = (PFNGLCOPYTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCopyTexSubImage2D", (void**)&glad_glCopyTexSubImage2D, (void*)glad_lazy_glCopyTexSubImage2D);
+    glad_proc(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXSUBIMAGE1DPROC glad_proc = (PFNGLTEXSUBIMAGE1DPROC)glad_lazy_resolve("glTexSubImage1D", (void**)&glad_glTexSubImage1D, (void*)glad_lazy_glTexSubImage1D);
+    glad_proc(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXSUBIMAGE2DPROC glad_proc = (PFNGLTEXSUBIMAGE2DPROC)glad_lazy_resolve("glTexSubImage2D", (void**)&glad_glTexSubImage2D, (void*)glad_lazy_glTexSubImage2D);
+    glad_proc(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glBindTexture(GLenum target, GLuint texture) {
+    PFNGLBINDTEXTUREPROC glad_proc = (PFNGLBINDTEXTUREPROC)glad_lazy_resolve("glBindTexture", (void**)&glad_glBindTexture, (void*)glad_lazy_glBindTexture);
+    glad_proc(target, texture);
+}
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+    PFNGLDELETETEXTURESPROC glad_proc = (PFNGLDELETETEXTURESPROC)glad_lazy_resolve("glDeleteTextures", (void**)&glad_glDeleteTextures, (void*)glad_lazy_glDeleteTextures);
+    glad_proc(n, textures);
+}
+static void APIENTRY glad_lazy_glGenTextures(GLsizei n, GLuint *textures) {
+    PFNGLGENTEXTURESPROC glad_proc = (PFNGLGENTEXTURESPROC)glad_lazy_resolve("glGenTextures", (void**)&glad_glGenTextures, (void*)glad_lazy_glGenTextures);
+    glad_proc(n, textures);
+}
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint texture) {
+    PFNGLISTEXTUREPROC glad_proc = (PFNGLISTEXTUREPROC)glad_lazy_resolve("glIsTexture", (void**)&glad_glIsTexture, (void*)glad_lazy_glIsTexture);
+    return glad_proc(texture);
+}
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+    PFNGLDRAWRANGEELEMENTSPROC glad_proc = (PFNGLDRAWRANGEELEMENTSPROC)glad_lazy_resolve("glDrawRangeElements", (void**)&glad_glDrawRangeElements, (void*)glad_lazy_glDrawRangeElements);
+    glad_proc(mode, start, end, count, type, indices);
+}
+static void APIENTRY glad_lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXIMAGE3DPROC glad_proc = (PFNGLTEXIMAGE3DPROC)glad_lazy_resolve("glTexImage3D", (void**)&glad_glTexImage3D, (void*)glad_lazy_glTexImage3D);
+    glad_proc(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+    PFNGLTEXSUBIMAGE3DPROC glad_proc = (PFNGLTEXSUBIMAGE3DPROC)glad_lazy_resolve("glTexSubImage3D", (void**)&glad_glTexSubImage3D, (void*)glad_lazy_glTexSubImage3D);
+    glad_proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+    PFNGLCOPYTEXSUBIMAGE3DPROC glad_proc = (PFNGLCOPYTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCopyTexSubImage3D", (void**)&glad_glCopyTexSubImage3D, (void*)glad_lazy_glCopyTexSubImage3D);
+    glad_proc(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY glad_lazy_glActiveTexture(GLenum texture) {
+    PFNGLACTIVETEXTUREPROC glad_proc = (PFNGLACTIVETEXTUREPROC)glad_lazy_resolve("glActiveTexture", (void**)&glad_glActiveTexture, (void*)glad_lazy_glActiveTexture);
+    glad_proc(texture);
+}
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+    PFNGLSAMPLECOVERAGEPROC glad_proc = (PFNGLSAMPLECOVERAGEPROC)glad_lazy_resolve("glSampleCoverage", (void**)&glad_glSampleCoverage, (void*)glad_lazy_glSampleCoverage);
+    glad_proc(value, invert);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_proc = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glad_lazy_resolve("glCompressedTexImage3D", (void**)&glad_glCompressedTexImage3D, (void*)glad_lazy_glCompressedTexImage3D);
+    glad_proc(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_proc = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glad_lazy_resolve("glCompressedTexImage2D", (void**)&glad_glCompressedTexImage2D, (void*)glad_lazy_glCompressedTexImage2D);
+    glad_proc(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_proc = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glad_lazy_resolve("glCompressedTexImage1D", (void**)&glad_glCompressedTexImage1D, (void*)glad_lazy_glCompressedTexImage1D);
+    glad_proc(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_proc = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glad_lazy_resolve("glCompressedTexSubImage3D", (void**)&glad_glCompressedTexSubImage3D, (void*)glad_lazy_glCompressedTexSubImage3D);
+    glad_proc(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_proc = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glad_lazy_resolve("glCompressedTexSubImage2D", (void**)&glad_glCompressedTexSubImage2D, (void*)glad_lazy_glCompressedTexSubImage2D);
+    glad_proc(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+    PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_proc = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glad_lazy_resolve("glCompressedTexSubImage1D", (void**)&glad_glCompressedTexSubImage1D, (void*)glad_lazy_glCompressedTexSubImage1D);
+    glad_proc(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+    PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_proc = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glad_lazy_resolve("glGetCompressedTexImage", (void**)&glad_glGetCompressedTexImage, (void*)glad_lazy_glGetCompressedTexImage);
+    glad_proc(target, level, img);
+}
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+    PFNGLBLENDFUNCSEPARATEPROC glad_proc = (PFNGLBLENDFUNCSEPARATEPROC)glad_lazy_resolve("glBlendFuncSeparate", (void**)&glad_glBlendFuncSeparate, (void*)glad_lazy_glBlendFuncSeparate);
+    glad_proc(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+    PFNGLMULTIDRAWARRAYSPROC glad_proc = (PFNGLMULTIDRAWARRAYSPROC)glad_lazy_resolve("glMultiDrawArrays", (void**)&glad_glMultiDrawArrays, (void*)glad_lazy_glMultiDrawArrays);
+    glad_proc(mode, first, count, drawcount);
+}
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+    PFNGLMULTIDRAWELEMENTSPROC glad_proc = (PFNGLMULTIDRAWELEMENTSPROC)glad_lazy_resolve("glMultiDrawElements", (void**)&glad_glMultiDrawElements, (void*)glad_lazy_glMultiDrawElements);
+    glad_proc(mode, count, type, indices, drawcount);
+}
+static void APIENTRY glad_lazy_glPointParameterf(GLenum pname, GLfloat param) {
+    PFNGLPOINTPARAMETERFPROC glad_proc = (PFNGLPOINTPARAMETERFPROC)glad_lazy_resolve("glPointParameterf", (void**)&glad_glPointParameterf, (void*)glad_lazy_glPointParameterf);
+    glad_proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+    PFNGLPOINTPARAMETERFVPROC glad_proc = (PFNGLPOINTPARAMETERFVPROC)glad_lazy_resolve("glPointParameterfv", (void**)&glad_glPointParameterfv, (void*)glad_lazy_glPointParameterfv);
+    glad_proc(pname, params);
+}
+static void APIENTRY glad_lazy_glPointParameteri(GLenum pname, GLint param) {
+    PFNGLPOINTPARAMETERIPROC glad_proc = (PFNGLPOINTPARAMETERIPROC)glad_lazy_resolve("glPointParameteri", (void**)&glad_glPointParameteri, (void*)glad_lazy_glPointParameteri);
+    glad_proc(pname, param);
+}
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+    PFNGLPOINTPARAMETERIVPROC glad_proc = (PFNGLPOINTPARAMETERIVPROC)glad_lazy_resolve("glPointParameteriv", (void**)&glad_glPointParameteriv, (void*)glad_lazy_glPointParameteriv);
+    glad_proc(pname, params);
+}
+static void APIENTRY glad_lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+    PFNGLBLENDCOLORPROC glad_proc = (PFNGLBLENDCOLORPROC)glad_lazy_resolve("glBlendColor", (void**)&glad_glBlendColor, (void*)glad_lazy_glBlendColor);
+    glad_proc(red, green, blue, alpha);
+}
+static void APIENTRY glad_lazy_glBlendEquation(GLenum mode) {
+    PFNGLBLENDEQUATIONPROC glad_proc = (PFNGLBLENDEQUATIONPROC)glad_lazy_resolve("glBlendEquation", (void**)&glad_glBlendEquation, (void*)glad_lazy_glBlendEquation);
+    glad_proc(mode);
+}
+static void APIENTRY glad_lazy_glGenQueries(GLsizei n, GLuint *ids) {
+    PFNGLGENQUERIESPROC glad_proc = (PFNGLGENQUERIESPROC)glad_lazy_resolve("glGenQueries", (void**)&glad_glGenQueries, (void*)glad_lazy_glGenQueries);
+    glad_proc(n, ids);
+}
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+    PFNGLDELETEQUERIESPROC glad_proc = (PFNGLDELETEQUERIESPROC)glad_lazy_resolve("glDeleteQueries", (void**)&glad_glDeleteQueries, (void*)glad_lazy_glDeleteQueries);
+    glad_proc(n, ids);
+}
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint id) {
+    PFNGLISQUERYPROC glad_proc = (PFNGLISQUERYPROC)glad_lazy_resolve("glIsQuery", (void**)&glad_glIsQuery, (void*)glad_lazy_glIsQuery);
+    return glad_proc(id);
+}
+static void APIENTRY glad_lazy_glBeginQuery(GLenum target, GLuint id) {
+    PFNGLBEGINQUERYPROC glad_proc = (PFNGLBEGINQUERYPROC)glad_lazy_resolve("glBeginQuery", (void**)&glad_glBeginQuery, (void*)glad_lazy_glBeginQuery);
+    glad_proc(target, id);
+}
+static void APIENTRY glad_lazy_glEndQuery(GLenum target) {
+    PFNGLENDQUERYPROC glad_proc = (PFNGLENDQUERYPROC)glad_lazy_resolve("glEndQuery", (void**)&glad_glEndQuery, (void*)glad_lazy_glEndQuery);
+    glad_proc(target);
+}
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+    PFNGLGETQUERYIVPROC glad_proc = (PFNGLGETQUERYIVPROC)glad_lazy_resolve("glGetQueryiv", (void**)&glad_glGetQueryiv, (void*)glad_lazy_glGetQueryiv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+    PFNGLGETQUERYOBJECTIVPROC glad_proc = (PFNGLGETQUERYOBJECTIVPROC)glad_lazy_resolve("glGetQueryObjectiv", (void**)&glad_glGetQueryObjectiv, (void*)glad_lazy_glGetQueryObjectiv);
+    glad_proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+    PFNGLGETQUERYOBJECTUIVPROC glad_proc = (PFNGLGETQUERYOBJECTUIVPROC)glad_lazy_resolve("glGetQueryObjectuiv", (void**)&glad_glGetQueryObjectuiv, (void*)glad_lazy_glGetQueryObjectuiv);
+    glad_proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glBindBuffer(GLenum target, GLuint buffer) {
+    PFNGLBINDBUFFERPROC glad_proc = (PFNGLBINDBUFFERPROC)glad_lazy_resolve("glBindBuffer", (void**)&glad_glBindBuffer, (void*)glad_lazy_glBindBuffer);
+    glad_proc(target, buffer);
+}
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+    PFNGLDELETEBUFFERSPROC glad_proc = (PFNGLDELETEBUFFERSPROC)glad_lazy_resolve("glDeleteBuffers", (void**)&glad_glDeleteBuffers, (void*)glad_lazy_glDeleteBuffers);
+    glad_proc(n, buffers);
+}
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+    PFNGLGENBUFFERSPROC glad_proc = (PFNGLGENBUFFERSPROC)glad_lazy_resolve("glGenBuffers", (void**)&glad_glGenBuffers, (void*)glad_lazy_glGenBuffers);
+    glad_proc(n, buffers);
+}
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint buffer) {
+    PFNGLISBUFFERPROC glad_proc = (PFNGLISBUFFERPROC)glad_lazy_resolve("glIsBuffer", (void**)&glad_glIsBuffer, (void*)glad_lazy_glIsBuffer);
+    return glad_proc(buffer);
+}
+static void APIENTRY glad_lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+    PFNGLBUFFERDATAPROC glad_proc = (PFNGLBUFFERDATAPROC)glad_lazy_resolve("glBufferData", (void**)&glad_glBufferData, (void*)glad_lazy_glBufferData);
+    glad_proc(target, size, data, usage);
+}
+static void APIENTRY glad_lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+    PFNGLBUFFERSUBDATAPROC glad_proc = (PFNGLBUFFERSUBDATAPROC)glad_lazy_resolve("glBufferSubData", (void**)&glad_glBufferSubData, (void*)glad_lazy_glBufferSubData);
+    glad_proc(target, offset, size, data);
+}
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+    PFNGLGETBUFFERSUBDATAPROC glad_proc = (PFNGLGETBUFFERSUBDATAPROC)glad_lazy_resolve("glGetBufferSubData", (void**)&glad_glGetBufferSubData, (void*)glad_lazy_glGetBufferSubData);
+    glad_proc(target, offset, size, data);
+}
+static void * APIENTRY glad_lazy_glMapBuffer(GLenum target, GLenum access) {
+    PFNGLMAPBUFFERPROC glad_proc = (PFNGLMAPBUFFERPROC)glad_lazy_resolve("glMapBuffer", (void**)&glad_glMapBuffer, (void*)glad_lazy_glMapBuffer);
+    return glad_proc(target, access);
+}
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum target) {
+    PFNGLUNMAPBUFFERPROC glad_proc = (PFNGLUNMAPBUFFERPROC)glad_lazy_resolve("glUnmapBuffer", (void**)&glad_glUnmapBuffer, (void*)glad_lazy_glUnmapBuffer);
+    return glad_proc(target);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    PFNGLGETBUFFERPARAMETERIVPROC glad_proc = (PFNGLGETBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetBufferParameteriv", (void**)&glad_glGetBufferParameteriv, (void*)glad_lazy_glGetBufferParameteriv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+    PFNGLGETBUFFERPOINTERVPROC glad_proc = (PFNGLGETBUFFERPOINTERVPROC)glad_lazy_resolve("glGetBufferPointerv", (void**)&glad_glGetBufferPointerv, (void*)glad_lazy_glGetBufferPointerv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+    PFNGLBLENDEQUATIONSEPARATEPROC glad_proc = (PFNGLBLENDEQUATIONSEPARATEPROC)glad_lazy_resolve("glBlendEquationSeparate", (void**)&glad_glBlendEquationSeparate, (void*)glad_lazy_glBlendEquationSeparate);
+    glad_proc(modeRGB, modeAlpha);
+}
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+    PFNGLDRAWBUFFERSPROC glad_proc = (PFNGLDRAWBUFFERSPROC)glad_lazy_resolve("glDrawBuffers", (void**)&glad_glDrawBuffers, (void*)glad_lazy_glDrawBuffers);
+    glad_proc(n, bufs);
+}
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+    PFNGLSTENCILOPSEPARATEPROC glad_proc = (PFNGLSTENCILOPSEPARATEPROC)glad_lazy_resolve("glStencilOpSeparate", (void**)&glad_glStencilOpSeparate, (void*)glad_lazy_glStencilOpSeparate);
+    glad_proc(face, sfail, dpfail, dppass);
+}
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+    PFNGLSTENCILFUNCSEPARATEPROC glad_proc = (PFNGLSTENCILFUNCSEPARATEPROC)glad_lazy_resolve("glStencilFuncSeparate", (void**)&glad_glStencilFuncSeparate, (void*)glad_lazy_glStencilFuncSeparate);
+    glad_proc(face, func, ref, mask);
+}
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+    PFNGLSTENCILMASKSEPARATEPROC glad_proc = (PFNGLSTENCILMASKSEPARATEPROC)glad_lazy_resolve("glStencilMaskSeparate", (void**)&glad_glStencilMaskSeparate, (void*)glad_lazy_glStencilMaskSeparate);
+    glad_proc(face, mask);
+}
+static void APIENTRY glad_lazy_glAttachShader(GLuint program, GLuint shader) {
+    PFNGLATTACHSHADERPROC glad_proc = (PFNGLATTACHSHADERPROC)glad_lazy_resolve("glAttachShader", (void**)&glad_glAttachShader, (void*)glad_lazy_glAttachShader);
+    glad_proc(program, shader);
+}
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+    PFNGLBINDATTRIBLOCATIONPROC glad_proc = (PFNGLBINDATTRIBLOCATIONPROC)glad_lazy_resolve("glBindAttribLocation", (void**)&glad_glBindAttribLocation, (void*)glad_lazy_glBindAttribLocation);
+    glad_proc(program, index, name);
+}
+static void APIENTRY glad_lazy_glCompileShader(GLuint shader) {
+    PFNGLCOMPILESHADERPROC glad_proc = (PFNGLCOMPILESHADERPROC)glad_lazy_resolve("glCompileShader", (void**)&glad_glCompileShader, (void*)glad_lazy_glCompileShader);
+    glad_proc(shader);
+}
+static GLuint APIENTRY glad_lazy_glCreateProgram(void) {
+    PFNGLCREATEPROGRAMPROC glad_proc = (PFNGLCREATEPROGRAMPROC)glad_lazy_resolve("glCreateProgram", (void**)&glad_glCreateProgram, (void*)glad_lazy_glCreateProgram);
+    return glad_proc();
+}
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum type) {
+    PFNGLCREATESHADERPROC glad_proc = (PFNGLCREATESHADERPROC)glad_lazy_resolve("glCreateShader", (void**)&glad_glCreateShader, (void*)glad_lazy_glCreateShader);
+    return glad_proc(type);
+}
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint program) {
+    PFNGLDELETEPROGRAMPROC glad_proc = (PFNGLDELETEPROGRAMPROC)glad_lazy_resolve("glDeleteProgram", (void**)&glad_glDeleteProgram, (void*)glad_lazy_glDeleteProgram);
+    glad_proc(program);
+}
+static void APIENTRY glad_lazy_glDeleteShader(GLuint shader) {
+    PFNGLDELETESHADERPROC glad_proc = (PFNGLDELETESHADERPROC)glad_lazy_resolve("glDeleteShader", (void**)&glad_glDeleteShader, (void*)glad_lazy_glDeleteShader);
+    glad_proc(shader);
+}
+static void APIENTRY glad_lazy_glDetachShader(GLuint program, GLuint shader) {
+    PFNGLDETACHSHADERPROC glad_proc = (PFNGLDETACHSHADERPROC)glad_lazy_resolve("glDetachShader", (void**)&glad_glDetachShader, (void*)glad_lazy_glDetachShader);
+    glad_proc(program, shader);
+}
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint index) {
+    PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_proc = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glDisableVertexAttribArray", (void**)&glad_glDisableVertexAttribArray, (void*)glad_lazy_glDisableVertexAttribArray);
+    glad_proc(index);
+}
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint index) {
+    PFNGLENABLEVERTEXATTRIBARRAYPROC glad_proc = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glad_lazy_resolve("glEnableVertexAttribArray", (void**)&glad_glEnableVertexAttribArray, (void*)glad_lazy_glEnableVertexAttribArray);
+    glad_proc(index);
+}
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    PFNGLGETACTIVEATTRIBPROC glad_proc = (PFNGLGETACTIVEATTRIBPROC)glad_lazy_resolve("glGetActiveAttrib", (void**)&glad_glGetActiveAttrib, (void*)glad_lazy_glGetActiveAttrib);
+    glad_proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+    PFNGLGETACTIVEUNIFORMPROC glad_proc = (PFNGLGETACTIVEUNIFORMPROC)glad_lazy_resolve("glGetActiveUniform", (void**)&glad_glGetActiveUniform, (void*)glad_lazy_glGetActiveUniform);
+    glad_proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+    PFNGLGETATTACHEDSHADERSPROC glad_proc = (PFNGLGETATTACHEDSHADERSPROC)glad_lazy_resolve("glGetAttachedShaders", (void**)&glad_glGetAttachedShaders, (void*)glad_lazy_glGetAttachedShaders);
+    glad_proc(program, maxCount, count, shaders);
+}
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+    PFNGLGETATTRIBLOCATIONPROC glad_proc = (PFNGLGETATTRIBLOCATIONPROC)glad_lazy_resolve("glGetAttribLocation", (void**)&glad_glGetAttribLocation, (void*)glad_lazy_glGetAttribLocation);
+    return glad_proc(program, name);
+}
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+    PFNGLGETPROGRAMIVPROC glad_proc = (PFNGLGETPROGRAMIVPROC)glad_lazy_resolve("glGetProgramiv", (void**)&glad_glGetProgramiv, (void*)glad_lazy_glGetProgramiv);
+    glad_proc(program, pname, params);
+}
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    PFNGLGETPROGRAMINFOLOGPROC glad_proc = (PFNGLGETPROGRAMINFOLOGPROC)glad_lazy_resolve("glGetProgramInfoLog", (void**)&glad_glGetProgramInfoLog, (void*)glad_lazy_glGetProgramInfoLog);
+    glad_proc(program, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+    PFNGLGETSHADERIVPROC glad_proc = (PFNGLGETSHADERIVPROC)glad_lazy_resolve("glGetShaderiv", (void**)&glad_glGetShaderiv, (void*)glad_lazy_glGetShaderiv);
+    glad_proc(shader, pname, params);
+}
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+    PFNGLGETSHADERINFOLOGPROC glad_proc = (PFNGLGETSHADERINFOLOGPROC)glad_lazy_resolve("glGetShaderInfoLog", (void**)&glad_glGetShaderInfoLog, (void*)glad_lazy_glGetShaderInfoLog);
+    glad_proc(shader, bufSize, length, infoLog);
+}
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+    PFNGLGETSHADERSOURCEPROC glad_proc = (PFNGLGETSHADERSOURCEPROC)glad_lazy_resolve("glGetShaderSource", (void**)&glad_glGetShaderSource, (void*)glad_lazy_glGetShaderSource);
+    glad_proc(shader, bufSize, length, source);
+}
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+    PFNGLGETUNIFORMLOCATIONPROC glad_proc = (PFNGLGETUNIFORMLOCATIONPROC)glad_lazy_resolve("glGetUniformLocation", (void**)&glad_glGetUniformLocation, (void*)glad_lazy_glGetUniformLocation);
+    return glad_proc(program, name);
+}
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+    PFNGLGETUNIFORMFVPROC glad_proc = (PFNGLGETUNIFORMFVPROC)glad_lazy_resolve("glGetUniformfv", (void**)&glad_glGetUniformfv, (void*)glad_lazy_glGetUniformfv);
+    glad_proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+    PFNGLGETUNIFORMIVPROC glad_proc = (PFNGLGETUNIFORMIVPROC)glad_lazy_resolve("glGetUniformiv", (void**)&glad_glGetUniformiv, (void*)glad_lazy_glGetUniformiv);
+    glad_proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+    PFNGLGETVERTEXATTRIBDVPROC glad_proc = (PFNGLGETVERTEXATTRIBDVPROC)glad_lazy_resolve("glGetVertexAttribdv", (void**)&glad_glGetVertexAttribdv, (void*)glad_lazy_glGetVertexAttribdv);
+    glad_proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+    PFNGLGETVERTEXATTRIBFVPROC glad_proc = (PFNGLGETVERTEXATTRIBFVPROC)glad_lazy_resolve("glGetVertexAttribfv", (void**)&glad_glGetVertexAttribfv, (void*)glad_lazy_glGetVertexAttribfv);
+    glad_proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+    PFNGLGETVERTEXATTRIBIVPROC glad_proc = (PFNGLGETVERTEXATTRIBIVPROC)glad_lazy_resolve("glGetVertexAttribiv", (void**)&glad_glGetVertexAttribiv, (void*)glad_lazy_glGetVertexAttribiv);
+    glad_proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+    PFNGLGETVERTEXATTRIBPOINTERVPROC glad_proc = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glad_lazy_resolve("glGetVertexAttribPointerv", (void**)&glad_glGetVertexAttribPointerv, (void*)glad_lazy_glGetVertexAttribPointerv);
+    glad_proc(index, pname, pointer);
+}
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint program) {
+    PFNGLISPROGRAMPROC glad_proc = (PFNGLISPROGRAMPROC)glad_lazy_resolve("glIsProgram", (void**)&glad_glIsProgram, (void*)glad_lazy_glIsProgram);
+    return glad_proc(program);
+}
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint shader) {
+    PFNGLISSHADERPROC glad_proc = (PFNGLISSHADERPROC)glad_lazy_resolve("glIsShader", (void**)&glad_glIsShader, (void*)glad_lazy_glIsShader);
+    return glad_proc(shader);
+}
+static void APIENTRY glad_lazy_glLinkProgram(GLuint program) {
+    PFNGLLINKPROGRAMPROC glad_proc = (PFNGLLINKPROGRAMPROC)glad_lazy_resolve("glLinkProgram", (void**)&glad_glLinkProgram, (void*)glad_lazy_glLinkProgram);
+    glad_proc(program);
+}
+static void APIENTRY glad_lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+    PFNGLSHADERSOURCEPROC glad_proc = (PFNGLSHADERSOURCEPROC)glad_lazy_resolve("glShaderSource", (void**)&glad_glShaderSource, (void*)glad_lazy_glShaderSource);
+    glad_proc(shader, count, string, length);
+}
+static void APIENTRY glad_lazy_glUseProgram(GLuint program) {
+    PFNGLUSEPROGRAMPROC glad_proc = (PFNGLUSEPROGRAMPROC)glad_lazy_resolve("glUseProgram", (void**)&glad_glUseProgram, (void*)glad_lazy_glUseProgram);
+    glad_proc(program);
+}
+static void APIENTRY glad_lazy_glUniform1f(GLint location, GLfloat v0) {
+    PFNGLUNIFORM1FPROC glad_proc = (PFNGLUNIFORM1FPROC)glad_lazy_resolve("glUniform1f", (void**)&glad_glUniform1f, (void*)glad_lazy_glUniform1f);
+    glad_proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    PFNGLUNIFORM2FPROC glad_proc = (PFNGLUNIFORM2FPROC)glad_lazy_resolve("glUniform2f", (void**)&glad_glUniform2f, (void*)glad_lazy_glUniform2f);
+    glad_proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    PFNGLUNIFORM3FPROC glad_proc = (PFNGLUNIFORM3FPROC)glad_lazy_resolve("glUniform3f", (void**)&glad_glUniform3f, (void*)glad_lazy_glUniform3f);
+    glad_proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+    PFNGLUNIFORM4FPROC glad_proc = (PFNGLUNIFORM4FPROC)glad_lazy_resolve("glUniform4f", (void**)&glad_glUniform4f, (void*)glad_lazy_glUniform4f);
+    glad_proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1i(GLint location, GLint v0) {
+    PFNGLUNIFORM1IPROC glad_proc = (PFNGLUNIFORM1IPROC)glad_lazy_resolve("glUniform1i", (void**)&glad_glUniform1i, (void*)glad_lazy_glUniform1i);
+    glad_proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+    PFNGLUNIFORM2IPROC glad_proc = (PFNGLUNIFORM2IPROC)glad_lazy_resolve("glUniform2i", (void**)&glad_glUniform2i, (void*)glad_lazy_glUniform2i);
+    glad_proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+    PFNGLUNIFORM3IPROC glad_proc = (PFNGLUNIFORM3IPROC)glad_lazy_resolve("glUniform3i", (void**)&glad_glUniform3i, (void*)glad_lazy_glUniform3i);
+    glad_proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+    PFNGLUNIFORM4IPROC glad_proc = (PFNGLUNIFORM4IPROC)glad_lazy_resolve("glUniform4i", (void**)&glad_glUniform4i, (void*)glad_lazy_glUniform4i);
+    glad_proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+    PFNGLUNIFORM1FVPROC glad_proc = (PFNGLUNIFORM1FVPROC)glad_lazy_resolve("glUniform1fv", (void**)&glad_glUniform1fv, (void*)glad_lazy_glUniform1fv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+    PFNGLUNIFORM2FVPROC glad_proc = (PFNGLUNIFORM2FVPROC)glad_lazy_resolve("glUniform2fv", (void**)&glad_glUniform2fv, (void*)glad_lazy_glUniform2fv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+    PFNGLUNIFORM3FVPROC glad_proc = (PFNGLUNIFORM3FVPROC)glad_lazy_resolve("glUniform3fv", (void**)&glad_glUniform3fv, (void*)glad_lazy_glUniform3fv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+    PFNGLUNIFORM4FVPROC glad_proc = (PFNGLUNIFORM4FVPROC)glad_lazy_resolve("glUniform4fv", (void**)&glad_glUniform4fv, (void*)glad_lazy_glUniform4fv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+    PFNGLUNIFORM1IVPROC glad_proc = (PFNGLUNIFORM1IVPROC)glad_lazy_resolve("glUniform1iv", (void**)&glad_glUniform1iv, (void*)glad_lazy_glUniform1iv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+    PFNGLUNIFORM2IVPROC glad_proc = (PFNGLUNIFORM2IVPROC)glad_lazy_resolve("glUniform2iv", (void**)&glad_glUniform2iv, (void*)glad_lazy_glUniform2iv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+    PFNGLUNIFORM3IVPROC glad_proc = (PFNGLUNIFORM3IVPROC)glad_lazy_resolve("glUniform3iv", (void**)&glad_glUniform3iv, (void*)glad_lazy_glUniform3iv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+    PFNGLUNIFORM4IVPROC glad_proc = (PFNGLUNIFORM4IVPROC)glad_lazy_resolve("glUniform4iv", (void**)&glad_glUniform4iv, (void*)glad_lazy_glUniform4iv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX2FVPROC glad_proc = (PFNGLUNIFORMMATRIX2FVPROC)glad_lazy_resolve("glUniformMatrix2fv", (void**)&glad_glUniformMatrix2fv, (void*)glad_lazy_glUniformMatrix2fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX3FVPROC glad_proc = (PFNGLUNIFORMMATRIX3FVPROC)glad_lazy_resolve("glUniformMatrix3fv", (void**)&glad_glUniformMatrix3fv, (void*)glad_lazy_glUniformMatrix3fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX4FVPROC glad_proc = (PFNGLUNIFORMMATRIX4FVPROC)glad_lazy_resolve("glUniformMatrix4fv", (void**)&glad_glUniformMatrix4fv, (void*)glad_lazy_glUniformMatrix4fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glValidateProgram(GLuint program) {
+    PFNGLVALIDATEPROGRAMPROC glad_proc = (PFNGLVALIDATEPROGRAMPROC)glad_lazy_resolve("glValidateProgram", (void**)&glad_glValidateProgram, (void*)glad_lazy_glValidateProgram);
+    glad_proc(program);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+    PFNGLVERTEXATTRIB1DPROC glad_proc = (PFNGLVERTEXATTRIB1DPROC)glad_lazy_resolve("glVertexAttrib1d", (void**)&glad_glVertexAttrib1d, (void*)glad_lazy_glVertexAttrib1d);
+    glad_proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+    PFNGLVERTEXATTRIB1DVPROC glad_proc = (PFNGLVERTEXATTRIB1DVPROC)glad_lazy_resolve("glVertexAttrib1dv", (void**)&glad_glVertexAttrib1dv, (void*)glad_lazy_glVertexAttrib1dv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+    PFNGLVERTEXATTRIB1FPROC glad_proc = (PFNGLVERTEXATTRIB1FPROC)glad_lazy_resolve("glVertexAttrib1f", (void**)&glad_glVertexAttrib1f, (void*)glad_lazy_glVertexAttrib1f);
+    glad_proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+    PFNGLVERTEXATTRIB1FVPROC glad_proc = (PFNGLVERTEXATTRIB1FVPROC)glad_lazy_resolve("glVertexAttrib1fv", (void**)&glad_glVertexAttrib1fv, (void*)glad_lazy_glVertexAttrib1fv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+    PFNGLVERTEXATTRIB1SPROC glad_proc = (PFNGLVERTEXATTRIB1SPROC)glad_lazy_resolve("glVertexAttrib1s", (void**)&glad_glVertexAttrib1s, (void*)glad_lazy_glVertexAttrib1s);
+    glad_proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIB1SVPROC glad_proc = (PFNGLVERTEXATTRIB1SVPROC)glad_lazy_resolve("glVertexAttrib1sv", (void**)&glad_glVertexAttrib1sv, (void*)glad_lazy_glVertexAttrib1sv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+    PFNGLVERTEXATTRIB2DPROC glad_proc = (PFNGLVERTEXATTRIB2DPROC)glad_lazy_resolve("glVertexAttrib2d", (void**)&glad_glVertexAttrib2d, (void*)glad_lazy_glVertexAttrib2d);
+    glad_proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+    PFNGLVERTEXATTRIB2DVPROC glad_proc = (PFNGLVERTEXATTRIB2DVPROC)glad_lazy_resolve("glVertexAttrib2dv", (void**)&glad_glVertexAttrib2dv, (void*)glad_lazy_glVertexAttrib2dv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+    PFNGLVERTEXATTRIB2FPROC glad_proc = (PFNGLVERTEXATTRIB2FPROC)glad_lazy_resolve("glVertexAttrib2f", (void**)&glad_glVertexAttrib2f, (void*)glad_lazy_glVertexAttrib2f);
+    glad_proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+    PFNGLVERTEXATTRIB2FVPROC glad_proc = (PFNGLVERTEXATTRIB2FVPROC)glad_lazy_resolve("glVertexAttrib2fv", (void**)&glad_glVertexAttrib2fv, (void*)glad_lazy_glVertexAttrib2fv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+    PFNGLVERTEXATTRIB2SPROC glad_proc = (PFNGLVERTEXATTRIB2SPROC)glad_lazy_resolve("glVertexAttrib2s", (void**)&glad_glVertexAttrib2s, (void*)glad_lazy_glVertexAttrib2s);
+    glad_proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIB2SVPROC glad_proc = (PFNGLVERTEXATTRIB2SVPROC)glad_lazy_resolve("glVertexAttrib2sv", (void**)&glad_glVertexAttrib2sv, (void*)glad_lazy_glVertexAttrib2sv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+    PFNGLVERTEXATTRIB3DPROC glad_proc = (PFNGLVERTEXATTRIB3DPROC)glad_lazy_resolve("glVertexAttrib3d", (void**)&glad_glVertexAttrib3d, (void*)glad_lazy_glVertexAttrib3d);
+    glad_proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+    PFNGLVERTEXATTRIB3DVPROC glad_proc = (PFNGLVERTEXATTRIB3DVPROC)glad_lazy_resolve("glVertexAttrib3dv", (void**)&glad_glVertexAttrib3dv, (void*)glad_lazy_glVertexAttrib3dv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+    PFNGLVERTEXATTRIB3FPROC glad_proc = (PFNGLVERTEXATTRIB3FPROC)glad_lazy_resolve("glVertexAttrib3f", (void**)&glad_glVertexAttrib3f, (void*)glad_lazy_glVertexAttrib3f);
+    glad_proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+    PFNGLVERTEXATTRIB3FVPROC glad_proc = (PFNGLVERTEXATTRIB3FVPROC)glad_lazy_resolve("glVertexAttrib3fv", (void**)&glad_glVertexAttrib3fv, (void*)glad_lazy_glVertexAttrib3fv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+    PFNGLVERTEXATTRIB3SPROC glad_proc = (PFNGLVERTEXATTRIB3SPROC)glad_lazy_resolve("glVertexAttrib3s", (void**)&glad_glVertexAttrib3s, (void*)glad_lazy_glVertexAttrib3s);
+    glad_proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIB3SVPROC glad_proc = (PFNGLVERTEXATTRIB3SVPROC)glad_lazy_resolve("glVertexAttrib3sv", (void**)&glad_glVertexAttrib3sv, (void*)glad_lazy_glVertexAttrib3sv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+    PFNGLVERTEXATTRIB4NBVPROC glad_proc = (PFNGLVERTEXATTRIB4NBVPROC)glad_lazy_resolve("glVertexAttrib4Nbv", (void**)&glad_glVertexAttrib4Nbv, (void*)glad_lazy_glVertexAttrib4Nbv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIB4NIVPROC glad_proc = (PFNGLVERTEXATTRIB4NIVPROC)glad_lazy_resolve("glVertexAttrib4Niv", (void**)&glad_glVertexAttrib4Niv, (void*)glad_lazy_glVertexAttrib4Niv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIB4NSVPROC glad_proc = (PFNGLVERTEXATTRIB4NSVPROC)glad_lazy_resolve("glVertexAttrib4Nsv", (void**)&glad_glVertexAttrib4Nsv, (void*)glad_lazy_glVertexAttrib4Nsv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+    PFNGLVERTEXATTRIB4NUBPROC glad_proc = (PFNGLVERTEXATTRIB4NUBPROC)glad_lazy_resolve("glVertexAttrib4Nub", (void**)&glad_glVertexAttrib4Nub, (void*)glad_lazy_glVertexAttrib4Nub);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+    PFNGLVERTEXATTRIB4NUBVPROC glad_proc = (PFNGLVERTEXATTRIB4NUBVPROC)glad_lazy_resolve("glVertexAttrib4Nubv", (void**)&glad_glVertexAttrib4Nubv, (void*)glad_lazy_glVertexAttrib4Nubv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIB4NUIVPROC glad_proc = (PFNGLVERTEXATTRIB4NUIVPROC)glad_lazy_resolve("glVertexAttrib4Nuiv", (void**)&glad_glVertexAttrib4Nuiv, (void*)glad_lazy_glVertexAttrib4Nuiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+    PFNGLVERTEXATTRIB4NUSVPROC glad_proc = (PFNGLVERTEXATTRIB4NUSVPROC)glad_lazy_resolve("glVertexAttrib4Nusv", (void**)&glad_glVertexAttrib4Nusv, (void*)glad_lazy_glVertexAttrib4Nusv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+    PFNGLVERTEXATTRIB4BVPROC glad_proc = (PFNGLVERTEXATTRIB4BVPROC)glad_lazy_resolve("glVertexAttrib4bv", (void**)&glad_glVertexAttrib4bv, (void*)glad_lazy_glVertexAttrib4bv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+    PFNGLVERTEXATTRIB4DPROC glad_proc = (PFNGLVERTEXATTRIB4DPROC)glad_lazy_resolve("glVertexAttrib4d", (void**)&glad_glVertexAttrib4d, (void*)glad_lazy_glVertexAttrib4d);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+    PFNGLVERTEXATTRIB4DVPROC glad_proc = (PFNGLVERTEXATTRIB4DVPROC)glad_lazy_resolve("glVertexAttrib4dv", (void**)&glad_glVertexAttrib4dv, (void*)glad_lazy_glVertexAttrib4dv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+    PFNGLVERTEXATTRIB4FPROC glad_proc = (PFNGLVERTEXATTRIB4FPROC)glad_lazy_resolve("glVertexAttrib4f", (void**)&glad_glVertexAttrib4f, (void*)glad_lazy_glVertexAttrib4f);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+    PFNGLVERTEXATTRIB4FVPROC glad_proc = (PFNGLVERTEXATTRIB4FVPROC)glad_lazy_resolve("glVertexAttrib4fv", (void**)&glad_glVertexAttrib4fv, (void*)glad_lazy_glVertexAttrib4fv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIB4IVPROC glad_proc = (PFNGLVERTEXATTRIB4IVPROC)glad_lazy_resolve("glVertexAttrib4iv", (void**)&glad_glVertexAttrib4iv, (void*)glad_lazy_glVertexAttrib4iv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+    PFNGLVERTEXATTRIB4SPROC glad_proc = (PFNGLVERTEXATTRIB4SPROC)glad_lazy_resolve("glVertexAttrib4s", (void**)&glad_glVertexAttrib4s, (void*)glad_lazy_glVertexAttrib4s);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIB4SVPROC glad_proc = (PFNGLVERTEXATTRIB4SVPROC)glad_lazy_resolve("glVertexAttrib4sv", (void**)&glad_glVertexAttrib4sv, (void*)glad_lazy_glVertexAttrib4sv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+    PFNGLVERTEXATTRIB4UBVPROC glad_proc = (PFNGLVERTEXATTRIB4UBVPROC)glad_lazy_resolve("glVertexAttrib4ubv", (void**)&glad_glVertexAttrib4ubv, (void*)glad_lazy_glVertexAttrib4ubv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIB4UIVPROC glad_proc = (PFNGLVERTEXATTRIB4UIVPROC)glad_lazy_resolve("glVertexAttrib4uiv", (void**)&glad_glVertexAttrib4uiv, (void*)glad_lazy_glVertexAttrib4uiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+    PFNGLVERTEXATTRIB4USVPROC glad_proc = (PFNGLVERTEXATTRIB4USVPROC)glad_lazy_resolve("glVertexAttrib4usv", (void**)&glad_glVertexAttrib4usv, (void*)glad_lazy_glVertexAttrib4usv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+    PFNGLVERTEXATTRIBPOINTERPROC glad_proc = (PFNGLVERTEXATTRIBPOINTERPROC)glad_lazy_resolve("glVertexAttribPointer", (void**)&glad_glVertexAttribPointer, (void*)glad_lazy_glVertexAttribPointer);
+    glad_proc(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX2X3FVPROC glad_proc = (PFNGLUNIFORMMATRIX2X3FVPROC)glad_lazy_resolve("glUniformMatrix2x3fv", (void**)&glad_glUniformMatrix2x3fv, (void*)glad_lazy_glUniformMatrix2x3fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX3X2FVPROC glad_proc = (PFNGLUNIFORMMATRIX3X2FVPROC)glad_lazy_resolve("glUniformMatrix3x2fv", (void**)&glad_glUniformMatrix3x2fv, (void*)glad_lazy_glUniformMatrix3x2fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX2X4FVPROC glad_proc = (PFNGLUNIFORMMATRIX2X4FVPROC)glad_lazy_resolve("glUniformMatrix2x4fv", (void**)&glad_glUniformMatrix2x4fv, (void*)glad_lazy_glUniformMatrix2x4fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX4X2FVPROC glad_proc = (PFNGLUNIFORMMATRIX4X2FVPROC)glad_lazy_resolve("glUniformMatrix4x2fv", (void**)&glad_glUniformMatrix4x2fv, (void*)glad_lazy_glUniformMatrix4x2fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX3X4FVPROC glad_proc = (PFNGLUNIFORMMATRIX3X4FVPROC)glad_lazy_resolve("glUniformMatrix3x4fv", (void**)&glad_glUniformMatrix3x4fv, (void*)glad_lazy_glUniformMatrix3x4fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+    PFNGLUNIFORMMATRIX4X3FVPROC glad_proc = (PFNGLUNIFORMMATRIX4X3FVPROC)glad_lazy_resolve("glUniformMatrix4x3fv", (void**)&glad_glUniformMatrix4x3fv, (void*)glad_lazy_glUniformMatrix4x3fv);
+    glad_proc(location, count, transpose, value);
+}
+static void APIENTRY glad_lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    PFNGLCOLORMASKIPROC glad_proc = (PFNGLCOLORMASKIPROC)glad_lazy_resolve("glColorMaski", (void**)&glad_glColorMaski, (void*)glad_lazy_glColorMaski);
+    glad_proc(index, r, g, b, a);
+}
+static void APIENTRY glad_lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+    PFNGLGETBOOLEANI_VPROC glad_proc = (PFNGLGETBOOLEANI_VPROC)glad_lazy_resolve("glGetBooleani_v", (void**)&glad_glGetBooleani_v, (void*)glad_lazy_glGetBooleani_v);
+    glad_proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+    PFNGLGETINTEGERI_VPROC glad_proc = (PFNGLGETINTEGERI_VPROC)glad_lazy_resolve("glGetIntegeri_v", (void**)&glad_glGetIntegeri_v, (void*)glad_lazy_glGetIntegeri_v);
+    glad_proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glEnablei(GLenum target, GLuint index) {
+    PFNGLENABLEIPROC glad_proc = (PFNGLENABLEIPROC)glad_lazy_resolve("glEnablei", (void**)&glad_glEnablei, (void*)glad_lazy_glEnablei);
+    glad_proc(target, index);
+}
+static void APIENTRY glad_lazy_glDisablei(GLenum target, GLuint index) {
+    PFNGLDISABLEIPROC glad_proc = (PFNGLDISABLEIPROC)glad_lazy_resolve("glDisablei", (void**)&glad_glDisablei, (void*)glad_lazy_glDisablei);
+    glad_proc(target, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsEnabledi(GLenum target, GLuint index) {
+    PFNGLISENABLEDIPROC glad_proc = (PFNGLISENABLEDIPROC)glad_lazy_resolve("glIsEnabledi", (void**)&glad_glIsEnabledi, (void*)glad_lazy_glIsEnabledi);
+    return glad_proc(target, index);
+}
+static void APIENTRY glad_lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+    PFNGLBEGINTRANSFORMFEEDBACKPROC glad_proc = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glBeginTransformFeedback", (void**)&glad_glBeginTransformFeedback, (void*)glad_lazy_glBeginTransformFeedback);
+    glad_proc(primitiveMode);
+}
+static void APIENTRY glad_lazy_glEndTransformFeedback(void) {
+    PFNGLENDTRANSFORMFEEDBACKPROC glad_proc = (PFNGLENDTRANSFORMFEEDBACKPROC)glad_lazy_resolve("glEndTransformFeedback", (void**)&glad_glEndTransformFeedback, (void*)glad_lazy_glEndTransformFeedback);
+    glad_proc();
+}
+static void APIENTRY glad_lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    PFNGLBINDBUFFERRANGEPROC glad_proc = (PFNGLBINDBUFFERRANGEPROC)glad_lazy_resolve("glBindBufferRange", (void**)&glad_glBindBufferRange, (void*)glad_lazy_glBindBufferRange);
+    glad_proc(target, index, buffer, offset, size);
+}
+static void APIENTRY glad_lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    PFNGLBINDBUFFERBASEPROC glad_proc = (PFNGLBINDBUFFERBASEPROC)glad_lazy_resolve("glBindBufferBase", (void**)&glad_glBindBufferBase, (void*)glad_lazy_glBindBufferBase);
+    glad_proc(target, index, buffer);
+}
+static void APIENTRY glad_lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+    PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_proc = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glad_lazy_resolve("glTransformFeedbackVaryings", (void**)&glad_glTransformFeedbackVaryings, (void*)glad_lazy_glTransformFeedbackVaryings);
+    glad_proc(program, count, varyings, bufferMode);
+}
+static void APIENTRY glad_lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+    PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_proc = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glad_lazy_resolve("glGetTransformFeedbackVarying", (void**)&glad_glGetTransformFeedbackVarying, (void*)glad_lazy_glGetTransformFeedbackVarying);
+    glad_proc(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY glad_lazy_glClampColor(GLenum target, GLenum clamp) {
+    PFNGLCLAMPCOLORPROC glad_proc = (PFNGLCLAMPCOLORPROC)glad_lazy_resolve("glClampColor", (void**)&glad_glClampColor, (void*)glad_lazy_glClampColor);
+    glad_proc(target, clamp);
+}
+static void APIENTRY glad_lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+    PFNGLBEGINCONDITIONALRENDERPROC glad_proc = (PFNGLBEGINCONDITIONALRENDERPROC)glad_lazy_resolve("glBeginConditionalRender", (void**)&glad_glBeginConditionalRender, (void*)glad_lazy_glBeginConditionalRender);
+    glad_proc(id, mode);
+}
+static void APIENTRY glad_lazy_glEndConditionalRender(void) {
+    PFNGLENDCONDITIONALRENDERPROC glad_proc = (PFNGLENDCONDITIONALRENDERPROC)glad_lazy_resolve("glEndConditionalRender", (void**)&glad_glEndConditionalRender, (void*)glad_lazy_glEndConditionalRender);
+    glad_proc();
+}
+static void APIENTRY glad_lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+    PFNGLVERTEXATTRIBIPOINTERPROC glad_proc = (PFNGLVERTEXATTRIBIPOINTERPROC)glad_lazy_resolve("glVertexAttribIPointer", (void**)&glad_glVertexAttribIPointer, (void*)glad_lazy_glVertexAttribIPointer);
+    glad_proc(index, size, type, stride, pointer);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+    PFNGLGETVERTEXATTRIBIIVPROC glad_proc = (PFNGLGETVERTEXATTRIBIIVPROC)glad_lazy_resolve("glGetVertexAttribIiv", (void**)&glad_glGetVertexAttribIiv, (void*)glad_lazy_glGetVertexAttribIiv);
+    glad_proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+    PFNGLGETVERTEXATTRIBIUIVPROC glad_proc = (PFNGLGETVERTEXATTRIBIUIVPROC)glad_lazy_resolve("glGetVertexAttribIuiv", (void**)&glad_glGetVertexAttribIuiv, (void*)glad_lazy_glGetVertexAttribIuiv);
+    glad_proc(index, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1i(GLuint index, GLint x) {
+    PFNGLVERTEXATTRIBI1IPROC glad_proc = (PFNGLVERTEXATTRIBI1IPROC)glad_lazy_resolve("glVertexAttribI1i", (void**)&glad_glVertexAttribI1i, (void*)glad_lazy_glVertexAttribI1i);
+    glad_proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+    PFNGLVERTEXATTRIBI2IPROC glad_proc = (PFNGLVERTEXATTRIBI2IPROC)glad_lazy_resolve("glVertexAttribI2i", (void**)&glad_glVertexAttribI2i, (void*)glad_lazy_glVertexAttribI2i);
+    glad_proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+    PFNGLVERTEXATTRIBI3IPROC glad_proc = (PFNGLVERTEXATTRIBI3IPROC)glad_lazy_resolve("glVertexAttribI3i", (void**)&glad_glVertexAttribI3i, (void*)glad_lazy_glVertexAttribI3i);
+    glad_proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+    PFNGLVERTEXATTRIBI4IPROC glad_proc = (PFNGLVERTEXATTRIBI4IPROC)glad_lazy_resolve("glVertexAttribI4i", (void**)&glad_glVertexAttribI4i, (void*)glad_lazy_glVertexAttribI4i);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+    PFNGLVERTEXATTRIBI1UIPROC glad_proc = (PFNGLVERTEXATTRIBI1UIPROC)glad_lazy_resolve("glVertexAttribI1ui", (void**)&glad_glVertexAttribI1ui, (void*)glad_lazy_glVertexAttribI1ui);
+    glad_proc(index, x);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+    PFNGLVERTEXATTRIBI2UIPROC glad_proc = (PFNGLVERTEXATTRIBI2UIPROC)glad_lazy_resolve("glVertexAttribI2ui", (void**)&glad_glVertexAttribI2ui, (void*)glad_lazy_glVertexAttribI2ui);
+    glad_proc(index, x, y);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+    PFNGLVERTEXATTRIBI3UIPROC glad_proc = (PFNGLVERTEXATTRIBI3UIPROC)glad_lazy_resolve("glVertexAttribI3ui", (void**)&glad_glVertexAttribI3ui, (void*)glad_lazy_glVertexAttribI3ui);
+    glad_proc(index, x, y, z);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+    PFNGLVERTEXATTRIBI4UIPROC glad_proc = (PFNGLVERTEXATTRIBI4UIPROC)glad_lazy_resolve("glVertexAttribI4ui", (void**)&glad_glVertexAttribI4ui, (void*)glad_lazy_glVertexAttribI4ui);
+    glad_proc(index, x, y, z, w);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIBI1IVPROC glad_proc = (PFNGLVERTEXATTRIBI1IVPROC)glad_lazy_resolve("glVertexAttribI1iv", (void**)&glad_glVertexAttribI1iv, (void*)glad_lazy_glVertexAttribI1iv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIBI2IVPROC glad_proc = (PFNGLVERTEXATTRIBI2IVPROC)glad_lazy_resolve("glVertexAttribI2iv", (void**)&glad_glVertexAttribI2iv, (void*)glad_lazy_glVertexAttribI2iv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIBI3IVPROC glad_proc = (PFNGLVERTEXATTRIBI3IVPROC)glad_lazy_resolve("glVertexAttribI3iv", (void**)&glad_glVertexAttribI3iv, (void*)glad_lazy_glVertexAttribI3iv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+    PFNGLVERTEXATTRIBI4IVPROC glad_proc = (PFNGLVERTEXATTRIBI4IVPROC)glad_lazy_resolve("glVertexAttribI4iv", (void**)&glad_glVertexAttribI4iv, (void*)glad_lazy_glVertexAttribI4iv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIBI1UIVPROC glad_proc = (PFNGLVERTEXATTRIBI1UIVPROC)glad_lazy_resolve("glVertexAttribI1uiv", (void**)&glad_glVertexAttribI1uiv, (void*)glad_lazy_glVertexAttribI1uiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIBI2UIVPROC glad_proc = (PFNGLVERTEXATTRIBI2UIVPROC)glad_lazy_resolve("glVertexAttribI2uiv", (void**)&glad_glVertexAttribI2uiv, (void*)glad_lazy_glVertexAttribI2uiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIBI3UIVPROC glad_proc = (PFNGLVERTEXATTRIBI3UIVPROC)glad_lazy_resolve("glVertexAttribI3uiv", (void**)&glad_glVertexAttribI3uiv, (void*)glad_lazy_glVertexAttribI3uiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+    PFNGLVERTEXATTRIBI4UIVPROC glad_proc = (PFNGLVERTEXATTRIBI4UIVPROC)glad_lazy_resolve("glVertexAttribI4uiv", (void**)&glad_glVertexAttribI4uiv, (void*)glad_lazy_glVertexAttribI4uiv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+    PFNGLVERTEXATTRIBI4BVPROC glad_proc = (PFNGLVERTEXATTRIBI4BVPROC)glad_lazy_resolve("glVertexAttribI4bv", (void**)&glad_glVertexAttribI4bv, (void*)glad_lazy_glVertexAttribI4bv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+    PFNGLVERTEXATTRIBI4SVPROC glad_proc = (PFNGLVERTEXATTRIBI4SVPROC)glad_lazy_resolve("glVertexAttribI4sv", (void**)&glad_glVertexAttribI4sv, (void*)glad_lazy_glVertexAttribI4sv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+    PFNGLVERTEXATTRIBI4UBVPROC glad_proc = (PFNGLVERTEXATTRIBI4UBVPROC)glad_lazy_resolve("glVertexAttribI4ubv", (void**)&glad_glVertexAttribI4ubv, (void*)glad_lazy_glVertexAttribI4ubv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+    PFNGLVERTEXATTRIBI4USVPROC glad_proc = (PFNGLVERTEXATTRIBI4USVPROC)glad_lazy_resolve("glVertexAttribI4usv", (void**)&glad_glVertexAttribI4usv, (void*)glad_lazy_glVertexAttribI4usv);
+    glad_proc(index, v);
+}
+static void APIENTRY glad_lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+    PFNGLGETUNIFORMUIVPROC glad_proc = (PFNGLGETUNIFORMUIVPROC)glad_lazy_resolve("glGetUniformuiv", (void**)&glad_glGetUniformuiv, (void*)glad_lazy_glGetUniformuiv);
+    glad_proc(program, location, params);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+    PFNGLBINDFRAGDATALOCATIONPROC glad_proc = (PFNGLBINDFRAGDATALOCATIONPROC)glad_lazy_resolve("glBindFragDataLocation", (void**)&glad_glBindFragDataLocation, (void*)glad_lazy_glBindFragDataLocation);
+    glad_proc(program, color, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+    PFNGLGETFRAGDATALOCATIONPROC glad_proc = (PFNGLGETFRAGDATALOCATIONPROC)glad_lazy_resolve("glGetFragDataLocation", (void**)&glad_glGetFragDataLocation, (void*)glad_lazy_glGetFragDataLocation);
+    return glad_proc(program, name);
+}
+static void APIENTRY glad_lazy_glUniform1ui(GLint location, GLuint v0) {
+    PFNGLUNIFORM1UIPROC glad_proc = (PFNGLUNIFORM1UIPROC)glad_lazy_resolve("glUniform1ui", (void**)&glad_glUniform1ui, (void*)glad_lazy_glUniform1ui);
+    glad_proc(location, v0);
+}
+static void APIENTRY glad_lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+    PFNGLUNIFORM2UIPROC glad_proc = (PFNGLUNIFORM2UIPROC)glad_lazy_resolve("glUniform2ui", (void**)&glad_glUniform2ui, (void*)glad_lazy_glUniform2ui);
+    glad_proc(location, v0, v1);
+}
+static void APIENTRY glad_lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+    PFNGLUNIFORM3UIPROC glad_proc = (PFNGLUNIFORM3UIPROC)glad_lazy_resolve("glUniform3ui", (void**)&glad_glUniform3ui, (void*)glad_lazy_glUniform3ui);
+    glad_proc(location, v0, v1, v2);
+}
+static void APIENTRY glad_lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+    PFNGLUNIFORM4UIPROC glad_proc = (PFNGLUNIFORM4UIPROC)glad_lazy_resolve("glUniform4ui", (void**)&glad_glUniform4ui, (void*)glad_lazy_glUniform4ui);
+    glad_proc(location, v0, v1, v2, v3);
+}
+static void APIENTRY glad_lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+    PFNGLUNIFORM1UIVPROC glad_proc = (PFNGLUNIFORM1UIVPROC)glad_lazy_resolve("glUniform1uiv", (void**)&glad_glUniform1uiv, (void*)glad_lazy_glUniform1uiv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+    PFNGLUNIFORM2UIVPROC glad_proc = (PFNGLUNIFORM2UIVPROC)glad_lazy_resolve("glUniform2uiv", (void**)&glad_glUniform2uiv, (void*)glad_lazy_glUniform2uiv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+    PFNGLUNIFORM3UIVPROC glad_proc = (PFNGLUNIFORM3UIVPROC)glad_lazy_resolve("glUniform3uiv", (void**)&glad_glUniform3uiv, (void*)glad_lazy_glUniform3uiv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+    PFNGLUNIFORM4UIVPROC glad_proc = (PFNGLUNIFORM4UIVPROC)glad_lazy_resolve("glUniform4uiv", (void**)&glad_glUniform4uiv, (void*)glad_lazy_glUniform4uiv);
+    glad_proc(location, count, value);
+}
+static void APIENTRY glad_lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+    PFNGLTEXPARAMETERIIVPROC glad_proc = (PFNGLTEXPARAMETERIIVPROC)glad_lazy_resolve("glTexParameterIiv", (void**)&glad_glTexParameterIiv, (void*)glad_lazy_glTexParameterIiv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+    PFNGLTEXPARAMETERIUIVPROC glad_proc = (PFNGLTEXPARAMETERIUIVPROC)glad_lazy_resolve("glTexParameterIuiv", (void**)&glad_glTexParameterIuiv, (void*)glad_lazy_glTexParameterIuiv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+    PFNGLGETTEXPARAMETERIIVPROC glad_proc = (PFNGLGETTEXPARAMETERIIVPROC)glad_lazy_resolve("glGetTexParameterIiv", (void**)&glad_glGetTexParameterIiv, (void*)glad_lazy_glGetTexParameterIiv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+    PFNGLGETTEXPARAMETERIUIVPROC glad_proc = (PFNGLGETTEXPARAMETERIUIVPROC)glad_lazy_resolve("glGetTexParameterIuiv", (void**)&glad_glGetTexParameterIuiv, (void*)glad_lazy_glGetTexParameterIuiv);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+    PFNGLCLEARBUFFERIVPROC glad_proc = (PFNGLCLEARBUFFERIVPROC)glad_lazy_resolve("glClearBufferiv", (void**)&glad_glClearBufferiv, (void*)glad_lazy_glClearBufferiv);
+    glad_proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+    PFNGLCLEARBUFFERUIVPROC glad_proc = (PFNGLCLEARBUFFERUIVPROC)glad_lazy_resolve("glClearBufferuiv", (void**)&glad_glClearBufferuiv, (void*)glad_lazy_glClearBufferuiv);
+    glad_proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+    PFNGLCLEARBUFFERFVPROC glad_proc = (PFNGLCLEARBUFFERFVPROC)glad_lazy_resolve("glClearBufferfv", (void**)&glad_glClearBufferfv, (void*)glad_lazy_glClearBufferfv);
+    glad_proc(buffer, drawbuffer, value);
+}
+static void APIENTRY glad_lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+    PFNGLCLEARBUFFERFIPROC glad_proc = (PFNGLCLEARBUFFERFIPROC)glad_lazy_resolve("glClearBufferfi", (void**)&glad_glClearBufferfi, (void*)glad_lazy_glClearBufferfi);
+    glad_proc(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY glad_lazy_glGetStringi(GLenum name, GLuint index) {
+    PFNGLGETSTRINGIPROC glad_proc = (PFNGLGETSTRINGIPROC)glad_lazy_resolve("glGetStringi", (void**)&glad_glGetStringi, (void*)glad_lazy_glGetStringi);
+    return glad_proc(name, index);
+}
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint renderbuffer) {
+    PFNGLISRENDERBUFFERPROC glad_proc = (PFNGLISRENDERBUFFERPROC)glad_lazy_resolve("glIsRenderbuffer", (void**)&glad_glIsRenderbuffer, (void*)glad_lazy_glIsRenderbuffer);
+    return glad_proc(renderbuffer);
+}
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+    PFNGLBINDRENDERBUFFERPROC glad_proc = (PFNGLBINDRENDERBUFFERPROC)glad_lazy_resolve("glBindRenderbuffer", (void**)&glad_glBindRenderbuffer, (void*)glad_lazy_glBindRenderbuffer);
+    glad_proc(target, renderbuffer);
+}
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+    PFNGLDELETERENDERBUFFERSPROC glad_proc = (PFNGLDELETERENDERBUFFERSPROC)glad_lazy_resolve("glDeleteRenderbuffers", (void**)&glad_glDeleteRenderbuffers, (void*)glad_lazy_glDeleteRenderbuffers);
+    glad_proc(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+    PFNGLGENRENDERBUFFERSPROC glad_proc = (PFNGLGENRENDERBUFFERSPROC)glad_lazy_resolve("glGenRenderbuffers", (void**)&glad_glGenRenderbuffers, (void*)glad_lazy_glGenRenderbuffers);
+    glad_proc(n, renderbuffers);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLRENDERBUFFERSTORAGEPROC glad_proc = (PFNGLRENDERBUFFERSTORAGEPROC)glad_lazy_resolve("glRenderbufferStorage", (void**)&glad_glRenderbufferStorage, (void*)glad_lazy_glRenderbufferStorage);
+    glad_proc(target, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+    PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_proc = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glad_lazy_resolve("glGetRenderbufferParameteriv", (void**)&glad_glGetRenderbufferParameteriv, (void*)glad_lazy_glGetRenderbufferParameteriv);
+    glad_proc(target, pname, params);
+}
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint framebuffer) {
+    PFNGLISFRAMEBUFFERPROC glad_proc = (PFNGLISFRAMEBUFFERPROC)glad_lazy_resolve("glIsFramebuffer", (void**)&glad_glIsFramebuffer, (void*)glad_lazy_glIsFramebuffer);
+    return glad_proc(framebuffer);
+}
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+    PFNGLBINDFRAMEBUFFERPROC glad_proc = (PFNGLBINDFRAMEBUFFERPROC)glad_lazy_resolve("glBindFramebuffer", (void**)&glad_glBindFramebuffer, (void*)glad_lazy_glBindFramebuffer);
+    glad_proc(target, framebuffer);
+}
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+    PFNGLDELETEFRAMEBUFFERSPROC glad_proc = (PFNGLDELETEFRAMEBUFFERSPROC)glad_lazy_resolve("glDeleteFramebuffers", (void**)&glad_glDeleteFramebuffers, (void*)glad_lazy_glDeleteFramebuffers);
+    glad_proc(n, framebuffers);
+}
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+    PFNGLGENFRAMEBUFFERSPROC glad_proc = (PFNGLGENFRAMEBUFFERSPROC)glad_lazy_resolve("glGenFramebuffers", (void**)&glad_glGenFramebuffers, (void*)glad_lazy_glGenFramebuffers);
+    glad_proc(n, framebuffers);
+}
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum target) {
+    PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_proc = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glad_lazy_resolve("glCheckFramebufferStatus", (void**)&glad_glCheckFramebufferStatus, (void*)glad_lazy_glCheckFramebufferStatus);
+    return glad_proc(target);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTURE1DPROC glad_proc = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glad_lazy_resolve("glFramebufferTexture1D", (void**)&glad_glFramebufferTexture1D, (void*)glad_lazy_glFramebufferTexture1D);
+    glad_proc(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTURE2DPROC glad_proc = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glad_lazy_resolve("glFramebufferTexture2D", (void**)&glad_glFramebufferTexture2D, (void*)glad_lazy_glFramebufferTexture2D);
+    glad_proc(target, attachment, textarget, texture, level);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+    PFNGLFRAMEBUFFERTEXTURE3DPROC glad_proc = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glad_lazy_resolve("glFramebufferTexture3D", (void**)&glad_glFramebufferTexture3D, (void*)glad_lazy_glFramebufferTexture3D);
+    glad_proc(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+    PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_proc = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glad_lazy_resolve("glFramebufferRenderbuffer", (void**)&glad_glFramebufferRenderbuffer, (void*)glad_lazy_glFramebufferRenderbuffer);
+    glad_proc(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+    PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_proc = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glad_lazy_resolve("glGetFramebufferAttachmentParameteriv", (void**)&glad_glGetFramebufferAttachmentParameteriv, (void*)glad_lazy_glGetFramebufferAttachmentParameteriv);
+    glad_proc(target, attachment, pname, params);
+}
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum target) {
+    PFNGLGENERATEMIPMAPPROC glad_proc = (PFNGLGENERATEMIPMAPPROC)glad_lazy_resolve("glGenerateMipmap", (void**)&glad_glGenerateMipmap, (void*)glad_lazy_glGenerateMipmap);
+    glad_proc(target);
+}
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+    PFNGLBLITFRAMEBUFFERPROC glad_proc = (PFNGLBLITFRAMEBUFFERPROC)glad_lazy_resolve("glBlitFramebuffer", (void**)&glad_glBlitFramebuffer, (void*)glad_lazy_glBlitFramebuffer);
+    glad_proc(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+    PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_proc = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glad_lazy_resolve("glRenderbufferStorageMultisample", (void**)&glad_glRenderbufferStorageMultisample, (void*)glad_lazy_glRenderbufferStorageMultisample);
+    glad_proc(target, samples, internalformat, width, height);
+}
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+    PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_proc = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glad_lazy_resolve("glFramebufferTextureLayer", (void**)&glad_glFramebufferTextureLayer, (void*)glad_lazy_glFramebufferTextureLayer);
+    glad_proc(target, attachment, texture, level, layer);
+}
+static void * APIENTRY glad_lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+    PFNGLMAPBUFFERRANGEPROC glad_proc = (PFNGLMAPBUFFERRANGEPROC)glad_lazy_resolve("glMapBufferRange", (void**)&glad_glMapBufferRange, (void*)glad_lazy_glMapBufferRange);
+    return glad_proc(target, offset, length, access);
+}
+static void APIENTRY glad_lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+    PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_proc = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glad_lazy_resolve("glFlushMappedBufferRange", (void**)&glad_glFlushMappedBufferRange, (void*)glad_lazy_glFlushMappedBufferRange);
+    glad_proc(target, offset, length);
+}
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint array) {
+    PFNGLBINDVERTEXARRAYPROC glad_proc = (PFNGLBINDVERTEXARRAYPROC)glad_lazy_resolve("glBindVertexArray", (void**)&glad_glBindVertexArray, (void*)glad_lazy_glBindVertexArray);
+    glad_proc(array);
+}
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+    PFNGLDELETEVERTEXARRAYSPROC glad_proc = (PFNGLDELETEVERTEXARRAYSPROC)glad_lazy_resolve("glDeleteVertexArrays", (void**)&glad_glDeleteVertexArrays, (void*)glad_lazy_glDeleteVertexArrays);
+    glad_proc(n, arrays);
+}
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+    PFNGLGENVERTEXARRAYSPROC glad_proc = (PFNGLGENVERTEXARRAYSPROC)glad_lazy_resolve("glGenVertexArrays", (void**)&glad_glGenVertexArrays, (void*)glad_lazy_glGenVertexArrays);
+    glad_proc(n, arrays);
+}
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint array) {
+    PFNGLISVERTEXARRAYPROC glad_proc = (PFNGLISVERTEXARRAYPROC)glad_lazy_resolve("glIsVertexArray", (void**)&glad_glIsVertexArray, (void*)glad_lazy_glIsVertexArray);
+    return glad_proc(array);
+}
+static void APIENTRY glad_lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+    PFNGLDRAWARRAYSINSTANCEDPROC glad_proc = (PFNGLDRAWARRAYSINSTANCEDPROC)glad_lazy_resolve("glDrawArraysInstanced", (void**)&glad_glDrawArraysInstanced, (void*)glad_lazy_glDrawArraysInstanced);
+    glad_proc(mode, first, count, instancecount);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+    PFNGLDRAWELEMENTSINSTANCEDPROC glad_proc = (PFNGLDRAWELEMENTSINSTANCEDPROC)glad_lazy_resolve("glDrawElementsInstanced", (void**)&glad_glDrawElementsInstanced, (void*)glad_lazy_glDrawElementsInstanced);
+    glad_proc(mode, count, type, indices, instancecount);
+}
+static void APIENTRY glad_lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+    PFNGLTEXBUFFERPROC glad_proc = (PFNGLTEXBUFFERPROC)glad_lazy_resolve("glTexBuffer", (void**)&glad_glTexBuffer, (void*)glad_lazy_glTexBuffer);
+    glad_proc(target, internalformat, buffer);
+}
+static void APIENTRY glad_lazy_glPrimitiveRestartIndex(GLuint index) {
+    PFNGLPRIMITIVERESTARTINDEXPROC glad_proc = (PFNGLPRIMITIVERESTARTINDEXPROC)glad_lazy_resolve("glPrimitiveRestartIndex", (void**)&glad_glPrimitiveRestartIndex, (void*)glad_lazy_glPrimitiveRestartIndex);
+    glad_proc(index);
+}
+static void APIENTRY glad_lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+    PFNGLCOPYBUFFERSUBDATAPROC glad_proc = (PFNGLCOPYBUFFERSUBDATAPROC)glad_lazy_resolve("glCopyBufferSubData", (void**)&glad_glCopyBufferSubData, (void*)glad_lazy_glCopyBufferSubData);
+    glad_proc(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY glad_lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+    PFNGLGETUNIFORMINDICESPROC glad_proc = (PFNGLGETUNIFORMINDICESPROC)glad_lazy_resolve("glGetUniformIndices", (void**)&glad_glGetUniformIndices, (void*)glad_lazy_glGetUniformIndices);
+    glad_proc(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+    PFNGLGETACTIVEUNIFORMSIVPROC glad_proc = (PFNGLGETACTIVEUNIFORMSIVPROC)glad_lazy_resolve("glGetActiveUniformsiv", (void**)&glad_glGetActiveUniformsiv, (void*)glad_lazy_glGetActiveUniformsiv);
+    glad_proc(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+    PFNGLGETACTIVEUNIFORMNAMEPROC glad_proc = (PFNGLGETACTIVEUNIFORMNAMEPROC)glad_lazy_resolve("glGetActiveUniformName", (void**)&glad_glGetActiveUniformName, (void*)glad_lazy_glGetActiveUniformName);
+    glad_proc(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY glad_lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+    PFNGLGETUNIFORMBLOCKINDEXPROC glad_proc = (PFNGLGETUNIFORMBLOCKINDEXPROC)glad_lazy_resolve("glGetUniformBlockIndex", (void**)&glad_glGetUniformBlockIndex, (void*)glad_lazy_glGetUniformBlockIndex);
+    return glad_proc(program, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+    PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_proc = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glad_lazy_resolve("glGetActiveUniformBlockiv", (void**)&glad_glGetActiveUniformBlockiv, (void*)glad_lazy_glGetActiveUniformBlockiv);
+    glad_proc(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY glad_lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+    PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_proc = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glad_lazy_resolve("glGetActiveUniformBlockName", (void**)&glad_glGetActiveUniformBlockName, (void*)glad_lazy_glGetActiveUniformBlockName);
+    glad_proc(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY glad_lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+    PFNGLUNIFORMBLOCKBINDINGPROC glad_proc = (PFNGLUNIFORMBLOCKBINDINGPROC)glad_lazy_resolve("glUniformBlockBinding", (void**)&glad_glUniformBlockBinding, (void*)glad_lazy_glUniformBlockBinding);
+    glad_proc(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY glad_lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    PFNGLDRAWELEMENTSBASEVERTEXPROC glad_proc = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsBaseVertex", (void**)&glad_glDrawElementsBaseVertex, (void*)glad_lazy_glDrawElementsBaseVertex);
+    glad_proc(mode, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+    PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_proc = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glDrawRangeElementsBaseVertex", (void**)&glad_glDrawRangeElementsBaseVertex, (void*)glad_lazy_glDrawRangeElementsBaseVertex);
+    glad_proc(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY glad_lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+    PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_proc = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glad_lazy_resolve("glDrawElementsInstancedBaseVertex", (void**)&glad_glDrawElementsInstancedBaseVertex, (void*)glad_lazy_glDrawElementsInstancedBaseVertex);
+    glad_proc(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY glad_lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+    PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_proc = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glad_lazy_resolve("glMultiDrawElementsBaseVertex", (void**)&glad_glMultiDrawElementsBaseVertex, (void*)glad_lazy_glMultiDrawElementsBaseVertex);
+    glad_proc(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY glad_lazy_glProvokingVertex(GLenum mode) {
+    PFNGLPROVOKINGVERTEXPROC glad_proc = (PFNGLPROVOKINGVERTEXPROC)glad_lazy_resolve("glProvokingVertex", (void**)&glad_glProvokingVertex, (void*)glad_lazy_glProvokingVertex);
+    glad_proc(mode);
+}
+static GLsync APIENTRY glad_lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+    PFNGLFENCESYNCPROC glad_proc = (PFNGLFENCESYNCPROC)glad_lazy_resolve("glFenceSync", (void**)&glad_glFenceSync, (void*)glad_lazy_glFenceSync);
+    return glad_proc(condition, flags);
+}
+static GLboolean APIENTRY glad_lazy_glIsSync(GLsync sync) {
+    PFNGLISSYNCPROC glad_proc = (PFNGLISSYNCPROC)glad_lazy_resolve("glIsSync", (void**)&glad_glIsSync, (void*)glad_lazy_glIsSync);
+    return glad_proc(sync);
+}
+static void APIENTRY glad_lazy_glDeleteSync(GLsync sync) {
+    PFNGLDELETESYNCPROC glad_proc = (PFNGLDELETESYNCPROC)glad_lazy_resolve("glDeleteSync", (void**)&glad_glDeleteSync, (void*)glad_lazy_glDeleteSync);
+    glad_proc(sync);
+}
+static GLenum APIENTRY glad_lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    PFNGLCLIENTWAITSYNCPROC glad_proc = (PFNGLCLIENTWAITSYNCPROC)glad_lazy_resolve("glClientWaitSync", (void**)&glad_glClientWaitSync, (void*)glad_lazy_glClientWaitSync);
+    return glad_proc(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+    PFNGLWAITSYNCPROC glad_proc = (PFNGLWAITSYNCPROC)glad_lazy_resolve("glWaitSync", (void**)&glad_glWaitSync, (void*)glad_lazy_glWaitSync);
+    glad_proc(sync, flags, timeout);
+}
+static void APIENTRY glad_lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+    PFNGLGETINTEGER64VPROC glad_proc = (PFNGLGETINTEGER64VPROC)glad_lazy_resolve("glGetInteger64v", (void**)&glad_glGetInteger64v, (void*)glad_lazy_glGetInteger64v);
+    glad_proc(pname, data);
+}
+static void APIENTRY glad_lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+    PFNGLGETSYNCIVPROC glad_proc = (PFNGLGETSYNCIVPROC)glad_lazy_resolve("glGetSynciv", (void**)&glad_glGetSynciv, (void*)glad_lazy_glGetSynciv);
+    glad_proc(sync, pname, bufSize, length, values);
+}
+static void APIENTRY glad_lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+    PFNGLGETINTEGER64I_VPROC glad_proc = (PFNGLGETINTEGER64I_VPROC)glad_lazy_resolve("glGetInteger64i_v", (void**)&glad_glGetInteger64i_v, (void*)glad_lazy_glGetInteger64i_v);
+    glad_proc(target, index, data);
+}
+static void APIENTRY glad_lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+    PFNGLGETBUFFERPARAMETERI64VPROC glad_proc = (PFNGLGETBUFFERPARAMETERI64VPROC)glad_lazy_resolve("glGetBufferParameteri64v", (void**)&glad_glGetBufferParameteri64v, (void*)glad_lazy_glGetBufferParameteri64v);
+    glad_proc(target, pname, params);
+}
+static void APIENTRY glad_lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+    PFNGLFRAMEBUFFERTEXTUREPROC glad_proc = (PFNGLFRAMEBUFFERTEXTUREPROC)glad_lazy_resolve("glFramebufferTexture", (void**)&glad_glFramebufferTexture, (void*)glad_lazy_glFramebufferTexture);
+    glad_proc(target, attachment, texture, level);
+}
+static void APIENTRY glad_lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+    PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_proc = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage2DMultisample", (void**)&glad_glTexImage2DMultisample, (void*)glad_lazy_glTexImage2DMultisample);
+    glad_proc(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+    PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_proc = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glad_lazy_resolve("glTexImage3DMultisample", (void**)&glad_glTexImage3DMultisample, (void*)glad_lazy_glTexImage3DMultisample);
+    glad_proc(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY glad_lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+    PFNGLGETMULTISAMPLEFVPROC glad_proc = (PFNGLGETMULTISAMPLEFVPROC)glad_lazy_resolve("glGetMultisamplefv", (void**)&glad_glGetMultisamplefv, (void*)glad_lazy_glGetMultisamplefv);
+    glad_proc(pname, index, val);
+}
+static void APIENTRY glad_lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+    PFNGLSAMPLEMASKIPROC glad_proc = (PFNGLSAMPLEMASKIPROC)glad_lazy_resolve("glSampleMaski", (void**)&glad_glSampleMaski, (void*)glad_lazy_glSampleMaski);
+    glad_proc(maskNumber, mask);
+}
+static void APIENTRY glad_lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+    PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_proc = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glad_lazy_resolve("glBindFragDataLocationIndexed", (void**)&glad_glBindFragDataLocationIndexed, (void*)glad_lazy_glBindFragDataLocationIndexed);
+    glad_proc(program, colorNumber, index, name);
+}
+static GLint APIENTRY glad_lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+    PFNGLGETFRAGDATAINDEXPROC glad_proc = (PFNGLGETFRAGDATAINDEXPROC)glad_lazy_resolve("glGetFragDataIndex", (void**)&glad_glGetFragDataIndex, (void*)glad_lazy_glGetFragDataIndex);
+    return glad_proc(program, name);
+}
+static void APIENTRY glad_lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+    PFNGLGENSAMPLERSPROC glad_proc = (PFNGLGENSAMPLERSPROC)glad_lazy_resolve("glGenSamplers", (void**)&glad_glGenSamplers, (void*)glad_lazy_glGenSamplers);
+    glad_proc(count, samplers);
+}
+static void APIENTRY glad_lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+    PFNGLDELETESAMPLERSPROC glad_proc = (PFNGLDELETESAMPLERSPROC)glad_lazy_resolve("glDeleteSamplers", (void**)&glad_glDeleteSamplers, (void*)glad_lazy_glDeleteSamplers);
+    glad_proc(count, samplers);
+}
+static GLboolean APIENTRY glad_lazy_glIsSampler(GLuint sampler) {
+    PFNGLISSAMPLERPROC glad_proc = (PFNGLISSAMPLERPROC)glad_lazy_resolve("glIsSampler", (void**)&glad_glIsSampler, (void*)glad_lazy_glIsSampler);
+    return glad_proc(sampler);
+}
+static void APIENTRY glad_lazy_glBindSampler(GLuint unit, GLuint sampler) {
+    PFNGLBINDSAMPLERPROC glad_proc = (PFNGLBINDSAMPLERPROC)glad_lazy_resolve("glBindSampler", (void**)&glad_glBindSampler, (void*)glad_lazy_glBindSampler);
+    glad_proc(unit, sampler);
+}
+static void APIENTRY glad_lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+    PFNGLSAMPLERPARAMETERIPROC glad_proc = (PFNGLSAMPLERPARAMETERIPROC)glad_lazy_resolve("glSamplerParameteri", (void**)&glad_glSamplerParameteri, (void*)glad_lazy_glSamplerParameteri);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+    PFNGLSAMPLERPARAMETERIVPROC glad_proc = (PFNGLSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glSamplerParameteriv", (void**)&glad_glSamplerParameteriv, (void*)glad_lazy_glSamplerParameteriv);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+    PFNGLSAMPLERPARAMETERFPROC glad_proc = (PFNGLSAMPLERPARAMETERFPROC)glad_lazy_resolve("glSamplerParameterf", (void**)&glad_glSamplerParameterf, (void*)glad_lazy_glSamplerParameterf);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+    PFNGLSAMPLERPARAMETERFVPROC glad_proc = (PFNGLSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glSamplerParameterfv", (void**)&glad_glSamplerParameterfv, (void*)glad_lazy_glSamplerParameterfv);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+    PFNGLSAMPLERPARAMETERIIVPROC glad_proc = (PFNGLSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glSamplerParameterIiv", (void**)&glad_glSamplerParameterIiv, (void*)glad_lazy_glSamplerParameterIiv);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+    PFNGLSAMPLERPARAMETERIUIVPROC glad_proc = (PFNGLSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glSamplerParameterIuiv", (void**)&glad_glSamplerParameterIuiv, (void*)glad_lazy_glSamplerParameterIuiv);
+    glad_proc(sampler, pname, param);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+    PFNGLGETSAMPLERPARAMETERIVPROC glad_proc = (PFNGLGETSAMPLERPARAMETERIVPROC)glad_lazy_resolve("glGetSamplerParameteriv", (void**)&glad_glGetSamplerParameteriv, (void*)glad_lazy_glGetSamplerParameteriv);
+    glad_proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+    PFNGLGETSAMPLERPARAMETERIIVPROC glad_proc = (PFNGLGETSAMPLERPARAMETERIIVPROC)glad_lazy_resolve("glGetSamplerParameterIiv", (void**)&glad_glGetSamplerParameterIiv, (void*)glad_lazy_glGetSamplerParameterIiv);
+    glad_proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+    PFNGLGETSAMPLERPARAMETERFVPROC glad_proc = (PFNGLGETSAMPLERPARAMETERFVPROC)glad_lazy_resolve("glGetSamplerParameterfv", (void**)&glad_glGetSamplerParameterfv, (void*)glad_lazy_glGetSamplerParameterfv);
+    glad_proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+    PFNGLGETSAMPLERPARAMETERIUIVPROC glad_proc = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glad_lazy_resolve("glGetSamplerParameterIuiv", (void**)&glad_glGetSamplerParameterIuiv, (void*)glad_lazy_glGetSamplerParameterIuiv);
+    glad_proc(sampler, pname, params);
+}
+static void APIENTRY glad_lazy_glQueryCounter(GLuint id, GLenum target) {
+    PFNGLQUERYCOUNTERPROC glad_proc = (PFNGLQUERYCOUNTERPROC)glad_lazy_resolve("glQueryCounter", (void**)&glad_glQueryCounter, (void*)glad_lazy_glQueryCounter);
+    glad_proc(id, target);
+}
+static void APIENTRY glad_lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+    PFNGLGETQUERYOBJECTI64VPROC glad_proc = (PFNGLGETQUERYOBJECTI64VPROC)glad_lazy_resolve("glGetQueryObjecti64v", (void**)&glad_glGetQueryObjecti64v, (void*)glad_lazy_glGetQueryObjecti64v);
+    glad_proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+    PFNGLGETQUERYOBJECTUI64VPROC glad_proc = (PFNGLGETQUERYOBJECTUI64VPROC)glad_lazy_resolve("glGetQueryObjectui64v", (void**)&glad_glGetQueryObjectui64v, (void*)glad_lazy_glGetQueryObjectui64v);
+    glad_proc(id, pname, params);
+}
+static void APIENTRY glad_lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+    PFNGLVERTEXATTRIBDIVISORPROC glad_proc = (PFNGLVERTEXATTRIBDIVISORPROC)glad_lazy_resolve("glVertexAttribDivisor", (void**)&glad_glVertexAttribDivisor, (void*)glad_lazy_glVertexAttribDivisor);
+    glad_proc(index, divisor);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP1UIPROC glad_proc = (PFNGLVERTEXATTRIBP1UIPROC)glad_lazy_resolve("glVertexAttribP1ui", (void**)&glad_glVertexAttribP1ui, (void*)glad_lazy_glVertexAttribP1ui);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    PFNGLVERTEXATTRIBP1UIVPROC glad_proc = (PFNGLVERTEXATTRIBP1UIVPROC)glad_lazy_resolve("glVertexAttribP1uiv", (void**)&glad_glVertexAttribP1uiv, (void*)glad_lazy_glVertexAttribP1uiv);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP2UIPROC glad_proc = (PFNGLVERTEXATTRIBP2UIPROC)glad_lazy_resolve("glVertexAttribP2ui", (void**)&glad_glVertexAttribP2ui, (void*)glad_lazy_glVertexAttribP2ui);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    PFNGLVERTEXATTRIBP2UIVPROC glad_proc = (PFNGLVERTEXATTRIBP2UIVPROC)glad_lazy_resolve("glVertexAttribP2uiv", (void**)&glad_glVertexAttribP2uiv, (void*)glad_lazy_glVertexAttribP2uiv);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP3UIPROC glad_proc = (PFNGLVERTEXATTRIBP3UIPROC)glad_lazy_resolve("glVertexAttribP3ui", (void**)&glad_glVertexAttribP3ui, (void*)glad_lazy_glVertexAttribP3ui);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    PFNGLVERTEXATTRIBP3UIVPROC glad_proc = (PFNGLVERTEXATTRIBP3UIVPROC)glad_lazy_resolve("glVertexAttribP3uiv", (void**)&glad_glVertexAttribP3uiv, (void*)glad_lazy_glVertexAttribP3uiv);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+    PFNGLVERTEXATTRIBP4UIPROC glad_proc = (PFNGLVERTEXATTRIBP4UIPROC)glad_lazy_resolve("glVertexAttribP4ui", (void**)&glad_glVertexAttribP4ui, (void*)glad_lazy_glVertexAttribP4ui);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+    PFNGLVERTEXATTRIBP4UIVPROC glad_proc = (PFNGLVERTEXATTRIBP4UIVPROC)glad_lazy_resolve("glVertexAttribP4uiv", (void**)&glad_glVertexAttribP4uiv, (void*)glad_lazy_glVertexAttribP4uiv);
+    glad_proc(index, type, normalized, value);
+}
+static void APIENTRY glad_lazy_glVertexP2ui(GLenum type, GLuint value) {
+    PFNGLVERTEXP2UIPROC glad_proc = (PFNGLVERTEXP2UIPROC)glad_lazy_resolve("glVertexP2ui", (void**)&glad_glVertexP2ui, (void*)glad_lazy_glVertexP2ui);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+    PFNGLVERTEXP2UIVPROC glad_proc = (PFNGLVERTEXP2UIVPROC)glad_lazy_resolve("glVertexP2uiv", (void**)&glad_glVertexP2uiv, (void*)glad_lazy_glVertexP2uiv);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3ui(GLenum type, GLuint value) {
+    PFNGLVERTEXP3UIPROC glad_proc = (PFNGLVERTEXP3UIPROC)glad_lazy_resolve("glVertexP3ui", (void**)&glad_glVertexP3ui, (void*)glad_lazy_glVertexP3ui);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+    PFNGLVERTEXP3UIVPROC glad_proc = (PFNGLVERTEXP3UIVPROC)glad_lazy_resolve("glVertexP3uiv", (void**)&glad_glVertexP3uiv, (void*)glad_lazy_glVertexP3uiv);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4ui(GLenum type, GLuint value) {
+    PFNGLVERTEXP4UIPROC glad_proc = (PFNGLVERTEXP4UIPROC)glad_lazy_resolve("glVertexP4ui", (void**)&glad_glVertexP4ui, (void*)glad_lazy_glVertexP4ui);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+    PFNGLVERTEXP4UIVPROC glad_proc = (PFNGLVERTEXP4UIVPROC)glad_lazy_resolve("glVertexP4uiv", (void**)&glad_glVertexP4uiv, (void*)glad_lazy_glVertexP4uiv);
+    glad_proc(type, value);
+}
+static void APIENTRY glad_lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+    PFNGLTEXCOORDP1UIPROC glad_proc = (PFNGLTEXCOORDP1UIPROC)glad_lazy_resolve("glTexCoordP1ui", (void**)&glad_glTexCoordP1ui, (void*)glad_lazy_glTexCoordP1ui);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+    PFNGLTEXCOORDP1UIVPROC glad_proc = (PFNGLTEXCOORDP1UIVPROC)glad_lazy_resolve("glTexCoordP1uiv", (void**)&glad_glTexCoordP1uiv, (void*)glad_lazy_glTexCoordP1uiv);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+    PFNGLTEXCOORDP2UIPROC glad_proc = (PFNGLTEXCOORDP2UIPROC)glad_lazy_resolve("glTexCoordP2ui", (void**)&glad_glTexCoordP2ui, (void*)glad_lazy_glTexCoordP2ui);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+    PFNGLTEXCOORDP2UIVPROC glad_proc = (PFNGLTEXCOORDP2UIVPROC)glad_lazy_resolve("glTexCoordP2uiv", (void**)&glad_glTexCoordP2uiv, (void*)glad_lazy_glTexCoordP2uiv);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+    PFNGLTEXCOORDP3UIPROC glad_proc = (PFNGLTEXCOORDP3UIPROC)glad_lazy_resolve("glTexCoordP3ui", (void**)&glad_glTexCoordP3ui, (void*)glad_lazy_glTexCoordP3ui);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+    PFNGLTEXCOORDP3UIVPROC glad_proc = (PFNGLTEXCOORDP3UIVPROC)glad_lazy_resolve("glTexCoordP3uiv", (void**)&glad_glTexCoordP3uiv, (void*)glad_lazy_glTexCoordP3uiv);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+    PFNGLTEXCOORDP4UIPROC glad_proc = (PFNGLTEXCOORDP4UIPROC)glad_lazy_resolve("glTexCoordP4ui", (void**)&glad_glTexCoordP4ui, (void*)glad_lazy_glTexCoordP4ui);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+    PFNGLTEXCOORDP4UIVPROC glad_proc = (PFNGLTEXCOORDP4UIVPROC)glad_lazy_resolve("glTexCoordP4uiv", (void**)&glad_glTexCoordP4uiv, (void*)glad_lazy_glTexCoordP4uiv);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+    PFNGLMULTITEXCOORDP1UIPROC glad_proc = (PFNGLMULTITEXCOORDP1UIPROC)glad_lazy_resolve("glMultiTexCoordP1ui", (void**)&glad_glMultiTexCoordP1ui, (void*)glad_lazy_glMultiTexCoordP1ui);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    PFNGLMULTITEXCOORDP1UIVPROC glad_proc = (PFNGLMULTITEXCOORDP1UIVPROC)glad_lazy_resolve("glMultiTexCoordP1uiv", (void**)&glad_glMultiTexCoordP1uiv, (void*)glad_lazy_glMultiTexCoordP1uiv);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+    PFNGLMULTITEXCOORDP2UIPROC glad_proc = (PFNGLMULTITEXCOORDP2UIPROC)glad_lazy_resolve("glMultiTexCoordP2ui", (void**)&glad_glMultiTexCoordP2ui, (void*)glad_lazy_glMultiTexCoordP2ui);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    PFNGLMULTITEXCOORDP2UIVPROC glad_proc = (PFNGLMULTITEXCOORDP2UIVPROC)glad_lazy_resolve("glMultiTexCoordP2uiv", (void**)&glad_glMultiTexCoordP2uiv, (void*)glad_lazy_glMultiTexCoordP2uiv);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+    PFNGLMULTITEXCOORDP3UIPROC glad_proc = (PFNGLMULTITEXCOORDP3UIPROC)glad_lazy_resolve("glMultiTexCoordP3ui", (void**)&glad_glMultiTexCoordP3ui, (void*)glad_lazy_glMultiTexCoordP3ui);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    PFNGLMULTITEXCOORDP3UIVPROC glad_proc = (PFNGLMULTITEXCOORDP3UIVPROC)glad_lazy_resolve("glMultiTexCoordP3uiv", (void**)&glad_glMultiTexCoordP3uiv, (void*)glad_lazy_glMultiTexCoordP3uiv);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+    PFNGLMULTITEXCOORDP4UIPROC glad_proc = (PFNGLMULTITEXCOORDP4UIPROC)glad_lazy_resolve("glMultiTexCoordP4ui", (void**)&glad_glMultiTexCoordP4ui, (void*)glad_lazy_glMultiTexCoordP4ui);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+    PFNGLMULTITEXCOORDP4UIVPROC glad_proc = (PFNGLMULTITEXCOORDP4UIVPROC)glad_lazy_resolve("glMultiTexCoordP4uiv", (void**)&glad_glMultiTexCoordP4uiv, (void*)glad_lazy_glMultiTexCoordP4uiv);
+    glad_proc(texture, type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3ui(GLenum type, GLuint coords) {
+    PFNGLNORMALP3UIPROC glad_proc = (PFNGLNORMALP3UIPROC)glad_lazy_resolve("glNormalP3ui", (void**)&glad_glNormalP3ui, (void*)glad_lazy_glNormalP3ui);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+    PFNGLNORMALP3UIVPROC glad_proc = (PFNGLNORMALP3UIVPROC)glad_lazy_resolve("glNormalP3uiv", (void**)&glad_glNormalP3uiv, (void*)glad_lazy_glNormalP3uiv);
+    glad_proc(type, coords);
+}
+static void APIENTRY glad_lazy_glColorP3ui(GLenum type, GLuint color) {
+    PFNGLCOLORP3UIPROC glad_proc = (PFNGLCOLORP3UIPROC)glad_lazy_resolve("glColorP3ui", (void**)&glad_glColorP3ui, (void*)glad_lazy_glColorP3ui);
+    glad_proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+    PFNGLCOLORP3UIVPROC glad_proc = (PFNGLCOLORP3UIVPROC)glad_lazy_resolve("glColorP3uiv", (void**)&glad_glColorP3uiv, (void*)glad_lazy_glColorP3uiv);
+    glad_proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4ui(GLenum type, GLuint color) {
+    PFNGLCOLORP4UIPROC glad_proc = (PFNGLCOLORP4UIPROC)glad_lazy_resolve("glColorP4ui", (void**)&glad_glColorP4ui, (void*)glad_lazy_glColorP4ui);
+    glad_proc(type, color);
+}
+static void APIENTRY glad_lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+    PFNGLCOLORP4UIVPROC glad_proc = (PFNGLCOLORP4UIVPROC)glad_lazy_resolve("glColorP4uiv", (void**)&glad_glColorP4uiv, (void*)glad_lazy_glColorP4uiv);
+    glad_proc(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+    PFNGLSECONDARYCOLORP3UIPROC glad_proc = (PFNGLSECONDARYCOLORP3UIPROC)glad_lazy_resolve("glSecondaryColorP3ui", (void**)&glad_glSecondaryColorP3ui, (void*)glad_lazy_glSecondaryColorP3ui);
+    glad_proc(type, color);
+}
+static void APIENTRY glad_lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+    PFNGLSECONDARYCOLORP3UIVPROC glad_proc = (PFNGLSECONDARYCOLORP3UIVPROC)glad_lazy_resolve("glSecondaryColorP3uiv", (void**)&glad_glSecondaryColorP3uiv, (void*)glad_lazy_glSecondaryColorP3uiv);
+    glad_proc(type, color);
+}
+static void glad_install_lazy_GL_VERSION_1_0(void) {
+    if(!GLAD_GL_VERSION_1_0) return;
+    glad_glCullFace = glad_lazy_glCullFace;
+    glad_glFrontFace = glad_lazy_glFrontFace;
+    glad_glHint = glad_lazy_glHint;
+    glad_glLineWidth = glad_lazy_glLineWidth;
+    glad_glPointSize = glad_lazy_glPointSize;
+    glad_glPolygonMode = glad_lazy_glPolygonMode;
+    glad_glScissor = glad_lazy_glScissor;
+    glad_glTexParameterf = glad_lazy_glTexParameterf;
+    glad_glTexParameterfv = glad_lazy_glTexParameterfv;
+    glad_glTexParameteri = glad_lazy_glTexParameteri;
+    glad_glTexParameteriv = glad_lazy_glTexParameteriv;
+    glad_glTexImage1D = glad_lazy_glTexImage1D;
+    glad_glTexImage2D = glad_lazy_glTexImage2D;
+    glad_glDrawBuffer = glad_lazy_glDrawBuffer;
+    glad_glClear = glad_lazy_glClear;
+    glad_glClearColor = glad_lazy_glClearColor;
+    glad_glClearStencil = glad_lazy_glClearStencil;
+    glad_glClearDepth = glad_lazy_glClearDepth;
+    glad_glStencilMask = glad_lazy_glStencilMask;
+    glad_glColorMask = glad_lazy_glColorMask;
+    glad_glDepthMask = glad_lazy_glDepthMask;
+    glad_glDisable = glad_lazy_glDisable;
+    glad_glEnable = glad_lazy_glEnable;
+    glad_glFinish = glad_lazy_glFinish;
+    glad_glFlush = glad_lazy_glFlush;
+    glad_glBlendFunc = glad_lazy_glBlendFunc;
+    glad_glLogicOp = glad_lazy_glLogicOp;
+    glad_glStencilFunc = glad_lazy_glStencilFunc;
+    glad_glStencilOp = glad_lazy_glStencilOp;
+    glad_glDepthFunc = glad_lazy_glDepthFunc;
+    glad_glPixelStoref = glad_lazy_glPixelStoref;
+    glad_glPixelStorei = glad_lazy_glPixelStorei;
+    glad_glReadBuffer = glad_lazy_glReadBuffer;
+    glad_glReadPixels = glad_lazy_glReadPixels;
+    glad_glGetBooleanv = glad_lazy_glGetBooleanv;
+    glad_glGetDoublev = glad_lazy_glGetDoublev;
+    glad_glGetError = glad_lazy_glGetError;
+    glad_glGetFloatv = glad_lazy_glGetFloatv;
+    glad_glGetIntegerv = glad_lazy_glGetIntegerv;
+    glad_glGetTexImage = glad_lazy_glGetTexImage;
+    glad_glGetTexParameterfv = glad_lazy_glGetTexParameterfv;
+    glad_glGetTexParameteriv = glad_lazy_glGetTexParameteriv;
+    glad_glGetTexLevelParameterfv = glad_lazy_glGetTexLevelParameterfv;
+    glad_glGetTexLevelParameteriv = glad_lazy_glGetTexLevelParameteriv;
+    glad_glIsEnabled = glad_lazy_glIsEnabled;
+    glad_glDepthRange = glad_lazy_glDepthRange;
+    glad_glViewport = glad_lazy_glViewport;
+}
+static void glad_install_lazy_GL_VERSION_1_1(void) {
+    if(!GLAD_GL_VERSION_1_1) return;
+    glad_glDrawArrays = glad_lazy_glDrawArrays;
+    glad_glDrawElements = glad_lazy_glDrawElements;
+    glad_glPolygonOffset = glad_lazy_glPolygonOffset;
+    glad_glCopyTexImage1D = glad_lazy_glCopyTexImage1D;
+    glad_glCopyTexImage2D = glad_lazy_glCopyTexImage2D;
+    glad_glCopyTexSubImage1D = glad_lazy_glCopyTexSubImage1D;
+    glad_glCopyTexSubImage2D = glad_lazy_glCopyTexSubImage2D;
+    glad_glTexSubImage1D = glad_lazy_glTexSubImage1D;
+    glad_glTexSubImage2D = glad_lazy_glTexSubImage2D;
+    glad_glBindTexture = glad_lazy_glBindTexture;
+    glad_glDeleteTextures = glad_lazy_glDeleteTextures;
+    glad_glGenTextures = glad_lazy_glGenTextures;
+    glad_glIsTexture = glad_lazy_glIsTexture;
+}
+static void glad_install_lazy_GL_VERSION_1_2(void) {
+    if(!GLAD_GL_VERSION_1_2) return;
+    glad_glDrawRangeElements = glad_lazy_glDrawRangeElements;
+    glad_glTexImage3D = glad_lazy_glTexImage3D;
+    glad_glTexSubImage3D = glad_lazy_glTexSubImage3D;
+    glad_glCopyTexSubImage3D = glad_lazy_glCopyTexSubImage3D;
+}
+static void glad_install_lazy_GL_VERSION_1_3(void) {
+    if(!GLAD_GL_VERSION_1_3) return;
+    glad_glActiveTexture = glad_lazy_glActiveTexture;
+    glad_glSampleCoverage = glad_lazy_glSampleCoverage;
+    glad_glCompressedTexImage3D = glad_lazy_glCompressedTexImage3D;
+    glad_glCompressedTexImage2D = glad_lazy_glCompressedTexImage2D;
+    glad_glCompressedTexImage1D = glad_lazy_glCompressedTexImage1D;
+    glad_glCompressedTexSubImage3D = glad_lazy_glCompressedTexSubImage3D;
+    glad_glCompressedTexSubImage2D = glad_lazy_glCompressedTexSubImage2D;
+    glad_glCompressedTexSubImage1D = glad_lazy_glCompressedTexSubImage1D;
+    glad_glGetCompressedTexImage = glad_lazy_glGetCompressedTexImage;
+}
+static void glad_install_lazy_GL_VERSION_1_4(void) {
+    if(!GLAD_GL_VERSION_1_4) return;
+    glad_glBlendFuncSeparate = glad_lazy_glBlendFuncSeparate;
+    glad_glMultiDrawArrays = glad_lazy_glMultiDrawArrays;
+    glad_glMultiDrawElements = glad_lazy_glMultiDrawElements;
+    glad_glPointParameterf = glad_lazy_glPointParameterf;
+    glad_glPointParameterfv = glad_lazy_glPointParameterfv;
+    glad_glPointParameteri = glad_lazy_glPointParameteri;
+    glad_glPointParameteriv = glad_lazy_glPointParameteriv;
+    glad_glBlendColor = glad_lazy_glBlendColor;
+    glad_glBlendEquation = glad_lazy_glBlendEquation;
+}
+static void glad_install_lazy_GL_VERSION_1_5(void) {
+    if(!GLAD_GL_VERSION_1_5) return;
+    glad_glGenQueries = glad_lazy_glGenQueries;
+    glad_glDeleteQueries = glad_lazy_glDeleteQueries;
+    glad_glIsQuery = glad_lazy_glIsQuery;
+    glad_glBeginQuery = glad_lazy_glBeginQuery;
+    glad_glEndQuery = glad_lazy_glEndQuery;
+    glad_glGetQueryiv = glad_lazy_glGetQueryiv;
+    glad_glGetQueryObjectiv = glad_lazy_glGetQueryObjectiv;
+    glad_glGetQueryObjectuiv = glad_lazy_glGetQueryObjectuiv;
+    glad_glBindBuffer = glad_lazy_glBindBuffer;
+    glad_glDeleteBuffers = glad_lazy_glDeleteBuffers;
+    glad_glGenBuffers = glad_lazy_glGenBuffers;
+    glad_glIsBuffer = glad_lazy_glIsBuffer;
+    glad_glBufferData = glad_lazy_glBufferData;
+    glad_glBufferSubData = glad_lazy_glBufferSubData;
+    glad_glGetBufferSubData = glad_lazy_glGetBufferSubData;
+    glad_glMapBuffer = glad_lazy_glMapBuffer;
+    glad_glUnmapBuffer = glad_lazy_glUnmapBuffer;
+    glad_glGetBufferParameteriv = glad_lazy_glGetBufferParameteriv;
+    glad_glGetBufferPointerv = glad_lazy_glGetBufferPointerv;
+}
+static void glad_install_lazy_GL_VERSION_2_0(void) {
+    if(!GLAD_GL_VERSION_2_0) return;
+    glad_glBlendEquationSeparate = glad_lazy_glBlendEquationSeparate;
+    glad_glDrawBuffers = glad_lazy_glDrawBuffers;
+    glad_glStencilOpSeparate = glad_lazy_glStencilOpSeparate;
+    glad_glStencilFuncSeparate = glad_lazy_glStencilFuncSeparate;
+    glad_glStencilMaskSeparate = glad_lazy_glStencilMaskSeparate;
+    glad_glAttachShader = glad_lazy_glAttachShader;
+    glad_glBindAttribLocation = glad_lazy_glBindAttribLocation;
+    glad_glCompileShader = glad_lazy_glCompileShader;
+    glad_glCreateProgram = glad_lazy_glCreateProgram;
+    glad_glCreateShader = glad_lazy_glCreateShader;
+    glad_glDeleteProgram = glad_lazy_glDeleteProgram;
+    glad_glDeleteShader = glad_lazy_glDeleteShader;
+    glad_glDetachShader = glad_lazy_glDetachShader;
+    glad_glDisableVertexAttribArray = glad_lazy_glDisableVertexAttribArray;
+    glad_glEnableVertexAttribArray = glad_lazy_glEnableVertexAttribArray;
+    glad_glGetActiveAttrib = glad_lazy_glGetActiveAttrib;
+    glad_glGetActiveUniform = glad_lazy_glGetActiveUniform;
+    glad_glGetAttachedShaders = glad_lazy_glGetAttachedShaders;
+    glad_glGetAttribLocation = glad_lazy_glGetAttribLocation;
+    glad_glGetProgramiv = glad_lazy_glGetProgramiv;
+    glad_glGetProgramInfoLog = glad_lazy_glGetProgramInfoLog;
+    glad_glGetShaderiv = glad_lazy_glGetShaderiv;
+    glad_glGetShaderInfoLog = glad_lazy_glGetShaderInfoLog;
+    glad_glGetShaderSource = glad_lazy_glGetShaderSource;
+    glad_glGetUniformLocation = glad_lazy_glGetUniformLocation;
+    glad_glGetUniformfv = glad_lazy_glGetUniformfv;
+    glad_glGetUniformiv = glad_lazy_glGetUniformiv;
+    glad_glGetVertexAttribdv = glad_lazy_glGetVertexAttribdv;
+    glad_glGetVertexAttribfv = glad_lazy_glGetVertexAttribfv;
+    glad_glGetVertexAttribiv = glad_lazy_glGetVertexAttribiv;
+    glad_glGetVertexAttribPointerv = glad_lazy_glGetVertexAttribPointerv;
+    glad_glIsProgram = glad_lazy_glIsProgram;
+    glad_glIsShader = glad_lazy_glIsShader;
+    glad_glLinkProgram = glad_lazy_glLinkProgram;
+    glad_glShaderSource = glad_lazy_glShaderSource;
+    glad_glUseProgram = glad_lazy_glUseProgram;
+    glad_glUniform1f = glad_lazy_glUniform1f;
+    glad_glUniform2f = glad_lazy_glUniform2f;
+    glad_glUniform3f = glad_lazy_glUniform3f;
+    glad_glUniform4f = glad_lazy_glUniform4f;
+    glad_glUniform1i = glad_lazy_glUniform1i;
+    glad_glUniform2i = glad_lazy_glUniform2i;
+    glad_glUniform3i = glad_lazy_glUniform3i;
+    glad_glUniform4i = glad_lazy_glUniform4i;
+    glad_glUniform1fv = glad_lazy_glUniform1fv;
+    glad_glUniform2fv = glad_lazy_glUniform2fv;
+    glad_glUniform3fv = glad_lazy_glUniform3fv;
+    glad_glUniform4fv = glad_lazy_glUniform4fv;
+    glad_glUniform1iv = glad_lazy_glUniform1iv;
+    glad_glUniform2iv = glad_lazy_glUniform2iv;
+    glad_glUniform3iv = glad_lazy_glUniform3iv;
+    glad_glUniform4iv = glad_lazy_glUniform4iv;
+    glad_glUniformMatrix2fv = glad_lazy_glUniformMatrix2fv;
+    glad_glUniformMatrix3fv = glad_lazy_glUniformMatrix3fv;
+    glad_glUniformMatrix4fv = glad_lazy_glUniformMatrix4fv;
+    glad_glValidateProgram = glad_lazy_glValidateProgram;
+    glad_glVertexAttrib1d = glad_lazy_glVertexAttrib1d;
+    glad_glVertexAttrib1dv = glad_lazy_glVertexAttrib1dv;
+    glad_glVertexAttrib1f = glad_lazy_glVertexAttrib1f;
+    glad_glVertexAttrib1fv = glad_lazy_glVertexAttrib1fv;
+    glad_glVertexAttrib1s = glad_lazy_glVertexAttrib1s;
+    glad_glVertexAttrib1sv = glad_lazy_glVertexAttrib1sv;
+    glad_glVertexAttrib2d = glad_lazy_glVertexAttrib2d;
+    glad_glVertexAttrib2dv = glad_lazy_glVertexAttrib2dv;
+    glad_glVertexAttrib2f = glad_lazy_glVertexAttrib2f;
+    glad_glVertexAttrib2fv = glad_lazy_glVertexAttrib2fv;
+    glad_glVertexAttrib2s = glad_lazy_glVertexAttrib2s;
+    glad_glVertexAttrib2sv = glad_lazy_glVertexAttrib2sv;
+    glad_glVertexAttrib3d = glad_lazy_glVertexAttrib3d;
+    glad_glVertexAttrib3dv = glad_lazy_glVertexAttrib3dv;
+    glad_glVertexAttrib3f = glad_lazy_glVertexAttrib3f;
+    glad_glVertexAttrib3fv = glad_lazy_glVertexAttrib3fv;
+    glad_glVertexAttrib3s = glad_lazy_glVertexAttrib3s;
+    glad_glVertexAttrib3sv = glad_lazy_glVertexAttrib3sv;
+    glad_glVertexAttrib4Nbv = glad_lazy_glVertexAttrib4Nbv;
+    glad_glVertexAttrib4Niv = glad_lazy_glVertexAttrib4Niv;
+    glad_glVertexAttrib4Nsv = glad_lazy_glVertexAttrib4Nsv;
+    glad_glVertexAttrib4Nub = glad_lazy_glVertexAttrib4Nub;
+    glad_glVertexAttrib4Nubv = glad_lazy_glVertexAttrib4Nubv;
+    glad_glVertexAttrib4Nuiv = glad_lazy_glVertexAttrib4Nuiv;
+    glad_glVertexAttrib4Nusv = glad_lazy_glVertexAttrib4Nusv;
+    glad_glVertexAttrib4bv = glad_lazy_glVertexAttrib4bv;
+    glad_glVertexAttrib4d = glad_lazy_glVertexAttrib4d;
+    glad_glVertexAttrib4dv = glad_lazy_glVertexAttrib4dv;
+    glad_glVertexAttrib4f = glad_lazy_glVertexAttrib4f;
+    glad_glVertexAttrib4fv = glad_lazy_glVertexAttrib4fv;
+    glad_glVertexAttrib4iv = glad_lazy_glVertexAttrib4iv;
+    glad_glVertexAttrib4s = glad_lazy_glVertexAttrib4s;
+    glad_glVertexAttrib4sv = glad_lazy_glVertexAttrib4sv;
+    glad_glVertexAttrib4ubv = glad_lazy_glVertexAttrib4ubv;
+    glad_glVertexAttrib4uiv = glad_lazy_glVertexAttrib4uiv;
+    glad_glVertexAttrib4usv = glad_lazy_glVertexAttrib4usv;
+    glad_glVertexAttribPointer = glad_lazy_glVertexAttribPointer;
+}
+static void glad_install_lazy_GL_VERSION_2_1(void) {
+    if(!GLAD_GL_VERSION_2_1) return;
+    glad_glUniformMatrix2x3fv = glad_lazy_glUniformMatrix2x3fv;
+    glad_glUniformMatrix3x2fv = glad_lazy_glUniformMatrix3x2fv;
+    glad_glUniformMatrix2x4fv = glad_lazy_glUniformMatrix2x4fv;
+    glad_glUniformMatrix4x2fv = glad_lazy_glUniformMatrix4x2fv;
+    glad_glUniformMatrix3x4fv = glad_lazy_glUniformMatrix3x4fv;
+    glad_glUniformMatrix4x3fv = glad_lazy_glUniformMatrix4x3fv;
+}
+static void glad_install_lazy_GL_VERSION_3_0(void) {
+    if(!GLAD_GL_VERSION_3_0) return;
+    glad_glColorMaski = glad_lazy_glColorMaski;
+    glad_glGetBooleani_v = glad_lazy_glGetBooleani_v;
+    glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+    glad_glEnablei = glad_lazy_glEnablei;
+    glad_glDisablei = glad_lazy_glDisablei;
+    glad_glIsEnabledi = glad_lazy_glIsEnabledi;
+    glad_glBeginTransformFeedback = glad_lazy_glBeginTransformFeedback;
+    glad_glEndTransformFeedback = glad_lazy_glEndTransformFeedback;
+    glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+    glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+    glad_glTransformFeedbackVaryings = glad_lazy_glTransformFeedbackVaryings;
+    glad_glGetTransformFeedbackVarying = glad_lazy_glGetTransformFeedbackVarying;
+    glad_glClampColor = glad_lazy_glClampColor;
+    glad_glBeginConditionalRender = glad_lazy_glBeginConditionalRender;
+    glad_glEndConditionalRender = glad_lazy_glEndConditionalRender;
+    glad_glVertexAttribIPointer = glad_lazy_glVertexAttribIPointer;
+    glad_glGetVertexAttribIiv = glad_lazy_glGetVertexAttribIiv;
+    glad_glGetVertexAttribIuiv = glad_lazy_glGetVertexAttribIuiv;
+    glad_glVertexAttribI1i = glad_lazy_glVertexAttribI1i;
+    glad_glVertexAttribI2i = glad_lazy_glVertexAttribI2i;
+    glad_glVertexAttribI3i = glad_lazy_glVertexAttribI3i;
+    glad_glVertexAttribI4i = glad_lazy_glVertexAttribI4i;
+    glad_glVertexAttribI1ui = glad_lazy_glVertexAttribI1ui;
+    glad_glVertexAttribI2ui = glad_lazy_glVertexAttribI2ui;
+    glad_glVertexAttribI3ui = glad_lazy_glVertexAttribI3ui;
+    glad_glVertexAttribI4ui = glad_lazy_glVertexAttribI4ui;
+    glad_glVertexAttribI1iv = glad_lazy_glVertexAttribI1iv;
+    glad_glVertexAttribI2iv = glad_lazy_glVertexAttribI2iv;
+    glad_glVertexAttribI3iv = glad_lazy_glVertexAttribI3iv;
+    glad_glVertexAttribI4iv = glad_lazy_glVertexAttribI4iv;
+    glad_glVertexAttribI1uiv = glad_lazy_glVertexAttribI1uiv;
+    glad_glVertexAttribI2uiv = glad_lazy_glVertexAttribI2uiv;
+    glad_glVertexAttribI3uiv = glad_lazy_glVertexAttribI3uiv;
+    glad_glVertexAttribI4uiv = glad_lazy_glVertexAttribI4uiv;
+    glad_glVertexAttribI4bv = glad_lazy_glVertexAttribI4bv;
+    glad_glVertexAttribI4sv = glad_lazy_glVertexAttribI4sv;
+    glad_glVertexAttribI4ubv = glad_lazy_glVertexAttribI4ubv;
+    glad_glVertexAttribI4usv = glad_lazy_glVertexAttribI4usv;
+    glad_glGetUniformuiv = glad_lazy_glGetUniformuiv;
+    glad_glBindFragDataLocation = glad_lazy_glBindFragDataLocation;
+    glad_glGetFragDataLocation = glad_lazy_glGetFragDataLocation;
+    glad_glUniform1ui = glad_lazy_glUniform1ui;
+    glad_glUniform2ui = glad_lazy_glUniform2ui;
+    glad_glUniform3ui = glad_lazy_glUniform3ui;
+    glad_glUniform4ui = glad_lazy_glUniform4ui;
+    glad_glUniform1uiv = glad_lazy_glUniform1uiv;
+    glad_glUniform2uiv = glad_lazy_glUniform2uiv;
+    glad_glUniform3uiv = glad_lazy_glUniform3uiv;
+    glad_glUniform4uiv = glad_lazy_glUniform4uiv;
+    glad_glTexParameterIiv = glad_lazy_glTexParameterIiv;
+    glad_glTexParameterIuiv = glad_lazy_glTexParameterIuiv;
+    glad_glGetTexParameterIiv = glad_lazy_glGetTexParameterIiv;
+    glad_glGetTexParameterIuiv = glad_lazy_glGetTexParameterIuiv;
+    glad_glClearBufferiv = glad_lazy_glClearBufferiv;
+    glad_glClearBufferuiv = glad_lazy_glClearBufferuiv;
+    glad_glClearBufferfv = glad_lazy_glClearBufferfv;
+    glad_glClearBufferfi = glad_lazy_glClearBufferfi;
+    glad_glGetStringi = glad_lazy_glGetStringi;
+    glad_glIsRenderbuffer = glad_lazy_glIsRenderbuffer;
+    glad_glBindRenderbuffer = glad_lazy_glBindRenderbuffer;
+    glad_glDeleteRenderbuffers = glad_lazy_glDeleteRenderbuffers;
+    glad_glGenRenderbuffers = glad_lazy_glGenRenderbuffers;
+    glad_glRenderbufferStorage = glad_lazy_glRenderbufferStorage;
+    glad_glGetRenderbufferParameteriv = glad_lazy_glGetRenderbufferParameteriv;
+    glad_glIsFramebuffer = glad_lazy_glIsFramebuffer;
+    glad_glBindFramebuffer = glad_lazy_glBindFramebuffer;
+    glad_glDeleteFramebuffers = glad_lazy_glDeleteFramebuffers;
+    glad_glGenFramebuffers = glad_lazy_glGenFramebuffers;
+    glad_glCheckFramebufferStatus = glad_lazy_glCheckFramebufferStatus;
+    glad_glFramebufferTexture1D = glad_lazy_glFramebufferTexture1D;
+    glad_glFramebufferTexture2D = glad_lazy_glFramebufferTexture2D;
+    glad_glFramebufferTexture3D = glad_lazy_glFramebufferTexture3D;
+    glad_glFramebufferRenderbuffer = glad_lazy_glFramebufferRenderbuffer;
+    glad_glGetFramebufferAttachmentParameteriv = glad_lazy_glGetFramebufferAttachmentParameteriv;
+    glad_glGenerateMipmap = glad_lazy_glGenerateMipmap;
+    glad_glBlitFramebuffer = glad_lazy_glBlitFramebuffer;
+    glad_glRenderbufferStorageMultisample = glad_lazy_glRenderbufferStorageMultisample;
+    glad_glFramebufferTextureLayer = glad_lazy_glFramebufferTextureLayer;
+    glad_glMapBufferRange = glad_lazy_glMapBufferRange;
+    glad_glFlushMappedBufferRange = glad_lazy_glFlushMappedBufferRange;
+    glad_glBindVertexArray = glad_lazy_glBindVertexArray;
+    glad_glDeleteVertexArrays = glad_lazy_glDeleteVertexArrays;
+    glad_glGenVertexArrays = glad_lazy_glGenVertexArrays;
+    glad_glIsVertexArray = glad_lazy_glIsVertexArray;
+}
+static void glad_install_lazy_GL_VERSION_3_1(void) {
+    if(!GLAD_GL_VERSION_3_1) return;
+    glad_glDrawArraysInstanced = glad_lazy_glDrawArraysInstanced;
+    glad_glDrawElementsInstanced = glad_lazy_glDrawElementsInstanced;
+    glad_glTexBuffer = glad_lazy_glTexBuffer;
+    glad_glPrimitiveRestartIndex = glad_lazy_glPrimitiveRestartIndex;
+    glad_glCopyBufferSubData = glad_lazy_glCopyBufferSubData;
+    glad_glGetUniformIndices = glad_lazy_glGetUniformIndices;
+    glad_glGetActiveUniformsiv = glad_lazy_glGetActiveUniformsiv;
+    glad_glGetActiveUniformName = glad_lazy_glGetActiveUniformName;
+    glad_glGetUniformBlockIndex = glad_lazy_glGetUniformBlockIndex;
+    glad_glGetActiveUniformBlockiv = glad_lazy_glGetActiveUniformBlockiv;
+    glad_glGetActiveUniformBlockName = glad_lazy_glGetActiveUniformBlockName;
+    glad_glUniformBlockBinding = glad_lazy_glUniformBlockBinding;
+    glad_glBindBufferRange = glad_lazy_glBindBufferRange;
+    glad_glBindBufferBase = glad_lazy_glBindBufferBase;
+    glad_glGetIntegeri_v = glad_lazy_glGetIntegeri_v;
+}
+static void glad_install_lazy_GL_VERSION_3_2(void) {
+    if(!GLAD_GL_VERSION_3_2) return;
+    glad_glDrawElementsBaseVertex = glad_lazy_glDrawElementsBaseVertex;
+    glad_glDrawRangeElementsBaseVertex = glad_lazy_glDrawRangeElementsBaseVertex;
+    glad_glDrawElementsInstancedBaseVertex = glad_lazy_glDrawElementsInstancedBaseVertex;
+    glad_glMultiDrawElementsBaseVertex = glad_lazy_glMultiDrawElementsBaseVertex;
+    glad_glProvokingVertex = glad_lazy_glProvokingVertex;
+    glad_glFenceSync = glad_lazy_glFenceSync;
+    glad_glIsSync = glad_lazy_glIsSync;
+    glad_glDeleteSync = glad_lazy_glDeleteSync;
+    glad_glClientWaitSync = glad_lazy_glClientWaitSync;
+    glad_glWaitSync = glad_lazy_glWaitSync;
+    glad_glGetInteger64v = glad_lazy_glGetInteger64v;
+    glad_glGetSynciv = glad_lazy_glGetSynciv;
+    glad_glGetInteger64i_v = glad_lazy_glGetInteger64i_v;
+    glad_glGetBufferParameteri64v = glad_lazy_glGetBufferParameteri64v;
+    glad_glFramebufferTexture = glad_lazy_glFramebufferTexture;
+    glad_glTexImage2DMultisample = glad_lazy_glTexImage2DMultisample;
+    glad_glTexImage3DMultisample = glad_lazy_glTexImage3DMultisample;
+    glad_glGetMultisamplefv = glad_lazy_glGetMultisamplefv;
+    glad_glSampleMaski = glad_lazy_glSampleMaski;
+}
+static void glad_install_lazy_GL_VERSION_3_3(void) {
+    if(!GLAD_GL_VERSION_3_3) return;
+    glad_glBindFragDataLocationIndexed = glad_lazy_glBindFragDataLocationIndexed;
+    glad_glGetFragDataIndex = glad_lazy_glGetFragDataIndex;
+    glad_glGenSamplers = glad_lazy_glGenSamplers;
+    glad_glDeleteSamplers = glad_lazy_glDeleteSamplers;
+    glad_glIsSampler = glad_lazy_glIsSampler;
+    glad_glBindSampler = glad_lazy_glBindSampler;
+    glad_glSamplerParameteri = glad_lazy_glSamplerParameteri;
+    glad_glSamplerParameteriv = glad_lazy_glSamplerParameteriv;
+    glad_glSamplerParameterf = glad_lazy_glSamplerParameterf;
+    glad_glSamplerParameterfv = glad_lazy_glSamplerParameterfv;
+    glad_glSamplerParameterIiv = glad_lazy_glSamplerParameterIiv;
+    glad_glSamplerParameterIuiv = glad_lazy_glSamplerParameterIuiv;
+    glad_glGetSamplerParameteriv = glad_lazy_glGetSamplerParameteriv;
+    glad_glGetSamplerParameterIiv = glad_lazy_glGetSamplerParameterIiv;
+    glad_glGetSamplerParameterfv = glad_lazy_glGetSamplerParameterfv;
+    glad_glGetSamplerParameterIuiv = glad_lazy_glGetSamplerParameterIuiv;
+    glad_glQueryCounter = glad_lazy_glQueryCounter;
+    glad_glGetQueryObjecti64v = glad_lazy_glGetQueryObjecti64v;
+    glad_glGetQueryObjectui64v = glad_lazy_glGetQueryObjectui64v;
+    glad_glVertexAttribDivisor = glad_lazy_glVertexAttribDivisor;
+    glad_glVertexAttribP1ui = glad_lazy_glVertexAttribP1ui;
+    glad_glVertexAttribP1uiv = glad_lazy_glVertexAttribP1uiv;
+    glad_glVertexAttribP2ui = glad_lazy_glVertexAttribP2ui;
+    glad_glVertexAttribP2uiv = glad_lazy_glVertexAttribP2uiv;
+    glad_glVertexAttribP3ui = glad_lazy_glVertexAttribP3ui;
+    glad_glVertexAttribP3uiv = glad_lazy_glVertexAttribP3uiv;
+    glad_glVertexAttribP4ui = glad_lazy_glVertexAttribP4ui;
+    glad_glVertexAttribP4uiv = glad_lazy_glVertexAttribP4uiv;
+    glad_glVertexP2ui = glad_lazy_glVertexP2ui;
+    glad_glVertexP2uiv = glad_lazy_glVertexP2uiv;
+    glad_glVertexP3ui = glad_lazy_glVertexP3ui;
+    glad_glVertexP3uiv = glad_lazy_glVertexP3uiv;
+    glad_glVertexP4ui = glad_lazy_glVertexP4ui;
+    glad_glVertexP4uiv = glad_lazy_glVertexP4uiv;
+    glad_glTexCoordP1ui = glad_lazy_glTexCoordP1ui;
+    glad_glTexCoordP1uiv = glad_lazy_glTexCoordP1uiv;
+    glad_glTexCoordP2ui = glad_lazy_glTexCoordP2ui;
+    glad_glTexCoordP2uiv = glad_lazy_glTexCoordP2uiv;
+    glad_glTexCoordP3ui = glad_lazy_glTexCoordP3ui;
+    glad_glTexCoordP3uiv = glad_lazy_glTexCoordP3uiv;
+    glad_glTexCoordP4ui = glad_lazy_glTexCoordP4ui;
+    glad_glTexCoordP4uiv = glad_lazy_glTexCoordP4uiv;
+    glad_glMultiTexCoordP1ui = glad_lazy_glMultiTexCoordP1ui;
+    glad_glMultiTexCoordP1uiv = glad_lazy_glMultiTexCoordP1uiv;
+    glad_glMultiTexCoordP2ui = glad_lazy_glMultiTexCoordP2ui;
+    glad_glMultiTexCoordP2uiv = glad_lazy_glMultiTexCoordP2uiv;
+    glad_glMultiTexCoordP3ui = glad_lazy_glMultiTexCoordP3ui;
+    glad_glMultiTexCoordP3uiv = glad_lazy_glMultiTexCoordP3uiv;
+    glad_glMultiTexCoordP4ui = glad_lazy_glMultiTexCoordP4ui;
+    glad_glMultiTexCoordP4uiv = glad_lazy_glMultiTexCoordP4uiv;
+    glad_glNormalP3ui = glad_lazy_glNormalP3ui;
+    glad_glNormalP3uiv = glad_lazy_glNormalP3uiv;
+    glad_glColorP3ui = glad_lazy_glColorP3ui;
+    glad_glColorP3uiv = glad_lazy_glColorP3uiv;
+    glad_glColorP4ui = glad_lazy_glColorP4ui;
+    glad_glColorP4uiv = glad_lazy_glColorP4uiv;
+    glad_glSecondaryColorP3ui = glad_lazy_glSecondaryColorP3ui;
+    glad_glSecondaryColorP3uiv = glad_lazy_glSecondaryColorP3uiv;
+}
+static void glad_install_lazy(GLADloadproc load) {
+    glad_lazy_loader = load;
+    __atomic_store_n(&glad_lazy_resolved, 0, __ATOMIC_RELAXED);
+    glad_install_lazy_GL_VERSION_1_0();
+    glad_install_lazy_GL_VERSION_1_1();
+    glad_install_lazy_GL_VERSION_1_2();
+    glad_install_lazy_GL_VERSION_1_3();
+    glad_install_lazy_GL_VERSION_1_4();
+    glad_install_lazy_GL_VERSION_1_5();
+    glad_install_lazy_GL_VERSION_2_0();
+    glad_install_lazy_GL_VERSION_2_1();
+    glad_install_lazy_GL_VERSION_3_0();
+    glad_install_lazy_GL_VERSION_3_1();
+    glad_install_lazy_GL_VERSION_3_2();
+    glad_install_lazy_GL_VERSION_3_3();
+}
+#endif /* GLAD_LAZY */
+
+int gladLoadGLLoader(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+#ifdef GLAD_LAZY
+	glad_install_lazy(load);
+#else
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+#endif
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
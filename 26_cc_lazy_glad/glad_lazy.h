@@ -0,0 +1,21 @@
+#ifndef GLAD_LAZY_H
+#define GLAD_LAZY_H
+
+/* glad lazy loading (glad.c built with GLAD_LAZY)
+ * gladLoadGLLoader installs trampolines for the GL versions of the
+ * context (the pointers of the others stay NULL), each entry point is
+ * resolved through the loader on its first call; the loader given to
+ * gladLoadGLLoader must stay valid for the life of the context */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* number of entry points resolved so far (since the last gladLoadGLLoader) */
+int gladLazyResolvedCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,147 @@
+// bench_ext.cc
+
+// extension lookup benchmark (headless):
+// the checks a loader generated with every extension does at startup
+// (one per known extension name, most of them misses) against
+// - linear: what glad did before, a realloc'd array of the
+//           glGetStringi pointers and a strcmp scan per check
+// - hashed: the set gladLoadGLLoader builds (gladLoadExtensions),
+//           gladHasExtension
+// each round rebuilds the list / the set, as a new context would;
+// build and checks are timed separately for both
+// usage: bench_ext [rounds]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "glad_ext.h"
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+// names checked per startup: the driver's own plus as many misses
+// (glad checks every extension of the spec, the driver has a subset)
+static std::vector<std::string> checkNames()
+{
+  std::vector<std::string> names;
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; i++) {
+    std::string name = (const char*)glGetStringi(GL_EXTENSIONS, i);
+    names.push_back(name);
+    names.push_back(name + "_unsupported");
+  }
+  return names;
+}
+
+// the previous glad code path
+static const char **linearExts = NULL;
+static int numLinearExts = 0;
+
+static void linearBuild()
+{
+  numLinearExts = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &numLinearExts);
+  linearExts = (const char**)realloc((void*)linearExts, numLinearExts * sizeof(*linearExts));
+  for (int i = 0; i < numLinearExts; i++)
+    linearExts[i] = (const char*)glGetStringi(GL_EXTENSIONS, i);
+}
+
+static bool linearHas(const char *ext)
+{
+  for (int i = 0; i < numLinearExts; i++)
+    if (strcmp(linearExts[i], ext) == 0)
+      return true;
+  return false;
+}
+
+static void linearFree()
+{
+  free((void*)linearExts);
+  linearExts = NULL;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int rounds = argc > 1 ? atoi(argv[1]) : 200;
+  if (rounds < 1) rounds = 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(16, 16, "bench_ext", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  std::vector<std::string> names = checkNames();
+  std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+  std::cout << gladExtensionCount() << " extensions, " << names.size() << " checks per round, "
+            << rounds << " rounds" << std::endl;
+
+  // linear: free + build, then the checks
+  unsigned int linearHits = 0;
+  double linearBuildTime = 0.0, linearCheckTime = 0.0;
+  for (unsigned int r = 0; r < rounds; r++) {
+    double start = glfwGetTime();
+    linearFree();
+    linearBuild();
+    double built = glfwGetTime();
+    for (size_t i = 0; i < names.size(); i++)
+      linearHits += linearHas(names[i].c_str());
+    linearCheckTime += glfwGetTime() - built;
+    linearBuildTime += built - start;
+  }
+  linearFree();
+
+  // hashed: the set alone (frees the previous one), then the checks
+  unsigned int hashedHits = 0;
+  double hashedBuildTime = 0.0, hashedCheckTime = 0.0;
+  for (unsigned int r = 0; r < rounds; r++) {
+    double start = glfwGetTime();
+    if (!gladLoadExtensions()) {
+      std::cout << "ERROR::BENCH_EXT::BUILD_FAILED" << std::endl;
+      break;
+    }
+    double built = glfwGetTime();
+    for (size_t i = 0; i < names.size(); i++)
+      hashedHits += gladHasExtension(names[i].c_str());
+    hashedCheckTime += glfwGetTime() - built;
+    hashedBuildTime += built - start;
+  }
+
+  if (linearHits != hashedHits)
+    std::cout << "ERROR::BENCH_EXT::MISMATCH " << linearHits << " vs " << hashedHits << std::endl;
+
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "linear: " << (linearBuildTime + linearCheckTime) / rounds * 1e6 << " us per round (build "
+            << linearBuildTime / rounds * 1e6 << " + checks " << linearCheckTime / rounds * 1e6 << ")" << std::endl;
+  std::cout << "hashed: " << (hashedBuildTime + hashedCheckTime) / rounds * 1e6 << " us per round (build "
+            << hashedBuildTime / rounds * 1e6 << " + checks " << hashedCheckTime / rounds * 1e6 << ")" << std::endl;
+
+  glfwTerminate();
+  return 0;
+}
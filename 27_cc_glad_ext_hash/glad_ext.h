@@ -0,0 +1,23 @@
+#ifndef GLAD_EXT_H
+#define GLAD_EXT_H
+
+/* extension queries against the set gladLoadGLLoader built for the
+ * current context (hashed, the names are copies: valid until the next
+ * gladLoadGLLoader, even after the context is gone) */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int gladHasExtension(const char *ext);
+int gladExtensionCount(void);
+
+/* rebuilds the set for the current context, as gladLoadGLLoader does;
+ * 0 on failure */
+int gladLoadExtensions(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+// main.cc
+
+// startup phase profiler: times glfwInit, window creation, glad,
+// shader read and compile, mesh read, buffer uploads and the first
+// glfwSwapBuffers, then reports the time to first frame.
+// usage: ./main [parallel]
+//   0: every phase in sequence (what the other samples do)
+//   1: shader and mesh files read on a worker thread while the window
+//      and context are created
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <pthread.h>
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "mesh.h"
+#include "profiler.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+// files read before the context exists
+struct Assets
+{
+  StartupProfiler* profiler;
+  const char* thread;
+  ShaderSource shader;
+  Mesh mesh;
+};
+
+static void* readAssets(void* data)
+{
+  Assets* assets = (Assets*)data;
+  StartupProfiler* profiler = assets->profiler;
+
+  double start = profiler->now();
+  assets->shader.read("../shader/shader.vs", "../shader/shader.fs");
+  double shaderRead = profiler->now();
+  profiler->record("shader read", assets->thread, start, shaderRead);
+
+  assets->mesh.read("../mesh/grid.obj");
+  profiler->record("mesh read", assets->thread, shaderRead, profiler->now());
+  return NULL;
+}
+
+int main(int argc, char* argv[])
+{
+  bool parallel = argc > 1 && atoi(argv[1]) != 0;
+  StartupProfiler profiler;
+
+  Assets assets;
+  assets.profiler = &profiler;
+  assets.thread = parallel ? "worker" : "main";
+  pthread_t worker;
+  bool workerRunning = parallel && pthread_create(&worker, NULL, readAssets, &assets) == 0;
+  if (parallel && !workerRunning) {
+    std::cout << "Failed to create the worker thread, reading on the main thread" << std::endl;
+    assets.thread = "main";
+  }
+
+  profiler.begin("glfwInit");
+  glfwInit();
+
+  profiler.begin("window");
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Startup Profile", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    if (workerRunning) pthread_join(worker, NULL);
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  profiler.begin("gladLoadGLLoader");
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    if (workerRunning) pthread_join(worker, NULL);
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  if (workerRunning) {
+    profiler.begin("wait for worker");
+    pthread_join(worker, NULL);
+  } else {
+    profiler.end();
+    readAssets(&assets);
+  }
+
+  profiler.begin("shader compile");
+  Shader ourShader(assets.shader);
+
+  profiler.begin("buffer upload");
+  GLuint meshVAO, meshVBO, meshEBO;
+  glGenVertexArrays(1, &meshVAO);
+  glGenBuffers(1, &meshVBO);
+  glGenBuffers(1, &meshEBO);
+
+  // bind mesh data
+  glBindVertexArray(meshVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, meshVBO);
+  glBufferData(GL_ARRAY_BUFFER, assets.mesh.vertices.size() * sizeof(float),
+               assets.mesh.vertices.empty() ? NULL : &assets.mesh.vertices[0], GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, assets.mesh.indices.size() * sizeof(GLuint),
+               assets.mesh.indices.empty() ? NULL : &assets.mesh.indices[0], GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+  profiler.end();
+
+  bool firstFrame = true;
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    if (firstFrame)
+      profiler.begin("first frame");
+    processInput(window);
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // load the shader program
+    ourShader.use();
+    //
+    float t = glfwGetTime();
+    float delta = sin(t) * 0.5f;
+    ourShader.setFloat("delta", delta);
+    // draw
+    glBindVertexArray(meshVAO);
+    glDrawElements(GL_TRIANGLES, assets.mesh.indices.size(), GL_UNSIGNED_INT, 0);
+
+    glfwSwapBuffers(window);
+    if (firstFrame) {
+      profiler.report(parallel ? "parallel" : "sequential");
+      firstFrame = false;
+    }
+    glfwPollEvents();
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
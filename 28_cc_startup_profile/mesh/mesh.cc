@@ -0,0 +1,43 @@
+#include "mesh.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <iostream>
+
+bool Mesh::read(const char* path)
+{
+  std::ifstream file(path);
+  if (!file) {
+    std::cout << "ERROR::MESH::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+    return false;
+  }
+
+  this->vertices.clear();
+  this->indices.clear();
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream in(line);
+    std::string type;
+    in >> type;
+    if (type == "v") {
+      float v[6] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+      in >> v[0] >> v[1] >> v[2];
+      if (!(in >> v[3] >> v[4] >> v[5])) {
+        v[3] = v[4] = v[5] = 1.0f;
+      }
+      this->vertices.insert(this->vertices.end(), v, v + 6);
+    } else if (type == "f") {
+      GLuint a, b, c;
+      if (!(in >> a >> b >> c) || a == 0 || b == 0 || c == 0) {
+        std::cout << "ERROR::MESH::BAD_FACE " << line << std::endl;
+        return false;
+      }
+      this->indices.push_back(a - 1);
+      this->indices.push_back(b - 1);
+      this->indices.push_back(c - 1);
+    }
+  }
+  return true;
+}
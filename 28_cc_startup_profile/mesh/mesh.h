@@ -0,0 +1,20 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+// triangle mesh read from an OBJ subset:
+//   v x y z [r g b]   (vertex colors, white if missing)
+//   f a b c           (1-based indices, triangles)
+// no GL calls, can be read on any thread
+struct Mesh
+{
+  std::vector<float> vertices;    // x y z r g b
+  std::vector<GLuint> indices;
+
+  bool read(const char* path);
+};
+
+#endif
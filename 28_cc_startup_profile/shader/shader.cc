@@ -0,0 +1,116 @@
+#include "shader.h"
+
+#include <glad/glad.h>
+
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+bool ShaderSource::read(const GLchar* vertexPath, const GLchar* fragmentPath)
+{
+  std::ifstream vShaderFile;
+  std::ifstream fShaderFile;
+  vShaderFile.exceptions(std::ifstream::failbit |
+                        std::ifstream::badbit);
+  fShaderFile.exceptions(std::ifstream::failbit |
+                        std::ifstream::badbit);
+
+  try
+  {
+    vShaderFile.open(vertexPath);
+    fShaderFile.open(fragmentPath);
+
+    std::stringstream vShaderStream, fShaderStream;
+    vShaderStream << vShaderFile.rdbuf();
+    fShaderStream << fShaderFile.rdbuf();
+
+    vShaderFile.close();
+    fShaderFile.close();
+
+    this->vertexCode = vShaderStream.str();
+    this->fragmentCode = fShaderStream.str();
+  }
+  catch(std::ifstream::failure e)
+  {
+    std::cout << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+Shader::Shader(const GLchar* vertexPath, const GLchar* fragmentPath)
+{
+  ShaderSource source;
+  source.read(vertexPath, fragmentPath);
+  this->compile(source.vertexCode, source.fragmentCode);
+}
+
+Shader::Shader(const ShaderSource &source)
+{
+  this->compile(source.vertexCode, source.fragmentCode);
+}
+
+void Shader::compile(const std::string &vertexCode, const std::string &fragmentCode)
+{
+  const GLchar* vShaderCode = vertexCode.c_str();
+  const GLchar* fShaderCode = fragmentCode.c_str();
+
+  GLuint vertex, fragment;
+  int success;
+  char infoLog[512];
+
+  vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &vShaderCode, NULL);
+  glCompileShader(vertex);
+
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &fShaderCode, NULL);
+  glCompileShader(fragment);
+
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  this->ID = glCreateProgram();
+  glAttachShader(this->ID, vertex);
+  glAttachShader(this->ID, fragment);
+  glLinkProgram(this->ID);
+
+  glGetProgramiv(this->ID, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(this->ID, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+}
+
+void Shader::use()
+{
+  glUseProgram(this->ID);
+}
+
+void Shader::setBool(const std::string &name, bool value) const
+{
+  glUniform1i(glGetUniformLocation(this->ID, name.c_str()), (int)value);
+}
+
+void Shader::setInt(const std::string &name, int value) const
+{
+  glUniform1i(glGetUniformLocation(this->ID, name.c_str()), value);
+}
+
+void Shader::setFloat(const std::string &name, float value) const
+{
+  glUniform1f(glGetUniformLocation(this->ID, name.c_str()), value);
+}
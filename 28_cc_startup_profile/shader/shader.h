@@ -0,0 +1,36 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+
+#include <string>
+
+// shader sources read from disk, no GL calls (can be read on any thread)
+struct ShaderSource
+{
+  std::string vertexCode;
+  std::string fragmentCode;
+
+  bool read(const GLchar* vertexPath, const GLchar* fragmentPath);
+};
+
+class Shader
+{
+  public:
+    GLuint ID;
+
+    Shader(const GLchar* vertexPath, const GLchar* fragmentPath);
+    // compile already read sources
+    Shader(const ShaderSource &source);
+
+    void use();
+
+    void setBool(const std::string &name, bool value) const;
+    void setInt(const std::string &name, int value) const;
+    void setFloat(const std::string &name, float value) const;
+
+  private:
+    void compile(const std::string &vertexCode, const std::string &fragmentCode);
+};
+
+#endif
@@ -0,0 +1,14 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+uniform float delta;
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = vec4(aPos.x + delta, aPos.y, aPos.z, 1.0f);
+  vertexColor = aColor;
+}
@@ -0,0 +1,76 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+
+StartupProfiler::StartupProfiler()
+  : openName(NULL), openStart(0.0)
+{
+  clock_gettime(CLOCK_MONOTONIC, &this->origin);
+  pthread_mutex_init(&this->mutex, NULL);
+}
+
+StartupProfiler::~StartupProfiler()
+{
+  pthread_mutex_destroy(&this->mutex);
+}
+
+double StartupProfiler::now() const
+{
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (t.tv_sec - this->origin.tv_sec) * 1000.0 +
+         (t.tv_nsec - this->origin.tv_nsec) / 1000000.0;
+}
+
+void StartupProfiler::begin(const char* name)
+{
+  if (this->openName != NULL)
+    this->end();
+  this->openName = name;
+  this->openStart = this->now();
+}
+
+void StartupProfiler::end()
+{
+  if (this->openName == NULL) return;
+  this->record(this->openName, "main", this->openStart, this->now());
+  this->openName = NULL;
+}
+
+void StartupProfiler::record(const char* name, const char* thread, double start, double end)
+{
+  Phase phase = { name, thread, start, end };
+  pthread_mutex_lock(&this->mutex);
+  this->phases.push_back(phase);
+  pthread_mutex_unlock(&this->mutex);
+}
+
+static bool byStart(const StartupProfiler::Phase &a, const StartupProfiler::Phase &b)
+{
+  return a.start < b.start;
+}
+
+void StartupProfiler::report(const char* mode)
+{
+  this->end();
+  double total = this->now();
+
+  pthread_mutex_lock(&this->mutex);
+  std::vector<Phase> sorted = this->phases;
+  pthread_mutex_unlock(&this->mutex);
+  std::sort(sorted.begin(), sorted.end(), byStart);
+
+  std::cout << "startup (" << mode << "), times in ms" << std::endl;
+  std::cout << "  phase                 thread     start  duration" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  for (size_t i = 0; i < sorted.size(); i++) {
+    std::cout << "  " << std::left << std::setw(20) << sorted[i].name << "  "
+              << std::setw(6) << sorted[i].thread << std::right
+              << std::setw(10) << sorted[i].start
+              << std::setw(10) << sorted[i].end - sorted[i].start << std::endl;
+  }
+  std::cout << "time to first frame: " << total << " ms" << std::endl;
+  std::cout.unsetf(std::ios::floatfield);
+}
@@ -0,0 +1,50 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <pthread.h>
+#include <time.h>
+
+#include <vector>
+
+// startup phase profiler
+// times are in ms since the profiler was created (before glfwInit,
+// glfwGetTime can't be used yet), phases can be recorded from any thread
+//
+// StartupProfiler profiler;
+// profiler.begin("glfwInit"); glfwInit(); profiler.end();
+// double start = profiler.now(); ...; profiler.record("read", "worker", start, profiler.now());
+// profiler.report();
+class StartupProfiler
+{
+  public:
+    StartupProfiler();
+    ~StartupProfiler();
+
+    double now() const;
+
+    // main thread phase, one at a time
+    void begin(const char* name);
+    void end();
+
+    void record(const char* name, const char* thread, double start, double end);
+
+    // phases in start order and the time to first frame (now)
+    void report(const char* mode);
+
+    struct Phase
+    {
+      const char* name;
+      const char* thread;
+      double start;
+      double end;
+    };
+
+  private:
+    timespec origin;
+    std::vector<Phase> phases;
+    pthread_mutex_t mutex;
+    const char* openName;
+    double openStart;
+};
+
+#endif
@@ -0,0 +1,781 @@
+#include "resources.h"
+
+#include <glad/glad.h>
+
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <stdlib.h>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+static const char* typeNames[NUM_RESOURCE_TYPES] = {
+  "buffer", "vertex array", "texture", "framebuffer", "renderbuffer",
+  "shader", "program", "query", "sampler", "sync"
+};
+
+struct Resource
+{
+  ResourceType type;
+  GLuint name;
+  void *site;
+  unsigned long createdFrame;
+  unsigned long lastUsedFrame;
+  unsigned long bytes;
+  // textures: bytes per (face, level), and the size of level 0
+  // (the layers of an array texture do not shrink with the levels)
+  std::map<int, unsigned long> levels;
+  GLsizei width, height, depth;
+  bool layered;
+};
+
+typedef std::pair<ResourceType, GLuint> ResourceKey;
+static std::map<ResourceKey, Resource> registry;
+static ResourceTotals totals[NUM_RESOURCE_TYPES];
+static unsigned long frameCount = 0;
+static bool tracking = false;
+
+// bound state, to find the object a storage call applies to
+static std::map<GLenum, GLuint> boundBuffers;
+static std::map<GLuint, GLuint> elementBuffers;   // element array binding per vertex array
+static GLuint boundVertexArray = 0;
+static std::map<std::pair<GLenum, GLenum>, GLuint> boundTextures;   // (unit, target)
+static GLenum activeTexture = GL_TEXTURE0;
+static GLuint boundRenderbuffer = 0;
+
+// sync objects are pointers: tracked under a name of their own
+static std::map<GLsync, GLuint> syncNames;
+static GLuint nextSyncName = 0;
+
+static void create(ResourceType type, GLuint name, void *site)
+{
+  if (name == 0) return;
+  Resource r;
+  r.type = type;
+  r.name = name;
+  r.site = site;
+  r.createdFrame = frameCount;
+  r.lastUsedFrame = frameCount;
+  r.bytes = 0;
+  r.width = r.height = r.depth = 0;
+  r.layered = false;
+  registry[ResourceKey(type, name)] = r;
+  totals[type].count++;
+}
+
+static void destroy(ResourceType type, GLuint name)
+{
+  std::map<ResourceKey, Resource>::iterator it = registry.find(ResourceKey(type, name));
+  if (it == registry.end()) return;
+  totals[type].count--;
+  totals[type].bytes -= it->second.bytes;
+  registry.erase(it);
+}
+
+static Resource* find(ResourceType type, GLuint name)
+{
+  if (name == 0) return NULL;
+  std::map<ResourceKey, Resource>::iterator it = registry.find(ResourceKey(type, name));
+  return it != registry.end() ? &it->second : NULL;
+}
+
+static void use(ResourceType type, GLuint name)
+{
+  Resource *r = find(type, name);
+  if (r != NULL)
+    r->lastUsedFrame = frameCount;
+}
+
+static void resize(Resource *r, unsigned long bytes)
+{
+  totals[r->type].bytes -= r->bytes;
+  r->bytes = bytes;
+  totals[r->type].bytes += bytes;
+}
+
+static GLuint boundBuffer(GLenum target)
+{
+  if (target == GL_ELEMENT_ARRAY_BUFFER)
+    return elementBuffers[boundVertexArray];
+  return boundBuffers[target];
+}
+
+static GLuint boundTexture(GLenum target)
+{
+  // cube map faces are stored on the cube map
+  if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+    target = GL_TEXTURE_CUBE_MAP;
+  return boundTextures[std::make_pair(activeTexture, target)];
+}
+
+// (face, level): cube map faces get their own levels
+static int levelKey(GLenum target, GLint level)
+{
+  int face = 0;
+  if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+    face = target - GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+  return face * 32 + level;
+}
+
+static void resizeToLevels(Resource *r)
+{
+  unsigned long total = 0;
+  for (std::map<int, unsigned long>::iterator it = r->levels.begin(); it != r->levels.end(); ++it)
+    total += it->second;
+  resize(r, total);
+}
+
+// storage of one level; level 0 also gives the size of the mip chain
+static void setLevel(Resource *r, GLenum target, GLint level, GLsizei width, GLsizei height,
+                     GLsizei depth, unsigned long bytes)
+{
+  r->levels[levelKey(target, level)] = bytes;
+  if (level == 0) {
+    r->width = width;
+    r->height = height;
+    r->depth = depth;
+    r->layered = target == GL_TEXTURE_2D_ARRAY || target == GL_TEXTURE_2D_MULTISAMPLE_ARRAY;
+  }
+
+  resizeToLevels(r);
+}
+
+static unsigned long levelTexels(const Resource *r, int level)
+{
+  unsigned long w = r->width >> level, h = r->height >> level;
+  unsigned long d = r->layered ? r->depth : r->depth >> level;
+  return (w > 0 ? w : 1) * (h > 0 ? h : 1) * (d > 0 ? d : 1);
+}
+
+// estimated storage per texel (RGB formats are padded by the drivers)
+static unsigned int bytesPerTexel(GLint internalformat)
+{
+  switch (internalformat) {
+    case GL_RED: case GL_R8: case GL_STENCIL_INDEX8:
+      return 1;
+    case GL_RG: case GL_RG8: case GL_R16F: case GL_DEPTH_COMPONENT16:
+      return 2;
+    case GL_RG16F: case GL_R32F:
+      return 4;
+    case GL_RGB16F: case GL_RGBA16F: case GL_RG32F:
+      return 8;
+    case GL_RGB32F: case GL_RGBA32F:
+      return 16;
+    default:
+      return 4;
+  }
+}
+
+// real functions
+
+static PFNGLGENBUFFERSPROC real_glGenBuffers;
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers;
+static PFNGLBINDBUFFERPROC real_glBindBuffer;
+static PFNGLBINDBUFFERBASEPROC real_glBindBufferBase;
+static PFNGLBINDBUFFERRANGEPROC real_glBindBufferRange;
+static PFNGLBUFFERDATAPROC real_glBufferData;
+static PFNGLGENVERTEXARRAYSPROC real_glGenVertexArrays;
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays;
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray;
+static PFNGLGENTEXTURESPROC real_glGenTextures;
+static PFNGLDELETETEXTURESPROC real_glDeleteTextures;
+static PFNGLACTIVETEXTUREPROC real_glActiveTexture;
+static PFNGLBINDTEXTUREPROC real_glBindTexture;
+static PFNGLTEXIMAGE2DPROC real_glTexImage2D;
+static PFNGLTEXIMAGE3DPROC real_glTexImage3D;
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC real_glCompressedTexImage2D;
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC real_glCompressedTexImage3D;
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC real_glTexImage2DMultisample;
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC real_glTexImage3DMultisample;
+static PFNGLGENERATEMIPMAPPROC real_glGenerateMipmap;
+static PFNGLGENFRAMEBUFFERSPROC real_glGenFramebuffers;
+static PFNGLDELETEFRAMEBUFFERSPROC real_glDeleteFramebuffers;
+static PFNGLBINDFRAMEBUFFERPROC real_glBindFramebuffer;
+static PFNGLGENRENDERBUFFERSPROC real_glGenRenderbuffers;
+static PFNGLDELETERENDERBUFFERSPROC real_glDeleteRenderbuffers;
+static PFNGLBINDRENDERBUFFERPROC real_glBindRenderbuffer;
+static PFNGLRENDERBUFFERSTORAGEPROC real_glRenderbufferStorage;
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real_glRenderbufferStorageMultisample;
+static PFNGLCREATESHADERPROC real_glCreateShader;
+static PFNGLDELETESHADERPROC real_glDeleteShader;
+static PFNGLCREATEPROGRAMPROC real_glCreateProgram;
+static PFNGLDELETEPROGRAMPROC real_glDeleteProgram;
+static PFNGLUSEPROGRAMPROC real_glUseProgram;
+static PFNGLGENQUERIESPROC real_glGenQueries;
+static PFNGLDELETEQUERIESPROC real_glDeleteQueries;
+static PFNGLBEGINQUERYPROC real_glBeginQuery;
+static PFNGLGENSAMPLERSPROC real_glGenSamplers;
+static PFNGLDELETESAMPLERSPROC real_glDeleteSamplers;
+static PFNGLBINDSAMPLERPROC real_glBindSampler;
+static PFNGLFENCESYNCPROC real_glFenceSync;
+static PFNGLDELETESYNCPROC real_glDeleteSync;
+static PFNGLCLIENTWAITSYNCPROC real_glClientWaitSync;
+static PFNGLWAITSYNCPROC real_glWaitSync;
+
+// wrappers
+// __builtin_return_address(0) is the code that called the GL function
+
+static void APIENTRY resources_glGenBuffers(GLsizei n, GLuint *buffers)
+{
+  real_glGenBuffers(n, buffers);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_BUFFER, buffers[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+  real_glDeleteBuffers(n, buffers);
+  for (GLsizei i = 0; i < n; i++) {
+    destroy(RESOURCE_BUFFER, buffers[i]);
+    // deleting a bound buffer unbinds it
+    for (std::map<GLenum, GLuint>::iterator it = boundBuffers.begin(); it != boundBuffers.end(); ++it)
+      if (it->second == buffers[i]) it->second = 0;
+    for (std::map<GLuint, GLuint>::iterator it = elementBuffers.begin(); it != elementBuffers.end(); ++it)
+      if (it->second == buffers[i]) it->second = 0;
+  }
+}
+
+static void APIENTRY resources_glBindBuffer(GLenum target, GLuint buffer)
+{
+  real_glBindBuffer(target, buffer);
+  if (target == GL_ELEMENT_ARRAY_BUFFER)
+    elementBuffers[boundVertexArray] = buffer;
+  else
+    boundBuffers[target] = buffer;
+  use(RESOURCE_BUFFER, buffer);
+}
+
+static void APIENTRY resources_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+  real_glBindBufferBase(target, index, buffer);
+  boundBuffers[target] = buffer;
+  use(RESOURCE_BUFFER, buffer);
+}
+
+static void APIENTRY resources_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  real_glBindBufferRange(target, index, buffer, offset, size);
+  boundBuffers[target] = buffer;
+  use(RESOURCE_BUFFER, buffer);
+}
+
+static void APIENTRY resources_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+  real_glBufferData(target, size, data, usage);
+  Resource *r = find(RESOURCE_BUFFER, boundBuffer(target));
+  if (r != NULL)
+    resize(r, size);
+}
+
+static void APIENTRY resources_glGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+  real_glGenVertexArrays(n, arrays);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_VERTEX_ARRAY, arrays[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+  real_glDeleteVertexArrays(n, arrays);
+  for (GLsizei i = 0; i < n; i++) {
+    destroy(RESOURCE_VERTEX_ARRAY, arrays[i]);
+    elementBuffers.erase(arrays[i]);
+    if (boundVertexArray == arrays[i]) boundVertexArray = 0;
+  }
+}
+
+static void APIENTRY resources_glBindVertexArray(GLuint array)
+{
+  real_glBindVertexArray(array);
+  boundVertexArray = array;
+  use(RESOURCE_VERTEX_ARRAY, array);
+}
+
+static void APIENTRY resources_glGenTextures(GLsizei n, GLuint *textures)
+{
+  real_glGenTextures(n, textures);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_TEXTURE, textures[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteTextures(GLsizei n, const GLuint *textures)
+{
+  real_glDeleteTextures(n, textures);
+  for (GLsizei i = 0; i < n; i++) {
+    destroy(RESOURCE_TEXTURE, textures[i]);
+    std::map<std::pair<GLenum, GLenum>, GLuint>::iterator it;
+    for (it = boundTextures.begin(); it != boundTextures.end(); ++it)
+      if (it->second == textures[i]) it->second = 0;
+  }
+}
+
+static void APIENTRY resources_glActiveTexture(GLenum texture)
+{
+  real_glActiveTexture(texture);
+  activeTexture = texture;
+}
+
+static void APIENTRY resources_glBindTexture(GLenum target, GLuint texture)
+{
+  real_glBindTexture(target, texture);
+  boundTextures[std::make_pair(activeTexture, target)] = texture;
+  use(RESOURCE_TEXTURE, texture);
+}
+
+static void APIENTRY resources_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  real_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, level, width, height, 1, (unsigned long)width * height * bytesPerTexel(internalformat));
+}
+
+static void APIENTRY resources_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  real_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, level, width, height, depth,
+             (unsigned long)width * height * depth * bytesPerTexel(internalformat));
+}
+
+static void APIENTRY resources_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+  real_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, level, width, height, 1, imageSize);
+}
+
+static void APIENTRY resources_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+  real_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, level, width, height, depth, imageSize);
+}
+
+static void APIENTRY resources_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+  real_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, 0, width, height, 1,
+             (unsigned long)width * height * bytesPerTexel(internalformat) * (samples > 0 ? samples : 1));
+}
+
+static void APIENTRY resources_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  real_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r != NULL)
+    setLevel(r, target, 0, width, height, depth,
+             (unsigned long)width * height * depth * bytesPerTexel(internalformat) * (samples > 0 ? samples : 1));
+}
+
+static void APIENTRY resources_glGenerateMipmap(GLenum target)
+{
+  real_glGenerateMipmap(target);
+  Resource *r = find(RESOURCE_TEXTURE, boundTexture(target));
+  if (r == NULL || r->width <= 0) return;
+
+  // the levels below each base level (one per cube map face), written
+  // into levels so a later glTexImage* on the texture keeps them;
+  // each one scales the base by its texel count (exact for
+  // uncompressed formats)
+  int top = 0;
+  GLsizei largest = std::max(r->width, std::max(r->height, r->layered ? 1 : r->depth));
+  while ((largest >> (top + 1)) > 0) top++;
+
+  std::vector<std::pair<int, unsigned long> > bases;
+  for (std::map<int, unsigned long>::iterator it = r->levels.begin(); it != r->levels.end(); ++it)
+    if (it->first % 32 == 0) bases.push_back(*it);
+  for (size_t b = 0; b < bases.size(); b++) {
+    GLenum face = target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + bases[b].first / 32 : target;
+    for (int level = 1; level <= top; level++)
+      r->levels[levelKey(face, level)] = (unsigned long)((double)bases[b].second * levelTexels(r, level) / levelTexels(r, 0));
+  }
+  resizeToLevels(r);
+}
+
+static void APIENTRY resources_glGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+  real_glGenFramebuffers(n, framebuffers);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_FRAMEBUFFER, framebuffers[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+  real_glDeleteFramebuffers(n, framebuffers);
+  for (GLsizei i = 0; i < n; i++)
+    destroy(RESOURCE_FRAMEBUFFER, framebuffers[i]);
+}
+
+static void APIENTRY resources_glBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+  real_glBindFramebuffer(target, framebuffer);
+  use(RESOURCE_FRAMEBUFFER, framebuffer);
+}
+
+static void APIENTRY resources_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+  real_glGenRenderbuffers(n, renderbuffers);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_RENDERBUFFER, renderbuffers[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+  real_glDeleteRenderbuffers(n, renderbuffers);
+  for (GLsizei i = 0; i < n; i++) {
+    destroy(RESOURCE_RENDERBUFFER, renderbuffers[i]);
+    if (boundRenderbuffer == renderbuffers[i]) boundRenderbuffer = 0;
+  }
+}
+
+static void APIENTRY resources_glBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+  real_glBindRenderbuffer(target, renderbuffer);
+  boundRenderbuffer = renderbuffer;
+  use(RESOURCE_RENDERBUFFER, renderbuffer);
+}
+
+static void APIENTRY resources_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  real_glRenderbufferStorage(target, internalformat, width, height);
+  Resource *r = find(RESOURCE_RENDERBUFFER, boundRenderbuffer);
+  if (r != NULL)
+    resize(r, (unsigned long)width * height * bytesPerTexel(internalformat));
+}
+
+static void APIENTRY resources_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  real_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+  Resource *r = find(RESOURCE_RENDERBUFFER, boundRenderbuffer);
+  if (r != NULL)
+    resize(r, (unsigned long)width * height * bytesPerTexel(internalformat) * (samples > 0 ? samples : 1));
+}
+
+static GLuint APIENTRY resources_glCreateShader(GLenum type)
+{
+  GLuint shader = real_glCreateShader(type);
+  create(RESOURCE_SHADER, shader, __builtin_return_address(0));
+  return shader;
+}
+
+static void APIENTRY resources_glDeleteShader(GLuint shader)
+{
+  // the GL keeps it while attached, the name is gone for the application
+  real_glDeleteShader(shader);
+  destroy(RESOURCE_SHADER, shader);
+}
+
+static GLuint APIENTRY resources_glCreateProgram()
+{
+  GLuint program = real_glCreateProgram();
+  create(RESOURCE_PROGRAM, program, __builtin_return_address(0));
+  return program;
+}
+
+static void APIENTRY resources_glDeleteProgram(GLuint program)
+{
+  real_glDeleteProgram(program);
+  destroy(RESOURCE_PROGRAM, program);
+}
+
+static void APIENTRY resources_glUseProgram(GLuint program)
+{
+  real_glUseProgram(program);
+  use(RESOURCE_PROGRAM, program);
+}
+
+static void APIENTRY resources_glGenQueries(GLsizei n, GLuint *ids)
+{
+  real_glGenQueries(n, ids);
+  for (GLsizei i = 0; i < n; i++)
+    create(RESOURCE_QUERY, ids[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteQueries(GLsizei n, const GLuint *ids)
+{
+  real_glDeleteQueries(n, ids);
+  for (GLsizei i = 0; i < n; i++)
+    destroy(RESOURCE_QUERY, ids[i]);
+}
+
+static void APIENTRY resources_glBeginQuery(GLenum target, GLuint id)
+{
+  real_glBeginQuery(target, id);
+  use(RESOURCE_QUERY, id);
+}
+
+static void APIENTRY resources_glGenSamplers(GLsizei count, GLuint *samplers)
+{
+  real_glGenSamplers(count, samplers);
+  for (GLsizei i = 0; i < count; i++)
+    create(RESOURCE_SAMPLER, samplers[i], __builtin_return_address(0));
+}
+
+static void APIENTRY resources_glDeleteSamplers(GLsizei count, const GLuint *samplers)
+{
+  real_glDeleteSamplers(count, samplers);
+  for (GLsizei i = 0; i < count; i++)
+    destroy(RESOURCE_SAMPLER, samplers[i]);
+}
+
+static void APIENTRY resources_glBindSampler(GLuint unit, GLuint sampler)
+{
+  real_glBindSampler(unit, sampler);
+  use(RESOURCE_SAMPLER, sampler);
+}
+
+static GLsync APIENTRY resources_glFenceSync(GLenum condition, GLbitfield flags)
+{
+  GLsync sync = real_glFenceSync(condition, flags);
+  if (sync != NULL) {
+    syncNames[sync] = ++nextSyncName;
+    create(RESOURCE_SYNC, nextSyncName, __builtin_return_address(0));
+  }
+  return sync;
+}
+
+static void APIENTRY resources_glDeleteSync(GLsync sync)
+{
+  real_glDeleteSync(sync);
+  std::map<GLsync, GLuint>::iterator it = syncNames.find(sync);
+  if (it == syncNames.end()) return;
+  destroy(RESOURCE_SYNC, it->second);
+  syncNames.erase(it);
+}
+
+static GLenum APIENTRY resources_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+  std::map<GLsync, GLuint>::iterator it = syncNames.find(sync);
+  if (it != syncNames.end())
+    use(RESOURCE_SYNC, it->second);
+  return real_glClientWaitSync(sync, flags, timeout);
+}
+
+static void APIENTRY resources_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+  std::map<GLsync, GLuint>::iterator it = syncNames.find(sync);
+  if (it != syncNames.end())
+    use(RESOURCE_SYNC, it->second);
+  real_glWaitSync(sync, flags, timeout);
+}
+
+#define HOOK(name) real_##name = glad_##name; glad_##name = resources_##name
+#define UNHOOK(name) glad_##name = real_##name
+
+void resourcesBegin()
+{
+  if (tracking) return;
+  registry.clear();
+  syncNames.clear();
+  nextSyncName = 0;
+  for (int i = 0; i < NUM_RESOURCE_TYPES; i++) {
+    totals[i].count = 0;
+    totals[i].bytes = 0;
+  }
+  frameCount = 0;
+  tracking = true;
+
+  HOOK(glGenBuffers);
+  HOOK(glDeleteBuffers);
+  HOOK(glBindBuffer);
+  HOOK(glBindBufferBase);
+  HOOK(glBindBufferRange);
+  HOOK(glBufferData);
+  HOOK(glGenVertexArrays);
+  HOOK(glDeleteVertexArrays);
+  HOOK(glBindVertexArray);
+  HOOK(glGenTextures);
+  HOOK(glDeleteTextures);
+  HOOK(glActiveTexture);
+  HOOK(glBindTexture);
+  HOOK(glTexImage2D);
+  HOOK(glTexImage3D);
+  HOOK(glCompressedTexImage2D);
+  HOOK(glCompressedTexImage3D);
+  HOOK(glTexImage2DMultisample);
+  HOOK(glTexImage3DMultisample);
+  HOOK(glGenerateMipmap);
+  HOOK(glGenFramebuffers);
+  HOOK(glDeleteFramebuffers);
+  HOOK(glBindFramebuffer);
+  HOOK(glGenRenderbuffers);
+  HOOK(glDeleteRenderbuffers);
+  HOOK(glBindRenderbuffer);
+  HOOK(glRenderbufferStorage);
+  HOOK(glRenderbufferStorageMultisample);
+  HOOK(glCreateShader);
+  HOOK(glDeleteShader);
+  HOOK(glCreateProgram);
+  HOOK(glDeleteProgram);
+  HOOK(glUseProgram);
+  HOOK(glGenQueries);
+  HOOK(glDeleteQueries);
+  HOOK(glBeginQuery);
+  HOOK(glGenSamplers);
+  HOOK(glDeleteSamplers);
+  HOOK(glBindSampler);
+  HOOK(glFenceSync);
+  HOOK(glDeleteSync);
+  HOOK(glClientWaitSync);
+  HOOK(glWaitSync);
+}
+
+void resourcesFrame()
+{
+  frameCount++;
+}
+
+ResourceTotals resourcesTotals(ResourceType type)
+{
+  return totals[type];
+}
+
+void resourcesReport(unsigned int staleFrames)
+{
+  unsigned long stale[NUM_RESOURCE_TYPES] = { 0 };
+  if (staleFrames > 0) {
+    for (std::map<ResourceKey, Resource>::iterator it = registry.begin(); it != registry.end(); ++it)
+      if (frameCount - it->second.lastUsedFrame >= staleFrames)
+        stale[it->second.type]++;
+  }
+
+  std::cout << "GL resources (frame " << frameCount << ")" << std::endl;
+  std::cout << "  type                live         bytes";
+  if (staleFrames > 0)
+    std::cout << "   unused for " << staleFrames << " frames";
+  std::cout << std::endl;
+
+  ResourceTotals all = { 0, 0 };
+  for (int i = 0; i < NUM_RESOURCE_TYPES; i++) {
+    all.count += totals[i].count;
+    all.bytes += totals[i].bytes;
+    if (totals[i].count == 0) continue;
+    std::cout << "  " << std::left << std::setw(14) << typeNames[i] << std::right
+              << std::setw(10) << totals[i].count << std::setw(14) << totals[i].bytes;
+    if (staleFrames > 0)
+      std::cout << std::setw(12) << stale[i];
+    std::cout << std::endl;
+  }
+  std::cout << "  " << std::left << std::setw(14) << "total" << std::right
+            << std::setw(10) << all.count << std::setw(14) << all.bytes << std::endl;
+}
+
+// symbol+offset, and the offset in its module for addr2line -e <module>
+static void printSite(void *site)
+{
+  Dl_info info;
+  if (dladdr(site, &info) == 0 || info.dli_fname == NULL) {
+    std::cout << site;
+    return;
+  }
+  if (info.dli_sname != NULL) {
+    int status;
+    char *demangled = abi::__cxa_demangle(info.dli_sname, NULL, NULL, &status);
+    std::cout << (status == 0 ? demangled : info.dli_sname);
+    free(demangled);
+    std::cout << "+0x" << std::hex << ((char*)site - (char*)info.dli_saddr) << std::dec;
+  } else {
+    std::cout << "??";
+  }
+  std::cout << " (" << info.dli_fname << " 0x" << std::hex
+            << ((char*)site - (char*)info.dli_fbase) << std::dec << ")";
+}
+
+struct Leak
+{
+  ResourceType type;
+  void *site;
+  unsigned long count;
+  unsigned long bytes;
+  unsigned long firstFrame;
+  unsigned long lastFrame;
+};
+
+void resourcesEnd()
+{
+  if (!tracking) return;
+
+  // leaks grouped by type and creation site
+  std::map<std::pair<ResourceType, void*>, Leak> leaks;
+  unsigned long count = 0, bytes = 0;
+  for (std::map<ResourceKey, Resource>::iterator it = registry.begin(); it != registry.end(); ++it) {
+    const Resource &r = it->second;
+    std::pair<ResourceType, void*> key(r.type, r.site);
+    std::map<std::pair<ResourceType, void*>, Leak>::iterator l = leaks.find(key);
+    if (l == leaks.end()) {
+      Leak leak = { r.type, r.site, 0, 0, r.createdFrame, r.createdFrame };
+      l = leaks.insert(std::make_pair(key, leak)).first;
+    }
+    l->second.count++;
+    l->second.bytes += r.bytes;
+    if (r.createdFrame < l->second.firstFrame) l->second.firstFrame = r.createdFrame;
+    if (r.createdFrame > l->second.lastFrame) l->second.lastFrame = r.createdFrame;
+    count++;
+    bytes += r.bytes;
+  }
+
+  std::cout << "\n--- GL resource leaks: " << count << " objects, " << bytes << " bytes ---" << std::endl;
+  for (std::map<std::pair<ResourceType, void*>, Leak>::iterator it = leaks.begin(); it != leaks.end(); ++it) {
+    const Leak &leak = it->second;
+    std::cout << "  " << leak.count << " " << typeNames[leak.type] << (leak.count > 1 ? "s" : "")
+              << ", " << leak.bytes << " bytes, created frame " << leak.firstFrame;
+    if (leak.lastFrame != leak.firstFrame)
+      std::cout << "-" << leak.lastFrame;
+    std::cout << " at ";
+    printSite(leak.site);
+    std::cout << std::endl;
+  }
+
+  UNHOOK(glGenBuffers);
+  UNHOOK(glDeleteBuffers);
+  UNHOOK(glBindBuffer);
+  UNHOOK(glBindBufferBase);
+  UNHOOK(glBindBufferRange);
+  UNHOOK(glBufferData);
+  UNHOOK(glGenVertexArrays);
+  UNHOOK(glDeleteVertexArrays);
+  UNHOOK(glBindVertexArray);
+  UNHOOK(glGenTextures);
+  UNHOOK(glDeleteTextures);
+  UNHOOK(glActiveTexture);
+  UNHOOK(glBindTexture);
+  UNHOOK(glTexImage2D);
+  UNHOOK(glTexImage3D);
+  UNHOOK(glCompressedTexImage2D);
+  UNHOOK(glCompressedTexImage3D);
+  UNHOOK(glTexImage2DMultisample);
+  UNHOOK(glTexImage3DMultisample);
+  UNHOOK(glGenerateMipmap);
+  UNHOOK(glGenFramebuffers);
+  UNHOOK(glDeleteFramebuffers);
+  UNHOOK(glBindFramebuffer);
+  UNHOOK(glGenRenderbuffers);
+  UNHOOK(glDeleteRenderbuffers);
+  UNHOOK(glBindRenderbuffer);
+  UNHOOK(glRenderbufferStorage);
+  UNHOOK(glRenderbufferStorageMultisample);
+  UNHOOK(glCreateShader);
+  UNHOOK(glDeleteShader);
+  UNHOOK(glCreateProgram);
+  UNHOOK(glDeleteProgram);
+  UNHOOK(glUseProgram);
+  UNHOOK(glGenQueries);
+  UNHOOK(glDeleteQueries);
+  UNHOOK(glBeginQuery);
+  UNHOOK(glGenSamplers);
+  UNHOOK(glDeleteSamplers);
+  UNHOOK(glBindSampler);
+  UNHOOK(glFenceSync);
+  UNHOOK(glDeleteSync);
+  UNHOOK(glClientWaitSync);
+  UNHOOK(glWaitSync);
+  tracking = false;
+}
@@ -0,0 +1,58 @@
+#ifndef RESOURCES_H
+#define RESOURCES_H
+
+// GL object registry on top of the glad function pointers:
+// resourcesBegin() swaps the glGen*/glCreate*, glDelete*, bind and
+// storage entry points with wrappers that record every object with its
+// type, size in bytes, creation site (caller address, shown as
+// symbol+offset and module offset for addr2line) and last used frame.
+//
+// sizes: glBufferData, glTexImage2D/3D and
+// glTexImage2D/3DMultisample (estimated from the internal format),
+// glCompressedTexImage2D/3D (the image size), the levels written by
+// glGenerateMipmap, and glRenderbufferStorage[Multisample];
+// used: bound (buffers, vertex arrays, textures, framebuffers,
+// renderbuffers, samplers), glUseProgram, glBeginQuery, waited on
+// (fence syncs) (the buffers a vertex array reads count as used when
+// they are bound, not when the vertex array is).
+// Objects created before resourcesBegin() are not tracked.
+
+enum ResourceType
+{
+  RESOURCE_BUFFER,
+  RESOURCE_VERTEX_ARRAY,
+  RESOURCE_TEXTURE,
+  RESOURCE_FRAMEBUFFER,
+  RESOURCE_RENDERBUFFER,
+  RESOURCE_SHADER,
+  RESOURCE_PROGRAM,
+  RESOURCE_QUERY,
+  RESOURCE_SAMPLER,
+  RESOURCE_SYNC,
+  NUM_RESOURCE_TYPES
+};
+
+struct ResourceTotals
+{
+  unsigned long count;
+  unsigned long bytes;
+};
+
+// call after gladLoadGLLoader
+void resourcesBegin();
+
+// end of a frame, call before glfwSwapBuffers
+void resourcesFrame();
+
+// live objects of one type
+ResourceTotals resourcesTotals(ResourceType type);
+
+// live totals per type; staleFrames > 0 also counts the objects not
+// used in the last staleFrames frames
+void resourcesReport(unsigned int staleFrames = 0);
+
+// leak report (every object still alive, by creation site), restore
+// the glad pointers; call before glfwTerminate
+void resourcesEnd();
+
+#endif
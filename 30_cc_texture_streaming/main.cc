@@ -0,0 +1,217 @@
+// main.cc
+
+// asynchronous texture streaming: 8 textures (1024x1024 RLE TGA files,
+// written to textures/ on the first run) decoded on worker threads and
+// uploaded through a PBO ring under a per-frame byte budget, coarse
+// mip levels first.
+// usage: ./main [sync] [budget KB]
+//   sync 1: decode and upload everything on the render thread before
+//           the first frame (the hitch the streamer avoids)
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <sys/stat.h>
+#include <stdio.h>
+
+#include <iostream>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "shader.h"
+#include "image.h"
+#include "streamer.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+#define TEXTURE_COUNT 8
+#define TEXTURE_SIZE 1024
+
+// procedural test images: rings, stripes and a checker, per texture colors
+static void writeTestImage(const char* path, int index)
+{
+  Image image(TEXTURE_SIZE, TEXTURE_SIZE);
+  float hue = index / (float)TEXTURE_COUNT * 6.2831853f;
+  for (int y = 0; y < image.height; y++) {
+    for (int x = 0; x < image.width; x++) {
+      float u = x / (float)image.width - 0.5f, v = y / (float)image.height - 0.5f;
+      float ring = sin(sqrt(u * u + v * v) * (40.0f + index * 8.0f));
+      bool checker = ((x >> 6) + (y >> 6)) & 1;
+      unsigned char *p = &image.pixels[((size_t)y * image.width + x) * 4];
+      float shade = ring > 0.0f ? 1.0f : (checker ? 0.35f : 0.6f);
+      p[0] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue)) * 255.0f);
+      p[1] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue + 2.1f)) * 255.0f);
+      p[2] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue + 4.2f)) * 255.0f);
+      p[3] = 255;
+    }
+  }
+  image.writeTGA(path);
+}
+
+int main(int argc, char* argv[])
+{
+  bool sync = argc > 1 && atoi(argv[1]) != 0;
+  unsigned int budget = (argc > 2 ? atoi(argv[2]) : 1024) * 1024;
+
+  std::string paths[TEXTURE_COUNT];
+  mkdir("textures", 0755);
+  for (int i = 0; i < TEXTURE_COUNT; i++) {
+    std::ostringstream path;
+    path << "textures/texture" << i << ".tga";
+    paths[i] = path.str();
+    FILE *file = fopen(paths[i].c_str(), "rb");
+    if (file != NULL)
+      fclose(file);
+    else
+      writeTestImage(paths[i].c_str(), i);
+  }
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Texture Streaming", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // 4x2 quads, one per texture (x y u v)
+  float quadVertices[TEXTURE_COUNT * 4 * 4];
+  GLuint quadIndices[TEXTURE_COUNT * 6];
+  for (int i = 0; i < TEXTURE_COUNT; i++) {
+    float x0 = -0.95f + (i % 4) * 0.48f, y0 = (i < 4) ? 0.02f : -0.95f;
+    float x1 = x0 + 0.45f, y1 = y0 + 0.93f;
+    float quad[16] = {
+      x0, y0, 0.0f, 0.0f,
+      x1, y0, 1.0f, 0.0f,
+      x1, y1, 1.0f, 1.0f,
+      x0, y1, 0.0f, 1.0f
+    };
+    std::copy(quad, quad + 16, quadVertices + i * 16);
+    GLuint indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; k++)
+      quadIndices[i * 6 + k] = i * 4 + indices[k];
+  }
+
+  GLuint quadVAO, quadVBO, quadEBO;
+  glGenVertexArrays(1, &quadVAO);
+  glGenBuffers(1, &quadVBO);
+  glGenBuffers(1, &quadEBO);
+
+  glBindVertexArray(quadVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)(2*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  ourShader.use();
+  ourShader.setInt("image", 0);
+
+  // textures
+  TextureStreamer *streamer = NULL;
+  GLuint textures[TEXTURE_COUNT];
+  double start = glfwGetTime();
+  if (sync) {
+    for (int i = 0; i < TEXTURE_COUNT; i++)
+      textures[i] = loadTextureNow(paths[i].c_str());
+    std::cout << "sync: " << TEXTURE_COUNT << " textures loaded on the render thread in "
+              << (glfwGetTime() - start) * 1000.0 << " ms" << std::endl;
+  } else {
+    streamer = new TextureStreamer(2, budget);
+    for (int i = 0; i < TEXTURE_COUNT; i++)
+      textures[i] = streamer->load(paths[i].c_str());
+  }
+
+  unsigned int frames = 0;
+  double lastFrame = glfwGetTime();
+  double longestFrame = 0.0;
+  bool reported = sync;
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    if (streamer != NULL)
+      streamer->update();
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ourShader.use();
+    glBindVertexArray(quadVAO);
+    for (int i = 0; i < TEXTURE_COUNT; i++) {
+      glBindTexture(GL_TEXTURE_2D, textures[i]);
+      glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(i * 6 * sizeof(GLuint)));
+    }
+
+    double now = glfwGetTime();
+    longestFrame = std::max(longestFrame, now - lastFrame);
+    lastFrame = now;
+    frames++;
+    if (!reported && streamer->pending() == 0) {
+      std::cout << "stream: " << TEXTURE_COUNT << " textures resident after " << frames << " frames ("
+                << (now - start) * 1000.0 << " ms), longest frame " << longestFrame * 1000.0 << " ms, "
+                << streamer->bytesUploaded() / 1024 << " KB uploaded" << std::endl;
+      reported = true;
+    }
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  delete streamer;
+  if (sync)
+    glDeleteTextures(TEXTURE_COUNT, textures);
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,286 @@
+#include "streamer.h"
+
+#include <string.h>
+#include <algorithm>
+#include <iostream>
+
+static void setFiltering()
+{
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+TextureStreamer::TextureStreamer(unsigned int workers, unsigned int budget,
+                                 unsigned int slots, unsigned int slotSize)
+  : quit(false), budget(budget), slotSize(slotSize), slot(0), uploaded(0)
+{
+  pthread_mutex_init(&this->mutex, NULL);
+  pthread_cond_init(&this->wake, NULL);
+
+  if (slots < 1) slots = 1;
+  this->pbos.resize(slots);
+  this->fences.assign(slots, (GLsync)NULL);
+  glGenBuffers(slots, &this->pbos[0]);
+  for (unsigned int i = 0; i < slots; i++) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->pbos[i]);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, slotSize, NULL, GL_STREAM_DRAW);
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+  if (workers < 1) workers = 1;
+  this->threads.resize(workers);
+  for (unsigned int i = 0; i < workers; i++)
+    pthread_create(&this->threads[i], NULL, TextureStreamer::worker, this);
+}
+
+TextureStreamer::~TextureStreamer()
+{
+  pthread_mutex_lock(&this->mutex);
+  this->quit = true;
+  pthread_cond_broadcast(&this->wake);
+  pthread_mutex_unlock(&this->mutex);
+  for (size_t i = 0; i < this->threads.size(); i++)
+    pthread_join(this->threads[i], NULL);
+
+  for (size_t i = 0; i < this->fences.size(); i++)
+    if (this->fences[i] != NULL)
+      glDeleteSync(this->fences[i]);
+  glDeleteBuffers(this->pbos.size(), &this->pbos[0]);
+
+  for (size_t i = 0; i < this->streams.size(); i++) {
+    glDeleteTextures(1, &this->streams[i]->texture);
+    delete this->streams[i];
+  }
+  pthread_cond_destroy(&this->wake);
+  pthread_mutex_destroy(&this->mutex);
+}
+
+GLuint TextureStreamer::load(const char* path)
+{
+  Stream *stream = new Stream();
+  stream->path = path;
+  stream->failed = false;
+  stream->done = false;
+  stream->level = -1;
+  stream->row = 0;
+
+  // placeholder until the tail of the mip chain is uploaded
+  const unsigned char gray[4] = { 128, 128, 128, 255 };
+  glGenTextures(1, &stream->texture);
+  glBindTexture(GL_TEXTURE_2D, stream->texture);
+  glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, gray);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+  setFiltering();
+  glBindTexture(GL_TEXTURE_2D, 0);
+  this->streams.push_back(stream);
+
+  pthread_mutex_lock(&this->mutex);
+  this->todo.push_back(stream);
+  pthread_cond_signal(&this->wake);
+  pthread_mutex_unlock(&this->mutex);
+  return stream->texture;
+}
+
+void* TextureStreamer::worker(void* data)
+{
+  TextureStreamer *streamer = (TextureStreamer*)data;
+  pthread_mutex_lock(&streamer->mutex);
+  while (true) {
+    while (!streamer->quit && streamer->todo.empty())
+      pthread_cond_wait(&streamer->wake, &streamer->mutex);
+    if (streamer->quit) break;
+    Stream *stream = streamer->todo.front();
+    streamer->todo.pop_front();
+    pthread_mutex_unlock(&streamer->mutex);
+
+    streamer->decode(stream);
+
+    pthread_mutex_lock(&streamer->mutex);
+    streamer->decoded.push_back(stream);
+  }
+  pthread_mutex_unlock(&streamer->mutex);
+  return NULL;
+}
+
+// worker thread, no GL calls
+void TextureStreamer::decode(Stream* stream)
+{
+  Image image;
+  if (!image.readTGA(stream->path.c_str())) {
+    stream->failed = true;
+    return;
+  }
+  buildMips(image, stream->levels);
+}
+
+// allocate every level, upload the tail, stream the rest
+void TextureStreamer::begin(Stream* stream)
+{
+  int levels = stream->levels.size();
+  if (stream->levels[0].width * 4 > (int)this->slotSize) {
+    std::cout << "ERROR::STREAMER::ROW_LARGER_THAN_SLOT " << stream->path << std::endl;
+    stream->failed = true;
+    return;
+  }
+
+  glBindTexture(GL_TEXTURE_2D, stream->texture);
+  int level = levels - 1;
+  for (int i = levels - 1; i >= 0; i--) {
+    const Image &image = stream->levels[i];
+    bool tail = image.width <= TAIL_SIZE && image.height <= TAIL_SIZE;
+    glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA8, image.width, image.height, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, tail ? &image.pixels[0] : NULL);
+    if (tail) {
+      this->uploaded += image.pixels.size();
+      level = i - 1;
+    }
+  }
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, level + 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  stream->level = level;
+  stream->row = 0;
+  if (level < 0) {
+    stream->done = true;
+    std::vector<Image>().swap(stream->levels);
+  } else {
+    this->uploading.push_back(stream);
+  }
+}
+
+// copy rows of the current level into the next ring slot and upload
+// them; false if the slot is still in use by the GPU or the budget is spent
+bool TextureStreamer::uploadBand(Stream* stream, unsigned int &budget)
+{
+  Image &level = stream->levels[stream->level];
+  unsigned int rowBytes = level.width * 4;
+  unsigned int rows = level.height - stream->row;
+  unsigned int fit = std::min(this->slotSize, budget) / rowBytes;
+  if (fit == 0) {
+    // budget below one row: go over it by one row, on a fresh budget only
+    if (budget < this->budget) return false;
+    fit = 1;
+  }
+  rows = std::min(rows, fit);
+
+  GLsync &fence = this->fences[this->slot];
+  if (fence != NULL) {
+    if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) return false;
+    glDeleteSync(fence);
+    fence = NULL;
+  }
+
+  GLsizeiptr bytes = (GLsizeiptr)rows * rowBytes;
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->pbos[this->slot]);
+  void *dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes,
+                               GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+  if (dst == NULL) {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return false;
+  }
+  memcpy(dst, &level.pixels[(size_t)stream->row * rowBytes], bytes);
+  glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+  glBindTexture(GL_TEXTURE_2D, stream->texture);
+  glTexSubImage2D(GL_TEXTURE_2D, stream->level, 0, stream->row, level.width, rows,
+                  GL_RGBA, GL_UNSIGNED_BYTE, (void*)0);
+  fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  this->slot = (this->slot + 1) % this->pbos.size();
+
+  budget -= std::min<unsigned int>(budget, bytes);
+  this->uploaded += bytes;
+  stream->row += rows;
+
+  if (stream->row == level.height) {
+    // level complete: sample down to it, drop the CPU copy
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, stream->level);
+    std::vector<unsigned char>().swap(level.pixels);
+    stream->level--;
+    stream->row = 0;
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+  return true;
+}
+
+// smallest pending level first, whatever the size of its texture,
+// then the oldest request
+bool TextureStreamer::coarser(const Stream* a, const Stream* b)
+{
+  const Image &la = a->levels[a->level];
+  const Image &lb = b->levels[b->level];
+  return la.width * la.height < lb.width * lb.height;
+}
+
+void TextureStreamer::update()
+{
+  std::vector<Stream*> ready;
+  pthread_mutex_lock(&this->mutex);
+  ready.swap(this->decoded);
+  pthread_mutex_unlock(&this->mutex);
+
+  for (size_t i = 0; i < ready.size(); i++) {
+    if (ready[i]->failed) continue;
+    this->begin(ready[i]);
+  }
+
+  unsigned int budget = this->budget;
+  while (budget > 0 && !this->uploading.empty()) {
+    std::stable_sort(this->uploading.begin(), this->uploading.end(), coarser);
+    Stream *stream = this->uploading.front();
+    if (!this->uploadBand(stream, budget)) break;
+    if (stream->level < 0) {
+      stream->done = true;
+      std::vector<Image>().swap(stream->levels);
+      this->uploading.erase(this->uploading.begin());
+    }
+  }
+}
+
+bool TextureStreamer::resident(GLuint texture) const
+{
+  for (size_t i = 0; i < this->streams.size(); i++)
+    if (this->streams[i]->texture == texture)
+      return this->streams[i]->done;
+  return false;
+}
+
+unsigned int TextureStreamer::pending() const
+{
+  unsigned int count = 0;
+  for (size_t i = 0; i < this->streams.size(); i++)
+    if (!this->streams[i]->failed && !this->streams[i]->done)
+      count++;
+  return count;
+}
+
+unsigned long TextureStreamer::bytesUploaded() const
+{
+  return this->uploaded;
+}
+
+GLuint loadTextureNow(const char* path)
+{
+  Image image;
+  std::vector<Image> levels;
+  if (image.readTGA(path))
+    buildMips(image, levels);
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  if (levels.empty()) {
+    const unsigned char gray[4] = { 128, 128, 128, 255 };
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, gray);
+  }
+  for (size_t i = 0; i < levels.size(); i++)
+    glTexImage2D(GL_TEXTURE_2D, i, GL_RGBA8, levels[i].width, levels[i].height,
+                 0, GL_RGBA, GL_UNSIGNED_BYTE, &levels[i].pixels[0]);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels.empty() ? 0 : levels.size() - 1);
+  setFiltering();
+  glBindTexture(GL_TEXTURE_2D, 0);
+  return texture;
+}
@@ -0,0 +1,86 @@
+#ifndef STREAMER_H
+#define STREAMER_H
+
+#include <glad/glad.h>
+#include <pthread.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "image.h"
+
+// mip levels up to this size are uploaded as soon as they are decoded
+#define TAIL_SIZE 32
+
+// asynchronous texture streaming
+// - load() returns a texture at once (a 1x1 gray placeholder); the file
+//   is decoded and its mip chain built on a worker thread
+// - update(), once per frame on the render thread, takes the decoded
+//   images: the tail of the mip chain (levels up to TAIL_SIZE) is
+//   uploaded at once, the other levels go through a ring of pixel
+//   buffer objects, at most budget bytes per frame, coarsest levels
+//   first across every texture, so detail comes in over the next
+//   frames; GL_TEXTURE_BASE_LEVEL follows the finest complete level,
+//   the texture is always complete
+// - a ring slot is reused only once its fence has signaled, update()
+//   never waits for the GPU
+// the streamer owns the textures it created
+class TextureStreamer
+{
+  public:
+    TextureStreamer(unsigned int workers, unsigned int budget,
+                    unsigned int slots = 4, unsigned int slotSize = 1 << 20);
+    ~TextureStreamer();
+
+    GLuint load(const char* path);
+
+    void update();
+
+    // every level of the texture uploaded
+    bool resident(GLuint texture) const;
+    // textures not resident yet
+    unsigned int pending() const;
+    unsigned long bytesUploaded() const;
+
+  private:
+    struct Stream
+    {
+      GLuint texture;
+      std::string path;
+      std::vector<Image> levels;   // filled by a worker
+      bool failed;
+      bool done;
+      int level;                   // level being uploaded
+      int row;                     // next row of that level
+    };
+
+    static void* worker(void* data);
+    static bool coarser(const Stream* a, const Stream* b);
+    void decode(Stream* stream);
+    void begin(Stream* stream);
+    bool uploadBand(Stream* stream, unsigned int &budget);
+
+    std::vector<pthread_t> threads;
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    bool quit;
+    std::deque<Stream*> todo;       // waiting for a worker
+    std::vector<Stream*> decoded;   // waiting for update()
+
+    std::vector<Stream*> uploading;
+    std::vector<Stream*> streams;
+
+    unsigned int budget;
+    unsigned int slotSize;
+    std::vector<GLuint> pbos;
+    std::vector<GLsync> fences;
+    unsigned int slot;
+    unsigned long uploaded;
+};
+
+// decode, build the mip chain and upload on the calling thread
+// (what the streamer avoids)
+GLuint loadTextureNow(const char* path);
+
+#endif
@@ -0,0 +1,234 @@
+#include "atlas.h"
+#include "packer.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+Atlas::Atlas(int pageWidth, int pageHeight, int padding)
+  : pageWidth(pageWidth), pageHeight(pageHeight), padding(padding), used(0)
+{
+}
+
+int Atlas::add(const std::string &name, const Image &image)
+{
+  this->names.push_back(name);
+  this->images.push_back(image);
+  return this->images.size() - 1;
+}
+
+// biggest first packs tighter
+struct ByHeight
+{
+  const std::vector<Image> *images;
+  bool operator()(int a, int b) const
+  {
+    const Image &ia = (*images)[a], &ib = (*images)[b];
+    return ia.height != ib.height ? ia.height > ib.height : ia.width > ib.width;
+  }
+};
+
+// copy the image at (x, y) of the page with its edge texels extruded
+// into the padding around it
+void Atlas::place(int index, int page, int x, int y)
+{
+  const Image &image = this->images[index];
+  Image &target = this->pages[page];
+  int p = this->padding;
+  for (int py = y - p; py < y + image.height + p; py++) {
+    if (py < 0 || py >= target.height) continue;
+    int sy = std::min(std::max(py - y, 0), image.height - 1);
+    for (int px = x - p; px < x + image.width + p; px++) {
+      if (px < 0 || px >= target.width) continue;
+      int sx = std::min(std::max(px - x, 0), image.width - 1);
+      const unsigned char *src = &image.pixels[((size_t)sy * image.width + sx) * 4];
+      unsigned char *dst = &target.pixels[((size_t)py * target.width + px) * 4];
+      std::copy(src, src + 4, dst);
+    }
+  }
+
+  AtlasRegion &r = this->regions[index];
+  r.layer = page;
+  r.u0 = x / (float)target.width;
+  r.v0 = y / (float)target.height;
+  r.u1 = (x + image.width) / (float)target.width;
+  r.v1 = (y + image.height) / (float)target.height;
+  this->used += (long)image.width * image.height;
+}
+
+bool Atlas::build(AtlasMode mode)
+{
+  this->pages.clear();
+  this->regions.assign(this->images.size(), AtlasRegion());
+  this->used = 0;
+
+  if (mode == ATLAS_LAYERS) {
+    int w = 1, h = 1;
+    for (size_t i = 0; i < this->images.size(); i++) {
+      w = std::max(w, this->images[i].width);
+      h = std::max(h, this->images[i].height);
+    }
+    this->pageWidth = w;
+    this->pageHeight = h;
+    for (size_t i = 0; i < this->images.size(); i++) {
+      this->pages.push_back(Image(w, h));
+      this->place(i, i, 0, 0);
+    }
+    return true;
+  }
+
+  std::vector<int> order(this->images.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  ByHeight byHeight = { &this->images };
+  std::sort(order.begin(), order.end(), byHeight);
+
+  std::vector<SkylinePacker> packers;
+  int p = this->padding;
+  for (size_t k = 0; k < order.size(); k++) {
+    const Image &image = this->images[order[k]];
+    int w = image.width + 2 * p, h = image.height + 2 * p;
+    if (w > this->pageWidth || h > this->pageHeight) {
+      std::cout << "ERROR::ATLAS::IMAGE_LARGER_THAN_PAGE " << this->names[order[k]] << std::endl;
+      return false;
+    }
+    // first page with room, else a new one
+    int x = 0, y = 0;
+    size_t page = 0;
+    while (page < packers.size() && !packers[page].pack(w, h, x, y))
+      page++;
+    if (page == packers.size()) {
+      packers.push_back(SkylinePacker(this->pageWidth, this->pageHeight));
+      this->pages.push_back(Image(this->pageWidth, this->pageHeight));
+      packers.back().pack(w, h, x, y);
+    }
+    this->place(order[k], page, x + p, y + p);
+  }
+  return true;
+}
+
+GLuint Atlas::upload() const
+{
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+  glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, this->pageWidth, this->pageHeight,
+               std::max<int>(this->pages.size(), 1), 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+  for (size_t i = 0; i < this->pages.size(); i++)
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, this->pageWidth, this->pageHeight, 1,
+                    GL_RGBA, GL_UNSIGNED_BYTE, &this->pages[i].pixels[0]);
+
+  // level n blends 2^n texels: stop where it would reach past the padding
+  int levels = 0;
+  while ((2 << levels) <= this->padding) levels++;
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels);
+  glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  return texture;
+}
+
+int Atlas::size() const
+{
+  return this->regions.size();
+}
+
+int Atlas::find(const std::string &name) const
+{
+  for (size_t i = 0; i < this->names.size(); i++)
+    if (this->names[i] == name)
+      return i;
+  return -1;
+}
+
+const AtlasRegion& Atlas::region(int index) const
+{
+  return this->regions[index];
+}
+
+void Atlas::remap(int index, float u, float v, float out[3]) const
+{
+  const AtlasRegion &r = this->regions[index];
+  out[0] = r.u0 + (r.u1 - r.u0) * u;
+  out[1] = r.v0 + (r.v1 - r.v0) * v;
+  out[2] = (float)r.layer;
+}
+
+int Atlas::pageCount() const
+{
+  return this->pages.size();
+}
+
+float Atlas::occupancy() const
+{
+  if (this->pages.empty()) return 0.0f;
+  return this->used / ((float)this->pageWidth * this->pageHeight * this->pages.size());
+}
+
+bool Atlas::save(const std::string &prefix) const
+{
+  std::ofstream manifest((prefix + ".atlas").c_str());
+  if (!manifest) {
+    std::cout << "ERROR::ATLAS::CANNOT_WRITE " << prefix << ".atlas" << std::endl;
+    return false;
+  }
+  manifest.precision(9);
+  manifest << "atlas " << this->pageWidth << " " << this->pageHeight << " "
+           << this->pages.size() << " " << this->padding << "\n";
+  for (size_t i = 0; i < this->regions.size(); i++) {
+    const AtlasRegion &r = this->regions[i];
+    manifest << this->names[i] << " " << r.layer << " "
+             << r.u0 << " " << r.v0 << " " << r.u1 << " " << r.v1 << "\n";
+  }
+
+  for (size_t i = 0; i < this->pages.size(); i++) {
+    std::ostringstream path;
+    path << prefix << "_" << i << ".tga";
+    if (!this->pages[i].writeTGA(path.str().c_str()))
+      return false;
+  }
+  return true;
+}
+
+bool Atlas::load(const std::string &prefix)
+{
+  std::ifstream manifest((prefix + ".atlas").c_str());
+  std::string magic;
+  int pageCount = 0;
+  if (!(manifest >> magic >> this->pageWidth >> this->pageHeight >> pageCount >> this->padding) ||
+      magic != "atlas") {
+    std::cout << "ERROR::ATLAS::BAD_MANIFEST " << prefix << ".atlas" << std::endl;
+    return false;
+  }
+
+  this->names.clear();
+  this->images.clear();
+  this->regions.clear();
+  std::string name;
+  AtlasRegion r;
+  while (manifest >> name >> r.layer >> r.u0 >> r.v0 >> r.u1 >> r.v1) {
+    this->names.push_back(name);
+    this->regions.push_back(r);
+  }
+
+  this->pages.assign(pageCount, Image());
+  this->used = 0;
+  for (int i = 0; i < pageCount; i++) {
+    std::ostringstream path;
+    path << prefix << "_" << i << ".tga";
+    if (!this->pages[i].readTGA(path.str().c_str()))
+      return false;
+    if (this->pages[i].width != this->pageWidth || this->pages[i].height != this->pageHeight) {
+      std::cout << "ERROR::ATLAS::PAGE_SIZE " << path.str() << std::endl;
+      return false;
+    }
+  }
+  for (size_t i = 0; i < this->regions.size(); i++) {
+    const AtlasRegion &q = this->regions[i];
+    this->used += (long)((q.u1 - q.u0) * this->pageWidth + 0.5f) * (long)((q.v1 - q.v0) * this->pageHeight + 0.5f);
+  }
+  return true;
+}
@@ -0,0 +1,70 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <glad/glad.h>
+
+#include <string>
+#include <vector>
+
+#include "image.h"
+
+// where an image ended up: layer of the array texture, uv rectangle
+struct AtlasRegion
+{
+  int layer;
+  float u0, v0, u1, v1;
+};
+
+enum AtlasMode
+{
+  ATLAS_PACKED,   // skyline packed into as many pages as needed
+  ATLAS_LAYERS    // one image per layer (layer size: the largest image)
+};
+
+// many small images in one GL_TEXTURE_2D_ARRAY: a draw reads every
+// material from one binding, the vertices carry (u, v, layer) from
+// remap(); images are padded with their edge texels so filtering and
+// the first mip levels don't bleed into the neighbours
+//
+// offline: build() then save() (see atlas_pack), runtime: load()
+class Atlas
+{
+  public:
+    Atlas(int pageWidth = 1024, int pageHeight = 1024, int padding = 4);
+
+    // the image is copied; returns its index
+    int add(const std::string &name, const Image &image);
+
+    // false if an image is larger than a page
+    bool build(AtlasMode mode);
+
+    // array texture, one layer per page, mipmapped down to the padding
+    GLuint upload() const;
+
+    int size() const;
+    int find(const std::string &name) const;   // -1 if missing
+    const AtlasRegion& region(int index) const;
+    // (u, v) in [0, 1] on the image to (u, v, layer) in the array
+    void remap(int index, float u, float v, float out[3]) const;
+
+    int pageCount() const;
+    float occupancy() const;
+
+    // <prefix>.atlas (regions by name) and <prefix>_<page>.tga
+    bool save(const std::string &prefix) const;
+    bool load(const std::string &prefix);
+
+  private:
+    void place(int index, int page, int x, int y);
+
+    int pageWidth;
+    int pageHeight;
+    int padding;
+    std::vector<std::string> names;
+    std::vector<Image> images;
+    std::vector<AtlasRegion> regions;
+    std::vector<Image> pages;
+    long used;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "packer.h"
+
+SkylinePacker::SkylinePacker(int width, int height)
+  : width(width), height(height), used(0)
+{
+  Segment first = { 0, 0, width };
+  this->skyline.push_back(first);
+}
+
+int SkylinePacker::fit(size_t i, int w, int h) const
+{
+  int x = this->skyline[i].x;
+  if (x + w > this->width) return -1;
+
+  // highest segment under the rectangle
+  int y = 0;
+  int left = w;
+  while (left > 0) {
+    if (i >= this->skyline.size()) return -1;
+    if (this->skyline[i].y > y) y = this->skyline[i].y;
+    left -= this->skyline[i].width;
+    i++;
+  }
+  return y + h <= this->height ? y : -1;
+}
+
+bool SkylinePacker::pack(int w, int h, int &x, int &y)
+{
+  int bestTop = this->height + 1, bestX = 0;
+  size_t best = this->skyline.size();
+  for (size_t i = 0; i < this->skyline.size(); i++) {
+    int fy = this->fit(i, w, h);
+    if (fy < 0) continue;
+    if (fy + h < bestTop || (fy + h == bestTop && this->skyline[i].x < bestX)) {
+      bestTop = fy + h;
+      bestX = this->skyline[i].x;
+      best = i;
+    }
+  }
+  if (best == this->skyline.size()) return false;
+
+  x = bestX;
+  y = bestTop - h;
+
+  // the new segment replaces what it covers
+  Segment top = { x, bestTop, w };
+  this->skyline.insert(this->skyline.begin() + best, top);
+  size_t i = best + 1;
+  while (i < this->skyline.size()) {
+    Segment &s = this->skyline[i];
+    int covered = x + w - s.x;
+    if (covered <= 0) break;
+    if (covered >= s.width) {
+      this->skyline.erase(this->skyline.begin() + i);
+    } else {
+      s.x += covered;
+      s.width -= covered;
+      break;
+    }
+  }
+
+  // merge neighbours at the same height
+  for (i = 0; i + 1 < this->skyline.size(); ) {
+    if (this->skyline[i].y == this->skyline[i + 1].y) {
+      this->skyline[i].width += this->skyline[i + 1].width;
+      this->skyline.erase(this->skyline.begin() + i + 1);
+    } else {
+      i++;
+    }
+  }
+
+  this->used += (long)w * h;
+  return true;
+}
+
+float SkylinePacker::occupancy() const
+{
+  return this->used / (float)((long)this->width * this->height);
+}
@@ -0,0 +1,39 @@
+#ifndef PACKER_H
+#define PACKER_H
+
+#include <stddef.h>
+
+#include <vector>
+
+// skyline bottom-left rectangle packer: the free space is the area
+// above a list of horizontal segments, a rectangle goes where its top
+// is the lowest (then the leftmost)
+class SkylinePacker
+{
+  public:
+    SkylinePacker(int width, int height);
+
+    // false if the rectangle doesn't fit
+    bool pack(int w, int h, int &x, int &y);
+
+    // area used / page area
+    float occupancy() const;
+
+  private:
+    struct Segment
+    {
+      int x;
+      int y;
+      int width;
+    };
+
+    // y where a w x h rectangle fits at segment i, -1 if it doesn't
+    int fit(size_t i, int w, int h) const;
+
+    int width;
+    int height;
+    long used;
+    std::vector<Segment> skyline;
+};
+
+#endif
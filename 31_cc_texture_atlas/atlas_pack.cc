@@ -0,0 +1,62 @@
+// atlas_pack.cc
+
+// offline atlas packer: packs TGA images into atlas pages
+// (<prefix>_<n>.tga) and writes the regions to <prefix>.atlas,
+// image names are the file names without directory and extension;
+// main loads the result with ./main <layers> <prefix>
+// usage: atlas_pack [-layers] [-page <size>] [-padding <texels>] <prefix> <image.tga>...
+
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+#include "atlas.h"
+
+static std::string baseName(const std::string &path)
+{
+  size_t slash = path.find_last_of('/');
+  std::string name = slash == std::string::npos ? path : path.substr(slash + 1);
+  size_t dot = name.find_last_of('.');
+  return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+int main(int argc, char *argv[])
+{
+  AtlasMode mode = ATLAS_PACKED;
+  int page = 1024, padding = 4;
+  int arg = 1;
+  while (arg < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-layers") == 0) {
+      mode = ATLAS_LAYERS;
+      arg++;
+    } else if (strcmp(argv[arg], "-page") == 0 && arg + 1 < argc) {
+      page = atoi(argv[arg + 1]);
+      arg += 2;
+    } else if (strcmp(argv[arg], "-padding") == 0 && arg + 1 < argc) {
+      padding = atoi(argv[arg + 1]);
+      arg += 2;
+    } else {
+      break;
+    }
+  }
+  if (argc - arg < 2) {
+    std::cout << "usage: atlas_pack [-layers] [-page <size>] [-padding <texels>] <prefix> <image.tga>..." << std::endl;
+    return 1;
+  }
+  std::string prefix = argv[arg++];
+
+  Atlas atlas(page, page, padding);
+  for (; arg < argc; arg++) {
+    Image image;
+    if (!image.readTGA(argv[arg]))
+      return 1;
+    atlas.add(baseName(argv[arg]), image);
+  }
+  if (!atlas.build(mode) || !atlas.save(prefix))
+    return 1;
+
+  std::cout << atlas.size() << " images, " << atlas.pageCount() << " pages, "
+            << atlas.occupancy() * 100.0f << "% used" << std::endl;
+  return 0;
+}
@@ -0,0 +1,196 @@
+// main.cc
+
+// texture atlas: 24 small materials packed into one array texture,
+// 512 sprites with interleaved materials in one glDrawElements and one
+// texture bind (the vertices carry u, v and the layer)
+// usage: ./main [layers] [prefix]
+//   layers 1: one material per array layer instead of packed pages
+//   prefix:   load an atlas written by atlas_pack instead of building one
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "shader.h"
+#include "atlas.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+#define MATERIAL_COUNT 24
+#define SPRITE_COUNT 512
+
+// procedural material: a colored disc, square or diamond with a border
+static Image makeMaterial(int index)
+{
+  int w = 16 + (index * 37) % 113, h = 16 + (index * 53) % 97;
+  Image image(w, h);
+  float hue = index * 0.7f;
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      float u = (x + 0.5f) / w * 2.0f - 1.0f, v = (y + 0.5f) / h * 2.0f - 1.0f;
+      float d;
+      switch (index % 3) {
+        case 0: d = sqrt(u * u + v * v); break;
+        case 1: d = std::max(fabs(u), fabs(v)); break;
+        default: d = fabs(u) + fabs(v); break;
+      }
+      unsigned char *p = &image.pixels[((size_t)y * w + x) * 4];
+      float shade = d > 0.8f ? 0.3f : 1.0f;
+      p[0] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue)) * 255.0f);
+      p[1] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue + 2.1f)) * 255.0f);
+      p[2] = (unsigned char)(shade * (0.5f + 0.5f * sin(hue + 4.2f)) * 255.0f);
+      p[3] = d > 1.0f ? 0 : 255;
+    }
+  }
+  return image;
+}
+
+int main(int argc, char* argv[])
+{
+  AtlasMode mode = argc > 1 && atoi(argv[1]) != 0 ? ATLAS_LAYERS : ATLAS_PACKED;
+
+  Atlas atlas(512, 512);
+  if (argc > 2) {
+    if (!atlas.load(argv[2]))
+      return -1;
+  } else {
+    for (int i = 0; i < MATERIAL_COUNT; i++) {
+      char name[32];
+      sprintf(name, "material%d", i);
+      atlas.add(name, makeMaterial(i));
+    }
+    if (!atlas.build(mode))
+      return -1;
+  }
+  std::cout << atlas.size() << " materials in " << atlas.pageCount() << " layers ("
+            << atlas.occupancy() * 100.0f << "% used)" << std::endl;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Texture Atlas", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // sprites: x y, then u v layer from the atlas
+  std::vector<float> vertices;
+  std::vector<GLuint> indices;
+  srand(1);
+  for (int i = 0; i < SPRITE_COUNT; i++) {
+    int material = rand() % atlas.size();
+    float size = 0.05f + (rand() % 100) / 1000.0f;
+    float x = (rand() % 2000) / 1000.0f - 1.0f, y = (rand() % 2000) / 1000.0f - 1.0f;
+    const float corners[4][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+    for (int c = 0; c < 4; c++) {
+      float uvl[3];
+      atlas.remap(material, corners[c][0], corners[c][1], uvl);
+      vertices.push_back(x + corners[c][0] * size);
+      vertices.push_back(y + corners[c][1] * size);
+      vertices.insert(vertices.end(), uvl, uvl + 3);
+    }
+    GLuint quad[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; k++)
+      indices.push_back(i * 4 + quad[k]);
+  }
+
+  GLuint spriteVAO, spriteVBO, spriteEBO;
+  glGenVertexArrays(1, &spriteVAO);
+  glGenBuffers(1, &spriteVBO);
+  glGenBuffers(1, &spriteEBO);
+
+  glBindVertexArray(spriteVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, spriteVBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), &vertices[0], GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, spriteEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), &indices[0], GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void*)(2*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  GLuint atlasTexture = atlas.upload();
+  ourShader.use();
+  ourShader.setInt("atlas", 0);
+  std::cout << SPRITE_COUNT << " sprites: 1 draw, 1 texture bind per frame" << std::endl;
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // every material from the same binding
+    ourShader.use();
+    glBindTexture(GL_TEXTURE_2D_ARRAY, atlasTexture);
+    glBindVertexArray(spriteVAO);
+    glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  glDeleteTextures(1, &atlasTexture);
+  glDeleteBuffers(1, &spriteEBO);
+  glDeleteBuffers(1, &spriteVBO);
+  glDeleteVertexArrays(1, &spriteVAO);
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,11 @@
+#version 330 core
+
+in vec3 texCoord;
+out vec4 FragColor;
+
+uniform sampler2DArray atlas;
+
+void main()
+{
+  FragColor = texture(atlas, texCoord);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+
+layout (location = 0) in vec2 aPos;
+layout (location = 1) in vec3 aTexCoord;   // u, v, layer
+
+out vec3 texCoord;
+
+void main()
+{
+  gl_Position = vec4(aPos, 0.0f, 1.0f);
+  texCoord = aTexCoord;
+}
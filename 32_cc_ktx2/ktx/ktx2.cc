@@ -0,0 +1,532 @@
+#include "ktx2.h"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <iostream>
+
+// compressed formats past the 3.3 headers
+#define GL_COMPRESSED_RGB_S3TC_DXT1 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5 0x83F3
+#define GL_COMPRESSED_SRGB_S3TC_DXT1 0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1 0x8C4D
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3 0x8C4E
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5 0x8C4F
+#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+#define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM 0x8E8D
+#define GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT 0x8E8E
+#define GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT 0x8E8F
+#define GL_COMPRESSED_R11_EAC 0x9270
+#define GL_COMPRESSED_SIGNED_R11_EAC 0x9271
+#define GL_COMPRESSED_RG11_EAC 0x9272
+#define GL_COMPRESSED_SIGNED_RG11_EAC 0x9273
+#define GL_COMPRESSED_RGB8_ETC2 0x9274
+#define GL_COMPRESSED_SRGB8_ETC2 0x9275
+#define GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9276
+#define GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2 0x9277
+#define GL_COMPRESSED_RGBA8_ETC2_EAC 0x9278
+#define GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC 0x9279
+
+#define S3TC "GL_EXT_texture_compression_s3tc"
+#define S3TC_SRGB "GL_EXT_texture_sRGB"
+#define BPTC "GL_ARB_texture_compression_bptc"
+#define ETC2 "GL_ARB_ES3_compatibility"
+
+static const KtxFormat formats[] = {
+  { 37, GL_RGBA8, BLOCK_NONE, 4, false, NULL, "rgba8" },
+  { 43, GL_SRGB8_ALPHA8, BLOCK_NONE, 4, true, NULL, "rgba8_srgb" },
+  { 131, GL_COMPRESSED_RGB_S3TC_DXT1, BLOCK_BC1_RGB, 8, false, S3TC, "bc1" },
+  { 132, GL_COMPRESSED_SRGB_S3TC_DXT1, BLOCK_BC1_RGB, 8, true, S3TC_SRGB, "bc1_srgb" },
+  { 133, GL_COMPRESSED_RGBA_S3TC_DXT1, BLOCK_BC1_RGBA, 8, false, S3TC, "bc1a" },
+  { 134, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1, BLOCK_BC1_RGBA, 8, true, S3TC_SRGB, "bc1a_srgb" },
+  { 135, GL_COMPRESSED_RGBA_S3TC_DXT3, BLOCK_BC2, 16, false, S3TC, "bc2" },
+  { 136, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3, BLOCK_BC2, 16, true, S3TC_SRGB, "bc2_srgb" },
+  { 137, GL_COMPRESSED_RGBA_S3TC_DXT5, BLOCK_BC3, 16, false, S3TC, "bc3" },
+  { 138, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5, BLOCK_BC3, 16, true, S3TC_SRGB, "bc3_srgb" },
+  { 139, GL_COMPRESSED_RED_RGTC1, BLOCK_BC4, 8, false, NULL, "bc4" },
+  { 140, GL_COMPRESSED_SIGNED_RED_RGTC1, BLOCK_NONE, 8, false, NULL, "bc4_snorm" },
+  { 141, GL_COMPRESSED_RG_RGTC2, BLOCK_BC5, 16, false, NULL, "bc5" },
+  { 142, GL_COMPRESSED_SIGNED_RG_RGTC2, BLOCK_NONE, 16, false, NULL, "bc5_snorm" },
+  { 143, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, BLOCK_NONE, 16, false, BPTC, "bc6h" },
+  { 144, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, BLOCK_NONE, 16, false, BPTC, "bc6h_sfloat" },
+  { 145, GL_COMPRESSED_RGBA_BPTC_UNORM, BLOCK_BC7, 16, false, BPTC, "bc7" },
+  { 146, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, BLOCK_BC7, 16, true, BPTC, "bc7_srgb" },
+  { 147, GL_COMPRESSED_RGB8_ETC2, BLOCK_ETC2_RGB, 8, false, ETC2, "etc2" },
+  { 148, GL_COMPRESSED_SRGB8_ETC2, BLOCK_ETC2_RGB, 8, true, ETC2, "etc2_srgb" },
+  { 149, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, BLOCK_ETC2_RGB_A1, 8, false, ETC2, "etc2a1" },
+  { 150, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, BLOCK_ETC2_RGB_A1, 8, true, ETC2, "etc2a1_srgb" },
+  { 151, GL_COMPRESSED_RGBA8_ETC2_EAC, BLOCK_ETC2_RGBA, 16, false, ETC2, "etc2a8" },
+  { 152, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, BLOCK_ETC2_RGBA, 16, true, ETC2, "etc2a8_srgb" },
+  { 153, GL_COMPRESSED_R11_EAC, BLOCK_EAC_R11, 8, false, ETC2, "eac_r11" },
+  { 154, GL_COMPRESSED_SIGNED_R11_EAC, BLOCK_NONE, 8, false, ETC2, "eac_r11_snorm" },
+  { 155, GL_COMPRESSED_RG11_EAC, BLOCK_EAC_RG11, 16, false, ETC2, "eac_rg11" },
+  { 156, GL_COMPRESSED_SIGNED_RG11_EAC, BLOCK_NONE, 16, false, ETC2, "eac_rg11_snorm" }
+};
+
+#define FORMAT_COUNT (sizeof(formats) / sizeof(formats[0]))
+
+const KtxFormat* ktxFormat(unsigned int vkFormat)
+{
+  for (size_t i = 0; i < FORMAT_COUNT; i++)
+    if (formats[i].vkFormat == vkFormat)
+      return &formats[i];
+  return NULL;
+}
+
+const KtxFormat* ktxFormatByName(const char* name)
+{
+  for (size_t i = 0; i < FORMAT_COUNT; i++)
+    if (strcmp(formats[i].name, name) == 0)
+      return &formats[i];
+  return NULL;
+}
+
+static bool compressed(const KtxFormat *format)
+{
+  return format->vkFormat != 37 && format->vkFormat != 43;
+}
+
+// bytes of a level: 4x4 blocks, or RGBA8 texels
+static size_t levelSize(const KtxFormat *format, int width, int height)
+{
+  if (!compressed(format))
+    return (size_t)width * height * format->blockSize;
+  return (size_t)((width + 3) / 4) * ((height + 3) / 4) * format->blockSize;
+}
+
+// ---- reading ----
+
+static const unsigned char ktx2Identifier[12] = {
+  0xab, 'K', 'T', 'X', ' ', '2', '0', 0xbb, '\r', '\n', 0x1a, '\n'
+};
+
+#define KTX2_HEADER_SIZE 80
+#define KTX2_LEVEL_SIZE 24
+
+static uint32_t read32(const unsigned char *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t read64(const unsigned char *p)
+{
+  return read32(p) | ((uint64_t)read32(p + 4) << 32);
+}
+
+Ktx2File::Ktx2File()
+  : format(NULL), width(0), height(0), mapping(NULL), mappingSize(0)
+{
+}
+
+Ktx2File::~Ktx2File()
+{
+  this->close();
+}
+
+void Ktx2File::close()
+{
+  if (this->mapping != NULL)
+    munmap(this->mapping, this->mappingSize);
+  this->mapping = NULL;
+  this->mappingSize = 0;
+  this->format = NULL;
+  this->width = this->height = 0;
+  this->levels.clear();
+}
+
+bool Ktx2File::open(const char* path)
+{
+  this->close();
+  int fd = ::open(path, O_RDONLY);
+  if (fd < 0) {
+    std::cout << "ERROR::KTX2::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size < KTX2_HEADER_SIZE) {
+    std::cout << "ERROR::KTX2::BAD_FILE " << path << std::endl;
+    ::close(fd);
+    return false;
+  }
+  // the mapping stays valid once the descriptor is closed
+  void *mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    std::cout << "ERROR::KTX2::MMAP_FAILED " << path << std::endl;
+    return false;
+  }
+  this->mapping = mapping;
+  this->mappingSize = info.st_size;
+
+  const unsigned char *data = (const unsigned char*)mapping;
+  size_t size = info.st_size;
+  if (memcmp(data, ktx2Identifier, sizeof(ktx2Identifier)) != 0) {
+    std::cout << "ERROR::KTX2::NOT_KTX2 " << path << std::endl;
+    this->close();
+    return false;
+  }
+
+  uint32_t vkFormat = read32(data + 12);
+  uint32_t pixelWidth = read32(data + 20);
+  uint32_t pixelHeight = read32(data + 24);
+  uint32_t pixelDepth = read32(data + 28);
+  uint32_t layerCount = read32(data + 32);
+  uint32_t faceCount = read32(data + 36);
+  uint32_t levelCount = read32(data + 40);
+  uint32_t supercompression = read32(data + 44);
+
+  this->format = ktxFormat(vkFormat);
+  if (this->format == NULL) {
+    std::cout << "ERROR::KTX2::UNSUPPORTED_FORMAT " << vkFormat << " " << path << std::endl;
+    this->close();
+    return false;
+  }
+  if (supercompression != 0) {
+    std::cout << "ERROR::KTX2::SUPERCOMPRESSION_NOT_SUPPORTED " << path << std::endl;
+    this->close();
+    return false;
+  }
+  if (pixelWidth == 0 || pixelHeight == 0 || pixelDepth > 1 || layerCount > 1 || faceCount != 1 ||
+      pixelWidth > 65536 || pixelHeight > 65536) {
+    std::cout << "ERROR::KTX2::NOT_A_2D_TEXTURE " << path << std::endl;
+    this->close();
+    return false;
+  }
+  // 0: the reader is asked to generate the mip chain, only level 0 is stored
+  if (levelCount == 0) levelCount = 1;
+  if (levelCount > 17 || KTX2_HEADER_SIZE + (size_t)levelCount * KTX2_LEVEL_SIZE > size) {
+    std::cout << "ERROR::KTX2::BAD_LEVEL_INDEX " << path << std::endl;
+    this->close();
+    return false;
+  }
+
+  this->width = pixelWidth;
+  this->height = pixelHeight;
+  for (uint32_t i = 0; i < levelCount; i++) {
+    const unsigned char *entry = data + KTX2_HEADER_SIZE + i * KTX2_LEVEL_SIZE;
+    uint64_t offset = read64(entry);
+    uint64_t length = read64(entry + 8);
+    KtxLevel level;
+    level.width = pixelWidth >> i > 0 ? pixelWidth >> i : 1;
+    level.height = pixelHeight >> i > 0 ? pixelHeight >> i : 1;
+    level.size = levelSize(this->format, level.width, level.height);
+    if (offset > size || length > size - offset || length != level.size) {
+      std::cout << "ERROR::KTX2::BAD_LEVEL " << i << " " << path << std::endl;
+      this->close();
+      return false;
+    }
+    level.data = data + offset;
+    this->levels.push_back(level);
+  }
+  // levels are read once each, in order from the largest
+  madvise(mapping, size, MADV_SEQUENTIAL);
+  return true;
+}
+
+// ---- upload ----
+
+static bool hasExtension(const char* name)
+{
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+  for (GLint i = 0; i < count; i++) {
+    const char *extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+    if (extension != NULL && strcmp(extension, name) == 0)
+      return true;
+  }
+  return false;
+}
+
+bool ktxFormatSupported(const KtxFormat *format)
+{
+  if (!compressed(format)) return true;
+  GLint count = 0;
+  glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count);
+  if (count > 0) {
+    std::vector<GLint> list(count);
+    glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, &list[0]);
+    for (GLint i = 0; i < count; i++)
+      if ((GLenum)list[i] == format->internalFormat)
+        return true;
+  }
+  // RGTC is core since 3.0 but usually left out of the list
+  return format->extension == NULL || hasExtension(format->extension);
+}
+
+static double milliseconds(const timespec &start)
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_nsec - start.tv_nsec) / 1000000.0;
+}
+
+GLuint uploadKtx2(const Ktx2File &file, bool forceTranscode, unsigned int threads, KtxUpload *info)
+{
+  KtxUpload result;
+  memset(&result, 0, sizeof(result));
+  if (file.format == NULL || file.levels.empty()) {
+    std::cout << "ERROR::KTX2::NOT_OPEN" << std::endl;
+    return 0;
+  }
+  const KtxFormat *format = file.format;
+  bool native = !compressed(format) || (!forceTranscode && ktxFormatSupported(format));
+  if (!native && format->block == BLOCK_NONE) {
+    std::cout << "ERROR::KTX2::NO_TRANSCODER " << format->name << std::endl;
+    return 0;
+  }
+  result.transcoded = !native;
+
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+  std::vector<unsigned char> rgba;
+  GLenum rgbaFormat = format->srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8;
+  for (size_t i = 0; i < file.levels.size(); i++) {
+    const KtxLevel &level = file.levels[i];
+    size_t rgbaSize = (size_t)level.width * level.height * 4;
+    result.rgbaBytes += rgbaSize;
+    timespec start;
+    if (native) {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      if (compressed(format))
+        glCompressedTexImage2D(GL_TEXTURE_2D, i, format->internalFormat, level.width,
+                               level.height, 0, level.size, level.data);
+      else
+        glTexImage2D(GL_TEXTURE_2D, i, format->internalFormat, level.width, level.height, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, level.data);
+      result.uploadMs += milliseconds(start);
+      result.textureBytes += level.size;
+    } else {
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      rgba.resize(rgbaSize);
+      transcode(format->block, level.data, level.width, level.height, &rgba[0], threads);
+      result.transcodeMs += milliseconds(start);
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      glTexImage2D(GL_TEXTURE_2D, i, rgbaFormat, level.width, level.height, 0,
+                   GL_RGBA, GL_UNSIGNED_BYTE, &rgba[0]);
+      result.uploadMs += milliseconds(start);
+      result.textureBytes += rgbaSize;
+    }
+  }
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  bool mips = file.levels.size() > 1;
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, file.levels.size() - 1);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, mips ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D, 0);
+
+  if (glGetError() != GL_NO_ERROR) {
+    std::cout << "ERROR::KTX2::UPLOAD_FAILED " << format->name << std::endl;
+    glDeleteTextures(1, &texture);
+    return 0;
+  }
+  if (info != NULL) *info = result;
+  return texture;
+}
+
+// ---- writing ----
+
+// data format descriptor sample: bit range of a channel in a block
+struct DfdSample
+{
+  int bitOffset;
+  int bitLength;
+  int channel;
+};
+
+// KHR_DF_MODEL_* and the samples of each block layout
+static int dfdModel(const KtxFormat *format, DfdSample samples[4])
+{
+  const DfdSample color64 = { 0, 64, 0 }, color128 = { 0, 128, 0 };
+  switch (format->block) {
+    case BLOCK_BC1_RGB: samples[0] = color64; return 128;
+    case BLOCK_BC1_RGBA: samples[0] = color64; samples[0].channel = 1; return 128;
+    case BLOCK_BC2:
+    case BLOCK_BC3:
+      samples[0].bitOffset = 0; samples[0].bitLength = 64; samples[0].channel = 15;
+      samples[1].bitOffset = 64; samples[1].bitLength = 64; samples[1].channel = 0;
+      return format->block == BLOCK_BC2 ? 129 : 130;
+    case BLOCK_BC4: samples[0] = color64; return 131;
+    case BLOCK_BC5:
+      samples[0].bitOffset = 0; samples[0].bitLength = 64; samples[0].channel = 0;
+      samples[1].bitOffset = 64; samples[1].bitLength = 64; samples[1].channel = 1;
+      return 132;
+    case BLOCK_BC7: samples[0] = color128; return 134;
+    case BLOCK_ETC2_RGB: samples[0] = color64; samples[0].channel = 2; return 161;
+    case BLOCK_ETC2_RGB_A1: samples[0] = color64; samples[0].channel = 2; return 161;
+    case BLOCK_ETC2_RGBA:
+      samples[0].bitOffset = 0; samples[0].bitLength = 64; samples[0].channel = 15;
+      samples[1].bitOffset = 64; samples[1].bitLength = 64; samples[1].channel = 2;
+      return 161;
+    case BLOCK_EAC_R11: samples[0] = color64; return 161;
+    case BLOCK_EAC_RG11:
+      samples[0] = color64;
+      samples[1].bitOffset = 64; samples[1].bitLength = 64; samples[1].channel = 1;
+      return 161;
+    default:
+      break;
+  }
+  // RGBA8: one byte per channel
+  for (int c = 0; c < 4; c++) {
+    samples[c].bitOffset = c * 8;
+    samples[c].bitLength = 8;
+    samples[c].channel = c == 3 ? 15 : c;
+  }
+  return 1;
+}
+
+static void put32(std::vector<unsigned char> &out, uint32_t v)
+{
+  for (int i = 0; i < 4; i++) out.push_back((v >> (8 * i)) & 0xff);
+}
+
+static void put64(std::vector<unsigned char> &out, uint64_t v)
+{
+  put32(out, (uint32_t)v);
+  put32(out, (uint32_t)(v >> 32));
+}
+
+static void basicDescriptor(const KtxFormat *format, std::vector<unsigned char> &out)
+{
+  DfdSample samples[4];
+  memset(samples, 0, sizeof(samples));
+  int model = dfdModel(format, samples);
+  int count = 0;
+  while (count < 4 && samples[count].bitLength > 0) count++;
+  bool block = compressed(format);
+
+  put32(out, 4 + 24 + 16 * count);          // total size
+  put32(out, 0);                            // Khronos vendor, basic descriptor
+  put32(out, 2 | ((24 + 16 * count) << 16));
+  out.push_back(model);
+  out.push_back(1);                         // BT.709 primaries
+  out.push_back(format->srgb ? 2 : 1);      // sRGB / linear transfer
+  out.push_back(0);                         // straight alpha
+  out.push_back(block ? 3 : 0);             // block dimensions - 1
+  out.push_back(block ? 3 : 0);
+  out.push_back(0);
+  out.push_back(0);
+  out.push_back(format->blockSize);
+  for (int i = 0; i < 7; i++) out.push_back(0);
+  for (int i = 0; i < count; i++) {
+    out.push_back(samples[i].bitOffset & 0xff);
+    out.push_back(samples[i].bitOffset >> 8);
+    out.push_back(samples[i].bitLength - 1);
+    out.push_back(samples[i].channel);
+    put32(out, 0);                          // sample position
+    put32(out, 0);                          // lower
+    put32(out, block ? 0xffffffff : 255);   // upper
+  }
+}
+
+static bool readBack(const KtxFormat *format, const Image &image, std::vector<unsigned char> &blocks)
+{
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D, texture);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  glTexImage2D(GL_TEXTURE_2D, 0, format->internalFormat, image.width, image.height, 0,
+               GL_RGBA, GL_UNSIGNED_BYTE, &image.pixels[0]);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+  GLint isCompressed = 0, size = 0;
+  glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &isCompressed);
+  glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+  bool ok = glGetError() == GL_NO_ERROR && isCompressed &&
+            (size_t)size == levelSize(format, image.width, image.height);
+  if (ok) {
+    blocks.resize(size);
+    glGetCompressedTexImage(GL_TEXTURE_2D, 0, &blocks[0]);
+  }
+  glBindTexture(GL_TEXTURE_2D, 0);
+  glDeleteTextures(1, &texture);
+  return ok;
+}
+
+bool writeKtx2(const char* path, const KtxFormat *format, const std::vector<Image> &levels)
+{
+  if (levels.empty()) return false;
+
+  // level data: compressed by the driver, or the RGBA8 texels as they are
+  std::vector<std::vector<unsigned char> > data(levels.size());
+  for (size_t i = 0; i < levels.size(); i++) {
+    if (!compressed(format)) {
+      data[i] = levels[i].pixels;
+    } else if (!readBack(format, levels[i], data[i])) {
+      std::cout << "ERROR::KTX2::DRIVER_CANNOT_ENCODE " << format->name << std::endl;
+      return false;
+    }
+  }
+
+  std::vector<unsigned char> dfd, kvd;
+  basicDescriptor(format, dfd);
+  // rows are stored bottom-up, as GL takes them
+  const char key[] = "KTXorientation\0ru";
+  put32(kvd, sizeof(key));
+  kvd.insert(kvd.end(), key, key + sizeof(key));
+  while (kvd.size() % 4) kvd.push_back(0);
+
+  size_t count = levels.size();
+  size_t dfdOffset = KTX2_HEADER_SIZE + count * KTX2_LEVEL_SIZE;
+  size_t kvdOffset = dfdOffset + dfd.size();
+  size_t offset = kvdOffset + kvd.size();
+
+  // level data smallest first, each aligned to the block size
+  size_t alignment = format->blockSize;
+  std::vector<uint64_t> offsets(count);
+  for (size_t i = count; i-- > 0;) {
+    offset = (offset + alignment - 1) / alignment * alignment;
+    offsets[i] = offset;
+    offset += data[i].size();
+  }
+
+  std::vector<unsigned char> out(ktx2Identifier, ktx2Identifier + sizeof(ktx2Identifier));
+  put32(out, format->vkFormat);
+  put32(out, 1);                                // type size
+  put32(out, levels[0].width);
+  put32(out, levels[0].height);
+  put32(out, 0);                                // depth
+  put32(out, 0);                                // layers
+  put32(out, 1);                                // faces
+  put32(out, count);
+  put32(out, 0);                                // no supercompression
+  put32(out, dfdOffset);
+  put32(out, dfd.size());
+  put32(out, kvdOffset);
+  put32(out, kvd.size());
+  put64(out, 0);
+  put64(out, 0);
+  for (size_t i = 0; i < count; i++) {
+    put64(out, offsets[i]);
+    put64(out, data[i].size());
+    put64(out, data[i].size());
+  }
+  out.insert(out.end(), dfd.begin(), dfd.end());
+  out.insert(out.end(), kvd.begin(), kvd.end());
+  for (size_t i = count; i-- > 0;) {
+    out.resize(offsets[i], 0);
+    out.insert(out.end(), data[i].begin(), data[i].end());
+  }
+
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    std::cout << "ERROR::KTX2::CANNOT_WRITE " << path << std::endl;
+    return false;
+  }
+  bool ok = fwrite(&out[0], 1, out.size(), file) == out.size();
+  fclose(file);
+  return ok;
+}
@@ -0,0 +1,87 @@
+#ifndef KTX2_H
+#define KTX2_H
+
+#include <glad/glad.h>
+#include <stddef.h>
+
+#include <vector>
+
+#include "image.h"
+#include "transcode.h"
+
+// a texel format KTX2 files can carry, by Vulkan format number
+struct KtxFormat
+{
+  unsigned int vkFormat;
+  GLenum internalFormat;   // GL_RGBA8 / GL_SRGB8_ALPHA8 for plain RGBA8
+  BlockFormat block;       // CPU decoder, BLOCK_NONE if there is none
+  unsigned int blockSize;  // bytes per 4x4 block, per texel for RGBA8
+  bool srgb;
+  const char* extension;   // needed on a 3.3 context, NULL if core
+  const char* name;
+};
+
+// NULL if the format is not one of the BC1 - BC7, ETC2 / EAC or RGBA8 ones
+const KtxFormat* ktxFormat(unsigned int vkFormat);
+const KtxFormat* ktxFormatByName(const char* name);
+
+struct KtxLevel
+{
+  int width;
+  int height;
+  const unsigned char *data;   // blocks (or texels) row by row
+  size_t size;
+};
+
+// a 2D KTX2 file, memory mapped read only: the levels point into the
+// mapping, nothing is copied until upload; cube maps, arrays, 3D
+// textures and supercompressed (Basis / zstd) files are rejected
+class Ktx2File
+{
+  public:
+    Ktx2File();
+    ~Ktx2File();
+
+    bool open(const char* path);
+    void close();
+
+    const KtxFormat *format;
+    int width;
+    int height;
+    std::vector<KtxLevel> levels;   // level 0 first
+
+  private:
+    Ktx2File(const Ktx2File&);
+    Ktx2File& operator=(const Ktx2File&);
+
+    void *mapping;
+    size_t mappingSize;
+};
+
+// the context takes the compressed format (GL_COMPRESSED_TEXTURE_FORMATS
+// or the extension)
+bool ktxFormatSupported(const KtxFormat *format);
+
+struct KtxUpload
+{
+  bool transcoded;        // decoded to RGBA8 on the CPU
+  size_t textureBytes;    // what the texture takes in video memory
+  size_t rgbaBytes;       // the same levels as RGBA8
+  double transcodeMs;
+  double uploadMs;
+};
+
+// texture with every level of the file; compressed levels go straight
+// to glCompressedTexImage2D, or, when the context lacks the format (or
+// forceTranscode), are decoded to RGBA8 on threads first;
+// 0 if the format can be neither uploaded nor decoded
+GLuint uploadKtx2(const Ktx2File &file, bool forceTranscode, unsigned int threads,
+                  KtxUpload *info = NULL);
+
+// compress the levels with the driver (glTexImage2D to a compressed
+// internal format, read back with glGetCompressedTexImage) and write
+// them as a KTX2 file; needs a current context whose driver can encode
+// the format
+bool writeKtx2(const char* path, const KtxFormat *format, const std::vector<Image> &levels);
+
+#endif
@@ -0,0 +1,607 @@
+#include "transcode.h"
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+static unsigned char clamp255(int v)
+{
+  return v < 0 ? 0 : (v > 255 ? 255 : v);
+}
+
+// ---- BC1 - BC5 (S3TC / RGTC) ----
+
+static void rgb565(unsigned int c, int out[3])
+{
+  int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+  out[0] = (r << 3) | (r >> 2);
+  out[1] = (g << 2) | (g >> 4);
+  out[2] = (b << 3) | (b >> 2);
+}
+
+// color part of BC1 / BC2 / BC3; BC2 and BC3 always use four colors
+static void decodeBC1(const unsigned char *block, unsigned char rgba[64], bool alpha, bool fourColors)
+{
+  unsigned int c0 = block[0] | (block[1] << 8);
+  unsigned int c1 = block[2] | (block[3] << 8);
+  int palette[4][4];
+  rgb565(c0, palette[0]);
+  rgb565(c1, palette[1]);
+  palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+  for (int k = 0; k < 3; k++) {
+    int a = palette[0][k], b = palette[1][k];
+    if (c0 > c1 || fourColors) {
+      palette[2][k] = (2 * a + b) / 3;
+      palette[3][k] = (a + 2 * b) / 3;
+    } else {
+      palette[2][k] = (a + b) / 2;
+      palette[3][k] = 0;
+    }
+  }
+  if (c0 <= c1 && !fourColors && alpha)
+    palette[3][3] = 0;
+
+  unsigned int indices = block[4] | (block[5] << 8) | (block[6] << 16) | ((unsigned int)block[7] << 24);
+  for (int i = 0; i < 16; i++) {
+    const int *c = palette[(indices >> (2 * i)) & 3];
+    for (int k = 0; k < 4; k++)
+      rgba[i * 4 + k] = c[k];
+  }
+}
+
+// BC3 alpha / BC4 / BC5 channel block into one channel of the output
+static void decodeBC4(const unsigned char *block, unsigned char rgba[64], int channel)
+{
+  int a0 = block[0], a1 = block[1];
+  int values[8];
+  values[0] = a0;
+  values[1] = a1;
+  if (a0 > a1) {
+    for (int i = 2; i < 8; i++)
+      values[i] = ((8 - i) * a0 + (i - 1) * a1) / 7;
+  } else {
+    for (int i = 2; i < 6; i++)
+      values[i] = ((6 - i) * a0 + (i - 1) * a1) / 5;
+    values[6] = 0;
+    values[7] = 255;
+  }
+  uint64_t bits = 0;
+  for (int i = 0; i < 6; i++)
+    bits |= (uint64_t)block[2 + i] << (8 * i);
+  for (int i = 0; i < 16; i++)
+    rgba[i * 4 + channel] = values[(bits >> (3 * i)) & 7];
+}
+
+static void decodeBC2Alpha(const unsigned char *block, unsigned char rgba[64])
+{
+  for (int i = 0; i < 16; i++) {
+    int a = (block[i / 2] >> (4 * (i & 1))) & 15;
+    rgba[i * 4 + 3] = a * 17;
+  }
+}
+
+// ---- BC7 ----
+
+// subset of each texel (bit i = texel i) for the 64 two subset partitions
+static const unsigned short bc7Partition2[64] = {
+  0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80,
+  0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8, 0xff00, 0xfff0, 0xf000,
+  0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce,
+  0x088c, 0x3110, 0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c,
+  0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696, 0xa55a,
+  0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660,
+  0x0272, 0x04e4, 0x4e40, 0x2720, 0xc936, 0x936c, 0x39c6, 0x639c,
+  0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22
+};
+
+// two bits per texel for the 64 three subset partitions
+static const unsigned int bc7Partition3[64] = {
+  0xaa685050, 0x6a5a5040, 0x5a5a4200, 0x5450a0a8, 0xa5a50000, 0xa0a05050, 0x5555a0a0, 0x5a5a5050,
+  0xaa550000, 0xaa555500, 0xaaaa5500, 0x90909090, 0x94949494, 0xa4a4a4a4, 0xa9a59450, 0x2a0a4250,
+  0xa5945040, 0x0a425054, 0xa5a5a500, 0x55a0a0a0, 0xa8a85454, 0x6a6a4040, 0xa4a45000, 0x1a1a0500,
+  0x0050a4a4, 0xaaa59090, 0x14696914, 0x69691400, 0xa08585a0, 0xaa821414, 0x50a4a450, 0x6a5a0200,
+  0xa9a58000, 0x5090a0a8, 0xa8a09050, 0x24242424, 0x00aa5500, 0x24924924, 0x24499224, 0x50a50a50,
+  0x500aa550, 0xaaaa4444, 0x66660000, 0xa5a0a5a0, 0x50a050a0, 0x69286928, 0x44aaaa44, 0x66666600,
+  0xaa444444, 0x54a854a8, 0x95809580, 0x96969600, 0xa85454a8, 0x80959580, 0xaa141414, 0x96960000,
+  0xaaaa1414, 0xa05050a0, 0xa0a5a5a0, 0x96000000, 0x40804080, 0xa9a8a9a8, 0xaaaaaa44, 0x2a4a5254
+};
+
+// anchor texel (index stored with one bit less) of the second subset
+static const unsigned char bc7Anchor2[64] = {
+  15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+  15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+  15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+   6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+};
+
+// anchors of the second and third subsets of three subset partitions
+static const unsigned char bc7Anchor3a[64] = {
+   3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+   3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+   8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+   3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3
+};
+
+static const unsigned char bc7Anchor3b[64] = {
+  15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+  15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+  15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+  15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8
+};
+
+static const int bc7Weights2[4] = { 0, 21, 43, 64 };
+static const int bc7Weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const int bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+struct BC7Mode
+{
+  int subsets;
+  int partitionBits;
+  int rotationBits;
+  int selectionBits;
+  int colorBits;
+  int alphaBits;
+  int endpointPBits;   // one per endpoint
+  int sharedPBits;     // one per subset
+  int indexBits;
+  int indexBits2;
+};
+
+static const BC7Mode bc7Modes[8] = {
+  { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+  { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+  { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+  { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+  { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+  { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+  { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+  { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 }
+};
+
+// reads a 128 bit block from the lowest bit up
+struct BitReader
+{
+  uint64_t low, high;
+  int position;
+
+  unsigned int read(int count)
+  {
+    if (count == 0) return 0;
+    uint64_t value;
+    if (this->position >= 64)
+      value = this->high >> (this->position - 64);
+    else if (this->position + count <= 64)
+      value = this->low >> this->position;
+    else
+      value = (this->low >> this->position) | (this->high << (64 - this->position));
+    this->position += count;
+    return (unsigned int)(value & ((1u << count) - 1));
+  }
+};
+
+static int bc7Expand(int value, int bits)
+{
+  value <<= 8 - bits;
+  return value | (value >> bits);
+}
+
+static int bc7Interpolate(int e0, int e1, int weight)
+{
+  return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+}
+
+static const int* bc7WeightTable(int bits)
+{
+  return bits == 2 ? bc7Weights2 : (bits == 3 ? bc7Weights3 : bc7Weights4);
+}
+
+static void decodeBC7(const unsigned char *block, unsigned char rgba[64])
+{
+  int mode = 0;
+  while (mode < 8 && !(block[0] & (1 << mode)))
+    mode++;
+  if (mode == 8) {
+    // reserved mode: transparent black
+    memset(rgba, 0, 64);
+    return;
+  }
+  const BC7Mode &m = bc7Modes[mode];
+  BitReader bits = { 0, 0, mode + 1 };
+  for (int i = 0; i < 8; i++) {
+    bits.low |= (uint64_t)block[i] << (8 * i);
+    bits.high |= (uint64_t)block[8 + i] << (8 * i);
+  }
+  int partition = bits.read(m.partitionBits);
+  int rotation = bits.read(m.rotationBits);
+  int selection = bits.read(m.selectionBits);
+
+  // endpoints[subset * 2 + end][channel]
+  int endpoints[6][4];
+  int count = m.subsets * 2;
+  for (int c = 0; c < 3; c++)
+    for (int e = 0; e < count; e++)
+      endpoints[e][c] = bits.read(m.colorBits);
+  for (int e = 0; e < count; e++)
+    endpoints[e][3] = m.alphaBits ? bits.read(m.alphaBits) : 255;
+
+  int colorBits = m.colorBits, alphaBits = m.alphaBits;
+  if (m.endpointPBits || m.sharedPBits) {
+    int p[6];
+    if (m.endpointPBits) {
+      for (int e = 0; e < count; e++) p[e] = bits.read(1);
+    } else {
+      for (int s = 0; s < m.subsets; s++) p[2 * s] = p[2 * s + 1] = bits.read(1);
+    }
+    for (int e = 0; e < count; e++) {
+      for (int c = 0; c < 3; c++)
+        endpoints[e][c] = (endpoints[e][c] << 1) | p[e];
+      if (m.alphaBits)
+        endpoints[e][3] = (endpoints[e][3] << 1) | p[e];
+    }
+    colorBits++;
+    if (alphaBits) alphaBits++;
+  }
+  for (int e = 0; e < count; e++) {
+    for (int c = 0; c < 3; c++)
+      endpoints[e][c] = bc7Expand(endpoints[e][c], colorBits);
+    if (alphaBits)
+      endpoints[e][3] = bc7Expand(endpoints[e][3], alphaBits);
+  }
+
+  int subset[16];
+  for (int i = 0; i < 16; i++) {
+    if (m.subsets == 2) subset[i] = (bc7Partition2[partition] >> i) & 1;
+    else if (m.subsets == 3) subset[i] = (bc7Partition3[partition] >> (2 * i)) & 3;
+    else subset[i] = 0;
+  }
+  int anchor[3] = { 0, 0, 0 };
+  if (m.subsets == 2) anchor[1] = bc7Anchor2[partition];
+  if (m.subsets == 3) {
+    anchor[1] = bc7Anchor3a[partition];
+    anchor[2] = bc7Anchor3b[partition];
+  }
+
+  int index[16], index2[16];
+  for (int i = 0; i < 16; i++) {
+    bool isAnchor = i == anchor[subset[i]];
+    index[i] = bits.read(m.indexBits - (isAnchor ? 1 : 0));
+  }
+  for (int i = 0; i < 16 && m.indexBits2; i++)
+    index2[i] = bits.read(m.indexBits2 - (i == 0 ? 1 : 0));
+
+  for (int i = 0; i < 16; i++) {
+    const int *e0 = endpoints[subset[i] * 2], *e1 = endpoints[subset[i] * 2 + 1];
+    int out[4];
+    if (m.indexBits2) {
+      // separate color and alpha indices, swapped by the selection bit
+      int colorIndex = selection ? index2[i] : index[i];
+      int alphaIndex = selection ? index[i] : index2[i];
+      const int *colorWeights = bc7WeightTable(selection ? m.indexBits2 : m.indexBits);
+      const int *alphaWeights = bc7WeightTable(selection ? m.indexBits : m.indexBits2);
+      for (int c = 0; c < 3; c++)
+        out[c] = bc7Interpolate(e0[c], e1[c], colorWeights[colorIndex]);
+      out[3] = bc7Interpolate(e0[3], e1[3], alphaWeights[alphaIndex]);
+    } else {
+      const int *weights = bc7WeightTable(m.indexBits);
+      for (int c = 0; c < 4; c++)
+        out[c] = bc7Interpolate(e0[c], e1[c], weights[index[i]]);
+    }
+    if (rotation)
+      std::swap(out[3], out[rotation - 1]);
+    for (int c = 0; c < 4; c++)
+      rgba[i * 4 + c] = out[c];
+  }
+}
+
+// ---- ETC2 / EAC ----
+
+static const int etcModifiers[8][4] = {
+  { 2, 8, -2, -8 }, { 5, 17, -5, -17 }, { 9, 29, -9, -29 }, { 13, 42, -13, -42 },
+  { 18, 60, -18, -60 }, { 24, 80, -24, -80 }, { 33, 106, -33, -106 }, { 47, 183, -47, -183 }
+};
+
+static const int etcDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+static const int eacModifiers[16][8] = {
+  { -3, -6, -9, -15, 2, 5, 8, 14 }, { -3, -7, -10, -13, 2, 6, 9, 12 },
+  { -2, -5, -8, -13, 1, 4, 7, 12 }, { -2, -4, -6, -13, 1, 3, 5, 12 },
+  { -3, -6, -8, -12, 2, 5, 7, 11 }, { -3, -7, -9, -11, 2, 6, 8, 10 },
+  { -4, -7, -8, -11, 3, 6, 7, 10 }, { -3, -5, -8, -11, 2, 4, 7, 10 },
+  { -2, -6, -8, -10, 1, 5, 7, 9 }, { -2, -5, -8, -10, 1, 4, 7, 9 },
+  { -2, -4, -8, -10, 1, 3, 7, 9 }, { -2, -5, -7, -10, 1, 4, 6, 9 },
+  { -3, -4, -7, -10, 2, 3, 6, 9 }, { -1, -2, -3, -10, 0, 1, 2, 9 },
+  { -4, -6, -8, -9, 3, 5, 7, 8 }, { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+static int extend4(int v) { return v * 17; }
+static int extend5(int v) { return (v << 3) | (v >> 2); }
+static int extend6(int v) { return (v << 2) | (v >> 4); }
+static int extend7(int v) { return (v << 1) | (v >> 6); }
+
+static int signed3(int v)
+{
+  return v >= 4 ? v - 8 : v;
+}
+
+// ETC texels are stored column by column: i = x * 4 + y
+static int etcIndex(const unsigned char *b, int x, int y)
+{
+  int i = x * 4 + y;
+  int msb = ((b[4 + (1 - i / 8)]) >> (i % 8)) & 1;
+  int lsb = ((b[6 + (1 - i / 8)]) >> (i % 8)) & 1;
+  return (msb << 1) | lsb;
+}
+
+static void setTexel(unsigned char rgba[64], int x, int y, int r, int g, int b, int a)
+{
+  unsigned char *out = &rgba[(y * 4 + x) * 4];
+  out[0] = clamp255(r);
+  out[1] = clamp255(g);
+  out[2] = clamp255(b);
+  out[3] = a;
+}
+
+// four paint colors picked by the texel index (T and H modes)
+static void etcPaint(const unsigned char *b, int paint[4][3], bool punchthrough, bool opaque,
+                     unsigned char rgba[64])
+{
+  for (int y = 0; y < 4; y++)
+    for (int x = 0; x < 4; x++) {
+      int i = etcIndex(b, x, y);
+      if (punchthrough && !opaque && i == 2)
+        setTexel(rgba, x, y, 0, 0, 0, 0);
+      else
+        setTexel(rgba, x, y, paint[i][0], paint[i][1], paint[i][2], 255);
+    }
+}
+
+// ETC2 RGB block; with punchthrough alpha the differential bit is the
+// opaque bit and there is no individual mode
+static void decodeETC2(const unsigned char *b, unsigned char rgba[64], bool punchthrough)
+{
+  bool diff = (b[3] & 2) != 0;
+  bool opaque = diff;
+  if (punchthrough) diff = true;
+  bool flip = (b[3] & 1) != 0;
+
+  int base[2][3];
+  if (!diff) {
+    for (int c = 0; c < 3; c++) {
+      base[0][c] = extend4(b[c] >> 4);
+      base[1][c] = extend4(b[c] & 15);
+    }
+  } else {
+    int r = b[0] >> 3, g = b[1] >> 3, bl = b[2] >> 3;
+    int r2 = r + signed3(b[0] & 7), g2 = g + signed3(b[1] & 7), b2 = bl + signed3(b[2] & 7);
+
+    if (r2 < 0 || r2 > 31) {
+      // T mode
+      int paint[4][3];
+      int c1[3] = { extend4(((b[0] >> 1) & 12) | (b[0] & 3)), extend4(b[1] >> 4), extend4(b[1] & 15) };
+      int c2[3] = { extend4(b[2] >> 4), extend4(b[2] & 15), extend4(b[3] >> 4) };
+      int d = etcDistances[((b[3] >> 1) & 6) | (b[3] & 1)];
+      for (int c = 0; c < 3; c++) {
+        paint[0][c] = c1[c];
+        paint[1][c] = c2[c] + d;
+        paint[2][c] = c2[c];
+        paint[3][c] = c2[c] - d;
+      }
+      etcPaint(b, paint, punchthrough, opaque, rgba);
+      return;
+    }
+    if (g2 < 0 || g2 > 31) {
+      // H mode
+      int r1 = (b[0] >> 3) & 15;
+      int g1 = ((b[0] & 7) << 1) | ((b[1] >> 4) & 1);
+      int b1 = (b[1] & 8) | ((b[1] & 3) << 1) | (b[2] >> 7);
+      int rr2 = (b[2] >> 3) & 15;
+      int gg2 = ((b[2] & 7) << 1) | (b[3] >> 7);
+      int bb2 = (b[3] >> 3) & 15;
+      int order = ((r1 << 8) | (g1 << 4) | b1) >= ((rr2 << 8) | (gg2 << 4) | bb2) ? 1 : 0;
+      int d = etcDistances[(b[3] & 4) | ((b[3] & 1) << 1) | order];
+      int c1[3] = { extend4(r1), extend4(g1), extend4(b1) };
+      int c2[3] = { extend4(rr2), extend4(gg2), extend4(bb2) };
+      int paint[4][3];
+      for (int c = 0; c < 3; c++) {
+        paint[0][c] = c1[c] + d;
+        paint[1][c] = c1[c] - d;
+        paint[2][c] = c2[c] + d;
+        paint[3][c] = c2[c] - d;
+      }
+      etcPaint(b, paint, punchthrough, opaque, rgba);
+      return;
+    }
+    if (b2 < 0 || b2 > 31) {
+      // planar mode: three colors, linear across the block, always opaque
+      int ro = extend6((b[0] >> 1) & 63);
+      int go = extend7(((b[0] & 1) << 6) | ((b[1] >> 1) & 63));
+      int bo = extend6(((b[1] & 1) << 5) | (b[2] & 0x18) | ((b[2] & 3) << 1) | (b[3] >> 7));
+      int rh = extend6(((b[3] >> 1) & 0x3e) | (b[3] & 1));
+      int gh = extend7(b[4] >> 1);
+      int bh = extend6(((b[4] & 1) << 5) | (b[5] >> 3));
+      int rv = extend6(((b[5] & 7) << 3) | (b[6] >> 5));
+      int gv = extend7(((b[6] & 31) << 2) | (b[7] >> 6));
+      int bv = extend6(b[7] & 63);
+      for (int y = 0; y < 4; y++)
+        for (int x = 0; x < 4; x++)
+          setTexel(rgba, x, y,
+                   (x * (rh - ro) + y * (rv - ro) + 4 * ro + 2) >> 2,
+                   (x * (gh - go) + y * (gv - go) + 4 * go + 2) >> 2,
+                   (x * (bh - bo) + y * (bv - bo) + 4 * bo + 2) >> 2, 255);
+      return;
+    }
+    base[0][0] = extend5(r);
+    base[0][1] = extend5(g);
+    base[0][2] = extend5(bl);
+    base[1][0] = extend5(r2);
+    base[1][1] = extend5(g2);
+    base[1][2] = extend5(b2);
+  }
+
+  // individual / differential: two sub-blocks with their own base color
+  int table[2] = { b[3] >> 5, (b[3] >> 2) & 7 };
+  for (int y = 0; y < 4; y++)
+    for (int x = 0; x < 4; x++) {
+      int sub = flip ? (y >= 2) : (x >= 2);
+      int i = etcIndex(b, x, y);
+      if (punchthrough && !opaque && i == 2) {
+        setTexel(rgba, x, y, 0, 0, 0, 0);
+        continue;
+      }
+      int modifier = etcModifiers[table[sub]][i];
+      if (punchthrough && !opaque && (i & 1) == 0)
+        modifier = 0;
+      setTexel(rgba, x, y, base[sub][0] + modifier, base[sub][1] + modifier,
+               base[sub][2] + modifier, 255);
+    }
+}
+
+// EAC block into one channel; eleven bit (R11 / RG11) or eight bit
+// (the alpha of RGBA8 ETC2) precision, kept as eight bits
+static void decodeEAC(const unsigned char *b, unsigned char rgba[64], int channel, bool elevenBits)
+{
+  int base = b[0];
+  int multiplier = b[1] >> 4;
+  const int *modifiers = eacModifiers[b[1] & 15];
+  uint64_t bits = 0;
+  for (int i = 2; i < 8; i++)
+    bits = (bits << 8) | b[i];
+  for (int i = 0; i < 16; i++) {
+    int index = (bits >> (45 - 3 * i)) & 7;
+    int x = i / 4, y = i % 4;
+    int value;
+    if (elevenBits) {
+      int v = base * 8 + 4 + modifiers[index] * (multiplier ? multiplier * 8 : 1);
+      v = v < 0 ? 0 : (v > 2047 ? 2047 : v);
+      value = (v * 255 + 1023) / 2047;
+    } else {
+      value = clamp255(base + modifiers[index] * multiplier);
+    }
+    rgba[(y * 4 + x) * 4 + channel] = value;
+  }
+}
+
+unsigned int blockBytes(BlockFormat format)
+{
+  switch (format) {
+    case BLOCK_BC1_RGB:
+    case BLOCK_BC1_RGBA:
+    case BLOCK_BC4:
+    case BLOCK_ETC2_RGB:
+    case BLOCK_ETC2_RGB_A1:
+    case BLOCK_EAC_R11:
+      return 8;
+    default:
+      return 16;
+  }
+}
+
+void decodeBlock(BlockFormat format, const unsigned char *block, unsigned char rgba[64])
+{
+  switch (format) {
+    case BLOCK_BC1_RGB:
+      decodeBC1(block, rgba, false, false);
+      break;
+    case BLOCK_BC1_RGBA:
+      decodeBC1(block, rgba, true, false);
+      break;
+    case BLOCK_BC2:
+      decodeBC1(block + 8, rgba, false, true);
+      decodeBC2Alpha(block, rgba);
+      break;
+    case BLOCK_BC3:
+      decodeBC1(block + 8, rgba, false, true);
+      decodeBC4(block, rgba, 3);
+      break;
+    case BLOCK_BC4:
+    case BLOCK_BC5:
+    case BLOCK_EAC_R11:
+    case BLOCK_EAC_RG11:
+      for (int i = 0; i < 16; i++) {
+        rgba[i * 4 + 1] = rgba[i * 4 + 2] = 0;
+        rgba[i * 4 + 3] = 255;
+      }
+      if (format == BLOCK_BC4 || format == BLOCK_BC5) {
+        decodeBC4(block, rgba, 0);
+        if (format == BLOCK_BC5) decodeBC4(block + 8, rgba, 1);
+      } else {
+        decodeEAC(block, rgba, 0, true);
+        if (format == BLOCK_EAC_RG11) decodeEAC(block + 8, rgba, 1, true);
+      }
+      break;
+    case BLOCK_BC7:
+      decodeBC7(block, rgba);
+      break;
+    case BLOCK_ETC2_RGB:
+      decodeETC2(block, rgba, false);
+      break;
+    case BLOCK_ETC2_RGB_A1:
+      decodeETC2(block, rgba, true);
+      break;
+    case BLOCK_ETC2_RGBA:
+      decodeETC2(block + 8, rgba, false);
+      decodeEAC(block, rgba, 3, false);
+      break;
+    case BLOCK_NONE:
+      memset(rgba, 0, 64);
+      break;
+  }
+}
+
+struct TranscodeJob
+{
+  BlockFormat format;
+  const unsigned char *blocks;
+  int width, height;
+  unsigned char *rgba;
+  int firstRow, lastRow;   // block rows
+};
+
+static void* transcodeRows(void* data)
+{
+  const TranscodeJob &job = *(const TranscodeJob*)data;
+  int blocksX = (job.width + 3) / 4;
+  unsigned int size = blockBytes(job.format);
+  unsigned char texels[64];
+  for (int by = job.firstRow; by < job.lastRow; by++) {
+    const unsigned char *block = job.blocks + (size_t)by * blocksX * size;
+    for (int bx = 0; bx < blocksX; bx++, block += size) {
+      decodeBlock(job.format, block, texels);
+      // blocks at the right / top edge are cut to the level size
+      int w = std::min(4, job.width - bx * 4), h = std::min(4, job.height - by * 4);
+      for (int y = 0; y < h; y++)
+        memcpy(job.rgba + ((size_t)(by * 4 + y) * job.width + bx * 4) * 4, &texels[y * 16], w * 4);
+    }
+  }
+  return NULL;
+}
+
+void transcode(BlockFormat format, const unsigned char *blocks, int width, int height,
+               unsigned char *rgba, unsigned int threads)
+{
+  int rows = (height + 3) / 4;
+  if (threads < 1) threads = 1;
+  if ((int)threads > rows) threads = rows;
+
+  std::vector<TranscodeJob> jobs(threads);
+  for (unsigned int i = 0; i < threads; i++) {
+    TranscodeJob &job = jobs[i];
+    job.format = format;
+    job.blocks = blocks;
+    job.width = width;
+    job.height = height;
+    job.rgba = rgba;
+    job.firstRow = rows * i / threads;
+    job.lastRow = rows * (i + 1) / threads;
+  }
+  // the calling thread takes the first share
+  std::vector<pthread_t> ids(threads);
+  for (unsigned int i = 1; i < threads; i++)
+    pthread_create(&ids[i], NULL, transcodeRows, &jobs[i]);
+  if (threads > 0)
+    transcodeRows(&jobs[0]);
+  for (unsigned int i = 1; i < threads; i++)
+    pthread_join(ids[i], NULL);
+}
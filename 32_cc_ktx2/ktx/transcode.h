@@ -0,0 +1,39 @@
+#ifndef TRANSCODE_H
+#define TRANSCODE_H
+
+#include <stddef.h>
+
+// CPU decoders for GPU block compressed formats (4x4 texel blocks) to
+// RGBA8, for contexts without the format; no GL calls
+// single channel formats decode to (r, 0, 0, 255), two channel ones
+// to (r, g, 0, 255), like the GL samples them
+enum BlockFormat
+{
+  BLOCK_BC1_RGB,
+  BLOCK_BC1_RGBA,
+  BLOCK_BC2,
+  BLOCK_BC3,
+  BLOCK_BC4,
+  BLOCK_BC5,
+  BLOCK_BC7,
+  BLOCK_ETC2_RGB,
+  BLOCK_ETC2_RGB_A1,
+  BLOCK_ETC2_RGBA,
+  BLOCK_EAC_R11,
+  BLOCK_EAC_RG11,
+  BLOCK_NONE          // no CPU decoder (BC6H, signed formats)
+};
+
+// bytes per 4x4 block (8 or 16)
+unsigned int blockBytes(BlockFormat format);
+
+// one block to 16 RGBA8 texels, row by row
+void decodeBlock(BlockFormat format, const unsigned char *block, unsigned char rgba[64]);
+
+// a whole level (width x height texels, blocks row by row) to RGBA8
+// rows (width * 4 bytes per row, bottom row first like the blocks),
+// block rows are split across threads
+void transcode(BlockFormat format, const unsigned char *blocks, int width, int height,
+               unsigned char *rgba, unsigned int threads);
+
+#endif
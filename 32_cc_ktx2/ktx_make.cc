@@ -0,0 +1,88 @@
+// ktx_make.cc
+
+// offline KTX2 writer: compresses a TGA image and its mip chain with
+// the driver's encoder (hidden window) and writes a KTX2 file that
+// main loads; formats the driver cannot encode fail with an error
+// usage: ktx_make [-format <name>] [-nomips] <image.tga> <out.ktx2>
+//   formats: bc1 bc1a bc2 bc3 bc4 bc5 bc7 (and _srgb), rgba8, ...
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+
+#include "ktx2.h"
+
+int main(int argc, char *argv[])
+{
+  const char *formatName = "bc7";
+  bool mips = true;
+  int arg = 1;
+  while (arg < argc && argv[arg][0] == '-') {
+    if (strcmp(argv[arg], "-format") == 0 && arg + 1 < argc) {
+      formatName = argv[arg + 1];
+      arg += 2;
+    } else if (strcmp(argv[arg], "-nomips") == 0) {
+      mips = false;
+      arg++;
+    } else {
+      break;
+    }
+  }
+  if (argc - arg != 2) {
+    std::cout << "usage: ktx_make [-format <name>] [-nomips] <image.tga> <out.ktx2>" << std::endl;
+    return 1;
+  }
+  const KtxFormat *format = ktxFormatByName(formatName);
+  if (format == NULL) {
+    std::cout << "ERROR::KTX_MAKE::UNKNOWN_FORMAT " << formatName << std::endl;
+    return 1;
+  }
+
+  Image image;
+  if (!image.readTGA(argv[arg]))
+    return 1;
+  std::vector<Image> levels;
+  if (mips) {
+    buildMips(image, levels);
+  } else {
+    levels.push_back(image);
+  }
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(16, 16, "ktx_make", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  bool ok = writeKtx2(argv[arg + 1], format, levels);
+  if (ok)
+    std::cout << argv[arg + 1] << ": " << format->name << ", " << levels[0].width << "x"
+              << levels[0].height << ", " << levels.size() << " levels" << std::endl;
+
+  glfwTerminate();
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,231 @@
+// main.cc
+
+// KTX2 textures: block compressed mip chains, memory mapped and handed
+// to glCompressedTexImage2D as they are; formats the context lacks are
+// decoded to RGBA8 on worker threads first. Without file arguments
+// BC1 / BC3 / BC7 / RGBA8 versions of a test image are written to
+// textures/ (driver encoder) on the first run and shown side by side.
+// usage: ./main [transcode] [threads] [file.ktx2...]
+//   transcode 1: decode on the CPU even when the format is supported
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <sys/stat.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "shader.h"
+#include "ktx2.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+#define TEXTURE_SIZE 1024
+#define MAX_TEXTURES 4
+
+// procedural test image: rings over a checker, alpha fading at the edge
+static Image makeTestImage()
+{
+  Image image(TEXTURE_SIZE, TEXTURE_SIZE);
+  for (int y = 0; y < image.height; y++) {
+    for (int x = 0; x < image.width; x++) {
+      float u = x / (float)image.width - 0.5f, v = y / (float)image.height - 0.5f;
+      float r = sqrt(u * u + v * v);
+      float ring = sin(r * 60.0f);
+      bool checker = ((x >> 6) + (y >> 6)) & 1;
+      unsigned char *p = &image.pixels[((size_t)y * image.width + x) * 4];
+      float shade = ring > 0.0f ? 1.0f : (checker ? 0.35f : 0.6f);
+      p[0] = (unsigned char)(shade * (0.5f + 0.5f * sin(u * 9.0f)) * 255.0f);
+      p[1] = (unsigned char)(shade * (0.5f + 0.5f * sin(v * 7.0f + 2.1f)) * 255.0f);
+      p[2] = (unsigned char)(shade * (0.5f + 0.5f * sin(r * 5.0f + 4.2f)) * 255.0f);
+      p[3] = (unsigned char)(std::min(1.0f, std::max(0.0f, (0.5f - r) * 8.0f)) * 255.0f);
+    }
+  }
+  return image;
+}
+
+int main(int argc, char* argv[])
+{
+  bool forceTranscode = argc > 1 && atoi(argv[1]) != 0;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned int threads = argc > 2 ? atoi(argv[2]) : (cpus > 0 ? cpus : 1);
+
+  std::vector<std::string> paths;
+  for (int i = 3; i < argc && (int)paths.size() < MAX_TEXTURES; i++)
+    paths.push_back(argv[i]);
+  bool defaults = paths.empty();
+  const char *defaultFormats[MAX_TEXTURES] = { "bc1", "bc3", "bc7", "rgba8" };
+  if (defaults)
+    for (int i = 0; i < MAX_TEXTURES; i++)
+      paths.push_back(std::string("textures/") + defaultFormats[i] + ".ktx2");
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "KTX2 Textures", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  // test files, written once (what ktx_make does)
+  if (defaults) {
+    mkdir("textures", 0755);
+    Image image = makeTestImage();
+    std::vector<Image> levels;
+    for (int i = 0; i < MAX_TEXTURES; i++) {
+      FILE *file = fopen(paths[i].c_str(), "rb");
+      if (file != NULL) {
+        fclose(file);
+        continue;
+      }
+      if (levels.empty()) {
+        Image copy = image;
+        buildMips(copy, levels);
+      }
+      writeKtx2(paths[i].c_str(), ktxFormatByName(defaultFormats[i]), levels);
+    }
+  }
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // textures
+  std::vector<GLuint> textures;
+  size_t textureBytes = 0, rgbaBytes = 0;
+  for (size_t i = 0; i < paths.size(); i++) {
+    Ktx2File file;
+    KtxUpload info;
+    GLuint texture = 0;
+    if (file.open(paths[i].c_str()))
+      texture = uploadKtx2(file, forceTranscode, threads, &info);
+    if (texture == 0)
+      continue;
+    textures.push_back(texture);
+    textureBytes += info.textureBytes;
+    rgbaBytes += info.rgbaBytes;
+    std::cout << paths[i] << ": " << file.format->name << " " << file.width << "x" << file.height
+              << ", " << file.levels.size() << " levels, "
+              << (info.transcoded ? "transcoded" : "native") << ", "
+              << info.textureBytes / 1024 << " KB (RGBA8 " << info.rgbaBytes / 1024 << " KB), ";
+    if (info.transcoded)
+      std::cout << "transcode " << info.transcodeMs << " ms on " << threads << " threads, ";
+    std::cout << "upload " << info.uploadMs << " ms" << std::endl;
+  }
+  if (textures.empty())
+    return -1;
+  std::cout << "video memory: " << textureBytes / 1024 << " KB, "
+            << (float)rgbaBytes / textureBytes << "x less than RGBA8" << std::endl;
+
+  // 2x2 quads, one per texture (x y u v)
+  float quadVertices[MAX_TEXTURES * 4 * 4];
+  GLuint quadIndices[MAX_TEXTURES * 6];
+  for (int i = 0; i < MAX_TEXTURES; i++) {
+    float x0 = (i % 2) ? 0.02f : -0.95f, y0 = (i < 2) ? 0.02f : -0.95f;
+    float x1 = x0 + 0.93f, y1 = y0 + 0.93f;
+    float quad[16] = {
+      x0, y0, 0.0f, 0.0f,
+      x1, y0, 1.0f, 0.0f,
+      x1, y1, 1.0f, 1.0f,
+      x0, y1, 0.0f, 1.0f
+    };
+    std::copy(quad, quad + 16, quadVertices + i * 16);
+    GLuint indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; k++)
+      quadIndices[i * 6 + k] = i * 4 + indices[k];
+  }
+
+  GLuint quadVAO, quadVBO, quadEBO;
+  glGenVertexArrays(1, &quadVAO);
+  glGenBuffers(1, &quadVBO);
+  glGenBuffers(1, &quadEBO);
+
+  glBindVertexArray(quadVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, quadVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)(2*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  ourShader.use();
+  ourShader.setInt("image", 0);
+
+  glEnable(GL_BLEND);
+  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    ourShader.use();
+    glBindVertexArray(quadVAO);
+    for (size_t i = 0; i < textures.size(); i++) {
+      glBindTexture(GL_TEXTURE_2D, textures[i]);
+      glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)(i * 6 * sizeof(GLuint)));
+    }
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  glDeleteTextures(textures.size(), &textures[0]);
+  glDeleteBuffers(1, &quadEBO);
+  glDeleteBuffers(1, &quadVBO);
+  glDeleteVertexArrays(1, &quadVAO);
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,191 @@
+#include "image.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+
+Image::Image()
+  : width(0), height(0)
+{
+}
+
+Image::Image(int width, int height)
+  : width(width), height(height), pixels((size_t)width * height * 4)
+{
+}
+
+// TGA header fields used here
+#define TGA_HEADER_SIZE 18
+#define TGA_TRUE_COLOR 2
+#define TGA_GRAY 3
+#define TGA_RLE 8
+#define TGA_TOP_LEFT 0x20
+
+bool Image::readTGA(const char* path)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    std::cout << "ERROR::IMAGE::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+    return false;
+  }
+  std::vector<unsigned char> data;
+  unsigned char buffer[65536];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    data.insert(data.end(), buffer, buffer + n);
+  fclose(file);
+
+  if (data.size() < TGA_HEADER_SIZE) {
+    std::cout << "ERROR::IMAGE::BAD_TGA " << path << std::endl;
+    return false;
+  }
+  const unsigned char *header = &data[0];
+  int idLength = header[0];
+  int colorMap = header[1];
+  int type = header[2];
+  int w = header[12] | (header[13] << 8);
+  int h = header[14] | (header[15] << 8);
+  int bpp = header[16] / 8;
+  bool topLeft = (header[17] & TGA_TOP_LEFT) != 0;
+
+  bool rle = (type & TGA_RLE) != 0;
+  int base = type & ~TGA_RLE;
+  bool supported = colorMap == 0 && w > 0 && h > 0 &&
+    ((base == TGA_TRUE_COLOR && (bpp == 3 || bpp == 4)) || (base == TGA_GRAY && bpp == 1));
+  if (!supported) {
+    std::cout << "ERROR::IMAGE::UNSUPPORTED_TGA " << path << std::endl;
+    return false;
+  }
+
+  this->width = w;
+  this->height = h;
+  this->pixels.assign((size_t)w * h * 4, 255);
+
+  const unsigned char *in = header + TGA_HEADER_SIZE + idLength;
+  const unsigned char *end = &data[0] + data.size();
+  size_t count = (size_t)w * h;
+  size_t i = 0;
+  while (i < count) {
+    // a packet: n pixels, repeated (RLE run) or stored one after the other
+    size_t n = 1;
+    bool run = false;
+    if (rle) {
+      if (in >= end) break;
+      n = (*in & 0x7f) + 1;
+      run = (*in & 0x80) != 0;
+      in++;
+    }
+    for (size_t k = 0; k < n && i < count; k++, i++) {
+      if (in + bpp > end) {
+        i = count + 1;
+        break;
+      }
+      // BGR(A) / gray to RGBA, flipped to bottom-up if stored top-down
+      size_t x = i % w, y = i / w;
+      if (topLeft) y = h - 1 - y;
+      unsigned char *out = &this->pixels[(y * w + x) * 4];
+      if (bpp == 1) {
+        out[0] = out[1] = out[2] = in[0];
+      } else {
+        out[0] = in[2];
+        out[1] = in[1];
+        out[2] = in[0];
+        if (bpp == 4) out[3] = in[3];
+      }
+      if (!run || k == n - 1) in += bpp;
+    }
+  }
+  if (i != count) {
+    std::cout << "ERROR::IMAGE::TRUNCATED_TGA " << path << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool Image::writeTGA(const char* path) const
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    std::cout << "ERROR::IMAGE::CANNOT_WRITE " << path << std::endl;
+    return false;
+  }
+  unsigned char header[TGA_HEADER_SIZE];
+  memset(header, 0, sizeof(header));
+  header[2] = TGA_TRUE_COLOR | TGA_RLE;
+  header[12] = this->width & 0xff;
+  header[13] = this->width >> 8;
+  header[14] = this->height & 0xff;
+  header[15] = this->height >> 8;
+  header[16] = 32;
+  header[17] = 8;   // alpha bits, bottom-up rows
+  fwrite(header, 1, sizeof(header), file);
+
+  std::vector<unsigned char> out;
+  size_t count = (size_t)this->width * this->height;
+  const unsigned char *p = this->pixels.empty() ? NULL : &this->pixels[0];
+  size_t i = 0;
+  while (i < count) {
+    // run of identical pixels (rows can be crossed), else a raw packet
+    size_t run = 1;
+    while (i + run < count && run < 128 && memcmp(p + i * 4, p + (i + run) * 4, 4) == 0)
+      run++;
+    if (run > 1) {
+      out.push_back(0x80 | (run - 1));
+      out.push_back(p[i * 4 + 2]);
+      out.push_back(p[i * 4 + 1]);
+      out.push_back(p[i * 4]);
+      out.push_back(p[i * 4 + 3]);
+      i += run;
+      continue;
+    }
+    size_t raw = 1;
+    while (i + raw < count && raw < 128 &&
+           (i + raw + 1 >= count || memcmp(p + (i + raw) * 4, p + (i + raw + 1) * 4, 4) != 0))
+      raw++;
+    out.push_back(raw - 1);
+    for (size_t k = i; k < i + raw; k++) {
+      out.push_back(p[k * 4 + 2]);
+      out.push_back(p[k * 4 + 1]);
+      out.push_back(p[k * 4]);
+      out.push_back(p[k * 4 + 3]);
+    }
+    i += raw;
+  }
+  bool ok = out.empty() || fwrite(&out[0], 1, out.size(), file) == out.size();
+  fclose(file);
+  return ok;
+}
+
+Image Image::half() const
+{
+  int w = this->width > 1 ? this->width / 2 : 1;
+  int h = this->height > 1 ? this->height / 2 : 1;
+  Image result(w, h);
+  for (int y = 0; y < h; y++) {
+    int y0 = this->height > 1 ? y * 2 : 0;
+    int y1 = this->height > 1 ? y0 + 1 : 0;
+    for (int x = 0; x < w; x++) {
+      int x0 = this->width > 1 ? x * 2 : 0;
+      int x1 = this->width > 1 ? x0 + 1 : 0;
+      const unsigned char *a = &this->pixels[((size_t)y0 * this->width + x0) * 4];
+      const unsigned char *b = &this->pixels[((size_t)y0 * this->width + x1) * 4];
+      const unsigned char *c = &this->pixels[((size_t)y1 * this->width + x0) * 4];
+      const unsigned char *d = &this->pixels[((size_t)y1 * this->width + x1) * 4];
+      unsigned char *out = &result.pixels[((size_t)y * w + x) * 4];
+      for (int k = 0; k < 4; k++)
+        out[k] = (a[k] + b[k] + c[k] + d[k] + 2) / 4;
+    }
+  }
+  return result;
+}
+
+void buildMips(Image &image, std::vector<Image> &levels)
+{
+  levels.clear();
+  levels.push_back(Image());
+  levels.back().width = image.width;
+  levels.back().height = image.height;
+  levels.back().pixels.swap(image.pixels);
+  while (levels.back().width > 1 || levels.back().height > 1)
+    levels.push_back(levels.back().half());
+}
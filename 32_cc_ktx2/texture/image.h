@@ -0,0 +1,28 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include <vector>
+
+// RGBA8 image, rows bottom to top (the GL order), no GL calls
+struct Image
+{
+  int width;
+  int height;
+  std::vector<unsigned char> pixels;
+
+  Image();
+  Image(int width, int height);
+
+  // TGA: true color 24/32 bits or grayscale 8 bits, raw or RLE
+  bool readTGA(const char* path);
+  // 32 bits RLE
+  bool writeTGA(const char* path) const;
+
+  // next mip level: 2x2 box filter, odd sizes round down (at least 1)
+  Image half() const;
+};
+
+// the image and its mip chain down to 1x1, level 0 first
+void buildMips(Image &image, std::vector<Image> &levels);
+
+#endif
@@ -0,0 +1,326 @@
+// bench_sprites.cc
+
+// sprite throughput benchmark (headless):
+// quads/sec for N rotating sprites per frame drawn
+// - per_quad:      uniforms + one glDrawElements per quad (07_cc_EBO /
+//                  09_cc_Uniform style), timed on a subset of the quads
+// - batch_scalar:  SpriteBatch, scalar corner transform
+// - batch_sse:     SpriteBatch, SSE corner transform
+// cpu is the time to issue the frame, frame adds glFinish
+// usage: bench_sprites [quads per frame] [frames]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "batch.h"
+
+#define WINDOW_SIZE 64          // tiny framebuffer: measure submission, not fill rate
+#define PER_QUAD_LIMIT 20000    // per_quad frames draw at most this many
+#define LAYERS 4
+
+static const char* batchVertexShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec2 aPos;\n"
+  "layout (location = 1) in vec3 aTexCoord;\n"
+  "layout (location = 2) in vec4 aColor;\n"
+  "uniform vec2 screen;\n"
+  "out vec3 texCoord;\n"
+  "out vec4 color;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = vec4(aPos / screen * 2.0f - 1.0f, 0.0f, 1.0f);\n"
+  "  texCoord = aTexCoord;\n"
+  "  color = aColor;\n"
+  "}\n";
+
+// the unit square of 07_cc_EBO placed by uniforms
+static const char* quadVertexShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec2 aCorner;\n"
+  "uniform vec2 screen;\n"
+  "uniform vec4 rect;\n"
+  "uniform float rotation;\n"
+  "uniform vec4 uv;\n"
+  "uniform float layer;\n"
+  "uniform vec4 tint;\n"
+  "out vec3 texCoord;\n"
+  "out vec4 color;\n"
+  "void main()\n"
+  "{\n"
+  "  vec2 o = aCorner * rect.zw;\n"
+  "  float c = cos(rotation), s = sin(rotation);\n"
+  "  vec2 p = rect.xy + vec2(o.x * c - o.y * s, o.x * s + o.y * c);\n"
+  "  gl_Position = vec4(p / screen * 2.0f - 1.0f, 0.0f, 1.0f);\n"
+  "  texCoord = vec3(mix(uv.xy, uv.zw, aCorner + 0.5f), layer);\n"
+  "  color = tint;\n"
+  "}\n";
+
+static const char* fragmentShaderSource = "#version 330 core\n"
+  "in vec3 texCoord;\n"
+  "in vec4 color;\n"
+  "out vec4 FragColor;\n"
+  "uniform sampler2DArray sprites;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = texture(sprites, texCoord) * color;\n"
+  "}\n";
+
+static GLuint compileProgram(const char* vertexSource, const char* fragmentSource)
+{
+  int success;
+  char infoLog[512];
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &vertexSource, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &fragmentSource, NULL);
+  glCompileShader(fragment);
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  glAttachShader(program, fragment);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+// LAYERS solid 4x4 layers
+static GLuint createTextureArray()
+{
+  std::vector<unsigned char> texels(4 * 4 * 4 * LAYERS);
+  for (size_t i = 0; i < texels.size(); i += 4) {
+    int layer = i / (4 * 4 * 4);
+    texels[i] = layer & 1 ? 255 : 64;
+    texels[i + 1] = layer & 2 ? 255 : 64;
+    texels[i + 2] = 128;
+    texels[i + 3] = 255;
+  }
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+  glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, 4, 4, LAYERS, 0, GL_RGBA, GL_UNSIGNED_BYTE, &texels[0]);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+  return texture;
+}
+
+static void animate(std::vector<Sprite> &sprites, unsigned int frame)
+{
+  for (size_t i = 0; i < sprites.size(); i++)
+    sprites[i].rotation = (i % 7) * 0.1f + frame * 0.05f;
+}
+
+struct Result
+{
+  double quadsPerSecond;
+  double cpuMs;      // per frame
+  double frameMs;
+  unsigned int draws;
+};
+
+static Result runBatch(SpriteBatch &batch, std::vector<Sprite> &sprites, unsigned int frames)
+{
+  Result result = { 0.0, 0.0, 0.0, 0 };
+  double start = glfwGetTime();
+  double cpu = 0.0;
+  for (unsigned int f = 0; f < frames; f++) {
+    animate(sprites, f);
+    double issue = glfwGetTime();
+    batch.begin();
+    batch.draw(&sprites[0], sprites.size());
+    batch.end();
+    cpu += glfwGetTime() - issue;
+    glFinish();
+  }
+  double elapsed = glfwGetTime() - start;
+  result.quadsPerSecond = (double)sprites.size() * frames / elapsed;
+  result.cpuMs = cpu / frames * 1000.0;
+  result.frameMs = elapsed / frames * 1000.0;
+  result.draws = batch.drawCalls();
+  return result;
+}
+
+static Result runPerQuad(GLuint program, std::vector<Sprite> &sprites, unsigned int frames)
+{
+  // 07_cc_EBO: a square from squareVertices / squareIndices
+  float squareVertices[] = {
+    -0.5f, -0.5f,
+     0.5f, -0.5f,
+     0.5f,  0.5f,
+    -0.5f,  0.5f
+  };
+  GLuint squareIndices[] = {
+    0, 1, 2,
+    0, 2, 3
+  };
+  GLuint squareVAO, squareVBO, squareEBO;
+  glGenVertexArrays(1, &squareVAO);
+  glGenBuffers(1, &squareVBO);
+  glGenBuffers(1, &squareEBO);
+  glBindVertexArray(squareVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, squareVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(squareVertices), squareVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, squareEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(squareIndices), squareIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+
+  GLint rect = glGetUniformLocation(program, "rect");
+  GLint rotation = glGetUniformLocation(program, "rotation");
+  GLint uv = glGetUniformLocation(program, "uv");
+  GLint layer = glGetUniformLocation(program, "layer");
+  GLint tint = glGetUniformLocation(program, "tint");
+
+  size_t count = std::min<size_t>(sprites.size(), PER_QUAD_LIMIT);
+  Result result = { 0.0, 0.0, 0.0, 0 };
+  double start = glfwGetTime();
+  double cpu = 0.0;
+  for (unsigned int f = 0; f < frames; f++) {
+    animate(sprites, f);
+    double issue = glfwGetTime();
+    for (size_t i = 0; i < count; i++) {
+      const Sprite &s = sprites[i];
+      glUniform4f(rect, s.x, s.y, s.width, s.height);
+      glUniform1f(rotation, s.rotation);
+      glUniform4f(uv, s.u0, s.v0, s.u1, s.v1);
+      glUniform1f(layer, s.layer);
+      glUniform4f(tint, (s.color & 0xff) / 255.0f, ((s.color >> 8) & 0xff) / 255.0f,
+                  ((s.color >> 16) & 0xff) / 255.0f, (s.color >> 24) / 255.0f);
+      glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+    }
+    cpu += glfwGetTime() - issue;
+    glFinish();
+  }
+  double elapsed = glfwGetTime() - start;
+  result.quadsPerSecond = (double)count * frames / elapsed;
+  result.cpuMs = cpu / frames * 1000.0 * sprites.size() / count;
+  result.frameMs = elapsed / frames * 1000.0 * sprites.size() / count;
+  result.draws = sprites.size();
+
+  glBindVertexArray(0);
+  glDeleteBuffers(1, &squareEBO);
+  glDeleteBuffers(1, &squareVBO);
+  glDeleteVertexArrays(1, &squareVAO);
+  return result;
+}
+
+static void print(const char* name, const Result &r)
+{
+  std::cout << std::setw(14) << name
+            << std::fixed << std::setprecision(2)
+            << std::setw(12) << r.quadsPerSecond / 1e6
+            << std::setw(10) << r.cpuMs
+            << std::setw(10) << r.frameMs
+            << std::setw(8) << r.draws << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int quads = argc > 1 ? atoi(argv[1]) : 100000;
+  unsigned int frames = argc > 2 ? atoi(argv[2]) : 20;
+  if (quads < 1) quads = 1;
+  if (frames < 1) frames = 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(WINDOW_SIZE, WINDOW_SIZE, "bench_sprites", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+  glViewport(0, 0, WINDOW_SIZE, WINDOW_SIZE);
+
+  GLuint texture = createTextureArray();
+  GLuint batchProgram = compileProgram(batchVertexShaderSource, fragmentShaderSource);
+  GLuint quadProgram = compileProgram(quadVertexShaderSource, fragmentShaderSource);
+  GLuint programs[2] = { batchProgram, quadProgram };
+  for (int i = 0; i < 2; i++) {
+    glUseProgram(programs[i]);
+    glUniform2f(glGetUniformLocation(programs[i], "screen"), WINDOW_SIZE, WINDOW_SIZE);
+    glUniform1i(glGetUniformLocation(programs[i], "sprites"), 0);
+  }
+
+  std::vector<Sprite> sprites(quads);
+  srand(1);
+  for (size_t i = 0; i < sprites.size(); i++) {
+    Sprite &s = sprites[i];
+    s.x = (rand() % 1000) / 1000.0f * WINDOW_SIZE;
+    s.y = (rand() % 1000) / 1000.0f * WINDOW_SIZE;
+    s.width = s.height = 1.0f + (rand() % 3);
+    s.rotation = 0.0f;
+    s.u0 = s.v0 = 0.0f;
+    s.u1 = s.v1 = 1.0f;
+    s.layer = rand() % LAYERS;
+    s.color = 0xff000000u | (rand() & 0xffffff);
+  }
+
+  std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+  std::cout << quads << " quads per frame, " << frames << " frames, times in ms per frame" << std::endl;
+  std::cout << "      strategy     Mquads/s       cpu     frame   draws" << std::endl;
+
+  glUseProgram(quadProgram);
+  print("per_quad", runPerQuad(quadProgram, sprites, frames));
+
+  glUseProgram(batchProgram);
+  {
+    SpriteBatch batch;
+    batch.setSimd(false);
+    runBatch(batch, sprites, 1);
+    print("batch_scalar", runBatch(batch, sprites, frames));
+    if (SpriteBatch::simdAvailable()) {
+      batch.setSimd(true);
+      print("batch_sse", runBatch(batch, sprites, frames));
+    } else {
+      std::cout << std::setw(14) << "batch_sse" << "  not available" << std::endl;
+    }
+  }
+
+  glDeleteProgram(quadProgram);
+  glDeleteProgram(batchProgram);
+  glDeleteTextures(1, &texture);
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,195 @@
+// main.cc
+
+// sprite batching: 100k rotating, tinted sprites from a 4 layer array
+// texture written into a streaming VBO and drawn with one draw call
+// per 16k quads, instead of the one glDrawElements per square of
+// 07_cc_EBO; quads/sec and draws per frame are printed every second
+// usage: ./main [sprites] [simd]
+//   simd 0: scalar corner transform
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "batch.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+#define LAYERS 4
+#define LAYER_SIZE 32
+
+// white disc, square, diamond and ring with soft edges; tinted per sprite
+static GLuint createSpriteTextures()
+{
+  std::vector<unsigned char> texels(LAYER_SIZE * LAYER_SIZE * 4 * LAYERS);
+  for (int layer = 0; layer < LAYERS; layer++) {
+    for (int y = 0; y < LAYER_SIZE; y++) {
+      for (int x = 0; x < LAYER_SIZE; x++) {
+        float u = (x + 0.5f) / LAYER_SIZE * 2.0f - 1.0f, v = (y + 0.5f) / LAYER_SIZE * 2.0f - 1.0f;
+        float d;
+        switch (layer) {
+          case 0: d = sqrt(u * u + v * v); break;
+          case 1: d = std::max(fabs(u), fabs(v)); break;
+          case 2: d = fabs(u) + fabs(v); break;
+          default: d = fabs(sqrt(u * u + v * v) - 0.6f) + 0.6f; break;
+        }
+        unsigned char *p = &texels[((layer * LAYER_SIZE + y) * LAYER_SIZE + x) * 4];
+        p[0] = p[1] = p[2] = 255;
+        p[3] = (unsigned char)(std::min(1.0f, std::max(0.0f, (1.0f - d) * 8.0f)) * 255.0f);
+      }
+    }
+  }
+  GLuint texture;
+  glGenTextures(1, &texture);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+  glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, LAYER_SIZE, LAYER_SIZE, LAYERS, 0,
+               GL_RGBA, GL_UNSIGNED_BYTE, &texels[0]);
+  glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+  glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+  return texture;
+}
+
+int main(int argc, char* argv[])
+{
+  unsigned int count = argc > 1 ? atoi(argv[1]) : 100000;
+  bool simd = argc > 2 ? atoi(argv[2]) != 0 : true;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Sprite Batch", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+  ourShader.use();
+  ourShader.setInt("sprites", 0);
+  GLint screenLocation = glGetUniformLocation(ourShader.ID, "screen");
+
+  GLuint spriteTexture = createSpriteTextures();
+
+  // sprites and their motion
+  std::vector<Sprite> sprites(count);
+  std::vector<float> velocities(count * 3);
+  srand(1);
+  for (size_t i = 0; i < sprites.size(); i++) {
+    Sprite &s = sprites[i];
+    s.x = rand() % SCREEN_WIDTH;
+    s.y = rand() % SCREEN_HEIGHT;
+    s.width = s.height = 4.0f + rand() % 9;
+    s.rotation = (rand() % 628) / 100.0f;
+    s.u0 = s.v0 = 0.0f;
+    s.u1 = s.v1 = 1.0f;
+    s.layer = rand() % LAYERS;
+    s.color = 0xff000000u | (rand() & 0xffffff);
+    velocities[i * 3] = (rand() % 200 - 100) * 0.5f;
+    velocities[i * 3 + 1] = (rand() % 200 - 100) * 0.5f;
+    velocities[i * 3 + 2] = (rand() % 200 - 100) * 0.02f;
+  }
+
+  {
+    SpriteBatch batch;
+    batch.setSimd(simd);
+    std::cout << count << " sprites, " << (simd && SpriteBatch::simdAvailable() ? "SSE" : "scalar")
+              << " corner transform" << std::endl;
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    double lastFrame = glfwGetTime();
+    double lastReport = lastFrame;
+    unsigned long quads = 0;
+
+    // game loop
+    while(!glfwWindowShouldClose(window))
+    {
+      processInput(window);
+
+      double now = glfwGetTime();
+      float dt = now - lastFrame;
+      lastFrame = now;
+      int width, height;
+      glfwGetFramebufferSize(window, &width, &height);
+      for (size_t i = 0; i < sprites.size(); i++) {
+        Sprite &s = sprites[i];
+        s.x = fmod(s.x + velocities[i * 3] * dt + width, (float)width);
+        s.y = fmod(s.y + velocities[i * 3 + 1] * dt + height, (float)height);
+        s.rotation += velocities[i * 3 + 2] * dt;
+      }
+
+      // set the color buffer
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
+
+      ourShader.use();
+      glUniform2f(screenLocation, width, height);
+      glBindTexture(GL_TEXTURE_2D_ARRAY, spriteTexture);
+      batch.begin();
+      batch.draw(&sprites[0], sprites.size());
+      batch.end();
+      quads += batch.quads();
+
+      if (now - lastReport >= 1.0) {
+        std::cout << quads / (now - lastReport) / 1e6 << " Mquads/s, "
+                  << batch.drawCalls() << " draws per frame" << std::endl;
+        quads = 0;
+        lastReport = now;
+      }
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  glDeleteTextures(1, &spriteTexture);
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,12 @@
+#version 330 core
+
+in vec3 texCoord;
+in vec4 color;
+out vec4 FragColor;
+
+uniform sampler2DArray sprites;
+
+void main()
+{
+  FragColor = texture(sprites, texCoord) * color;
+}
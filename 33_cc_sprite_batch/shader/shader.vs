@@ -0,0 +1,17 @@
+#version 330 core
+
+layout (location = 0) in vec2 aPos;         // pixels
+layout (location = 1) in vec3 aTexCoord;    // u, v, layer
+layout (location = 2) in vec4 aColor;
+
+out vec3 texCoord;
+out vec4 color;
+
+uniform vec2 screen;
+
+void main()
+{
+  gl_Position = vec4(aPos / screen * 2.0f - 1.0f, 0.0f, 1.0f);
+  texCoord = aTexCoord;
+  color = aColor;
+}
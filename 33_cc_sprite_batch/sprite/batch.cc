@@ -0,0 +1,213 @@
+#include "batch.h"
+
+#include <math.h>
+#include <string.h>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+#define POSITION_BYTES (2 * sizeof(float))
+#define ATTRIBUTE_BYTES (4 * sizeof(float))
+#define MAX_BATCH_QUADS 16384
+
+SpriteBatch::SpriteBatch(unsigned int batchQuads, unsigned int regions)
+  : batchQuads(batchQuads), regions(regions), region(0), positions(NULL), attributes(NULL),
+    count(0), mapped(false), simd(simdAvailable()), draws(0), total(0)
+{
+  if (this->batchQuads < 1) this->batchQuads = 1;
+  if (this->batchQuads > MAX_BATCH_QUADS) this->batchQuads = MAX_BATCH_QUADS;
+  if (this->regions < 1) this->regions = 1;
+  this->fences.assign(this->regions, (GLsync)NULL);
+
+  // the same six indices per quad for every batch, base vertex picks the region
+  std::vector<GLushort> indices(this->batchQuads * 6);
+  for (unsigned int i = 0; i < this->batchQuads; i++) {
+    GLushort quad[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int k = 0; k < 6; k++)
+      indices[i * 6 + k] = i * 4 + quad[k];
+  }
+
+  GLsizeiptr vertices = (GLsizeiptr)this->regions * this->batchQuads * 4;
+  glGenVertexArrays(1, &this->VAO);
+  glGenBuffers(1, &this->positionVBO);
+  glGenBuffers(1, &this->attributeVBO);
+  glGenBuffers(1, &this->EBO);
+
+  glBindVertexArray(this->VAO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), &indices[0], GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, this->positionVBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices * POSITION_BYTES, NULL, GL_STREAM_DRAW);
+  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, POSITION_BYTES, (void*)0);
+  glBindBuffer(GL_ARRAY_BUFFER, this->attributeVBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices * ATTRIBUTE_BYTES, NULL, GL_STREAM_DRAW);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, ATTRIBUTE_BYTES, (void*)0);
+  glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, ATTRIBUTE_BYTES, (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glEnableVertexAttribArray(2);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+}
+
+SpriteBatch::~SpriteBatch()
+{
+  if (this->mapped) {
+    glBindBuffer(GL_ARRAY_BUFFER, this->positionVBO);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, this->attributeVBO);
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+  for (size_t i = 0; i < this->fences.size(); i++)
+    if (this->fences[i] != NULL)
+      glDeleteSync(this->fences[i]);
+  glDeleteBuffers(1, &this->EBO);
+  glDeleteBuffers(1, &this->attributeVBO);
+  glDeleteBuffers(1, &this->positionVBO);
+  glDeleteVertexArrays(1, &this->VAO);
+}
+
+bool SpriteBatch::simdAvailable()
+{
+#ifdef __SSE__
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SpriteBatch::setSimd(bool simd)
+{
+  this->simd = simd && simdAvailable();
+}
+
+// map the current region of both buffers; waits only if the GPU still
+// reads it from the previous lap
+void SpriteBatch::map()
+{
+  GLsync &fence = this->fences[this->region];
+  if (fence != NULL) {
+    glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    glDeleteSync(fence);
+    fence = NULL;
+  }
+  GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+  GLintptr first = (GLintptr)this->region * this->batchQuads * 4;
+  GLsizeiptr vertices = (GLsizeiptr)this->batchQuads * 4;
+  glBindBuffer(GL_ARRAY_BUFFER, this->positionVBO);
+  this->positions = (float*)glMapBufferRange(GL_ARRAY_BUFFER, first * POSITION_BYTES,
+                                             vertices * POSITION_BYTES, access);
+  glBindBuffer(GL_ARRAY_BUFFER, this->attributeVBO);
+  this->attributes = (float*)glMapBufferRange(GL_ARRAY_BUFFER, first * ATTRIBUTE_BYTES,
+                                              vertices * ATTRIBUTE_BYTES, access);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  this->mapped = true;
+  this->count = 0;
+}
+
+// unmap, draw what was written, fence the region and move to the next
+void SpriteBatch::flush()
+{
+  if (!this->mapped) return;
+  glBindBuffer(GL_ARRAY_BUFFER, this->positionVBO);
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, this->attributeVBO);
+  glUnmapBuffer(GL_ARRAY_BUFFER);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  this->mapped = false;
+  if (this->count == 0) return;
+
+  glBindVertexArray(this->VAO);
+  glDrawElementsBaseVertex(GL_TRIANGLES, this->count * 6, GL_UNSIGNED_SHORT, (void*)0,
+                           this->region * this->batchQuads * 4);
+  glBindVertexArray(0);
+  this->fences[this->region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  this->draws++;
+  this->region = (this->region + 1) % this->regions;
+  this->count = 0;
+}
+
+void SpriteBatch::begin()
+{
+  this->draws = 0;
+  this->total = 0;
+  this->map();
+}
+
+void SpriteBatch::end()
+{
+  this->flush();
+}
+
+void SpriteBatch::draw(const Sprite &sprite)
+{
+  this->draw(&sprite, 1);
+}
+
+void SpriteBatch::draw(const Sprite *sprites, unsigned int count)
+{
+  for (unsigned int i = 0; i < count; i++) {
+    if (this->count == this->batchQuads) {
+      this->flush();
+      this->map();
+    }
+    const Sprite &s = sprites[i];
+    float c = 1.0f, sn = 0.0f;
+    if (s.rotation != 0.0f) {
+      c = cosf(s.rotation);
+      sn = sinf(s.rotation);
+    }
+    float hw = s.width * 0.5f, hh = s.height * 0.5f;
+    float *p = this->positions + this->count * 8;
+
+    // corners counterclockwise from bottom left
+#ifdef __SSE__
+    if (this->simd) {
+      __m128 ox = _mm_mul_ps(_mm_set1_ps(hw), _mm_set_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+      __m128 oy = _mm_mul_ps(_mm_set1_ps(hh), _mm_set_ps(1.0f, 1.0f, -1.0f, -1.0f));
+      __m128 vc = _mm_set1_ps(c), vs = _mm_set1_ps(sn);
+      __m128 xs = _mm_add_ps(_mm_set1_ps(s.x), _mm_sub_ps(_mm_mul_ps(ox, vc), _mm_mul_ps(oy, vs)));
+      __m128 ys = _mm_add_ps(_mm_set1_ps(s.y), _mm_add_ps(_mm_mul_ps(ox, vs), _mm_mul_ps(oy, vc)));
+      _mm_storeu_ps(p, _mm_unpacklo_ps(xs, ys));
+      _mm_storeu_ps(p + 4, _mm_unpackhi_ps(xs, ys));
+
+      float color;
+      memcpy(&color, &s.color, sizeof(color));
+      float *a = this->attributes + this->count * 16;
+      _mm_storeu_ps(a, _mm_set_ps(color, s.layer, s.v0, s.u0));
+      _mm_storeu_ps(a + 4, _mm_set_ps(color, s.layer, s.v0, s.u1));
+      _mm_storeu_ps(a + 8, _mm_set_ps(color, s.layer, s.v1, s.u1));
+      _mm_storeu_ps(a + 12, _mm_set_ps(color, s.layer, s.v1, s.u0));
+      this->count++;
+      continue;
+    }
+#endif
+    const float ox[4] = { -hw, hw, hw, -hw };
+    const float oy[4] = { -hh, -hh, hh, hh };
+    const float u[4] = { s.u0, s.u1, s.u1, s.u0 };
+    const float v[4] = { s.v0, s.v0, s.v1, s.v1 };
+    float *a = this->attributes + this->count * 16;
+    for (int k = 0; k < 4; k++) {
+      p[k * 2] = s.x + ox[k] * c - oy[k] * sn;
+      p[k * 2 + 1] = s.y + ox[k] * sn + oy[k] * c;
+      a[k * 4] = u[k];
+      a[k * 4 + 1] = v[k];
+      a[k * 4 + 2] = s.layer;
+      memcpy(&a[k * 4 + 3], &s.color, sizeof(float));
+    }
+    this->count++;
+  }
+  this->total += count;
+}
+
+unsigned int SpriteBatch::drawCalls() const
+{
+  return this->draws;
+}
+
+unsigned long SpriteBatch::quads() const
+{
+  return this->total;
+}
@@ -0,0 +1,77 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+// a textured, tinted, rotated quad in pixels
+struct Sprite
+{
+  float x, y;              // center
+  float width, height;
+  float rotation;          // radians, counterclockwise
+  float u0, v0, u1, v1;    // texture rectangle on the layer
+  float layer;             // layer of the bound array texture
+  unsigned int color;      // RGBA8 (R in the low byte) times the texel
+};
+
+// sprite batcher: quads are transformed on the CPU (four corners at
+// once with SSE when compiled in) and written straight into a mapped
+// streaming VBO; one static index buffer serves every batch, sprites
+// pick their texture by array layer, so a batch is flushed with one
+// glDrawElementsBaseVertex only when it is full or at end()
+//
+// the VBOs are a ring of regions of batchQuads quads, each mapped
+// unsynchronized and fenced after its draw: the CPU only waits for the
+// GPU when it laps the ring
+//
+// vertex attributes: 0 position (vec2, pixels), 1 texture (vec3: u, v,
+// layer), 2 color (vec4, normalized bytes); the caller binds the
+// program, the array texture and the viewport
+class SpriteBatch
+{
+  public:
+    // batchQuads up to 16384 (16 bit indices)
+    SpriteBatch(unsigned int batchQuads = 16384, unsigned int regions = 3);
+    ~SpriteBatch();
+
+    void begin();
+    void draw(const Sprite &sprite);
+    void draw(const Sprite *sprites, unsigned int count);
+    void end();
+
+    // SSE corner transform (default when available)
+    void setSimd(bool simd);
+    static bool simdAvailable();
+
+    // since the last begin()
+    unsigned int drawCalls() const;
+    unsigned long quads() const;
+
+  private:
+    SpriteBatch(const SpriteBatch&);
+    SpriteBatch& operator=(const SpriteBatch&);
+
+    void map();
+    void flush();
+
+    GLuint VAO, EBO;
+    GLuint positionVBO;        // x y per vertex
+    GLuint attributeVBO;       // u v layer color per vertex
+    unsigned int batchQuads;
+    unsigned int regions;
+    std::vector<GLsync> fences;
+
+    unsigned int region;       // region being filled
+    float *positions;          // its mapped position block
+    float *attributes;         // and attribute block
+    unsigned int count;        // quads in it
+    bool mapped;
+    bool simd;
+
+    unsigned int draws;
+    unsigned long total;
+};
+
+#endif
@@ -0,0 +1,165 @@
+// bench_particles.cc
+
+// particle benchmark (headless): per frame time to update N particles
+// (move, compact, refill) and to upload and draw them, for
+// - scalar:  ParticleSystem, scalar kernels on the job system
+// - avx2:    ParticleSystem, AVX2 kernels on the job system
+// - gpu_tf:  GpuParticleSystem, transform feedback update
+// update of gpu_tf includes a glFinish, draw always does
+// usage: bench_particles [particles] [frames] [threads]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+#include "shader.h"
+#include "jobsystem.h"
+#include "particles.h"
+#include "gpu.h"
+#include "renderer.h"
+
+#define WINDOW_SIZE 64          // tiny framebuffer: measure the particles, not fill rate
+#define FRAME_DT (1.0f / 60.0f)
+
+static const Emitter emitter = { 0.0f, -0.9f, 0.0f, { -0.4f, 1.0f, -0.4f }, { 0.4f, 1.8f, 0.4f }, 1.0f, 2.5f };
+
+struct Result
+{
+  double updateMs;    // per frame
+  double drawMs;
+  double perFrame;    // particles dying (and emitted) per frame
+};
+
+static Result runCpu(ParticleSystem &particles, ParticleRenderer &renderer, unsigned int frames)
+{
+  Result result = { 0.0, 0.0, 0.0 };
+  unsigned int count = particles.capacity();
+  double emitted = 0.0;
+  for (unsigned int f = 0; f < frames; f++) {
+    double start = glfwGetTime();
+    particles.update(FRAME_DT);
+    emitted += particles.emit(emitter, count - particles.size());
+    double updated = glfwGetTime();
+    renderer.draw(particles);
+    glFinish();
+    result.updateMs += updated - start;
+    result.drawMs += glfwGetTime() - updated;
+  }
+  result.updateMs = result.updateMs / frames * 1000.0;
+  result.drawMs = result.drawMs / frames * 1000.0;
+  result.perFrame = emitted / frames;
+  return result;
+}
+
+static Result runGpu(GpuParticleSystem &particles, ParticleRenderer &renderer, Shader &shader,
+                     unsigned int frames)
+{
+  Result result = { 0.0, 0.0, 0.0 };
+  for (unsigned int f = 0; f < frames; f++) {
+    double start = glfwGetTime();
+    particles.update(FRAME_DT);
+    glFinish();
+    double updated = glfwGetTime();
+    shader.use();
+    renderer.draw(particles);
+    glFinish();
+    result.updateMs += updated - start;
+    result.drawMs += glfwGetTime() - updated;
+  }
+  result.updateMs = result.updateMs / frames * 1000.0;
+  result.drawMs = result.drawMs / frames * 1000.0;
+  result.perFrame = -1.0;
+  return result;
+}
+
+static void print(const char* name, const Result &r)
+{
+  double total = r.updateMs + r.drawMs;
+  std::cout << std::setw(8) << name
+            << std::fixed << std::setprecision(2)
+            << std::setw(10) << r.updateMs
+            << std::setw(10) << r.drawMs
+            << std::setw(10) << total
+            << std::setw(8) << (total <= 1000.0 / 60.0 ? "yes" : "no");
+  if (r.perFrame >= 0.0)
+    std::cout << std::setprecision(0) << std::setw(10) << r.perFrame;
+  else
+    std::cout << std::setw(10) << "in place";
+  std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int count = argc > 1 ? atoi(argv[1]) : 1000000;
+  unsigned int frames = argc > 2 ? atoi(argv[2]) : 60;
+  unsigned int threads = argc > 3 ? atoi(argv[3]) : 0;
+  if (count < 1) count = 1;
+  if (frames < 1) frames = 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(WINDOW_SIZE, WINDOW_SIZE, "bench_particles", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+  glViewport(0, 0, WINDOW_SIZE, WINDOW_SIZE);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+  ourShader.use();
+  ourShader.setFloat("scale", 0.01f);
+
+  {
+    JobSystem jobs(threads);
+    ParticleRenderer renderer(count);
+
+    std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+    std::cout << count << " particles, " << frames << " frames of " << FRAME_DT * 1000.0f << " ms, "
+              << jobs.size() << " workers, times in ms per frame" << std::endl;
+    std::cout << "    mode    update      draw     total    60Hz   emitted" << std::endl;
+
+    ParticleSystem::Kernel kernels[2] = { ParticleSystem::KERNEL_SCALAR, ParticleSystem::KERNEL_AVX2 };
+    const char* names[2] = { "scalar", "avx2" };
+    for (int k = 0; k < 2; k++) {
+      if (!ParticleSystem::kernelAvailable(kernels[k])) {
+        std::cout << std::setw(8) << names[k] << "  not available" << std::endl;
+        continue;
+      }
+      ParticleSystem particles(count, &jobs);
+      particles.setKernel(kernels[k]);
+      particles.emit(emitter, count, true);
+      runCpu(particles, renderer, 2);
+      print(names[k], runCpu(particles, renderer, frames));
+    }
+
+    GpuParticleSystem gpuParticles(count, emitter);
+    runGpu(gpuParticles, renderer, ourShader, 2);
+    print("gpu_tf", runGpu(gpuParticles, renderer, ourShader, frames));
+  }
+
+  glfwTerminate();
+  return 0;
+}
@@ -0,0 +1,81 @@
+#ifndef DEQUE_H
+#define DEQUE_H
+
+// Chase-Lev work-stealing deque (fixed capacity, power of two).
+// The owner thread push()es and pop()s at the bottom (LIFO),
+// the other threads steal() from the top (FIFO).
+// Atomics are the GCC __atomic builtins (the samples build as C++98).
+template <typename T, unsigned int CAPACITY>
+class WorkStealingDeque
+{
+  public:
+    WorkStealingDeque()
+    {
+      this->top = 0;
+      this->bottom = 0;
+      for (unsigned int i = 0; i < CAPACITY; i++)
+        this->buffer[i] = 0;
+    }
+
+    // owner only, false if the deque is full
+    bool push(T *item)
+    {
+      long b = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED);
+      long t = __atomic_load_n(&this->top, __ATOMIC_ACQUIRE);
+      if (b - t >= (long)CAPACITY)
+        return false;
+      __atomic_store_n(&this->buffer[b & (CAPACITY - 1)], item, __ATOMIC_RELAXED);
+      __atomic_store_n(&this->bottom, b + 1, __ATOMIC_RELEASE);
+      return true;
+    }
+
+    // owner only, NULL if empty
+    T* pop()
+    {
+      long b = __atomic_load_n(&this->bottom, __ATOMIC_RELAXED) - 1;
+      __atomic_store_n(&this->bottom, b, __ATOMIC_RELAXED);
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      long t = __atomic_load_n(&this->top, __ATOMIC_RELAXED);
+
+      if (t > b) {
+        // empty
+        __atomic_store_n(&this->bottom, b + 1, __ATOMIC_RELAXED);
+        return 0;
+      }
+
+      T *item = __atomic_load_n(&this->buffer[b & (CAPACITY - 1)], __ATOMIC_RELAXED);
+      if (t == b) {
+        // last item: race against the thieves
+        if (!__atomic_compare_exchange_n(&this->top, &t, t + 1, false,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+          item = 0;
+        __atomic_store_n(&this->bottom, b + 1, __ATOMIC_RELAXED);
+      }
+      return item;
+    }
+
+    // any thread, NULL if empty or if another thief won
+    T* steal()
+    {
+      long t = __atomic_load_n(&this->top, __ATOMIC_ACQUIRE);
+      __atomic_thread_fence(__ATOMIC_SEQ_CST);
+      long b = __atomic_load_n(&this->bottom, __ATOMIC_ACQUIRE);
+
+      if (t >= b)
+        return 0;
+
+      T *item = __atomic_load_n(&this->buffer[t & (CAPACITY - 1)], __ATOMIC_RELAXED);
+      if (!__atomic_compare_exchange_n(&this->top, &t, t + 1, false,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        return 0;
+      return item;
+    }
+
+  private:
+    long top;
+    char padding[64];   // keep top and bottom on different cache lines
+    long bottom;
+    T *buffer[CAPACITY];
+};
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include "deque.h"
+
+#include <pthread.h>
+#include <vector>
+
+// job body: a single job gets begin = end = 0,
+// a parallelFor() job gets its [begin, end) range
+typedef void (*JobFunction)(void *data, unsigned int begin, unsigned int end);
+
+// dependency counter: incremented for each job started with it,
+// decremented when the job ends; wait() returns when it reaches 0
+struct JobCounter
+{
+  int value;
+
+  JobCounter() : value(0) {}
+};
+
+struct Job
+{
+  JobFunction function;
+  void *data;
+  unsigned int begin;
+  unsigned int end;
+  unsigned int grain;     // parallelFor: split while the range is bigger
+  JobCounter *counter;
+  int done;               // the slot can be reused
+};
+
+// Job system: a fixed pool of worker threads, each one with its own
+// Chase-Lev deque; idle workers steal from the others.
+// The thread that creates the JobSystem is worker 0: it can start jobs
+// and helps executing them while it wait()s.
+class JobSystem
+{
+  public:
+    static const unsigned int MAX_JOBS = 4096;   // per worker and per frame
+
+    // numThreads = 0: one per CPU core
+    JobSystem(unsigned int numThreads = 0);
+    ~JobSystem();
+
+    void run(JobFunction function, void *data, JobCounter *counter);
+
+    // split [0, count) in chunks of at least minChunk items;
+    // chunks are split on demand, so idle workers get work early
+    // and busy ones do not pay for many small jobs
+    void parallelFor(unsigned int count, unsigned int minChunk,
+                     JobFunction function, void *data, JobCounter *counter);
+
+    // execute jobs until the counter reaches 0
+    void wait(JobCounter *counter);
+
+    unsigned int size() const;
+
+  private:
+    struct Worker
+    {
+      JobSystem *system;
+      unsigned int index;
+      pthread_t thread;
+      WorkStealingDeque<Job, MAX_JOBS> queue;
+      Job *pool;
+      unsigned int poolIndex;
+      unsigned int random;
+    };
+
+    std::vector<Worker*> workers;
+    bool quit;
+
+    // sleeping workers
+    pthread_mutex_t mutex;
+    pthread_cond_t wakeCond;
+    int queued;
+    int sleeping;
+
+    Job* allocate(Worker *worker);
+    void push(Worker *worker, Job *job);
+    Job* find(Worker *worker);
+    void execute(Worker *worker, Job *job);
+    Worker* current();
+
+    static void* workerMain(void *arg);
+
+    // not copyable
+    JobSystem(const JobSystem&);
+    JobSystem& operator=(const JobSystem&);
+};
+
+#endif
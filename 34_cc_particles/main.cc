@@ -0,0 +1,151 @@
+// main.cc
+
+// particle system: a fountain of a million particles kept in structure
+// of arrays form, moved by AVX2 kernels running as jobs, dead particles
+// compacted away without branches and refilled by the emitter; drawn
+// with one instanced draw of the 13_cc_shader_class triangle
+// usage: ./main [particles] [mode]
+//   mode 0: scalar kernels, 1: AVX2 kernels (default),
+//   2: GPU update with transform feedback
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <cstdlib>
+
+#include "shader.h"
+#include "jobsystem.h"
+#include "particles.h"
+#include "gpu.h"
+#include "renderer.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+int main(int argc, char* argv[])
+{
+  unsigned int count = argc > 1 ? atoi(argv[1]) : 1000000;
+  int mode = argc > 2 ? atoi(argv[2]) : 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Particles", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+  ourShader.use();
+  ourShader.setFloat("scale", 0.01f);
+
+  Emitter emitter = { 0.0f, -0.9f, 0.0f, { -0.4f, 1.0f, -0.4f }, { 0.4f, 1.8f, 0.4f }, 1.0f, 2.5f };
+  const float gravity = -1.2f;
+
+  {
+    JobSystem jobs;
+    ParticleSystem cpuParticles(mode == 2 ? 0 : count, &jobs);
+    cpuParticles.setGravity(gravity);
+    cpuParticles.setKernel(mode == 0 ? ParticleSystem::KERNEL_SCALAR : ParticleSystem::KERNEL_AVX2);
+    cpuParticles.emit(emitter, count, true);
+    GpuParticleSystem gpuParticles(mode == 2 ? count : 0, emitter);
+    gpuParticles.setGravity(gravity);
+    ParticleRenderer renderer(mode == 2 ? 0 : count);
+
+    if (mode == 2)
+      std::cout << count << " particles, transform feedback update" << std::endl;
+    else
+      std::cout << count << " particles, "
+                << (cpuParticles.kernel() == ParticleSystem::KERNEL_AVX2 ? "AVX2" : "scalar")
+                << " kernels on " << jobs.size() << " workers" << std::endl;
+
+    double lastFrame = glfwGetTime();
+    double lastReport = lastFrame;
+    double updateTime = 0.0;
+    unsigned int frames = 0;
+
+    // game loop
+    while(!glfwWindowShouldClose(window))
+    {
+      processInput(window);
+
+      double now = glfwGetTime();
+      float dt = now - lastFrame;
+      if (dt > 0.05f) dt = 0.05f;
+      lastFrame = now;
+
+      // move, drop the dead, refill from the emitter
+      double start = glfwGetTime();
+      if (mode == 2) {
+        gpuParticles.update(dt);
+      } else {
+        cpuParticles.update(dt);
+        cpuParticles.emit(emitter, count - cpuParticles.size());
+      }
+      updateTime += glfwGetTime() - start;
+
+      // set the color buffer
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
+
+      ourShader.use();
+      if (mode == 2)
+        renderer.draw(gpuParticles);
+      else
+        renderer.draw(cpuParticles);
+
+      frames++;
+      if (now - lastReport >= 1.0) {
+        std::cout << frames / (now - lastReport) << " fps, update "
+                  << updateTime / frames * 1000.0 << " ms" << std::endl;
+        frames = 0;
+        updateTime = 0.0;
+        lastReport = now;
+      }
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
@@ -0,0 +1,163 @@
+#include "gpu.h"
+
+#include <iostream>
+#include <vector>
+
+static const char* updateShaderSource = "#version 330 core\n"
+  "layout (location = 0) in vec3 aPosition;\n"
+  "layout (location = 1) in vec3 aVelocity;\n"
+  "layout (location = 2) in float aLife;\n"
+  "uniform float dt;\n"
+  "uniform float gravity;\n"
+  "uniform uint seed;\n"
+  "uniform vec3 origin;\n"
+  "uniform vec3 velocityMin;\n"
+  "uniform vec3 velocityMax;\n"
+  "uniform vec2 lifeRange;\n"
+  "out vec3 outPosition;\n"
+  "out vec3 outVelocity;\n"
+  "out float outLife;\n"
+  "uint hash(uint x)\n"
+  "{\n"
+  "  x ^= x >> 16u; x *= 0x7feb352du;\n"
+  "  x ^= x >> 15u; x *= 0x846ca68bu;\n"
+  "  return x ^ (x >> 16u);\n"
+  "}\n"
+  "float random(inout uint state)\n"
+  "{\n"
+  "  state = hash(state);\n"
+  "  return float(state >> 8u) / 16777216.0f;\n"
+  "}\n"
+  "void main()\n"
+  "{\n"
+  "  vec3 velocity = aVelocity + vec3(0.0f, gravity * dt, 0.0f);\n"
+  "  outPosition = aPosition + velocity * dt;\n"
+  "  outVelocity = velocity;\n"
+  "  outLife = aLife - dt;\n"
+  "  if (outLife <= 0.0f) {\n"
+  "    uint state = uint(gl_VertexID) * 0x9e3779b9u + seed;\n"
+  "    vec3 r = vec3(random(state), random(state), random(state));\n"
+  "    outPosition = origin;\n"
+  "    outVelocity = mix(velocityMin, velocityMax, r);\n"
+  "    outLife = mix(lifeRange.x, lifeRange.y, random(state));\n"
+  "  }\n"
+  "}\n";
+
+static GLuint compileUpdateProgram()
+{
+  int success;
+  char infoLog[512];
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &updateShaderSource, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::PARTICLES::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  // the outputs must be named before linking
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  const char* varyings[3] = { "outPosition", "outVelocity", "outLife" };
+  glTransformFeedbackVaryings(program, 3, varyings, GL_INTERLEAVED_ATTRIBS);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "ERROR::PARTICLES::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  return program;
+}
+
+GpuParticleSystem::GpuParticleSystem(unsigned int count, const Emitter &emitter)
+  : count(count), current(0), frame(0), gravity(-1.0f)
+{
+  // same start as the CPU system
+  std::vector<float> data(count * 7);
+  {
+    ParticleSystem start(count, NULL);
+    start.emit(emitter, count, true);
+    const ParticleArrays &a = start.arrays();
+    for (unsigned int i = 0; i < count; i++) {
+      float particle[7] = { a.x[i], a.y[i], a.z[i], a.vx[i], a.vy[i], a.vz[i], a.life[i] };
+      for (int k = 0; k < 7; k++)
+        data[i * 7 + k] = particle[k];
+    }
+  }
+
+  glGenVertexArrays(2, this->VAO);
+  glGenBuffers(2, this->VBO);
+  for (int b = 0; b < 2; b++) {
+    glBindVertexArray(this->VAO[b]);
+    glBindBuffer(GL_ARRAY_BUFFER, this->VBO[b]);
+    glBufferData(GL_ARRAY_BUFFER, count * STRIDE, b == 0 && count > 0 ? &data[0] : NULL, GL_STREAM_COPY);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, STRIDE, (void*)0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, STRIDE, (void*)(3*sizeof(float)));
+    glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, STRIDE, (void*)(6*sizeof(float)));
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  this->program = compileUpdateProgram();
+  glUseProgram(this->program);
+  glUniform3f(glGetUniformLocation(this->program, "origin"), emitter.x, emitter.y, emitter.z);
+  glUniform3fv(glGetUniformLocation(this->program, "velocityMin"), 1, emitter.velocityMin);
+  glUniform3fv(glGetUniformLocation(this->program, "velocityMax"), 1, emitter.velocityMax);
+  glUniform2f(glGetUniformLocation(this->program, "lifeRange"), emitter.lifeMin, emitter.lifeMax);
+  this->dtLocation = glGetUniformLocation(this->program, "dt");
+  this->gravityLocation = glGetUniformLocation(this->program, "gravity");
+  this->seedLocation = glGetUniformLocation(this->program, "seed");
+  glUseProgram(0);
+}
+
+GpuParticleSystem::~GpuParticleSystem()
+{
+  glDeleteProgram(this->program);
+  glDeleteBuffers(2, this->VBO);
+  glDeleteVertexArrays(2, this->VAO);
+}
+
+void GpuParticleSystem::setGravity(float gravity)
+{
+  this->gravity = gravity;
+}
+
+void GpuParticleSystem::update(float dt)
+{
+  if (this->count == 0) return;
+  unsigned int next = 1 - this->current;
+
+  glUseProgram(this->program);
+  glUniform1f(this->dtLocation, dt);
+  glUniform1f(this->gravityLocation, this->gravity);
+  glUniform1ui(this->seedLocation, ++this->frame * 2654435761u);
+
+  glEnable(GL_RASTERIZER_DISCARD);
+  glBindVertexArray(this->VAO[this->current]);
+  glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, this->VBO[next]);
+  glBeginTransformFeedback(GL_POINTS);
+  glDrawArrays(GL_POINTS, 0, this->count);
+  glEndTransformFeedback();
+  glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+  glBindVertexArray(0);
+  glDisable(GL_RASTERIZER_DISCARD);
+  glUseProgram(0);
+
+  this->current = next;
+}
+
+GLuint GpuParticleSystem::buffer() const
+{
+  return this->VBO[this->current];
+}
+
+unsigned int GpuParticleSystem::size() const
+{
+  return this->count;
+}
@@ -0,0 +1,46 @@
+#ifndef GPU_H
+#define GPU_H
+
+#include <glad/glad.h>
+
+#include "particles.h"
+
+// GPU particle system, for comparison with ParticleSystem: the particles
+// live in a buffer object (x y z vx vy vz life, interleaved) and a vertex
+// shader moves them with transform feedback into a second buffer, with
+// the rasterizer off; the buffers are swapped after each update
+//
+// transform feedback keeps one output per input, so dead particles are
+// not compacted but emitted again in place, seeded by their index and a
+// frame counter: the count never changes
+class GpuParticleSystem
+{
+  public:
+    static const unsigned int STRIDE = 7 * sizeof(float);
+
+    // count particles from the emitter, at a random part of their life
+    GpuParticleSystem(unsigned int count, const Emitter &emitter);
+    ~GpuParticleSystem();
+
+    void setGravity(float gravity);
+    void update(float dt);
+
+    // current particles: position at 0, life at 6 floats
+    GLuint buffer() const;
+    unsigned int size() const;
+
+  private:
+    GpuParticleSystem(const GpuParticleSystem&);
+    GpuParticleSystem& operator=(const GpuParticleSystem&);
+
+    GLuint program;
+    GLuint VAO[2];
+    GLuint VBO[2];
+    GLint dtLocation, gravityLocation, seedLocation;
+    unsigned int count;
+    unsigned int current;
+    unsigned int frame;
+    float gravity;
+};
+
+#endif
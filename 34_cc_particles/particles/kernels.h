@@ -0,0 +1,24 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include "particles.h"
+
+// update kernels over [begin, end) of src; a particle survives the step
+// when life - dt > 0, both kernels must agree on it exactly
+
+// survivors of the step
+unsigned int countAliveScalar(const float *life, unsigned int begin, unsigned int end, float dt);
+unsigned int countAliveAvx2(const float *life, unsigned int begin, unsigned int end, float dt);
+
+// integrate and write the survivors to dst from out on; nothing is
+// written at or past limit (out + survivors), that is the next chunk
+void stepScalar(const ParticleArrays &src, const ParticleArrays &dst, unsigned int begin,
+                unsigned int end, unsigned int out, unsigned int limit, float dt, float gravity);
+void stepAvx2(const ParticleArrays &src, const ParticleArrays &dst, unsigned int begin,
+              unsigned int end, unsigned int out, unsigned int limit, float dt, float gravity);
+
+// lane permutation that packs the set lanes of an 8 bit mask first,
+// filled by the ParticleSystem constructor
+extern int compactPermutation[256][8];
+
+#endif
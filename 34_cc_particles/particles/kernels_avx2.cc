@@ -0,0 +1,57 @@
+// built with -mavx2 -mfma: only called after ParticleSystem checked the CPU
+
+#include "kernels.h"
+
+#include <immintrin.h>
+
+unsigned int countAliveAvx2(const float *life, unsigned int begin, unsigned int end, float dt)
+{
+  __m256 vdt = _mm256_set1_ps(dt);
+  __m256 zero = _mm256_setzero_ps();
+  unsigned int alive = 0;
+  unsigned int i = begin;
+  for (; i + 8 <= end; i += 8) {
+    __m256 l = _mm256_sub_ps(_mm256_load_ps(life + i), vdt);
+    alive += __builtin_popcount(_mm256_movemask_ps(_mm256_cmp_ps(l, zero, _CMP_GT_OQ)));
+  }
+  return alive + countAliveScalar(life, i, end, dt);
+}
+
+static inline void compact(float *dst, __m256 value, __m256i permutation)
+{
+  _mm256_storeu_ps(dst, _mm256_permutevar8x32_ps(value, permutation));
+}
+
+void stepAvx2(const ParticleArrays &src, const ParticleArrays &dst, unsigned int begin,
+              unsigned int end, unsigned int out, unsigned int limit, float dt, float gravity)
+{
+  __m256 vdt = _mm256_set1_ps(dt);
+  __m256 dv = _mm256_set1_ps(gravity * dt);
+  __m256 zero = _mm256_setzero_ps();
+
+  // a full 8 lane store is only safe while it stays before limit
+  unsigned int i = begin;
+  for (; i + 8 <= end && out + 8 <= limit; i += 8) {
+    __m256 life = _mm256_sub_ps(_mm256_load_ps(src.life + i), vdt);
+    __m256 vx = _mm256_load_ps(src.vx + i);
+    __m256 vy = _mm256_add_ps(_mm256_load_ps(src.vy + i), dv);
+    __m256 vz = _mm256_load_ps(src.vz + i);
+    __m256 x = _mm256_fmadd_ps(vx, vdt, _mm256_load_ps(src.x + i));
+    __m256 y = _mm256_fmadd_ps(vy, vdt, _mm256_load_ps(src.y + i));
+    __m256 z = _mm256_fmadd_ps(vz, vdt, _mm256_load_ps(src.z + i));
+
+    int mask = _mm256_movemask_ps(_mm256_cmp_ps(life, zero, _CMP_GT_OQ));
+    __m256i permutation = _mm256_loadu_si256((const __m256i*)compactPermutation[mask]);
+    compact(dst.x + out, x, permutation);
+    compact(dst.y + out, y, permutation);
+    compact(dst.z + out, z, permutation);
+    compact(dst.vx + out, vx, permutation);
+    compact(dst.vy + out, vy, permutation);
+    compact(dst.vz + out, vz, permutation);
+    compact(dst.life + out, life, permutation);
+    out += __builtin_popcount(mask);
+  }
+
+  // the last survivors of the chunk and the tail
+  stepScalar(src, dst, i, end, out, limit, dt, gravity);
+}
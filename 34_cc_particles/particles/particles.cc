@@ -0,0 +1,219 @@
+#include "particles.h"
+#include "kernels.h"
+
+#include <stdlib.h>
+
+int compactPermutation[256][8];
+
+static float* allocateArray(unsigned int count)
+{
+  void *p = NULL;
+  if (posix_memalign(&p, 32, count * sizeof(float)) != 0)
+    return NULL;
+  return (float*)p;
+}
+
+static void allocateArrays(ParticleArrays &arrays, unsigned int count)
+{
+  float **fields[7] = { &arrays.x, &arrays.y, &arrays.z, &arrays.vx, &arrays.vy, &arrays.vz, &arrays.life };
+  for (int k = 0; k < 7; k++)
+    *fields[k] = allocateArray(count);
+}
+
+static void freeArrays(ParticleArrays &arrays)
+{
+  float *fields[7] = { arrays.x, arrays.y, arrays.z, arrays.vx, arrays.vy, arrays.vz, arrays.life };
+  for (int k = 0; k < 7; k++)
+    free(fields[k]);
+}
+
+ParticleSystem::ParticleSystem(unsigned int capacity, JobSystem *jobs)
+  : jobs(jobs), count(0), maxCount(capacity), current(KERNEL_SCALAR), gravity(-1.0f),
+    dt(0.0f), random(2463534242u)
+{
+  allocateArrays(this->front, capacity);
+  allocateArrays(this->back, capacity);
+
+  unsigned int chunks = (capacity + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  this->chunkAlive.assign(chunks, 0);
+  this->chunkOffset.assign(chunks, 0);
+
+  for (int mask = 0; mask < 256; mask++) {
+    int n = 0;
+    for (int lane = 0; lane < 8; lane++)
+      if (mask & (1 << lane))
+        compactPermutation[mask][n++] = lane;
+    for (; n < 8; n++)
+      compactPermutation[mask][n] = 0;
+  }
+
+  if (kernelAvailable(KERNEL_AVX2))
+    this->current = KERNEL_AVX2;
+}
+
+ParticleSystem::~ParticleSystem()
+{
+  freeArrays(this->front);
+  freeArrays(this->back);
+}
+
+bool ParticleSystem::kernelAvailable(Kernel kernel)
+{
+  if (kernel == KERNEL_SCALAR)
+    return true;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+  return false;
+#endif
+}
+
+void ParticleSystem::setKernel(Kernel kernel)
+{
+  this->current = kernelAvailable(kernel) ? kernel : KERNEL_SCALAR;
+}
+
+ParticleSystem::Kernel ParticleSystem::kernel() const
+{
+  return this->current;
+}
+
+void ParticleSystem::setGravity(float gravity)
+{
+  this->gravity = gravity;
+}
+
+unsigned int ParticleSystem::emit(const Emitter &emitter, unsigned int count, bool spread)
+{
+  if (count > this->maxCount - this->count)
+    count = this->maxCount - this->count;
+
+  const ParticleArrays &a = this->front;
+  for (unsigned int i = this->count; i < this->count + count; i++) {
+    float r[5];
+    for (int k = 0; k < 5; k++) {
+      // xorshift32
+      this->random ^= this->random << 13;
+      this->random ^= this->random >> 17;
+      this->random ^= this->random << 5;
+      r[k] = (this->random >> 8) * (1.0f / 16777216.0f);
+    }
+    a.x[i] = emitter.x;
+    a.y[i] = emitter.y;
+    a.z[i] = emitter.z;
+    a.vx[i] = emitter.velocityMin[0] + r[0] * (emitter.velocityMax[0] - emitter.velocityMin[0]);
+    a.vy[i] = emitter.velocityMin[1] + r[1] * (emitter.velocityMax[1] - emitter.velocityMin[1]);
+    a.vz[i] = emitter.velocityMin[2] + r[2] * (emitter.velocityMax[2] - emitter.velocityMin[2]);
+    a.life[i] = emitter.lifeMin + r[3] * (emitter.lifeMax - emitter.lifeMin);
+    if (spread) {
+      // as if emitted age seconds ago
+      float age = r[4] * a.life[i];
+      a.life[i] -= age;
+      a.vy[i] += this->gravity * age * 0.5f;
+      a.x[i] += a.vx[i] * age;
+      a.y[i] += a.vy[i] * age;
+      a.z[i] += a.vz[i] * age;
+      a.vy[i] += this->gravity * age * 0.5f;
+    }
+  }
+  this->count += count;
+  return count;
+}
+
+void ParticleSystem::update(float dt)
+{
+  if (this->count == 0) return;
+  this->dt = dt;
+
+  unsigned int chunks = (this->count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  JobCounter counted;
+  this->jobs->parallelFor(chunks, 1, countJob, this, &counted);
+  this->jobs->wait(&counted);
+
+  unsigned int alive = 0;
+  for (unsigned int c = 0; c < chunks; c++) {
+    this->chunkOffset[c] = alive;
+    alive += this->chunkAlive[c];
+  }
+
+  JobCounter stepped;
+  this->jobs->parallelFor(chunks, 1, stepJob, this, &stepped);
+  this->jobs->wait(&stepped);
+
+  ParticleArrays swap = this->front;
+  this->front = this->back;
+  this->back = swap;
+  this->count = alive;
+}
+
+void ParticleSystem::countJob(void *data, unsigned int begin, unsigned int end)
+{
+  ParticleSystem *system = (ParticleSystem*)data;
+  for (unsigned int c = begin; c < end; c++) {
+    unsigned int first = c * CHUNK_SIZE;
+    unsigned int last = first + CHUNK_SIZE < system->count ? first + CHUNK_SIZE : system->count;
+    if (system->current == KERNEL_AVX2)
+      system->chunkAlive[c] = countAliveAvx2(system->front.life, first, last, system->dt);
+    else
+      system->chunkAlive[c] = countAliveScalar(system->front.life, first, last, system->dt);
+  }
+}
+
+void ParticleSystem::stepJob(void *data, unsigned int begin, unsigned int end)
+{
+  ParticleSystem *system = (ParticleSystem*)data;
+  for (unsigned int c = begin; c < end; c++) {
+    unsigned int first = c * CHUNK_SIZE;
+    unsigned int last = first + CHUNK_SIZE < system->count ? first + CHUNK_SIZE : system->count;
+    unsigned int out = system->chunkOffset[c];
+    unsigned int limit = out + system->chunkAlive[c];
+    if (system->current == KERNEL_AVX2)
+      stepAvx2(system->front, system->back, first, last, out, limit, system->dt, system->gravity);
+    else
+      stepScalar(system->front, system->back, first, last, out, limit, system->dt, system->gravity);
+  }
+}
+
+unsigned int ParticleSystem::size() const
+{
+  return this->count;
+}
+
+unsigned int ParticleSystem::capacity() const
+{
+  return this->maxCount;
+}
+
+const ParticleArrays& ParticleSystem::arrays() const
+{
+  return this->front;
+}
+
+unsigned int countAliveScalar(const float *life, unsigned int begin, unsigned int end, float dt)
+{
+  unsigned int alive = 0;
+  for (unsigned int i = begin; i < end; i++)
+    alive += life[i] - dt > 0.0f;
+  return alive;
+}
+
+// every particle is written at out, out only moves on for the survivors;
+// the loop stops once the chunk has all its survivors, the rest are dead
+void stepScalar(const ParticleArrays &src, const ParticleArrays &dst, unsigned int begin,
+                unsigned int end, unsigned int out, unsigned int limit, float dt, float gravity)
+{
+  float dv = gravity * dt;
+  for (unsigned int i = begin; i < end && out < limit; i++) {
+    float life = src.life[i] - dt;
+    float vy = src.vy[i] + dv;
+    dst.x[out] = src.x[i] + src.vx[i] * dt;
+    dst.y[out] = src.y[i] + vy * dt;
+    dst.z[out] = src.z[i] + src.vz[i] * dt;
+    dst.vx[out] = src.vx[i];
+    dst.vy[out] = vy;
+    dst.vz[out] = src.vz[i];
+    dst.life[out] = life;
+    out += life > 0.0f;
+  }
+}
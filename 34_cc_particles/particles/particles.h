@@ -0,0 +1,90 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include "jobsystem.h"
+
+#include <vector>
+
+// one set of particle arrays (structure of arrays, 32 byte aligned)
+struct ParticleArrays
+{
+  float *x, *y, *z;
+  float *vx, *vy, *vz;
+  float *life;            // seconds left
+};
+
+// fountain emitter: particles start at the origin with a random velocity
+// in the box [velocityMin, velocityMax] and a random life
+struct Emitter
+{
+  float x, y, z;
+  float velocityMin[3];
+  float velocityMax[3];
+  float lifeMin, lifeMax;
+};
+
+// CPU particle system: the particles live in structure of arrays form,
+// the update runs as jobs over chunks of CHUNK_SIZE particles
+//
+// update(): one job pass counts the particles that survive the step in
+// each chunk, a prefix sum turns the counts into output offsets, a second
+// pass integrates the chunks and writes the survivors, compacted without
+// branches, in the back arrays at their offset; the arrays are swapped,
+// so the live particles are always [0, size())
+//
+// the AVX2 kernels do 8 particles at a time and compact them with one
+// permutation per array; they are compiled apart with -mavx2 -mfma and
+// picked at run time, the scalar kernels are the fallback
+class ParticleSystem
+{
+  public:
+    static const unsigned int CHUNK_SIZE = 16384;   // multiple of 8
+
+    enum Kernel
+    {
+      KERNEL_SCALAR,
+      KERNEL_AVX2
+    };
+
+    ParticleSystem(unsigned int capacity, JobSystem *jobs);
+    ~ParticleSystem();
+
+    // AVX2 by default when the CPU has it
+    void setKernel(Kernel kernel);
+    Kernel kernel() const;
+    static bool kernelAvailable(Kernel kernel);
+
+    void setGravity(float gravity);
+
+    // add up to count particles; spread = true gives them a random part
+    // of their life (start up without waves of deaths); returns the added
+    unsigned int emit(const Emitter &emitter, unsigned int count, bool spread = false);
+
+    // move the particles by dt seconds and drop the dead ones
+    void update(float dt);
+
+    unsigned int size() const;
+    unsigned int capacity() const;
+    const ParticleArrays& arrays() const;
+
+  private:
+    ParticleSystem(const ParticleSystem&);
+    ParticleSystem& operator=(const ParticleSystem&);
+
+    static void countJob(void *data, unsigned int begin, unsigned int end);
+    static void stepJob(void *data, unsigned int begin, unsigned int end);
+
+    JobSystem *jobs;
+    unsigned int count;
+    unsigned int maxCount;
+    ParticleArrays front;       // live particles
+    ParticleArrays back;        // written by update()
+    std::vector<unsigned int> chunkAlive;
+    std::vector<unsigned int> chunkOffset;
+    Kernel current;
+    float gravity;
+    float dt;
+    unsigned int random;
+};
+
+#endif
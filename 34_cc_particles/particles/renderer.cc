@@ -0,0 +1,105 @@
+#include "renderer.h"
+
+ParticleRenderer::ParticleRenderer(unsigned int capacity)
+  : capacity(capacity)
+{
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  glGenBuffers(1, &this->triangleVBO);
+  glGenBuffers(1, &this->triangleEBO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->triangleVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glGenVertexArrays(1, &this->cpuVAO);
+  glGenVertexArrays(1, &this->gpuVAO);
+  this->createTriangle(this->cpuVAO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+  this->createTriangle(this->gpuVAO);
+
+  // one array after the other, at fixed offsets: x y z life are one
+  // float attribute each
+  glGenBuffers(1, &this->instanceVBO);
+  glBindVertexArray(this->cpuVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)capacity * 4 * sizeof(float), NULL, GL_STREAM_DRAW);
+  for (GLuint k = 0; k < 4; k++) {
+    glVertexAttribPointer(2 + k, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)(k * capacity * sizeof(float)));
+    glEnableVertexAttribArray(2 + k);
+    glVertexAttribDivisor(2 + k, 1);        // advance once per instance
+  }
+
+  glBindVertexArray(this->gpuVAO);
+  for (GLuint k = 0; k < 4; k++) {
+    glEnableVertexAttribArray(2 + k);
+    glVertexAttribDivisor(2 + k, 1);
+  }
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+}
+
+ParticleRenderer::~ParticleRenderer()
+{
+  glDeleteBuffers(1, &this->instanceVBO);
+  glDeleteBuffers(1, &this->triangleEBO);
+  glDeleteBuffers(1, &this->triangleVBO);
+  glDeleteVertexArrays(1, &this->gpuVAO);
+  glDeleteVertexArrays(1, &this->cpuVAO);
+}
+
+// triangle attributes and indices of a VAO
+void ParticleRenderer::createTriangle(GLuint VAO)
+{
+  glBindVertexArray(VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->triangleVBO);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->triangleEBO);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+}
+
+void ParticleRenderer::draw(const ParticleSystem &particles)
+{
+  unsigned int count = particles.size();
+  if (count > this->capacity) count = this->capacity;
+  if (count == 0) return;
+
+  // orphan the storage, then one copy per array, no packing
+  const ParticleArrays &a = particles.arrays();
+  const float *arrays[4] = { a.x, a.y, a.z, a.life };
+  GLsizeiptr stride = (GLsizeiptr)this->capacity * sizeof(float);
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, stride * 4, NULL, GL_STREAM_DRAW);
+  for (int k = 0; k < 4; k++)
+    glBufferSubData(GL_ARRAY_BUFFER, stride * k, count * sizeof(float), arrays[k]);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+  glBindVertexArray(this->cpuVAO);
+  glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, count);
+  glBindVertexArray(0);
+}
+
+void ParticleRenderer::draw(const GpuParticleSystem &particles)
+{
+  if (particles.size() == 0) return;
+
+  // the buffers swap at each update
+  glBindVertexArray(this->gpuVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, particles.buffer());
+  GLuint offsets[4] = { 0, 1, 2, 6 };         // x y z life
+  for (GLuint k = 0; k < 4; k++)
+    glVertexAttribPointer(2 + k, 1, GL_FLOAT, GL_FALSE, GpuParticleSystem::STRIDE,
+                          (void*)(offsets[k] * sizeof(float)));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, particles.size());
+  glBindVertexArray(0);
+}
@@ -0,0 +1,39 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <glad/glad.h>
+
+#include "particles.h"
+#include "gpu.h"
+
+// draws every particle as the triangle of 13_cc_shader_class with one
+// glDrawElementsInstanced
+//
+// vertex attributes: 0 position and 1 color of the triangle (per vertex),
+// then per instance one float each: 2 x, 3 y, 4 z, 5 life; the CPU
+// particles are copied array by array into one instance buffer (no
+// packing), the GPU particles are read in place from the transform
+// feedback buffer; the caller binds the program
+class ParticleRenderer
+{
+  public:
+    // capacity: most CPU particles drawn at once
+    ParticleRenderer(unsigned int capacity);
+    ~ParticleRenderer();
+
+    void draw(const ParticleSystem &particles);
+    void draw(const GpuParticleSystem &particles);
+
+  private:
+    ParticleRenderer(const ParticleRenderer&);
+    ParticleRenderer& operator=(const ParticleRenderer&);
+
+    void createTriangle(GLuint VAO);
+
+    GLuint triangleVBO, triangleEBO;
+    GLuint cpuVAO, gpuVAO;
+    GLuint instanceVBO;        // x[capacity] y[capacity] z[capacity] life[capacity]
+    unsigned int capacity;
+};
+
+#endif
@@ -0,0 +1,20 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in float aX;        // per instance
+layout (location = 3) in float aY;
+layout (location = 4) in float aZ;
+layout (location = 5) in float aLife;
+
+uniform float scale;
+
+out vec3 vertexColor;
+
+void main()
+{
+  // shrink and fade out during the last second
+  float fade = clamp(aLife, 0.0f, 1.0f);
+  gl_Position = vec4(aPos.x * scale * fade + aX, aPos.y * scale * fade + aY, aZ * 0.5f, 1.0f);
+  vertexColor = aColor * fade;
+}
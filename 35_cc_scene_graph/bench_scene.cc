@@ -0,0 +1,252 @@
+// bench_scene.cc
+
+// scene graph benchmark (headless): per frame time to recompute the
+// world matrices of 200k nodes (500 trees of 400) and to stream them into
+// the instance buffer, when some percent of the nodes move
+// - tree_full:     pointer tree (node objects with child lists), every
+//                  node recomputed recursively, whole buffer uploaded
+// - flat_full:     SceneGraph with every root dirty, whole buffer uploaded
+// - dirty_scalar:  SceneGraph, dirty subtrees only, scalar multiplies,
+//                  changed ranges uploaded
+// - dirty_sse:     the same with SSE multiplies
+// usage: bench_scene [trees] [frames]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "scenegraph.h"
+#include "stream.h"
+
+#define WINDOW_SIZE 64
+#define BRANCHES 7
+#define LEVELS 3
+
+static void transform(float *m, float x, float y, float angle, float scale)
+{
+  float c = cos(angle) * scale, s = sin(angle) * scale;
+  float matrix[16] = {
+    c,    s,    0.0f,  0.0f,
+    -s,   c,    0.0f,  0.0f,
+    0.0f, 0.0f, scale, 0.0f,
+    x,    y,    0.0f,  1.0f
+  };
+  for (int i = 0; i < 16; i++)
+    m[i] = matrix[i];
+}
+
+static void multiply(const float *a, const float *b, float *out)
+{
+  for (int j = 0; j < 4; j++)
+    for (int i = 0; i < 4; i++)
+      out[j * 4 + i] = a[i] * b[j * 4] + a[4 + i] * b[j * 4 + 1] +
+                       a[8 + i] * b[j * 4 + 2] + a[12 + i] * b[j * 4 + 3];
+}
+
+// the classic scene graph, for reference
+struct TreeNode
+{
+  float local[16];
+  float world[16];
+  std::vector<TreeNode*> children;
+};
+
+static void updateTree(TreeNode *node, const float *parentWorld, float *&out)
+{
+  if (parentWorld != NULL)
+    multiply(parentWorld, node->local, node->world);
+  else
+    for (int i = 0; i < 16; i++) node->world[i] = node->local[i];
+  for (int i = 0; i < 16; i++) *out++ = node->world[i];
+  for (size_t c = 0; c < node->children.size(); c++)
+    updateTree(node->children[c], node->world, out);
+}
+
+static void deleteTree(TreeNode *node)
+{
+  for (size_t c = 0; c < node->children.size(); c++)
+    deleteTree(node->children[c]);
+  delete node;
+}
+
+// the same shape in both: depth first
+static void branch(SceneGraph &scene, SceneGraph::Node parent, TreeNode *treeParent, int level)
+{
+  if (level == LEVELS) return;
+  for (int b = 0; b < BRANCHES; b++) {
+    float angle = b * 6.2831853f / BRANCHES;
+    TreeNode *node = new TreeNode();
+    transform(node->local, cos(angle) * 1.2f, sin(angle) * 1.2f, angle, 0.4f);
+    treeParent->children.push_back(node);
+    branch(scene, scene.create(parent, node->local), node, level + 1);
+  }
+}
+
+struct Result
+{
+  double updateMs;      // per frame
+  double uploadMs;
+  unsigned long matrices;
+  unsigned long bytes;
+  unsigned int ranges;
+};
+
+static void print(const char* name, float percent, const Result &r)
+{
+  std::cout << std::setw(14) << name
+            << std::fixed << std::setprecision(1)
+            << std::setw(8) << percent
+            << std::setw(10) << r.matrices
+            << std::setprecision(3)
+            << std::setw(10) << r.updateMs
+            << std::setw(10) << r.uploadMs
+            << std::setw(10) << r.bytes / 1024
+            << std::setw(8) << r.ranges << std::endl;
+}
+
+// spin the moving nodes
+static void animate(SceneGraph &scene, const std::vector<SceneGraph::Node> &moving)
+{
+  for (size_t i = 0; i < moving.size(); i++) {
+    float m[16];
+    const float *local = scene.local(moving[i]);
+    for (int k = 0; k < 16; k++) m[k] = local[k];
+    float c = cos(0.01f), s = sin(0.01f);
+    for (int k = 0; k < 2; k++) {
+      float x = m[k * 4], y = m[k * 4 + 1];
+      m[k * 4] = x * c - y * s;
+      m[k * 4 + 1] = x * s + y * c;
+    }
+    scene.setLocal(moving[i], m);
+  }
+}
+
+static Result runFlat(SceneGraph &scene, WorldStream &stream, const std::vector<SceneGraph::Node> &moving,
+                      bool all, unsigned int frames)
+{
+  Result result = { 0.0, 0.0, 0, 0, 0 };
+  for (unsigned int f = 0; f < frames; f++) {
+    animate(scene, moving);
+    double start = glfwGetTime();
+    scene.update();
+    double updated = glfwGetTime();
+    result.bytes += all ? stream.uploadAll(scene) : stream.upload(scene);
+    glFinish();
+    result.updateMs += updated - start;
+    result.uploadMs += glfwGetTime() - updated;
+    result.matrices += scene.recomputed();
+    result.ranges = stream.uploads();
+  }
+  result.updateMs = result.updateMs / frames * 1000.0;
+  result.uploadMs = result.uploadMs / frames * 1000.0;
+  result.matrices /= frames;
+  result.bytes /= frames;
+  return result;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int trees = argc > 1 ? atoi(argv[1]) : 500;
+  unsigned int frames = argc > 2 ? atoi(argv[2]) : 50;
+  if (trees < 1) trees = 1;
+  if (frames < 1) frames = 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core), no visible window
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+  glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(WINDOW_SIZE, WINDOW_SIZE, "bench_scene", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSwapInterval(0);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  {
+    SceneGraph scene;
+    std::vector<TreeNode*> roots;
+    std::vector<SceneGraph::Node> rootNodes;
+    for (unsigned int t = 0; t < trees; t++) {
+      TreeNode *root = new TreeNode();
+      transform(root->local, (t % 25) * 0.08f - 1.0f, (t / 25) * 0.1f - 1.0f, 0.0f, 0.025f);
+      roots.push_back(root);
+      rootNodes.push_back(scene.create(SceneGraph::NONE, root->local));
+      branch(scene, rootNodes.back(), root, 0);
+    }
+    WorldStream stream;
+    scene.update();
+    stream.upload(scene);
+
+    std::cout << "renderer: " << (const char*)glGetString(GL_RENDERER) << std::endl;
+    std::cout << scene.size() << " nodes, " << scene.depths() << " depths, " << frames
+              << " frames, times in ms per frame" << std::endl;
+    std::cout << "      strategy  moving  matrices    update    upload        KB  ranges" << std::endl;
+
+    // pointer tree, recursive
+    Result tree = { 0.0, 0.0, 0, 0, 1 };
+    std::vector<float> worlds(scene.size() * 16);
+    for (unsigned int f = 0; f < frames; f++) {
+      double start = glfwGetTime();
+      float *out = &worlds[0];
+      for (size_t r = 0; r < roots.size(); r++)
+        updateTree(roots[r], NULL, out);
+      double updated = glfwGetTime();
+      glBindBuffer(GL_ARRAY_BUFFER, stream.buffer());
+      glBufferSubData(GL_ARRAY_BUFFER, 0, worlds.size() * sizeof(float), &worlds[0]);
+      glBindBuffer(GL_ARRAY_BUFFER, 0);
+      glFinish();
+      tree.updateMs += updated - start;
+      tree.uploadMs += glfwGetTime() - updated;
+    }
+    tree.updateMs = tree.updateMs / frames * 1000.0;
+    tree.uploadMs = tree.uploadMs / frames * 1000.0;
+    tree.matrices = scene.size();
+    tree.bytes = worlds.size() * sizeof(float);
+    print("tree_full", 100.0f, tree);
+
+    print("flat_full", 100.0f, runFlat(scene, stream, rootNodes, true, frames));
+
+    const float percents[3] = { 0.5f, 2.0f, 5.0f };
+    for (int p = 0; p < 3; p++) {
+      std::vector<SceneGraph::Node> moving;
+      srand(1);
+      for (SceneGraph::Node node = 0; node < scene.size(); node++)
+        if (rand() % 10000 < percents[p] * 100.0f)
+          moving.push_back(node);
+      scene.setSimd(false);
+      print("dirty_scalar", percents[p], runFlat(scene, stream, moving, false, frames));
+      if (SceneGraph::simdAvailable()) {
+        scene.setSimd(true);
+        print("dirty_sse", percents[p], runFlat(scene, stream, moving, false, frames));
+      }
+    }
+
+    for (size_t r = 0; r < roots.size(); r++)
+      deleteTree(roots[r]);
+  }
+
+  glfwTerminate();
+  return 0;
+}
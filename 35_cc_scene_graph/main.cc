@@ -0,0 +1,233 @@
+// main.cc
+
+// scene graph: 500 trees of 400 nodes (200k) in a flattened hierarchy;
+// each frame a few percent of the nodes spin, only their subtrees get
+// new world matrices and only those are streamed to the instance buffer
+// the 13_cc_shader_class triangle is drawn once per node, instanced
+// usage: ./main [moving percent] [simd]
+//   simd 0: scalar 4x4 multiplies
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "scenegraph.h"
+#include "stream.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define TREES_X 25
+#define TREES_Y 20
+#define BRANCHES 7
+#define LEVELS 3            // below the root: 1 + 7 + 49 + 343 = 400 nodes
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+// translate * rotate around z * uniform scale, column major
+static void transform(float *m, float x, float y, float angle, float scale)
+{
+  float c = cos(angle) * scale, s = sin(angle) * scale;
+  float matrix[16] = {
+    c,    s,    0.0f,  0.0f,
+    -s,   c,    0.0f,  0.0f,
+    0.0f, 0.0f, scale, 0.0f,
+    x,    y,    0.0f,  1.0f
+  };
+  for (int i = 0; i < 16; i++)
+    m[i] = matrix[i];
+}
+
+// children around their parent, depth first
+static void branch(SceneGraph &scene, SceneGraph::Node parent, int level)
+{
+  if (level == LEVELS) return;
+  for (int b = 0; b < BRANCHES; b++) {
+    float angle = b * 6.2831853f / BRANCHES, m[16];
+    transform(m, cos(angle) * 1.2f, sin(angle) * 1.2f, angle, 0.4f);
+    branch(scene, scene.create(parent, m), level + 1);
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  float movingPercent = argc > 1 ? atof(argv[1]) : 2.0f;
+  bool simd = argc > 2 ? atoi(argv[2]) != 0 : true;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Scene Graph", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  // the trees: depth first, so the first update() sorts them by depth
+  SceneGraph scene;
+  scene.setSimd(simd);
+  std::vector<SceneGraph::Node> moving;
+  std::vector<float> phase;
+  for (int ty = 0; ty < TREES_Y; ty++) {
+    for (int tx = 0; tx < TREES_X; tx++) {
+      float m[16];
+      transform(m, -1.0f + (tx + 0.5f) * 2.0f / TREES_X, -1.0f + (ty + 0.5f) * 2.0f / TREES_Y, 0.0f, 0.025f);
+      branch(scene, scene.create(SceneGraph::NONE, m), 0);
+    }
+  }
+  srand(1);
+  for (SceneGraph::Node node = 0; node < scene.size(); node++) {
+    if (rand() % 10000 < movingPercent * 100.0f) {
+      moving.push_back(node);
+      phase.push_back((rand() % 628) / 100.0f);
+    }
+  }
+
+  {
+    WorldStream stream;
+    scene.update();
+    stream.upload(scene);
+    std::cout << scene.size() << " nodes, " << scene.depths() << " depths, " << moving.size()
+              << " moving, " << (simd && SceneGraph::simdAvailable() ? "SSE" : "scalar")
+              << " multiplies" << std::endl;
+
+    GLuint triangleVAO, triangleVBO, triangleEBO;
+    glGenVertexArrays(1, &triangleVAO);
+    glGenBuffers(1, &triangleVBO);
+    glGenBuffers(1, &triangleEBO);
+
+    // bind triangle data
+    glBindVertexArray(triangleVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, triangleVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0,                  // vertex attribute to configure (loc = 0)
+                            3,                // size of vertex attribute, 3 coords
+                            GL_FLOAT,         // type of data
+                            GL_FALSE,         // don't normalize data
+                            6*sizeof(float),  // stride
+                            (void*)0          // start at
+    );
+    glVertexAttribPointer(1,                  // vertex attribute to configure (loc = 1)
+                            3,                // size of vertex attribute, rgb
+                            GL_FLOAT,         // type of data
+                            GL_FALSE,         // don't normalize data
+                            6*sizeof(float),  // stride
+                            (void*)(3*sizeof(GL_FLOAT))  // start at
+    );
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    stream.bind(2);                           // world matrix per instance
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    double lastReport = glfwGetTime();
+    double updateTime = 0.0, uploadTime = 0.0;
+    unsigned long recomputed = 0, bytes = 0;
+    unsigned int frames = 0;
+
+    // game loop
+    while(!glfwWindowShouldClose(window))
+    {
+      processInput(window);
+
+      // spin the moving nodes in place
+      float t = glfwGetTime();
+      for (size_t i = 0; i < moving.size(); i++) {
+        float m[16];
+        const float *local = scene.local(moving[i]);
+        float scale = sqrt(local[0] * local[0] + local[1] * local[1]);
+        transform(m, local[12], local[13], phase[i] + t, scale);
+        scene.setLocal(moving[i], m);
+      }
+
+      double start = glfwGetTime();
+      scene.update();
+      double updated = glfwGetTime();
+      bytes += stream.upload(scene);
+      uploadTime += glfwGetTime() - updated;
+      updateTime += updated - start;
+      recomputed += scene.recomputed();
+
+      // set the color buffer
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT);
+
+      ourShader.use();
+      glBindVertexArray(triangleVAO);
+      glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, scene.size());
+
+      frames++;
+      double now = glfwGetTime();
+      if (now - lastReport >= 1.0) {
+        std::cout << recomputed / frames << " matrices per frame, update "
+                  << updateTime / frames * 1000.0 << " ms, upload "
+                  << uploadTime / frames * 1000.0 << " ms ("
+                  << bytes / frames / 1024 << " KB in " << stream.uploads() << " ranges)" << std::endl;
+        frames = 0;
+        recomputed = bytes = 0;
+        updateTime = uploadTime = 0.0;
+        lastReport = now;
+      }
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
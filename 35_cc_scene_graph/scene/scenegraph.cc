@@ -0,0 +1,256 @@
+#include "scenegraph.h"
+
+#include <string.h>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+static const float identity[16] = {
+  1.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 1.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 1.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 1.0f
+};
+
+SceneGraph::SceneGraph()
+  : sorted(true), grown(false), mergeGap(32), lastRecomputed(0), simd(simdAvailable())
+{
+}
+
+SceneGraph::Node SceneGraph::create(Node parent, const float *local)
+{
+  unsigned int slot = this->nodes.size();
+  Node node = this->slots.size();
+  unsigned int parentSlot = parent == NONE ? slot : this->slots[parent];
+  unsigned int depth = parent == NONE ? 0 : this->depth[parentSlot] + 1;
+  if (slot > 0 && depth < this->depth[slot - 1])
+    this->sorted = false;
+
+  this->locals.insert(this->locals.end(), local != NULL ? local : identity, (local != NULL ? local : identity) + 16);
+  this->worldMatrices.insert(this->worldMatrices.end(), identity, identity + 16);
+  this->parents.push_back(parentSlot);
+  this->depth.push_back(depth);
+  this->dirty.push_back(1);
+  this->nodes.push_back(node);
+  this->slots.push_back(slot);
+  this->grown = true;
+  return node;
+}
+
+void SceneGraph::setLocal(Node node, const float *local)
+{
+  unsigned int slot = this->slots[node];
+  memcpy(&this->locals[slot * 16], local, 16 * sizeof(float));
+  this->dirty[slot] = 1;
+}
+
+const float* SceneGraph::local(Node node) const
+{
+  return &this->locals[this->slots[node] * 16];
+}
+
+const float* SceneGraph::world(Node node) const
+{
+  return &this->worldMatrices[this->slots[node] * 16];
+}
+
+SceneGraph::Node SceneGraph::parent(Node node) const
+{
+  unsigned int slot = this->slots[node];
+  return this->parents[slot] == slot ? NONE : this->nodes[this->parents[slot]];
+}
+
+// stable counting sort of the slots by depth
+void SceneGraph::sort()
+{
+  unsigned int count = this->nodes.size();
+  unsigned int maxDepth = 0;
+  for (unsigned int s = 0; s < count; s++)
+    if (this->depth[s] > maxDepth) maxDepth = this->depth[s];
+
+  std::vector<unsigned int> next(maxDepth + 1, 0);
+  for (unsigned int s = 0; s < count; s++)
+    next[this->depth[s]]++;
+  unsigned int start = 0;
+  for (unsigned int d = 0; d <= maxDepth; d++) {
+    unsigned int n = next[d];
+    next[d] = start;
+    start += n;
+  }
+  std::vector<unsigned int> moved(count);
+  for (unsigned int s = 0; s < count; s++)
+    moved[s] = next[this->depth[s]]++;
+
+  std::vector<float> locals(count * 16), worlds(count * 16);
+  std::vector<unsigned int> parents(count), depth(count);
+  std::vector<unsigned char> dirty(count);
+  std::vector<Node> nodes(count);
+  for (unsigned int s = 0; s < count; s++) {
+    unsigned int t = moved[s];
+    memcpy(&locals[t * 16], &this->locals[s * 16], 16 * sizeof(float));
+    memcpy(&worlds[t * 16], &this->worldMatrices[s * 16], 16 * sizeof(float));
+    parents[t] = moved[this->parents[s]];
+    depth[t] = this->depth[s];
+    dirty[t] = this->dirty[s];
+    nodes[t] = this->nodes[s];
+    this->slots[this->nodes[s]] = t;
+  }
+  this->locals.swap(locals);
+  this->worldMatrices.swap(worlds);
+  this->parents.swap(parents);
+  this->depth.swap(depth);
+  this->dirty.swap(dirty);
+  this->nodes.swap(nodes);
+  this->sorted = true;
+}
+
+// out = a * b, column major
+static inline void multiply4x4(const float *a, const float *b, float *out, bool simd)
+{
+#ifdef __SSE__
+  if (simd) {
+    __m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+    for (int j = 0; j < 4; j++) {
+      const float *column = b + j * 4;
+      __m128 r = _mm_mul_ps(a0, _mm_set1_ps(column[0]));
+      r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_set1_ps(column[1])));
+      r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_set1_ps(column[2])));
+      r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_set1_ps(column[3])));
+      _mm_storeu_ps(out + j * 4, r);
+    }
+    return;
+  }
+#endif
+  for (int j = 0; j < 4; j++)
+    for (int i = 0; i < 4; i++)
+      out[j * 4 + i] = a[i] * b[j * 4] + a[4 + i] * b[j * 4 + 1] +
+                       a[8 + i] * b[j * 4 + 2] + a[12 + i] * b[j * 4 + 3];
+}
+
+// world = parent world * local for the listed slots of one depth
+void SceneGraph::multiply(const unsigned int *slots, unsigned int count)
+{
+  float *worlds = &this->worldMatrices[0];
+  const float *locals = &this->locals[0];
+  for (unsigned int k = 0; k < count; k++) {
+    unsigned int s = slots[k];
+    multiply4x4(worlds + this->parents[s] * 16, locals + s * 16, worlds + s * 16, this->simd);
+  }
+}
+
+void SceneGraph::update()
+{
+  unsigned int count = this->nodes.size();
+  this->ranges.clear();
+  this->lastRecomputed = 0;
+  if (count == 0) return;
+
+  bool resorted = !this->sorted;
+  if (!this->sorted)
+    this->sort();
+  if (this->grown || resorted) {
+    this->depthStart.clear();
+    for (unsigned int s = 0; s < count; s++)
+      if (s == 0 || this->depth[s] != this->depth[s - 1])
+        this->depthStart.push_back(s);
+    this->depthStart.push_back(count);
+    this->grown = false;
+  }
+
+  if (this->updated.size() < count)
+    this->updated.resize(count);
+  unsigned int *list = &this->updated[0];
+  unsigned char *dirty = &this->dirty[0];
+  const unsigned int *parents = &this->parents[0];
+  unsigned int n = 0;
+
+  // roots: world = local
+  for (unsigned int s = 0; s < this->depthStart[1]; s++) {
+    list[n] = s;
+    n += dirty[s];
+  }
+  for (unsigned int k = 0; k < n; k++)
+    memcpy(&this->worldMatrices[list[k] * 16], &this->locals[list[k] * 16], 16 * sizeof(float));
+
+  // the parents are final when their depth is done
+  for (unsigned int d = 1; d + 1 < this->depthStart.size(); d++) {
+    unsigned int first = n;
+    for (unsigned int s = this->depthStart[d]; s < this->depthStart[d + 1]; s++) {
+      dirty[s] |= dirty[parents[s]];
+      list[n] = s;
+      n += dirty[s];
+    }
+    this->multiply(list + first, n - first);
+  }
+
+  for (unsigned int k = 0; k < n; k++)
+    dirty[list[k]] = 0;
+  this->lastRecomputed = n;
+
+  // the list is in slot order: merge it into upload ranges
+  if (resorted) {
+    SlotRange all = { 0, count };
+    this->ranges.push_back(all);
+    return;
+  }
+  for (unsigned int k = 0; k < n; k++) {
+    unsigned int s = list[k];
+    if (!this->ranges.empty() && s <= this->ranges.back().end + this->mergeGap) {
+      this->ranges.back().end = s + 1;
+    } else {
+      SlotRange range = { s, s + 1 };
+      this->ranges.push_back(range);
+    }
+  }
+}
+
+bool SceneGraph::simdAvailable()
+{
+#ifdef __SSE__
+  return true;
+#else
+  return false;
+#endif
+}
+
+void SceneGraph::setSimd(bool simd)
+{
+  this->simd = simd && simdAvailable();
+}
+
+unsigned int SceneGraph::size() const
+{
+  return this->nodes.size();
+}
+
+unsigned int SceneGraph::depths() const
+{
+  return this->depthStart.empty() ? 0 : this->depthStart.size() - 1;
+}
+
+const float* SceneGraph::worlds() const
+{
+  return this->worldMatrices.empty() ? NULL : &this->worldMatrices[0];
+}
+
+unsigned int SceneGraph::slot(Node node) const
+{
+  return this->slots[node];
+}
+
+void SceneGraph::setMergeGap(unsigned int mergeGap)
+{
+  this->mergeGap = mergeGap;
+}
+
+const std::vector<SlotRange>& SceneGraph::changed() const
+{
+  return this->ranges;
+}
+
+unsigned int SceneGraph::recomputed() const
+{
+  return this->lastRecomputed;
+}
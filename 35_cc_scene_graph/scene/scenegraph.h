@@ -0,0 +1,89 @@
+#ifndef SCENEGRAPH_H
+#define SCENEGRAPH_H
+
+#include <cstddef>
+#include <vector>
+
+// slots [begin, end) of the world matrix array
+struct SlotRange
+{
+  unsigned int begin, end;
+};
+
+// scene graph with a flattened transform hierarchy
+//
+// matrices are 16 floats, column major (glUniformMatrix4fv without
+// transpose); world = world of the parent * local
+//
+// the nodes live in contiguous arrays (local, world, parent, dirty)
+// sorted by depth, so parents always come before their children.
+// setLocal() only sets a dirty flag; update() walks the depths in order:
+// a first linear pass over a depth ORs the flag of the parent into each
+// node and lists the dirty ones (without branches), a second one
+// recomputes their world matrices, 4x4 multiplies with SSE when compiled
+// in; clean subtrees are never touched
+//
+// Node handles stay valid when the arrays are re-sorted (after nodes
+// are added under a deeper level), slot() gives the current position
+class SceneGraph
+{
+  public:
+    typedef unsigned int Node;
+    static const Node NONE = 0xffffffffu;
+
+    SceneGraph();
+
+    // a new node under parent (NONE: a root), identity if local is NULL
+    Node create(Node parent, const float *local = NULL);
+
+    void setLocal(Node node, const float *local);
+    const float* local(Node node) const;
+    const float* world(Node node) const;   // as of the last update()
+    Node parent(Node node) const;
+
+    // recompute the world matrices of the dirty subtrees
+    void update();
+
+    // SSE 4x4 multiplies (default when available)
+    void setSimd(bool simd);
+    static bool simdAvailable();
+
+    unsigned int size() const;
+    unsigned int depths() const;
+
+    // world matrices in slot order, and the slot of a node
+    const float* worlds() const;
+    unsigned int slot(Node node) const;
+
+    // slots whose world matrix changed in the last update(), merged into
+    // ranges when they are less than mergeGap slots apart (one upload
+    // per range); everything after a re-sort
+    void setMergeGap(unsigned int mergeGap);
+    const std::vector<SlotRange>& changed() const;
+    unsigned int recomputed() const;
+
+  private:
+    void sort();
+    void multiply(const unsigned int *slots, unsigned int count);
+
+    // per slot
+    std::vector<float> locals;
+    std::vector<float> worldMatrices;
+    std::vector<unsigned int> parents;     // slot of the parent, itself for roots
+    std::vector<unsigned int> depth;
+    std::vector<unsigned char> dirty;
+    std::vector<Node> nodes;               // node of the slot
+
+    std::vector<unsigned int> slots;       // slot of the node
+    std::vector<unsigned int> depthStart;  // first slot of each depth, then size()
+    bool sorted;                           // no node before a shallower one
+    bool grown;                            // nodes added since update()
+
+    std::vector<unsigned int> updated;     // slots recomputed by update(), lastRecomputed of them
+    std::vector<SlotRange> ranges;
+    unsigned int mergeGap;
+    unsigned int lastRecomputed;
+    bool simd;
+};
+
+#endif
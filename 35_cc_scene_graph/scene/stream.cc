@@ -0,0 +1,72 @@
+#include "stream.h"
+
+#define MATRIX_BYTES (16 * sizeof(float))
+
+WorldStream::WorldStream()
+  : capacity(0), calls(0)
+{
+  glGenBuffers(1, &this->VBO);
+}
+
+WorldStream::~WorldStream()
+{
+  glDeleteBuffers(1, &this->VBO);
+}
+
+unsigned long WorldStream::upload(const SceneGraph &scene)
+{
+  if (scene.size() > this->capacity)
+    return this->uploadAll(scene);
+
+  const std::vector<SlotRange> &ranges = scene.changed();
+  const float *worlds = scene.worlds();
+  unsigned long bytes = 0;
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  for (size_t i = 0; i < ranges.size(); i++) {
+    GLsizeiptr size = (GLsizeiptr)(ranges[i].end - ranges[i].begin) * MATRIX_BYTES;
+    glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)ranges[i].begin * MATRIX_BYTES, size,
+                    worlds + ranges[i].begin * 16);
+    bytes += size;
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  this->calls = ranges.size();
+  return bytes;
+}
+
+unsigned long WorldStream::uploadAll(const SceneGraph &scene)
+{
+  GLsizeiptr size = (GLsizeiptr)scene.size() * MATRIX_BYTES;
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  if (scene.size() > this->capacity) {
+    // the VAOs keep pointing at the same buffer name
+    glBufferData(GL_ARRAY_BUFFER, size, scene.worlds(), GL_DYNAMIC_DRAW);
+    this->capacity = scene.size();
+  } else {
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, scene.worlds());
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  this->calls = 1;
+  return size;
+}
+
+void WorldStream::bind(GLuint location)
+{
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  for (GLuint column = 0; column < 4; column++) {
+    glVertexAttribPointer(location + column, 4, GL_FLOAT, GL_FALSE, MATRIX_BYTES,
+                          (void*)(column * 4 * sizeof(float)));
+    glEnableVertexAttribArray(location + column);
+    glVertexAttribDivisor(location + column, 1);   // advance once per instance
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+GLuint WorldStream::buffer() const
+{
+  return this->VBO;
+}
+
+unsigned int WorldStream::uploads() const
+{
+  return this->calls;
+}
@@ -0,0 +1,41 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <glad/glad.h>
+
+#include "scenegraph.h"
+
+// GPU copy of the world matrices of a SceneGraph, in slot order, used as
+// a per instance mat4 attribute (bind() sets four vec4 attributes from
+// location on, advancing once per instance)
+//
+// upload() sends only the ranges changed by the last update(), one
+// glBufferSubData each; when the scene grew the buffer is reallocated
+// and filled whole
+class WorldStream
+{
+  public:
+    WorldStream();
+    ~WorldStream();
+
+    // returns the bytes sent
+    unsigned long upload(const SceneGraph &scene);
+    // everything, whatever changed
+    unsigned long uploadAll(const SceneGraph &scene);
+
+    // on the bound VAO
+    void bind(GLuint location);
+
+    GLuint buffer() const;
+    unsigned int uploads() const;      // glBufferSubData calls of the last upload
+
+  private:
+    WorldStream(const WorldStream&);
+    WorldStream& operator=(const WorldStream&);
+
+    GLuint VBO;
+    unsigned int capacity;             // matrices
+    unsigned int calls;
+};
+
+#endif
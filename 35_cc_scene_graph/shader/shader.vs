@@ -0,0 +1,13 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in mat4 aWorld;     // per instance, locations 2 to 5
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = aWorld * vec4(aPos, 1.0f);
+  vertexColor = aColor;
+}
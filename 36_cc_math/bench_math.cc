@@ -0,0 +1,138 @@
+// bench_math.cc
+
+// math library benchmark: batch transforms per implementation
+// - mat4_pairs:   out[i] = a[i] * b[i]
+// - mat4_parent:  out[i] = parent * b[i]
+// - points_aos:   N vec3 by a mat4
+// - points_soa:   N points as x, y, z arrays by a mat4
+// millions of items per second, speedup over scalar and the largest
+// difference from the scalar results
+// usage: bench_math [count] [repeats]
+
+#include "vmath.h"
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <time.h>
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float randomFloat()
+{
+  return (rand() % 20001) / 10000.0f - 1.0f;
+}
+
+static const MathPath paths[3] = { MATH_SCALAR, MATH_SSE, MATH_AVX };
+static const char* pathNames[3] = { "scalar", "sse", "avx" };
+
+static void print(const char* operation, int path, double seconds, double items, double scalarSeconds,
+                  double difference)
+{
+  std::cout << std::setw(12) << operation << std::setw(8) << pathNames[path]
+            << std::fixed << std::setprecision(1)
+            << std::setw(10) << items / seconds / 1e6
+            << std::setprecision(2)
+            << std::setw(10) << seconds / items * 1e9
+            << std::setw(9) << scalarSeconds / seconds << "x"
+            << std::scientific << std::setprecision(1)
+            << std::setw(10) << difference << std::endl;
+}
+
+static double difference(const float *a, const float *b, size_t count)
+{
+  double d = 0.0;
+  for (size_t i = 0; i < count; i++)
+    d = std::max(d, (double)fabs(a[i] - b[i]));
+  return d;
+}
+
+int main(int argc, char *argv[])
+{
+  size_t count = argc > 1 ? atoi(argv[1]) : 100000;
+  unsigned int repeats = argc > 2 ? atoi(argv[2]) : 50;
+  if (count < 1) count = 1;
+  if (repeats < 1) repeats = 1;
+
+  srand(1);
+  std::vector<mat4> a(count), b(count), out(count), reference(count);
+  for (size_t i = 0; i < count; i++) {
+    a[i] = translate(vec3(randomFloat(), randomFloat(), randomFloat())) *
+           toMat4(normalize(quat(randomFloat(), randomFloat(), randomFloat(), randomFloat())));
+    b[i] = rotate(randomFloat() * 3.0f, vec3(randomFloat(), randomFloat(), 1.0f)) * scale(vec3(0.5f));
+  }
+  mat4 parent = a[0];
+  std::vector<vec3> points(count), pointsOut(count), pointsReference(count);
+  std::vector<float> x(count), y(count), z(count), outX(count), outY(count), outZ(count);
+  for (size_t i = 0; i < count; i++) {
+    points[i] = vec3(randomFloat(), randomFloat(), randomFloat());
+    x[i] = points[i].x;
+    y[i] = points[i].y;
+    z[i] = points[i].z;
+  }
+
+  std::cout << count << " items, " << repeats << " repeats, best path: "
+            << pathNames[mathBestPath() == MATH_AVX ? 2 : mathBestPath() == MATH_SSE ? 1 : 0] << std::endl;
+  std::cout << "   operation    path   Mitem/s   ns/item  speedup      diff" << std::endl;
+
+  for (int op = 0; op < 4; op++) {
+    const char* names[4] = { "mat4_pairs", "mat4_parent", "points_aos", "points_soa" };
+    double scalarSeconds = 0.0;
+    for (int p = 0; p < 3; p++) {
+      if (!mathPathAvailable(paths[p]))
+        continue;
+      // the AoS points have no AVX kernel
+      if (op == 2 && paths[p] == MATH_AVX)
+        continue;
+
+      double start = now();
+      for (unsigned int r = 0; r < repeats; r++) {
+        switch (op) {
+          case 0: multiplyMatrices(&a[0], &b[0], &out[0], count, paths[p]); break;
+          case 1: multiplyMatrices(parent, &b[0], &out[0], count, paths[p]); break;
+          case 2: transformPoints(parent, &points[0], &pointsOut[0], count, paths[p]); break;
+          default:
+            transformPoints(parent, &x[0], &y[0], &z[0], &outX[0], &outY[0], &outZ[0], count, paths[p]);
+        }
+      }
+      double seconds = now() - start;
+
+      double d = 0.0;
+      if (op < 2) {
+        if (p == 0) reference = out;
+        d = difference(reference[0].m, out[0].m, count * 16);
+      } else if (op == 2) {
+        if (p == 0) pointsReference = pointsOut;
+        d = difference(&pointsReference[0].x, &pointsOut[0].x, count * 3);
+      } else {
+        if (p == 0) {
+          for (size_t i = 0; i < count; i++)
+            pointsReference[i] = vec3(outX[i], outY[i], outZ[i]);
+        }
+        for (size_t i = 0; i < count; i++)
+          d = std::max(d, (double)length(pointsReference[i] - vec3(outX[i], outY[i], outZ[i])));
+      }
+      if (p == 0) scalarSeconds = seconds;
+      print(names[op], p, seconds, (double)count * repeats, scalarSeconds, d);
+    }
+  }
+
+  // sanity of the non batch operations
+  mat4 m = a[1];
+  double identityError = difference((m * inverse(m)).m, mat4().m, 16);
+  quat q = normalize(quat(0.3f, -0.5f, 0.2f, 0.8f));
+  vec3 v(0.3f, 0.7f, -1.1f);
+  vec3 byQuat = q * v, byMatrix = transformVector(toMat4(q), v);
+  std::cout << std::scientific << std::setprecision(1)
+            << "m * inverse(m) - I: " << identityError
+            << ", quat vs matrix rotation: " << length(byQuat - byMatrix) << std::endl;
+  return 0;
+}
@@ -0,0 +1,125 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// 4x4 kernels on column major float[16], shared by mat.h and batch.h
+//
+// SSE is used when the compiler targets it (always on x86-64); the AVX
+// kernels are compiled for AVX with a function attribute whatever the
+// compiler flags, and only called after mathPathAvailable(MATH_AVX)
+// checked the CPU; VMATH_SCALAR turns every SIMD path off
+
+#include <stddef.h>
+
+#if !defined(VMATH_SCALAR) && defined(__SSE__)
+#define VMATH_SSE 1
+#include <xmmintrin.h>
+#endif
+
+#if !defined(VMATH_SCALAR) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VMATH_AVX 1
+#include <immintrin.h>
+#define VMATH_TARGET_AVX __attribute__((target("avx")))
+#endif
+
+enum MathPath
+{
+  MATH_SCALAR,
+  MATH_SSE,
+  MATH_AVX,
+  MATH_BEST       // the fastest available
+};
+
+inline bool mathPathAvailable(MathPath path)
+{
+  switch (path) {
+    case MATH_SCALAR:
+    case MATH_BEST:
+      return true;
+    case MATH_SSE:
+#ifdef VMATH_SSE
+      return true;
+#else
+      return false;
+#endif
+    case MATH_AVX:
+#ifdef VMATH_AVX
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx");
+#else
+      return false;
+#endif
+  }
+  return false;
+}
+
+inline MathPath mathBestPath()
+{
+  static const MathPath best = mathPathAvailable(MATH_AVX) ? MATH_AVX :
+                               mathPathAvailable(MATH_SSE) ? MATH_SSE : MATH_SCALAR;
+  return best;
+}
+
+// out = a * b (out may not alias b)
+inline void multiply4x4Scalar(const float *a, const float *b, float *out)
+{
+  for (int j = 0; j < 4; j++)
+    for (int i = 0; i < 4; i++)
+      out[j * 4 + i] = a[i] * b[j * 4] + a[4 + i] * b[j * 4 + 1] +
+                       a[8 + i] * b[j * 4 + 2] + a[12 + i] * b[j * 4 + 3];
+}
+
+// out = m * v
+inline void multiply4x4VectorScalar(const float *m, const float *v, float *out)
+{
+  for (int i = 0; i < 4; i++)
+    out[i] = m[i] * v[0] + m[4 + i] * v[1] + m[8 + i] * v[2] + m[12 + i] * v[3];
+}
+
+#ifdef VMATH_SSE
+// each column of the result: the columns of a weighted by a column of b
+inline void multiply4x4Sse(const float *a, const float *b, float *out)
+{
+  __m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4);
+  __m128 a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+  __m128 r[4];
+  for (int j = 0; j < 4; j++) {
+    __m128 column = _mm_loadu_ps(b + j * 4);
+    r[j] = _mm_mul_ps(a0, _mm_shuffle_ps(column, column, 0x00));
+    r[j] = _mm_add_ps(r[j], _mm_mul_ps(a1, _mm_shuffle_ps(column, column, 0x55)));
+    r[j] = _mm_add_ps(r[j], _mm_mul_ps(a2, _mm_shuffle_ps(column, column, 0xaa)));
+    r[j] = _mm_add_ps(r[j], _mm_mul_ps(a3, _mm_shuffle_ps(column, column, 0xff)));
+  }
+  for (int j = 0; j < 4; j++)
+    _mm_storeu_ps(out + j * 4, r[j]);
+}
+
+inline void multiply4x4VectorSse(const float *m, const float *v, float *out)
+{
+  __m128 r = _mm_mul_ps(_mm_loadu_ps(m), _mm_set1_ps(v[0]));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 4), _mm_set1_ps(v[1])));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 8), _mm_set1_ps(v[2])));
+  r = _mm_add_ps(r, _mm_mul_ps(_mm_loadu_ps(m + 12), _mm_set1_ps(v[3])));
+  _mm_storeu_ps(out, r);
+}
+#endif
+
+// what mat4 operators use
+inline void multiply4x4(const float *a, const float *b, float *out)
+{
+#ifdef VMATH_SSE
+  multiply4x4Sse(a, b, out);
+#else
+  multiply4x4Scalar(a, b, out);
+#endif
+}
+
+inline void multiply4x4Vector(const float *m, const float *v, float *out)
+{
+#ifdef VMATH_SSE
+  multiply4x4VectorSse(m, v, out);
+#else
+  multiply4x4VectorScalar(m, v, out);
+#endif
+}
+
+#endif
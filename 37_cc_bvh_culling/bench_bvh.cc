@@ -0,0 +1,183 @@
+// bench_bvh.cc
+
+// frustum culling benchmark over N objects (1M by default) scattered in
+// a large flat world, seen from random cameras inside it
+// - build:    Bvh::build from scratch
+// - cull:     a linear pass over every box (scalar, SSE 4 wide, AVX 8
+//             wide) against the BVH (scalar, SSE 4 children per node);
+//             milliseconds per frustum, visible objects per frustum and
+//             whether each path found exactly the objects of the scalar
+//             linear pass
+// - refit:    a fraction of the objects moved (Bvh::move), then
+//             Bvh::refit; the cost (node area over root area) and the BVH
+//             cull time grow with the rounds until rebuildIfDegraded
+//             starts over
+// usage: bench_bvh [objects] [frusta] [moved percent]
+
+#include "vmath.h"
+#include "bvh.h"
+#include "boxlist.h"
+
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <time.h>
+
+#define WORLD_SIZE 1000.0f
+#define WORLD_HEIGHT 50.0f
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float randomFloat()
+{
+  return (rand() % 100001) / 100000.0f;
+}
+
+static Aabb randomBox()
+{
+  vec3 center(randomFloat() * WORLD_SIZE, randomFloat() * WORLD_HEIGHT, randomFloat() * WORLD_SIZE);
+  vec3 half(0.25f + randomFloat() * 0.75f);
+  return Aabb(center - half, center + half);
+}
+
+// looking around horizontally from a random point of the world
+static Frustum randomFrustum()
+{
+  vec3 eye(randomFloat() * WORLD_SIZE, WORLD_HEIGHT * 0.5f, randomFloat() * WORLD_SIZE);
+  float yaw = randomFloat() * 6.2831853f, pitch = (randomFloat() - 0.5f) * 0.5f;
+  vec3 forward(sinf(yaw) * cosf(pitch), sinf(pitch), -cosf(yaw) * cosf(pitch));
+  return Frustum(perspective(1.0f, 4.0f / 3.0f, 0.1f, 200.0f) *
+                 lookAt(eye, eye + forward, vec3(0.0f, 1.0f, 0.0f)));
+}
+
+struct Result
+{
+  double seconds;
+  double visible;
+  bool exact;
+};
+
+static std::vector<std::vector<unsigned int> > reference;
+
+// every frustum once; the visible lists are sorted and compared with
+// the reference (or become it)
+template <typename Culler>
+static Result measure(const Culler &culler, const std::vector<Frustum> &frusta, MathPath path, bool isReference)
+{
+  Result result = { 0.0, 0.0, true };
+  std::vector<unsigned int> visible;
+  if (isReference)
+    reference.resize(frusta.size());
+  for (unsigned int f = 0; f < frusta.size(); f++) {
+    double start = now();
+    culler.cull(frusta[f], visible, path);
+    result.seconds += now() - start;
+    result.visible += visible.size();
+
+    std::sort(visible.begin(), visible.end());
+    if (isReference)
+      reference[f] = visible;
+    else if (visible != reference[f])
+      result.exact = false;
+  }
+  result.seconds /= frusta.size();
+  result.visible /= frusta.size();
+  return result;
+}
+
+static void print(const char* name, const Result &r, double baseSeconds)
+{
+  std::cout << std::setw(14) << name << std::fixed << std::setprecision(3)
+            << std::setw(10) << r.seconds * 1000.0
+            << std::setprecision(0) << std::setw(10) << r.visible
+            << std::setprecision(1) << std::setw(9) << baseSeconds / r.seconds << "x"
+            << std::setw(7) << (r.exact ? "yes" : "NO") << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int objects = argc > 1 ? atoi(argv[1]) : 1000000;
+  unsigned int frustumCount = argc > 2 ? atoi(argv[2]) : 64;
+  unsigned int movedPercent = argc > 3 ? atoi(argv[3]) : 5;
+  if (objects < 1) objects = 1;
+  if (frustumCount < 1) frustumCount = 1;
+  if (movedPercent > 100) movedPercent = 100;
+
+  srand(1);
+  std::vector<Aabb> boxes(objects);
+  BoxList list;
+  list.resize(objects);
+  for (unsigned int i = 0; i < objects; i++) {
+    boxes[i] = randomBox();
+    list.set(i, boxes[i]);
+  }
+  std::vector<Frustum> frusta(frustumCount);
+  for (unsigned int f = 0; f < frustumCount; f++)
+    frusta[f] = randomFrustum();
+
+  Bvh bvh;
+  double start = now();
+  bvh.build(&boxes[0], objects);
+  double buildSeconds = now() - start;
+  std::cout << objects << " objects, " << frustumCount << " frusta, " << bvh.nodes() << " nodes, build "
+            << std::fixed << std::setprecision(1) << buildSeconds * 1000.0 << " ms, cost "
+            << std::setprecision(2) << bvh.cost() << std::endl;
+
+  std::cout << "          cull   ms/cull   visible  speedup  exact" << std::endl;
+  Result base = measure(list, frusta, MATH_SCALAR, true);
+  print("linear_scalar", base, base.seconds);
+  if (mathPathAvailable(MATH_SSE))
+    print("linear_sse", measure(list, frusta, MATH_SSE, false), base.seconds);
+  if (mathPathAvailable(MATH_AVX))
+    print("linear_avx", measure(list, frusta, MATH_AVX, false), base.seconds);
+  print("bvh_scalar", measure(bvh, frusta, MATH_SCALAR, false), base.seconds);
+  print("bvh_sse", measure(bvh, frusta, MATH_SSE, false), base.seconds);
+
+  // objects drift a little every round, the tree is only refitted
+  unsigned int moved = (unsigned long)objects * movedPercent / 100;
+  std::cout << "\nrefit: " << moved << " objects moved by up to 5 units per round" << std::endl;
+  std::cout << " round   move ms  refit ms    cost   bvh_sse ms" << std::endl;
+  std::vector<unsigned int> movedObjects(moved);
+  for (unsigned int round = 1; round <= 8; round++) {
+    for (unsigned int k = 0; k < moved; k++) {
+      unsigned int i = movedObjects[k] = rand() % objects;
+      vec3 step((randomFloat() - 0.5f) * 10.0f, 0.0f, (randomFloat() - 0.5f) * 10.0f);
+      boxes[i] = Aabb(boxes[i].min + step, boxes[i].max + step);
+      list.set(i, boxes[i]);
+    }
+
+    double moveStart = now();
+    for (unsigned int k = 0; k < moved; k++)
+      bvh.move(movedObjects[k], boxes[movedObjects[k]]);
+    double refitStart = now();
+    bvh.refit();
+    double refitEnd = now();
+
+    measure(list, frusta, MATH_SCALAR, true);
+    Result r = measure(bvh, frusta, MATH_SSE, false);
+    std::cout << std::setw(6) << round << std::fixed << std::setprecision(3)
+              << std::setw(10) << (refitStart - moveStart) * 1000.0
+              << std::setw(10) << (refitEnd - refitStart) * 1000.0
+              << std::setprecision(2) << std::setw(8) << bvh.cost()
+              << std::setprecision(3) << std::setw(13) << r.seconds * 1000.0
+              << (r.exact ? "" : "  NOT EXACT") << std::endl;
+  }
+
+  start = now();
+  bool rebuilt = bvh.rebuildIfDegraded(1.0f);
+  double rebuildSeconds = now() - start;
+  Result r = measure(bvh, frusta, MATH_SSE, false);
+  std::cout << "rebuild " << (rebuilt ? "done" : "skipped") << " in " << std::setprecision(1)
+            << rebuildSeconds * 1000.0 << " ms, cost " << std::setprecision(2) << bvh.cost()
+            << ", bvh_sse " << std::setprecision(3) << r.seconds * 1000.0 << " ms"
+            << (r.exact ? "" : "  NOT EXACT") << std::endl;
+  return 0;
+}
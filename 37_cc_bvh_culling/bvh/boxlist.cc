@@ -0,0 +1,181 @@
+#include "boxlist.h"
+
+// the arrays of a BoxList, for the kernels
+struct BoxArrays
+{
+  const float *minX, *minY, *minZ;
+  const float *maxX, *maxY, *maxZ;
+};
+
+// Frustum::intersects on boxes [begin, end), visible ones appended to out
+static unsigned int cullScalar(const Frustum &frustum, const BoxArrays &b, unsigned int begin,
+                               unsigned int end, unsigned int *out)
+{
+  float n[6][3], a[6][3], w[6];
+  for (int p = 0; p < 6; p++) {
+    for (int j = 0; j < 3; j++) {
+      n[p][j] = frustum.planes[p][j];
+      a[p][j] = fabsf(frustum.planes[p][j]);
+    }
+    w[p] = frustum.planes[p][3];
+  }
+
+  unsigned int count = 0;
+  for (unsigned int i = begin; i < end; i++) {
+    float cx = (b.minX[i] + b.maxX[i]) * 0.5f, ex = (b.maxX[i] - b.minX[i]) * 0.5f;
+    float cy = (b.minY[i] + b.maxY[i]) * 0.5f, ey = (b.maxY[i] - b.minY[i]) * 0.5f;
+    float cz = (b.minZ[i] + b.maxZ[i]) * 0.5f, ez = (b.maxZ[i] - b.minZ[i]) * 0.5f;
+    bool outside = false;
+    for (int p = 0; p < 6; p++) {
+      float d = n[p][0] * cx + n[p][1] * cy + n[p][2] * cz + w[p];
+      float r = a[p][0] * ex + a[p][1] * ey + a[p][2] * ez;
+      outside |= d + r < 0.0f;
+    }
+    out[count] = i;
+    count += !outside;
+  }
+  return count;
+}
+
+#ifdef VMATH_SSE
+static unsigned int cullSse(const Frustum &frustum, const BoxArrays &b, unsigned int size, unsigned int *out)
+{
+  __m128 n[6][3], a[6][3], w[6];
+  for (int p = 0; p < 6; p++) {
+    for (int j = 0; j < 3; j++) {
+      n[p][j] = _mm_set1_ps(frustum.planes[p][j]);
+      a[p][j] = _mm_set1_ps(fabsf(frustum.planes[p][j]));
+    }
+    w[p] = _mm_set1_ps(frustum.planes[p][3]);
+  }
+  const __m128 half = _mm_set1_ps(0.5f), zero = _mm_setzero_ps();
+
+  unsigned int count = 0, i = 0;
+  for (; i + 4 <= size; i += 4) {
+    __m128 minX = _mm_loadu_ps(b.minX + i), maxX = _mm_loadu_ps(b.maxX + i);
+    __m128 minY = _mm_loadu_ps(b.minY + i), maxY = _mm_loadu_ps(b.maxY + i);
+    __m128 minZ = _mm_loadu_ps(b.minZ + i), maxZ = _mm_loadu_ps(b.maxZ + i);
+    __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half), ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+    __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half), ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+    __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+    __m128 outside = zero;
+    for (int p = 0; p < 6; p++) {
+      __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(n[p][0], cx), _mm_mul_ps(n[p][1], cy)),
+                                       _mm_mul_ps(n[p][2], cz)), w[p]);
+      __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p][0], ex), _mm_mul_ps(a[p][1], ey)),
+                            _mm_mul_ps(a[p][2], ez));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), zero));
+    }
+
+    int visible = ~_mm_movemask_ps(outside) & 0xf;
+    while (visible) {
+      out[count++] = i + __builtin_ctz(visible);
+      visible &= visible - 1;
+    }
+  }
+  return count + cullScalar(frustum, b, i, size, out + count);
+}
+#endif
+
+#ifdef VMATH_AVX
+VMATH_TARGET_AVX static unsigned int cullAvx(const Frustum &frustum, const BoxArrays &b, unsigned int size,
+                                             unsigned int *out)
+{
+  __m256 n[6][3], a[6][3], w[6];
+  for (int p = 0; p < 6; p++) {
+    for (int j = 0; j < 3; j++) {
+      n[p][j] = _mm256_set1_ps(frustum.planes[p][j]);
+      a[p][j] = _mm256_set1_ps(fabsf(frustum.planes[p][j]));
+    }
+    w[p] = _mm256_set1_ps(frustum.planes[p][3]);
+  }
+  const __m256 half = _mm256_set1_ps(0.5f), zero = _mm256_setzero_ps();
+
+  unsigned int count = 0, i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __m256 minX = _mm256_loadu_ps(b.minX + i), maxX = _mm256_loadu_ps(b.maxX + i);
+    __m256 minY = _mm256_loadu_ps(b.minY + i), maxY = _mm256_loadu_ps(b.maxY + i);
+    __m256 minZ = _mm256_loadu_ps(b.minZ + i), maxZ = _mm256_loadu_ps(b.maxZ + i);
+    __m256 cx = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+    __m256 cy = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+    __m256 cz = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+    __m256 ex = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+    __m256 ey = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+    __m256 ez = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+    __m256 outside = zero;
+    for (int p = 0; p < 6; p++) {
+      __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(n[p][0], cx),
+                                                           _mm256_mul_ps(n[p][1], cy)),
+                                             _mm256_mul_ps(n[p][2], cz)), w[p]);
+      __m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[p][0], ex), _mm256_mul_ps(a[p][1], ey)),
+                               _mm256_mul_ps(a[p][2], ez));
+      outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, r), zero, _CMP_LT_OQ));
+    }
+
+    int visible = ~_mm256_movemask_ps(outside) & 0xff;
+    while (visible) {
+      out[count++] = i + __builtin_ctz(visible);
+      visible &= visible - 1;
+    }
+  }
+  return count + cullScalar(frustum, b, i, size, out + count);
+}
+#endif
+
+BoxList::BoxList()
+{
+}
+
+void BoxList::resize(unsigned int count)
+{
+  this->minX.resize(count);
+  this->minY.resize(count);
+  this->minZ.resize(count);
+  this->maxX.resize(count);
+  this->maxY.resize(count);
+  this->maxZ.resize(count);
+}
+
+void BoxList::set(unsigned int object, const Aabb &box)
+{
+  this->minX[object] = box.min.x;
+  this->minY[object] = box.min.y;
+  this->minZ[object] = box.min.z;
+  this->maxX[object] = box.max.x;
+  this->maxY[object] = box.max.y;
+  this->maxZ[object] = box.max.z;
+}
+
+unsigned int BoxList::size() const
+{
+  return this->minX.size();
+}
+
+void BoxList::cull(const Frustum &frustum, std::vector<unsigned int> &visible, MathPath path) const
+{
+  unsigned int size = this->size(), count = 0;
+  // the kernels write every index and only advance on the visible ones,
+  // never past the current box
+  visible.resize(size);
+  if (size > 0) {
+    BoxArrays b = { &this->minX[0], &this->minY[0], &this->minZ[0],
+                    &this->maxX[0], &this->maxY[0], &this->maxZ[0] };
+    switch (mathResolvePath(path)) {
+#ifdef VMATH_AVX
+      case MATH_AVX:
+        count = cullAvx(frustum, b, size, &visible[0]);
+        break;
+#endif
+#ifdef VMATH_SSE
+      case MATH_SSE:
+        count = cullSse(frustum, b, size, &visible[0]);
+        break;
+#endif
+      default:
+        count = cullScalar(frustum, b, 0, size, &visible[0]);
+    }
+  }
+  visible.resize(count);
+}
@@ -0,0 +1,347 @@
+#include "bvh.h"
+
+#include <algorithm>
+#include <cfloat>
+
+// orders objects by the center of their box along one axis (the sum of
+// min and max, the half is not needed to compare)
+struct CenterLess
+{
+  const Aabb *boxes;
+  int axis;
+
+  CenterLess(const Aabb *boxes, int axis) : boxes(boxes), axis(axis) {}
+  bool operator()(unsigned int a, unsigned int b) const
+  {
+    return boxes[a].min[axis] + boxes[a].max[axis] < boxes[b].min[axis] + boxes[b].max[axis];
+  }
+};
+
+static float area(const Aabb &box)
+{
+  vec3 d = box.max - box.min;
+  return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+Bvh::Bvh()
+  : moved(false), builtCost(0.0f)
+{
+}
+
+void Bvh::build(const Aabb *boxes, unsigned int count)
+{
+  this->boxes.assign(boxes, boxes + count);
+  this->rebuild();
+}
+
+void Bvh::rebuild()
+{
+  unsigned int count = this->boxes.size();
+  this->order.resize(count);
+  for (unsigned int i = 0; i < count; i++)
+    this->order[i] = i;
+  this->objectNode.resize(count);
+  this->objectLane.resize(count);
+
+  // a full 4 wide tree has about count / 3 nodes
+  this->tree.clear();
+  this->tree.reserve(count / 3 + 1);
+  if (count > 0) {
+    Node root;
+    root.parent = -1;
+    this->tree.push_back(root);
+    this->buildNode(0, 0, count);
+  }
+  this->dirty.assign(this->tree.size(), 0);
+  this->moved = false;
+  this->builtCost = this->cost();
+}
+
+// children are allocated together (siblings adjacent in memory), then
+// built one after the other
+void Bvh::buildNode(unsigned int node, unsigned int begin, unsigned int end)
+{
+  unsigned int bounds[5];
+  unsigned int groups;
+  if (end - begin <= 4) {
+    groups = end - begin;
+    for (unsigned int k = 0; k <= groups; k++)
+      bounds[k] = begin + k;
+  } else {
+    groups = 4;
+    bounds[0] = begin;
+    bounds[2] = this->split(begin, end);
+    bounds[1] = this->split(begin, bounds[2]);
+    bounds[3] = this->split(bounds[2], end);
+    bounds[4] = end;
+  }
+
+  this->tree[node].count = groups;
+  this->tree[node].begin = begin;
+  this->tree[node].end = end;
+  for (unsigned int k = groups; k < 4; k++) {
+    this->setLane(this->tree[node], k, Aabb(vec3(0.0f), vec3(0.0f)));
+    this->tree[node].child[k] = -1;
+  }
+
+  for (unsigned int k = 0; k < groups; k++) {
+    Aabb box = this->boxes[this->order[bounds[k]]];
+    for (unsigned int i = bounds[k] + 1; i < bounds[k + 1]; i++)
+      box = merge(box, this->boxes[this->order[i]]);
+    this->setLane(this->tree[node], k, box);
+
+    if (bounds[k + 1] - bounds[k] == 1) {
+      unsigned int object = this->order[bounds[k]];
+      this->tree[node].child[k] = ~(int)object;
+      this->objectNode[object] = node;
+      this->objectLane[object] = k;
+    } else {
+      Node child;
+      child.parent = node;
+      this->tree[node].child[k] = this->tree.size();
+      this->tree.push_back(child);
+    }
+  }
+
+  for (unsigned int k = 0; k < groups; k++) {
+    int child = this->tree[node].child[k];
+    if (child >= 0)
+      this->buildNode(child, bounds[k], bounds[k + 1]);
+  }
+}
+
+// median of the centers along the axis where they spread the most
+unsigned int Bvh::split(unsigned int begin, unsigned int end)
+{
+  vec3 low(FLT_MAX), high(-FLT_MAX);
+  for (unsigned int i = begin; i < end; i++) {
+    const Aabb &box = this->boxes[this->order[i]];
+    for (int a = 0; a < 3; a++) {
+      float c = box.min[a] + box.max[a];
+      low[a] = std::min(low[a], c);
+      high[a] = std::max(high[a], c);
+    }
+  }
+  vec3 spread = high - low;
+  int axis = spread.x > spread.y ? (spread.x > spread.z ? 0 : 2) : (spread.y > spread.z ? 1 : 2);
+
+  unsigned int middle = begin + (end - begin) / 2;
+  std::nth_element(this->order.begin() + begin, this->order.begin() + middle,
+                   this->order.begin() + end, CenterLess(&this->boxes[0], axis));
+  return middle;
+}
+
+void Bvh::setLane(Node &node, unsigned int lane, const Aabb &box)
+{
+  node.minX[lane] = box.min.x;
+  node.minY[lane] = box.min.y;
+  node.minZ[lane] = box.min.z;
+  node.maxX[lane] = box.max.x;
+  node.maxY[lane] = box.max.y;
+  node.maxZ[lane] = box.max.z;
+}
+
+void Bvh::move(unsigned int object, const Aabb &box)
+{
+  this->boxes[object] = box;
+  int node = this->objectNode[object];
+  this->setLane(this->tree[node], this->objectLane[object], box);
+  // stop at the first ancestor already dirty: the rest of its path is too
+  while (node >= 0 && !this->dirty[node]) {
+    this->dirty[node] = 1;
+    node = this->tree[node].parent;
+  }
+  this->moved = true;
+}
+
+// children have larger indices than their parent: walking backwards
+// refits every dirty node after all of its dirty children
+void Bvh::refit()
+{
+  if (!this->moved)
+    return;
+  for (unsigned int i = this->tree.size() - 1; i > 0; i--) {
+    if (!this->dirty[i])
+      continue;
+    this->dirty[i] = 0;
+
+    const Node &node = this->tree[i];
+    Aabb box(vec3(node.minX[0], node.minY[0], node.minZ[0]), vec3(node.maxX[0], node.maxY[0], node.maxZ[0]));
+    for (unsigned int k = 1; k < node.count; k++)
+      box = merge(box, Aabb(vec3(node.minX[k], node.minY[k], node.minZ[k]),
+                            vec3(node.maxX[k], node.maxY[k], node.maxZ[k])));
+
+    Node &parent = this->tree[node.parent];
+    for (unsigned int k = 0; k < parent.count; k++) {
+      if (parent.child[k] == (int)i) {
+        this->setLane(parent, k, box);
+        break;
+      }
+    }
+  }
+  this->dirty[0] = 0;
+  this->moved = false;
+}
+
+// the expected number of nodes a random ray (or small frustum) visits:
+// the surface areas of all the node boxes over the one of the root
+float Bvh::cost() const
+{
+  if (this->tree.empty())
+    return 0.0f;
+  const Node &root = this->tree[0];
+  Aabb rootBox(vec3(root.minX[0], root.minY[0], root.minZ[0]), vec3(root.maxX[0], root.maxY[0], root.maxZ[0]));
+  for (unsigned int k = 1; k < root.count; k++)
+    rootBox = merge(rootBox, Aabb(vec3(root.minX[k], root.minY[k], root.minZ[k]),
+                                  vec3(root.maxX[k], root.maxY[k], root.maxZ[k])));
+  float rootArea = area(rootBox);
+  if (rootArea <= 0.0f)
+    return 1.0f;
+
+  double sum = rootArea;
+  for (unsigned int i = 0; i < this->tree.size(); i++) {
+    const Node &node = this->tree[i];
+    for (unsigned int k = 0; k < node.count; k++) {
+      if (node.child[k] >= 0)
+        sum += area(Aabb(vec3(node.minX[k], node.minY[k], node.minZ[k]),
+                         vec3(node.maxX[k], node.maxY[k], node.maxZ[k])));
+    }
+  }
+  return sum / rootArea;
+}
+
+bool Bvh::rebuildIfDegraded(float ratio)
+{
+  this->refit();
+  if (this->cost() <= ratio * this->builtCost)
+    return false;
+  this->rebuild();
+  return true;
+}
+
+void Bvh::cull(const Frustum &frustum, std::vector<unsigned int> &visible, MathPath path) const
+{
+  // room for every object, trimmed at the end (no reallocation once
+  // the vector has grown)
+  visible.resize(this->boxes.size());
+  unsigned int count = 0;
+  if (!this->tree.empty()) {
+#ifdef VMATH_SSE
+    if (mathResolvePath(path) != MATH_SCALAR)
+      this->cullSse(frustum, &visible[0], count);
+    else
+#endif
+      this->cullScalar(frustum, &visible[0], count);
+  }
+  visible.resize(count);
+}
+
+// the same tests as Frustum::intersects, in the same order, so that
+// both paths agree bit for bit
+void Bvh::cullScalar(const Frustum &frustum, unsigned int *out, unsigned int &count) const
+{
+  unsigned int stack[128];
+  unsigned int top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const Node &node = this->tree[stack[--top]];
+    for (unsigned int k = 0; k < node.count; k++) {
+      float cx = (node.minX[k] + node.maxX[k]) * 0.5f, ex = (node.maxX[k] - node.minX[k]) * 0.5f;
+      float cy = (node.minY[k] + node.maxY[k]) * 0.5f, ey = (node.maxY[k] - node.minY[k]) * 0.5f;
+      float cz = (node.minZ[k] + node.maxZ[k]) * 0.5f, ez = (node.maxZ[k] - node.minZ[k]) * 0.5f;
+      bool outside = false, inside = true;
+      for (int p = 0; p < 6; p++) {
+        const float *n = frustum.planes[p];
+        float d = n[0] * cx + n[1] * cy + n[2] * cz + n[3];
+        float r = fabsf(n[0]) * ex + fabsf(n[1]) * ey + fabsf(n[2]) * ez;
+        outside |= d + r < 0.0f;
+        inside &= d - r >= 0.0f;
+      }
+      if (outside)
+        continue;
+
+      int child = node.child[k];
+      if (child < 0) {
+        out[count++] = ~child;
+      } else if (inside) {
+        const Node &subtree = this->tree[child];
+        for (unsigned int i = subtree.begin; i < subtree.end; i++)
+          out[count++] = this->order[i];
+      } else {
+        stack[top++] = child;
+      }
+    }
+  }
+}
+
+#ifdef VMATH_SSE
+// the 4 children of a node against one plane at a time
+void Bvh::cullSse(const Frustum &frustum, unsigned int *out, unsigned int &count) const
+{
+  __m128 n[6][3], a[6][3], w[6];
+  for (int p = 0; p < 6; p++) {
+    for (int j = 0; j < 3; j++) {
+      n[p][j] = _mm_set1_ps(frustum.planes[p][j]);
+      a[p][j] = _mm_set1_ps(fabsf(frustum.planes[p][j]));
+    }
+    w[p] = _mm_set1_ps(frustum.planes[p][3]);
+  }
+  const __m128 half = _mm_set1_ps(0.5f), zero = _mm_setzero_ps();
+
+  unsigned int stack[128];
+  unsigned int top = 0;
+  stack[top++] = 0;
+  while (top > 0) {
+    const Node &node = this->tree[stack[--top]];
+    __m128 minX = _mm_loadu_ps(node.minX), maxX = _mm_loadu_ps(node.maxX);
+    __m128 minY = _mm_loadu_ps(node.minY), maxY = _mm_loadu_ps(node.maxY);
+    __m128 minZ = _mm_loadu_ps(node.minZ), maxZ = _mm_loadu_ps(node.maxZ);
+    __m128 cx = _mm_mul_ps(_mm_add_ps(minX, maxX), half), ex = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+    __m128 cy = _mm_mul_ps(_mm_add_ps(minY, maxY), half), ey = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+    __m128 cz = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half), ez = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+    __m128 outside = zero, inside = _mm_cmpeq_ps(zero, zero);
+    for (int p = 0; p < 6; p++) {
+      __m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(n[p][0], cx), _mm_mul_ps(n[p][1], cy)),
+                                       _mm_mul_ps(n[p][2], cz)), w[p]);
+      __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p][0], ex), _mm_mul_ps(a[p][1], ey)),
+                            _mm_mul_ps(a[p][2], ez));
+      outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), zero));
+      inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_sub_ps(d, r), zero));
+    }
+
+    int used = (1 << node.count) - 1;
+    int visible = ~_mm_movemask_ps(outside) & used;
+    int entire = _mm_movemask_ps(inside) & visible;
+    while (visible) {
+      int k = __builtin_ctz(visible);
+      visible &= visible - 1;
+      int child = node.child[k];
+      if (child < 0) {
+        out[count++] = ~child;
+      } else if (entire & (1 << k)) {
+        const Node &subtree = this->tree[child];
+        for (unsigned int i = subtree.begin; i < subtree.end; i++)
+          out[count++] = this->order[i];
+      } else {
+        stack[top++] = child;
+      }
+    }
+  }
+}
+#endif
+
+unsigned int Bvh::size() const
+{
+  return this->boxes.size();
+}
+
+unsigned int Bvh::nodes() const
+{
+  return this->tree.size();
+}
+
+const Aabb& Bvh::box(unsigned int object) const
+{
+  return this->boxes[object];
+}
@@ -0,0 +1,80 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <vector>
+
+#include "frustum.h"
+
+// dynamic bounding volume hierarchy for frustum culling
+//
+// a 4 wide tree: each node stores the boxes of its (up to) 4 children
+// as separate x / y / z arrays, so one node is tested against a frustum
+// plane with a single SSE operation per coordinate; a child is either
+// another node or an object. Nodes are built top down by median splits
+// of the object centers along the longest axis, parents before
+// children, so a reverse walk of the node array sees every child before
+// its parent
+//
+// move() stores the new box of an object and marks its ancestors dirty,
+// refit() then grows / shrinks the dirty nodes bottom up without
+// changing the topology. Refits degrade the tree as objects travel;
+// cost() measures it (the node surface areas relative to the root) and
+// rebuildIfDegraded() starts over when it grew too much since the last
+// build
+//
+// cull() lists the objects whose boxes intersect the frustum; a subtree
+// entirely inside is emitted without further tests (its objects are a
+// contiguous range of the build order)
+class Bvh
+{
+  public:
+    Bvh();
+
+    // replaces the whole tree, objects are the indices of boxes
+    void build(const Aabb *boxes, unsigned int count);
+
+    void move(unsigned int object, const Aabb &box);
+    void refit();
+
+    float cost() const;
+    // rebuild when cost() > ratio * the cost right after the last build
+    bool rebuildIfDegraded(float ratio);
+
+    // visible is overwritten, in tree order; MATH_SCALAR or SSE (AVX
+    // uses the SSE path: a node has 4 children)
+    void cull(const Frustum &frustum, std::vector<unsigned int> &visible, MathPath path = MATH_BEST) const;
+
+    unsigned int size() const;
+    unsigned int nodes() const;
+    const Aabb& box(unsigned int object) const;
+
+  private:
+    struct Node
+    {
+      float minX[4], minY[4], minZ[4];
+      float maxX[4], maxY[4], maxZ[4];
+      int child[4];               // >= 0: a node, < 0: ~object
+      int parent;                 // -1: the root
+      unsigned int count;         // children in use, from lane 0
+      unsigned int begin, end;    // the objects of the subtree in order
+    };
+
+    void rebuild();
+    void buildNode(unsigned int node, unsigned int begin, unsigned int end);
+    unsigned int split(unsigned int begin, unsigned int end);
+    void setLane(Node &node, unsigned int lane, const Aabb &box);
+
+    void cullScalar(const Frustum &frustum, unsigned int *out, unsigned int &count) const;
+    void cullSse(const Frustum &frustum, unsigned int *out, unsigned int &count) const;
+
+    std::vector<Node> tree;
+    std::vector<unsigned char> dirty;
+    std::vector<Aabb> boxes;
+    std::vector<unsigned int> order;          // objects in leaf order
+    std::vector<unsigned int> objectNode;
+    std::vector<unsigned char> objectLane;
+    bool moved;
+    float builtCost;
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "vmath.h"
+
+struct Aabb
+{
+  vec3 min, max;
+
+  Aabb() {}
+  Aabb(const vec3 &min, const vec3 &max) : min(min), max(max) {}
+};
+
+inline Aabb merge(const Aabb &a, const Aabb &b)
+{
+  return Aabb(vec3(a.min.x < b.min.x ? a.min.x : b.min.x, a.min.y < b.min.y ? a.min.y : b.min.y,
+                   a.min.z < b.min.z ? a.min.z : b.min.z),
+              vec3(a.max.x > b.max.x ? a.max.x : b.max.x, a.max.y > b.max.y ? a.max.y : b.max.y,
+                   a.max.z > b.max.z ? a.max.z : b.max.z));
+}
+
+// the six planes (a x + b y + c z + d >= 0 inside) of a view projection
+// matrix, not normalized: only signs are tested
+struct Frustum
+{
+  float planes[6][4];
+
+  Frustum() {}
+  explicit Frustum(const mat4 &viewProjection)
+  {
+    // row 3 +- row 0, 1, 2 of the column major matrix
+    const float *m = viewProjection.m;
+    for (int p = 0; p < 6; p++) {
+      int row = p / 2;
+      float sign = p % 2 == 0 ? 1.0f : -1.0f;
+      for (int k = 0; k < 4; k++)
+        this->planes[p][k] = m[k * 4 + 3] + sign * m[k * 4 + row];
+    }
+  }
+
+  // center / extent form: a box is out when its nearest corner to the
+  // plane normal is behind it
+  bool intersects(const Aabb &box) const
+  {
+    vec3 c = (box.min + box.max) * 0.5f, e = (box.max - box.min) * 0.5f;
+    for (int p = 0; p < 6; p++) {
+      const float *n = this->planes[p];
+      float d = n[0] * c.x + n[1] * c.y + n[2] * c.z + n[3];
+      float r = fabsf(n[0]) * e.x + fabsf(n[1]) * e.y + fabsf(n[2]) * e.z;
+      if (d + r < 0.0f)
+        return false;
+    }
+    return true;
+  }
+};
+
+#endif
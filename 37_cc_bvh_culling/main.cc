@@ -0,0 +1,251 @@
+// main.cc
+
+// BVH frustum culling: only the objects inside the view are packed into
+// the instance buffer and drawn (one instanced draw, as in
+// 17_cc_job_system); 100k billboard triangles on a plane around a turning
+// camera, some of them wandering (refit every frame, rebuild when the
+// tree degraded); object 0 is the triangle of 13_cc_shader_class sliding
+// sideways by delta, culled whenever it leaves the screen
+// usage: ./main [objects]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "vmath.h"
+#include "bvh.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define WORLD_SIZE 100.0f
+#define MOVING_OBJECTS 2000
+#define REBUILD_FRAMES 120
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+// a billboard of half size 0.5 * scale turns around its center
+static Aabb bounds(const vec4 &instance)
+{
+  vec3 r(0.71f * instance.w);
+  return Aabb(instance.xyz() - r, instance.xyz() + r);
+}
+
+int main(int argc, char *argv[])
+{
+  unsigned int objects = argc > 1 ? atoi(argv[1]) : 100000;
+  if (objects < MOVING_OBJECTS + 1) objects = MOVING_OBJECTS + 1;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "BVH Culling", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  glEnable(GL_DEPTH_TEST);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // vertices data (a triangle)
+  float triangleVertices[] = {
+    // coords               // color
+    -0.5f,  -0.5f,  0.0f,   1.0f, 0.0f, 0.0f,
+     0.5f,  -0.5f,  0.0f,   0.0f, 1.0f, 0.0f,
+     0.0f,   0.5f,  0.0f,   0.0f, 0.0f, 1.0f
+  };
+  GLuint triangleIndices[] = {
+    0, 1, 2
+  };
+
+  GLuint triangleVAO, triangleVBO, triangleEBO;
+  glGenVertexArrays(1, &triangleVAO);
+  glGenBuffers(1, &triangleVBO);
+  glGenBuffers(1, &triangleEBO);
+
+  // bind triangle data
+  glBindVertexArray(triangleVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, triangleVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(triangleVertices), triangleVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(triangleIndices), triangleIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0,                  // vertex attribute to configure (loc = 0)
+                          3,                // size of vertex attribute, 3 coords
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glVertexAttribPointer(1,                  // vertex attribute to configure (loc = 1)
+                          3,                // size of vertex attribute, rgb
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          6*sizeof(float),  // stride
+                          (void*)(3*sizeof(GL_FLOAT))  // start at
+  );
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  // per instance position and scale of the visible objects, every frame
+  GLuint instanceVBO;
+  glGenBuffers(1, &instanceVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, objects * 4 * sizeof(float), NULL, GL_STREAM_DRAW);
+  glVertexAttribPointer(2,                  // vertex attribute to configure (loc = 2)
+                          4,                // size of vertex attribute, x y z scale
+                          GL_FLOAT,         // type of data
+                          GL_FALSE,         // don't normalize data
+                          4*sizeof(float),  // stride
+                          (void*)0          // start at
+  );
+  glEnableVertexAttribArray(2);
+  glVertexAttribDivisor(2, 1);              // advance once per instance
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  ourShader.use();
+  GLint viewProjectionLocation = glGetUniformLocation(ourShader.ID, "viewProjection");
+  GLint cameraRightLocation = glGetUniformLocation(ourShader.ID, "cameraRight");
+  GLint cameraUpLocation = glGetUniformLocation(ourShader.ID, "cameraUp");
+
+  // the scene is much larger than what the camera sees
+  std::vector<vec4> instances(objects), packed(objects);
+  std::vector<vec3> velocities(MOVING_OBJECTS + 1);
+  std::vector<Aabb> boxes(objects);
+  unsigned int seed = 1;
+  for (unsigned int i = 0; i < objects; i++) {
+    float r[4];
+    for (int k = 0; k < 4; k++) {
+      seed = seed * 1103515245u + 12345u;
+      r[k] = ((seed >> 8) % 10000) / 10000.0f;
+    }
+    instances[i] = vec4((r[0] * 2.0f - 1.0f) * WORLD_SIZE, r[1] * 3.0f, (r[2] * 2.0f - 1.0f) * WORLD_SIZE,
+                        0.5f + r[3]);
+    if (i <= MOVING_OBJECTS)
+      velocities[i] = vec3(r[1] - 0.5f, 0.0f, r[3] - 0.5f) * 8.0f;
+    boxes[i] = bounds(instances[i]);
+  }
+
+  Bvh bvh;
+  bvh.build(&boxes[0], objects);
+  std::cout << objects << " objects, " << bvh.nodes() << " BVH nodes" << std::endl;
+
+  std::vector<unsigned int> visible;
+  unsigned int frame = 0, rebuilds = 0;
+  double cullTime = 0.0;
+  float lastTime = glfwGetTime();
+
+  // game loop
+  while(!glfwWindowShouldClose(window))
+  {
+    processInput(window);
+
+    float t = glfwGetTime();
+    float dt = t - lastTime;
+    lastTime = t;
+
+    // the camera turns around on the spot
+    float yaw = t * 0.2f;
+    vec3 eye(0.0f, 2.0f, 0.0f), forward(sinf(yaw), 0.0f, -cosf(yaw)), right(cosf(yaw), 0.0f, sinf(yaw));
+    int width, height;
+    glfwGetFramebufferSize(window, &width, &height);
+    mat4 viewProjection = perspective(0.8f, (float)width / (height > 0 ? height : 1), 0.1f, 60.0f) *
+                          lookAt(eye, eye + forward, vec3(0.0f, 1.0f, 0.0f));
+
+    // object 0 slides across the view and out of it on both sides
+    float delta = sinf(t) * 5.0f;
+    instances[0] = vec4(eye + forward * 5.0f + right * delta, 1.0f);
+    bvh.move(0, bounds(instances[0]));
+
+    // the wanderers bounce on the border of the world
+    for (unsigned int i = 1; i <= MOVING_OBJECTS; i++) {
+      vec3 p = instances[i].xyz() + velocities[i] * dt;
+      if (p.x < -WORLD_SIZE || p.x > WORLD_SIZE) velocities[i].x = -velocities[i].x;
+      if (p.z < -WORLD_SIZE || p.z > WORLD_SIZE) velocities[i].z = -velocities[i].z;
+      instances[i] = vec4(p, instances[i].w);
+      bvh.move(i, bounds(instances[i]));
+    }
+    bvh.refit();
+    if (++frame % REBUILD_FRAMES == 0 && bvh.rebuildIfDegraded(1.2f))
+      rebuilds++;
+
+    // cull, then pack the visible instances contiguously
+    double start = glfwGetTime();
+    bvh.cull(Frustum(viewProjection), visible);
+    cullTime += glfwGetTime() - start;
+    for (unsigned int k = 0; k < visible.size(); k++)
+      packed[k] = instances[visible[k]];
+
+    if (frame % REBUILD_FRAMES == 0) {
+      std::cout << std::fixed << std::setprecision(3)
+                << "visible " << std::setw(7) << visible.size() << " / " << objects
+                << ", cull " << cullTime / REBUILD_FRAMES * 1000.0 << " ms"
+                << ", cost " << std::setprecision(2) << bvh.cost()
+                << ", rebuilds " << rebuilds << std::endl;
+      cullTime = 0.0;
+    }
+
+    // set the color buffer
+    glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // upload and draw all the visible objects at once
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, visible.size() * 4 * sizeof(float), &packed[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    ourShader.use();
+    glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection.ptr());
+    glUniform3f(cameraRightLocation, right.x, right.y, right.z);
+    glUniform3f(cameraUpLocation, 0.0f, 1.0f, 0.0f);
+    glBindVertexArray(triangleVAO);
+    glDrawElementsInstanced(GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, visible.size());
+
+    glfwSwapBuffers(window);
+    glfwPollEvents();
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
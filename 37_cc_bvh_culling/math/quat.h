@@ -0,0 +1,96 @@
+#ifndef QUAT_H
+#define QUAT_H
+
+#include "vec.h"
+#include "mat.h"
+
+// rotation quaternion x i + y j + z k + w; a * b rotates by b, then a
+struct quat
+{
+  float x, y, z, w;
+
+  // identity
+  quat() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+  quat(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+};
+
+// counterclockwise around axis, angle in radians
+inline quat angleAxis(float angle, const vec3 &axis)
+{
+  vec3 u = normalize(axis) * sinf(angle * 0.5f);
+  return quat(u.x, u.y, u.z, cosf(angle * 0.5f));
+}
+
+inline quat operator*(const quat &a, const quat &b)
+{
+  return quat(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+              a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+              a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+              a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+
+inline quat& operator*=(quat &a, const quat &b)
+{
+  a = a * b;
+  return a;
+}
+
+inline float dot(const quat &a, const quat &b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+inline float length(const quat &q) { return sqrtf(dot(q, q)); }
+inline quat conjugate(const quat &q) { return quat(-q.x, -q.y, -q.z, q.w); }
+
+inline quat normalize(const quat &q)
+{
+  float s = 1.0f / length(q);
+  return quat(q.x * s, q.y * s, q.z * s, q.w * s);
+}
+
+inline quat inverse(const quat &q)
+{
+  float s = 1.0f / dot(q, q);
+  return quat(-q.x * s, -q.y * s, -q.z * s, q.w * s);
+}
+
+// q v q^-1 for a unit q, without building the product
+inline vec3 operator*(const quat &q, const vec3 &v)
+{
+  vec3 u(q.x, q.y, q.z);
+  vec3 t = cross(u, v) * 2.0f;
+  return v + t * q.w + cross(u, t);
+}
+
+inline mat3 toMat3(const quat &q)
+{
+  float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+  float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+  return mat3(vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)),
+              vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)),
+              vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)));
+}
+
+inline mat4 toMat4(const quat &q)
+{
+  return mat4(toMat3(q));
+}
+
+// shortest arc, falls back to a normalized lerp when a and b are close
+inline quat slerp(const quat &a, const quat &b, float t)
+{
+  quat c = b;
+  float cosine = dot(a, b);
+  if (cosine < 0.0f) {
+    c = quat(-b.x, -b.y, -b.z, -b.w);
+    cosine = -cosine;
+  }
+  float wa = 1.0f - t, wb = t;
+  if (cosine < 0.9995f) {
+    float angle = acosf(cosine), s = 1.0f / sinf(angle);
+    wa = sinf(wa * angle) * s;
+    wb = sinf(wb * angle) * s;
+  }
+  quat r(a.x * wa + c.x * wb, a.y * wa + c.y * wb, a.z * wa + c.z * wb, a.w * wa + c.w * wb);
+  return cosine < 0.9995f ? r : normalize(r);
+}
+
+#endif
@@ -0,0 +1,19 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec4 aInstance;   // world position, scale
+
+uniform mat4 viewProjection;
+uniform vec3 cameraRight;
+uniform vec3 cameraUp;
+
+out vec3 vertexColor;
+
+void main()
+{
+  // billboard: the triangle always faces the camera
+  vec3 position = aInstance.xyz + (cameraRight * aPos.x + cameraUp * aPos.y) * aInstance.w;
+  gl_Position = viewProjection * vec4(position, 1.0f);
+  vertexColor = aColor;
+}
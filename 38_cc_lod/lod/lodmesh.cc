@@ -0,0 +1,96 @@
+#include "lodmesh.h"
+
+LodMesh::LodMesh(const std::vector<Mesh> &levels, unsigned int capacity)
+  : capacity(capacity)
+{
+  // levels one after the other; indices stay relative to their level
+  // (base vertex)
+  std::vector<float> vertices;
+  std::vector<GLuint> indices;
+  for (size_t i = 0; i < levels.size(); i++) {
+    Level level;
+    level.baseVertex = vertices.size() / 6;
+    level.firstIndex = indices.size();
+    level.indexCount = levels[i].indices.size();
+    level.error = levels[i].error;
+    this->table.push_back(level);
+    vertices.insert(vertices.end(), levels[i].vertices.begin(), levels[i].vertices.end());
+    indices.insert(indices.end(), levels[i].indices.begin(), levels[i].indices.end());
+  }
+
+  glGenVertexArrays(1, &this->VAO);
+  glGenBuffers(1, &this->VBO);
+  glGenBuffers(1, &this->EBO);
+  glGenBuffers(1, &this->instanceVBO);
+
+  glBindVertexArray(this->VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.empty() ? NULL : &vertices[0],
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.empty() ? NULL : &indices[0],
+               GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)capacity * 4 * sizeof(float), NULL, GL_STREAM_DRAW);
+  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(2);
+  glVertexAttribDivisor(2, 1);              // advance once per instance
+
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+}
+
+LodMesh::~LodMesh()
+{
+  glDeleteBuffers(1, &this->instanceVBO);
+  glDeleteBuffers(1, &this->EBO);
+  glDeleteBuffers(1, &this->VBO);
+  glDeleteVertexArrays(1, &this->VAO);
+}
+
+void LodMesh::upload(const float *instances, unsigned int count)
+{
+  if (count > this->capacity) count = this->capacity;
+  if (count == 0) return;
+  // orphan the storage: the draws of the last frame may still read it
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVBO);
+  glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)this->capacity * 4 * sizeof(float), NULL, GL_STREAM_DRAW);
+  glBufferSubData(GL_ARRAY_BUFFER, 0, count * 4 * sizeof(float), instances);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void LodMesh::draw(unsigned int level, unsigned int first, unsigned int count) const
+{
+  if (level >= this->table.size() || count == 0 || first + count > this->capacity)
+    return;
+  const Level &l = this->table[level];
+  glBindVertexArray(this->VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->instanceVBO);
+  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 4*sizeof(float), (void*)(first * 4 * sizeof(float)));
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glDrawElementsInstancedBaseVertex(GL_TRIANGLES, l.indexCount, GL_UNSIGNED_INT,
+                                    (void*)(l.firstIndex * sizeof(GLuint)), count, l.baseVertex);
+}
+
+unsigned int LodMesh::levels() const
+{
+  return this->table.size();
+}
+
+unsigned int LodMesh::triangles(unsigned int level) const
+{
+  return level < this->table.size() ? this->table[level].indexCount / 3 : 0;
+}
+
+std::vector<float> LodMesh::errors() const
+{
+  std::vector<float> errors;
+  for (size_t i = 0; i < this->table.size(); i++)
+    errors.push_back(this->table[i].error);
+  return errors;
+}
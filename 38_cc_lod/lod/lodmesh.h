@@ -0,0 +1,50 @@
+#ifndef LODMESH_H
+#define LODMESH_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+#include "mesh.h"
+
+// the levels of detail of a mesh (finest first) in one vertex and one
+// index buffer, drawn instanced level by level
+//
+// vertex attributes: 0 position and 1 color (per vertex), 2 a vec4 per
+// instance (x y z position, dither fade, see shader.fs); the instances
+// of a frame are uploaded once, grouped by level, and each draw points
+// attribute 2 at its group (no base instance in OpenGL 3.3); the
+// caller binds the program
+class LodMesh
+{
+  public:
+    // capacity: most instances uploaded at once
+    LodMesh(const std::vector<Mesh> &levels, unsigned int capacity);
+    ~LodMesh();
+
+    void upload(const float *instances, unsigned int count);
+    // instances [first, first + count) of the last upload
+    void draw(unsigned int level, unsigned int first, unsigned int count) const;
+
+    unsigned int levels() const;
+    unsigned int triangles(unsigned int level) const;
+    std::vector<float> errors() const;
+
+  private:
+    LodMesh(const LodMesh&);
+    LodMesh& operator=(const LodMesh&);
+
+    struct Level
+    {
+      GLint baseVertex;
+      GLuint firstIndex;
+      GLsizei indexCount;
+      float error;
+    };
+
+    std::vector<Level> table;
+    GLuint VAO, VBO, EBO, instanceVBO;
+    unsigned int capacity;
+};
+
+#endif
@@ -0,0 +1,79 @@
+#include "selector.h"
+
+#include <algorithm>
+#include <cmath>
+
+// closer than this counts as this close (inside the bounding sphere)
+#define MIN_DISTANCE 0.001f
+
+LodSelector::LodSelector(const std::vector<float> &errors)
+  : errors(errors), pixelScale(1.0f), threshold(1.0f), hysteresis(0.25f), fadeTime(0.0f)
+{
+  if (this->errors.empty())
+    this->errors.push_back(0.0f);
+  for (size_t i = 1; i < this->errors.size(); i++)
+    this->errors[i] = std::max(this->errors[i], this->errors[i - 1]);
+}
+
+void LodSelector::setProjection(float fovy, float viewportHeight)
+{
+  this->pixelScale = viewportHeight / (2.0f * tanf(fovy * 0.5f));
+}
+
+void LodSelector::setThreshold(float pixels)
+{
+  this->threshold = pixels;
+}
+
+void LodSelector::setHysteresis(float fraction)
+{
+  this->hysteresis = std::min(1.0f, std::max(0.0f, fraction));
+}
+
+void LodSelector::setFadeTime(float seconds)
+{
+  this->fadeTime = std::max(0.0f, seconds);
+}
+
+float LodSelector::projectedError(unsigned int level, float distance) const
+{
+  return this->errors[level] * this->pixelScale / std::max(distance, MIN_DISTANCE);
+}
+
+unsigned int LodSelector::select(unsigned int current, float distance) const
+{
+  unsigned int level = 0;
+  while (level + 1 < this->errors.size() && this->projectedError(level + 1, distance) <= this->threshold)
+    level++;
+
+  // coarser only well under the threshold, or stay
+  float coarser = this->threshold * (1.0f - this->hysteresis);
+  while (level > current && this->projectedError(level, distance) > coarser)
+    level--;
+  return level;
+}
+
+void LodSelector::update(LodState &state, float distance, float dt) const
+{
+  if (state.fade < 1.0f) {
+    state.fade = std::min(1.0f, state.fade + dt / this->fadeTime);
+    return;
+  }
+  unsigned int level = this->select(state.level, distance);
+  if (level != state.level) {
+    state.previous = state.level;
+    state.level = level;
+    state.fade = this->fadeTime > 0.0f ? 0.0f : 1.0f;
+  }
+}
+
+void LodSelector::reset(LodState &state, float distance) const
+{
+  state.level = state.previous = this->select(this->errors.size() - 1, distance);
+  state.fade = 1.0f;
+}
+
+unsigned int LodSelector::levels() const
+{
+  return this->errors.size();
+}
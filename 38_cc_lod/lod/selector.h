@@ -0,0 +1,58 @@
+#ifndef SELECTOR_H
+#define SELECTOR_H
+
+#include <vector>
+
+// per object state: the level drawn and, while a cross-fade runs, the
+// level it replaces (fade goes 0 -> 1, 1 when settled)
+struct LodState
+{
+  unsigned int level, previous;
+  float fade;
+
+  LodState() : level(0), previous(0), fade(1.0f) {}
+};
+
+// discrete level of detail selection by screen space error
+//
+// a level with an object space error e (Mesh::error) seen at distance d
+// is off by e * pixelScale / d pixels, pixelScale = viewport height /
+// (2 tan(fovy / 2)); the coarsest level within threshold pixels wins.
+// To go coarser the error must also stay below threshold * (1 -
+// hysteresis), so an object at a boundary does not switch every frame;
+// finer levels are taken as soon as the current one is over the
+// threshold
+//
+// with a fade time each switch starts a cross-fade: both levels are
+// drawn with complementary dither patterns for that long (no blending,
+// no sorting), and the object does not switch again before it ends
+class LodSelector
+{
+  public:
+    // errors of the levels, finest first (made non decreasing)
+    explicit LodSelector(const std::vector<float> &errors);
+
+    void setProjection(float fovy, float viewportHeight);
+    void setThreshold(float pixels);
+    void setHysteresis(float fraction);
+    void setFadeTime(float seconds);     // 0: switch at once
+
+    float projectedError(unsigned int level, float distance) const;
+    unsigned int select(unsigned int current, float distance) const;
+
+    // the level for this frame, starting or advancing a cross-fade
+    void update(LodState &state, float distance, float dt) const;
+    // the level for the distance, no fade (new objects, teleports)
+    void reset(LodState &state, float distance) const;
+
+    unsigned int levels() const;
+
+  private:
+    std::vector<float> errors;
+    float pixelScale;
+    float threshold;
+    float hysteresis;
+    float fadeTime;
+};
+
+#endif
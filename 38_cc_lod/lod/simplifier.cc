@@ -0,0 +1,417 @@
+#include "simplifier.h"
+
+#include <algorithm>
+#include <iterator>
+#include <queue>
+#include <cmath>
+
+#include "vmath.h"
+
+// planes across open borders weigh this much more than the triangles
+#define BORDER_WEIGHT 10.0
+
+// symmetric 4x4 matrix, the sum of the outer products of planes
+// (a, b, c, d): xx xy xz xw yy yz yw zz zw ww
+struct Quadric
+{
+  double q[10];
+
+  Quadric()
+  {
+    for (int i = 0; i < 10; i++) q[i] = 0.0;
+  }
+  Quadric(double a, double b, double c, double d, double weight)
+  {
+    q[0] = a * a * weight; q[1] = a * b * weight; q[2] = a * c * weight; q[3] = a * d * weight;
+    q[4] = b * b * weight; q[5] = b * c * weight; q[6] = b * d * weight;
+    q[7] = c * c * weight; q[8] = c * d * weight;
+    q[9] = d * d * weight;
+  }
+
+  void add(const Quadric &other)
+  {
+    for (int i = 0; i < 10; i++) q[i] += other.q[i];
+  }
+
+  // the sum of the squared distances of p to the planes
+  double evaluate(const vec3 &p) const
+  {
+    double x = p.x, y = p.y, z = p.z;
+    return q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x +
+           q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y +
+           q[7] * z * z + 2.0 * q[8] * z + q[9];
+  }
+
+  // the point of least error, false when the planes do not pin one down
+  // (flat or cylindrical neighborhoods)
+  bool minimum(vec3 &p) const
+  {
+    double det = q[0] * (q[4] * q[7] - q[5] * q[5]) - q[1] * (q[1] * q[7] - q[5] * q[2]) +
+                 q[2] * (q[1] * q[5] - q[4] * q[2]);
+    if (fabs(det) < 1e-8)
+      return false;
+    double bx = -q[3], by = -q[6], bz = -q[8];
+    p.x = (bx * (q[4] * q[7] - q[5] * q[5]) - q[1] * (by * q[7] - q[5] * bz) + q[2] * (by * q[5] - q[4] * bz)) / det;
+    p.y = (q[0] * (by * q[7] - bz * q[5]) - bx * (q[1] * q[7] - q[5] * q[2]) + q[2] * (q[1] * bz - by * q[2])) / det;
+    p.z = (q[0] * (q[4] * bz - q[5] * by) - q[1] * (q[1] * bz - by * q[2]) + bx * (q[1] * q[5] - q[4] * q[2])) / det;
+    return true;
+  }
+};
+
+// distance of p to the triangle abc: to its plane when p projects
+// inside it, else to the closest edge or corner
+static float triangleDistance(const vec3 &p, const vec3 &a, const vec3 &b, const vec3 &c)
+{
+  vec3 ab = b - a, ac = c - a, ap = p - a;
+  float d1 = dot(ab, ap), d2 = dot(ac, ap);
+  if (d1 <= 0.0f && d2 <= 0.0f)
+    return length(ap);
+  vec3 bp = p - b;
+  float d3 = dot(ab, bp), d4 = dot(ac, bp);
+  if (d3 >= 0.0f && d4 <= d3)
+    return length(bp);
+  vec3 cp = p - c;
+  float d5 = dot(ab, cp), d6 = dot(ac, cp);
+  if (d6 >= 0.0f && d5 <= d6)
+    return length(cp);
+
+  float vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+    return length(ap - ab * (d1 / (d1 - d3)));
+  float vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+    return length(ap - ac * (d2 / (d2 - d6)));
+  float va = d3 * d6 - d5 * d4;
+  if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+    return length(bp - (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+
+  float sum = va + vb + vc;
+  return length(ap - ab * (vb / sum) - ac * (vc / sum));
+}
+
+// removes vertex b, a moves to target; valid while neither end changed
+// since (the versions), ordered cheapest first in a priority_queue
+struct Collapse
+{
+  double cost;
+  unsigned int a, b;
+  unsigned int versionA, versionB;
+  vec3 target;
+  float t;                      // target along a -> b, for the color
+
+  bool operator<(const Collapse &other) const { return this->cost > other.cost; }
+};
+
+// an edge seen from one of its triangles
+struct EdgeRef
+{
+  unsigned int a, b, triangle;
+
+  bool operator<(const EdgeRef &other) const
+  {
+    return this->a != other.a ? this->a < other.a : this->b < other.b;
+  }
+};
+
+class Simplifier
+{
+  public:
+    explicit Simplifier(const Mesh &mesh);
+    void run(unsigned int targetTriangles);
+    Mesh result() const;
+
+  private:
+    float distance(const vec3 &p) const;
+    vec3 normal(unsigned int triangle) const;
+    void neighbors(unsigned int v, std::vector<unsigned int> &out) const;
+    bool contains(unsigned int triangle, unsigned int v) const;
+    bool valid(const Collapse &c) const;
+    bool flips(unsigned int v, unsigned int other, const vec3 &target) const;
+    void push(unsigned int a, unsigned int b);
+    void apply(const Collapse &c);
+
+    std::vector<vec3> original, position, color;
+    std::vector<Quadric> quadric;
+    std::vector<unsigned int> version;
+    std::vector<unsigned char> vertexAlive;
+    std::vector<std::vector<unsigned int> > vertexTriangles;
+    std::vector<unsigned int> triangle;         // 3 vertices each
+    std::vector<unsigned char> triangleAlive;
+    unsigned int triangles;
+    std::priority_queue<Collapse> queue;
+};
+
+Simplifier::Simplifier(const Mesh &mesh)
+  : triangles(mesh.indices.size() / 3)
+{
+  unsigned int vertices = mesh.vertices.size() / 6;
+  this->position.resize(vertices);
+  this->color.resize(vertices);
+  for (unsigned int i = 0; i < vertices; i++) {
+    const float *v = &mesh.vertices[i * 6];
+    this->position[i] = vec3(v[0], v[1], v[2]);
+    this->color[i] = vec3(v[3], v[4], v[5]);
+  }
+  this->original = this->position;
+  this->quadric.resize(vertices);
+  this->version.assign(vertices, 0);
+  this->vertexAlive.assign(vertices, 1);
+  this->vertexTriangles.resize(vertices);
+  this->triangle.assign(mesh.indices.begin(), mesh.indices.begin() + this->triangles * 3);
+  this->triangleAlive.assign(this->triangles, 1);
+
+  // the plane of every triangle goes to its three vertices
+  std::vector<EdgeRef> edges;
+  for (unsigned int t = 0; t < this->triangles; t++) {
+    const unsigned int *v = &this->triangle[t * 3];
+    vec3 n = this->normal(t);
+    float area = length(n);
+    if (area > 0.0f) {
+      n = n / area;
+      Quadric plane(n.x, n.y, n.z, -dot(n, this->position[v[0]]), 1.0);
+      for (int k = 0; k < 3; k++)
+        this->quadric[v[k]].add(plane);
+    }
+    for (int k = 0; k < 3; k++) {
+      this->vertexTriangles[v[k]].push_back(t);
+      EdgeRef e = { std::min(v[k], v[(k + 1) % 3]), std::max(v[k], v[(k + 1) % 3]), t };
+      edges.push_back(e);
+    }
+  }
+
+  // every edge once; the ones of a single triangle are borders
+  std::sort(edges.begin(), edges.end());
+  for (size_t i = 0; i < edges.size(); ) {
+    size_t j = i + 1;
+    while (j < edges.size() && edges[j].a == edges[i].a && edges[j].b == edges[i].b)
+      j++;
+    const EdgeRef &e = edges[i];
+    if (j - i == 1) {
+      vec3 n = this->normal(e.triangle);
+      vec3 across = cross(this->position[e.b] - this->position[e.a], n);
+      float l = length(across);
+      if (l > 0.0f) {
+        across = across / l;
+        Quadric border(across.x, across.y, across.z, -dot(across, this->position[e.a]), BORDER_WEIGHT);
+        this->quadric[e.a].add(border);
+        this->quadric[e.b].add(border);
+      }
+    }
+    i = j;
+  }
+  for (size_t i = 0; i < edges.size(); i++) {
+    if (i == 0 || edges[i].a != edges[i - 1].a || edges[i].b != edges[i - 1].b)
+      this->push(edges[i].a, edges[i].b);
+  }
+}
+
+vec3 Simplifier::normal(unsigned int t) const
+{
+  const unsigned int *v = &this->triangle[t * 3];
+  return cross(this->position[v[1]] - this->position[v[0]], this->position[v[2]] - this->position[v[0]]);
+}
+
+bool Simplifier::contains(unsigned int t, unsigned int v) const
+{
+  const unsigned int *tv = &this->triangle[t * 3];
+  return tv[0] == v || tv[1] == v || tv[2] == v;
+}
+
+void Simplifier::neighbors(unsigned int v, std::vector<unsigned int> &out) const
+{
+  out.clear();
+  const std::vector<unsigned int> &around = this->vertexTriangles[v];
+  for (size_t i = 0; i < around.size(); i++) {
+    if (!this->triangleAlive[around[i]])
+      continue;
+    const unsigned int *tv = &this->triangle[around[i] * 3];
+    for (int k = 0; k < 3; k++) {
+      if (tv[k] != v)
+        out.push_back(tv[k]);
+    }
+  }
+  std::sort(out.begin(), out.end());
+  out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+// the cheapest of the optimal point, both ends and the middle
+void Simplifier::push(unsigned int a, unsigned int b)
+{
+  Quadric q = this->quadric[a];
+  q.add(this->quadric[b]);
+  vec3 pa = this->position[a], pb = this->position[b];
+
+  vec3 candidates[4] = { pa, pb, (pa + pb) * 0.5f, vec3() };
+  int count = q.minimum(candidates[3]) ? 4 : 3;
+  Collapse c;
+  c.cost = q.evaluate(candidates[0]);
+  c.target = candidates[0];
+  for (int i = 1; i < count; i++) {
+    double cost = q.evaluate(candidates[i]);
+    if (cost < c.cost) {
+      c.cost = cost;
+      c.target = candidates[i];
+    }
+  }
+  if (c.cost < 0.0) c.cost = 0.0;         // rounding
+
+  vec3 edge = pb - pa;
+  float l2 = dot(edge, edge);
+  c.t = l2 > 0.0f ? std::min(1.0f, std::max(0.0f, dot(c.target - pa, edge) / l2)) : 0.0f;
+  c.a = a;
+  c.b = b;
+  c.versionA = this->version[a];
+  c.versionB = this->version[b];
+  this->queue.push(c);
+}
+
+// both ends unchanged, the neighborhood stays a manifold and no
+// triangle turns over
+bool Simplifier::valid(const Collapse &c) const
+{
+  if (!this->vertexAlive[c.a] || !this->vertexAlive[c.b] ||
+      this->version[c.a] != c.versionA || this->version[c.b] != c.versionB)
+    return false;
+
+  std::vector<unsigned int> na, nb, common;
+  this->neighbors(c.a, na);
+  this->neighbors(c.b, nb);
+  std::set_intersection(na.begin(), na.end(), nb.begin(), nb.end(), std::back_inserter(common));
+  unsigned int shared = 0;
+  const std::vector<unsigned int> &around = this->vertexTriangles[c.b];
+  for (size_t i = 0; i < around.size(); i++)
+    shared += this->triangleAlive[around[i]] && this->contains(around[i], c.a);
+  if (common.size() != shared)
+    return false;
+
+  return !this->flips(c.a, c.b, c.target) && !this->flips(c.b, c.a, c.target);
+}
+
+// the triangles of v that survive the collapse, v moved to target
+bool Simplifier::flips(unsigned int v, unsigned int other, const vec3 &target) const
+{
+  const std::vector<unsigned int> &around = this->vertexTriangles[v];
+  for (size_t i = 0; i < around.size(); i++) {
+    unsigned int t = around[i];
+    if (!this->triangleAlive[t] || this->contains(t, other))
+      continue;
+    vec3 p[3];
+    for (int k = 0; k < 3; k++) {
+      unsigned int tv = this->triangle[t * 3 + k];
+      p[k] = tv == v ? target : this->position[tv];
+    }
+    vec3 after = cross(p[1] - p[0], p[2] - p[0]);
+    if (dot(this->normal(t), after) <= 0.0f)
+      return true;
+  }
+  return false;
+}
+
+void Simplifier::apply(const Collapse &c)
+{
+  unsigned int a = c.a, b = c.b;
+  this->position[a] = c.target;
+  this->color[a] = this->color[a] + (this->color[b] - this->color[a]) * c.t;
+  this->quadric[a].add(this->quadric[b]);
+  this->vertexAlive[b] = 0;
+  this->version[a]++;
+  this->version[b]++;
+
+  // the triangles on the edge disappear, the others of b move to a
+  std::vector<unsigned int> &aroundB = this->vertexTriangles[b];
+  for (size_t i = 0; i < aroundB.size(); i++) {
+    unsigned int t = aroundB[i];
+    if (!this->triangleAlive[t])
+      continue;
+    if (this->contains(t, a)) {
+      this->triangleAlive[t] = 0;
+      this->triangles--;
+    } else {
+      for (int k = 0; k < 3; k++) {
+        if (this->triangle[t * 3 + k] == b)
+          this->triangle[t * 3 + k] = a;
+      }
+      this->vertexTriangles[a].push_back(t);
+    }
+  }
+  aroundB.clear();
+
+  std::vector<unsigned int> &aroundA = this->vertexTriangles[a];
+  size_t kept = 0;
+  for (size_t i = 0; i < aroundA.size(); i++) {
+    if (this->triangleAlive[aroundA[i]])
+      aroundA[kept++] = aroundA[i];
+  }
+  aroundA.resize(kept);
+
+  std::vector<unsigned int> around;
+  this->neighbors(a, around);
+  for (size_t i = 0; i < around.size(); i++)
+    this->push(a, around[i]);
+}
+
+void Simplifier::run(unsigned int targetTriangles)
+{
+  while (this->triangles > targetTriangles && !this->queue.empty()) {
+    Collapse c = this->queue.top();
+    this->queue.pop();
+    if (this->valid(c))
+      this->apply(c);
+  }
+}
+
+// distance of p to the closest surviving triangle
+float Simplifier::distance(const vec3 &p) const
+{
+  float closest = 1e30f;
+  for (unsigned int t = 0; t < this->triangleAlive.size(); t++) {
+    if (!this->triangleAlive[t])
+      continue;
+    const unsigned int *v = &this->triangle[t * 3];
+    closest = std::min(closest, triangleDistance(p, this->position[v[0]], this->position[v[1]], this->position[v[2]]));
+  }
+  return closest;
+}
+
+// the surviving vertices renumbered in their original order, the error
+// is the farthest original vertex from the simplified surface
+Mesh Simplifier::result() const
+{
+  Mesh mesh;
+  std::vector<unsigned int> remap(this->position.size(), 0xffffffffu);
+  for (unsigned int t = 0; t < this->triangleAlive.size(); t++) {
+    if (!this->triangleAlive[t])
+      continue;
+    for (int k = 0; k < 3; k++) {
+      unsigned int v = this->triangle[t * 3 + k];
+      if (remap[v] == 0xffffffffu)
+        remap[v] = 0;
+    }
+  }
+  unsigned int vertices = 0;
+  for (unsigned int v = 0; v < this->position.size(); v++) {
+    if (remap[v] == 0xffffffffu)
+      continue;
+    remap[v] = vertices++;
+    float data[6] = { this->position[v].x, this->position[v].y, this->position[v].z,
+                      this->color[v].x, this->color[v].y, this->color[v].z };
+    mesh.vertices.insert(mesh.vertices.end(), data, data + 6);
+  }
+  for (unsigned int t = 0; t < this->triangleAlive.size(); t++) {
+    if (!this->triangleAlive[t])
+      continue;
+    for (int k = 0; k < 3; k++)
+      mesh.indices.push_back(remap[this->triangle[t * 3 + k]]);
+  }
+  mesh.error = 0.0f;
+  for (size_t v = 0; v < this->original.size(); v++)
+    mesh.error = std::max(mesh.error, this->distance(this->original[v]));
+  return mesh;
+}
+
+Mesh simplify(const Mesh &mesh, unsigned int targetTriangles)
+{
+  Simplifier simplifier(mesh);
+  simplifier.run(targetTriangles);
+  return simplifier.result();
+}
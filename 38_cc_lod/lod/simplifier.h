@@ -0,0 +1,24 @@
+#ifndef SIMPLIFIER_H
+#define SIMPLIFIER_H
+
+#include "mesh.h"
+
+// quadric error metric simplification (Garland / Heckbert)
+//
+// every vertex sums the planes of its triangles as a 4x4 quadric: the
+// squared distance of a point to all of them. Edges are collapsed
+// cheapest first, each into the point of least error for the sum of the
+// quadrics of both ends (or an end or the middle when that system is
+// singular), until targetTriangles remain or no valid edge is left.
+// A collapse is refused when it would fold a triangle over or join two
+// sheets (more common neighbors than shared triangles); open borders
+// carry an extra plane across them so they keep their outline
+//
+// colors are interpolated along the collapsed edge; the error of the
+// result is the largest distance of an original vertex to the simplified
+// triangles, in object units (Mesh::error); the collapse costs only
+// order the edges, summed squared distances to many planes are not a
+// deviation; offline tool, not meant for every frame
+Mesh simplify(const Mesh &mesh, unsigned int targetTriangles);
+
+#endif
@@ -0,0 +1,221 @@
+// main.cc
+
+// discrete levels of detail: a field of rocks seen by a camera moving
+// back and forth; every rock picks the coarsest level of its chain
+// whose error stays under a pixel threshold on screen (hysteresis
+// against flickering between two levels), switches with a dithered
+// cross-fade, and each level is drawn with one instanced call
+// (levels: ../mesh/rock.obj and the rock.lod*.obj written by make_lods)
+// usage: ./main [threshold pixels, 0: always the finest] [fade seconds]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "vmath.h"
+#include "mesh.h"
+#include "lodmesh.h"
+#include "selector.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define LOD_LEVELS 5
+#define GRID 24
+#define SPACING 3.0f
+#define FOVY 0.8f
+#define STATS_FRAMES 120
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+int main(int argc, char *argv[])
+{
+  float threshold = argc > 1 ? atof(argv[1]) : 1.0f;
+  float fadeTime = argc > 2 ? atof(argv[2]) : 0.25f;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Level of Detail", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  glEnable(GL_DEPTH_TEST);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  // the chain, finest first
+  std::vector<Mesh> levels(LOD_LEVELS);
+  for (int i = 0; i < LOD_LEVELS; i++) {
+    std::ostringstream path;
+    path << "../mesh/rock";
+    if (i > 0) path << ".lod" << i;
+    path << ".obj";
+    if (!levels[i].read(path.str().c_str()) || levels[i].indices.empty()) {
+      glfwTerminate();
+      return -1;
+    }
+  }
+  // bounding sphere around the origin of the mesh
+  float radius = 0.0f;
+  for (size_t i = 0; i + 6 <= levels[0].vertices.size(); i += 6)
+    radius = std::max(radius, length(vec3(levels[0].vertices[i], levels[0].vertices[i + 1],
+                                          levels[0].vertices[i + 2])));
+
+  const unsigned int objects = GRID * GRID;
+  std::vector<vec3> positions(objects);
+  for (unsigned int i = 0; i < objects; i++)
+    positions[i] = vec3(((i % GRID) - (GRID - 1) * 0.5f) * SPACING, 0.0f, -3.0f - (i / GRID) * SPACING);
+
+  {
+    // a crossfading object is drawn twice
+    LodMesh rock(levels, objects * 2);
+    LodSelector selector(rock.errors());
+    selector.setThreshold(threshold > 0.0f ? threshold : 0.0f);
+    selector.setFadeTime(fadeTime);
+
+    std::cout << "levels:";
+    for (unsigned int l = 0; l < rock.levels(); l++)
+      std::cout << " " << rock.triangles(l) << " (" << std::setprecision(3) << rock.errors()[l] << ")";
+    std::cout << " triangles (error), threshold " << threshold << " px, fade " << fadeTime << " s" << std::endl;
+
+    ourShader.use();
+    GLint viewProjectionLocation = glGetUniformLocation(ourShader.ID, "viewProjection");
+
+    std::vector<LodState> states(objects);
+    std::vector<float> instances(objects * 2 * 4);
+    unsigned int first[LOD_LEVELS + 1], fill[LOD_LEVELS];
+    unsigned int frame = 0, switches = 0;
+    double triangles = 0.0, fading = 0.0;
+    float lastTime = glfwGetTime();
+    bool started = false;
+
+    // game loop
+    while(!glfwWindowShouldClose(window))
+    {
+      processInput(window);
+
+      float t = glfwGetTime();
+      float dt = t - lastTime;
+      lastTime = t;
+
+      // the camera flies back and forth over the field
+      int width, height;
+      glfwGetFramebufferSize(window, &width, &height);
+      if (height < 1) height = 1;
+      vec3 eye(0.0f, 4.0f, 5.0f + 60.0f * (0.5f - 0.5f * cosf(t * 0.25f)));
+      mat4 viewProjection = perspective(FOVY, (float)width / height, 0.1f, 200.0f) *
+                            lookAt(eye, eye + vec3(0.0f, -0.25f, -1.0f), vec3(0.0f, 1.0f, 0.0f));
+      selector.setProjection(FOVY, height);
+
+      // levels, then the instances grouped by level (counting sort)
+      unsigned int count[LOD_LEVELS] = { 0 };
+      for (unsigned int i = 0; i < objects; i++) {
+        float distance = length(positions[i] - eye) - radius;
+        LodState &s = states[i];
+        unsigned int before = s.level;
+        if (!started)
+          selector.reset(s, distance);
+        else
+          selector.update(s, distance, dt);
+        switches += s.level != before && started;
+        count[s.level]++;
+        if (s.fade < 1.0f) {
+          count[s.previous]++;
+          fading++;
+        }
+      }
+      started = true;
+      first[0] = 0;
+      for (int l = 0; l < LOD_LEVELS; l++) {
+        first[l + 1] = first[l] + count[l];
+        fill[l] = first[l];
+        triangles += (double)count[l] * rock.triangles(l);
+      }
+      for (unsigned int i = 0; i < objects; i++) {
+        const LodState &s = states[i];
+        float *p = &instances[fill[s.level]++ * 4];
+        p[0] = positions[i].x; p[1] = positions[i].y; p[2] = positions[i].z;
+        p[3] = s.fade;
+        if (s.fade < 1.0f) {
+          p = &instances[fill[s.previous]++ * 4];
+          p[0] = positions[i].x; p[1] = positions[i].y; p[2] = positions[i].z;
+          p[3] = s.fade - 1.0f;
+        }
+      }
+
+      if (++frame % STATS_FRAMES == 0) {
+        std::cout << "levels";
+        for (int l = 0; l < LOD_LEVELS; l++)
+          std::cout << std::setw(5) << count[l];
+        std::cout << std::fixed << std::setprecision(0)
+                  << ", triangles " << std::setw(8) << triangles / STATS_FRAMES
+                  << " (finest " << (double)objects * rock.triangles(0) << ")"
+                  << ", switches " << switches
+                  << ", fading " << std::setprecision(1) << fading / STATS_FRAMES << std::endl;
+        triangles = fading = 0.0;
+        switches = 0;
+      }
+
+      // set the color buffer
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+      // one upload, one draw per level
+      ourShader.use();
+      glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection.ptr());
+      rock.upload(&instances[0], first[LOD_LEVELS]);
+      for (int l = 0; l < LOD_LEVELS; l++)
+        rock.draw(l, first[l], count[l]);
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
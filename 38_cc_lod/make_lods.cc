@@ -0,0 +1,56 @@
+// make_lods.cc
+
+// offline LOD chain generation: every level is simplified from the
+// original mesh (not from the previous level, so errors do not add up)
+// down to ratio^level of its triangles by quadric error edge collapses,
+// and written next to it in the same OBJ subset, with its error
+// usage: make_lods <mesh.obj> [levels] [ratio]
+//   writes <mesh>.lod1.obj ... <mesh>.lod<levels - 1>.obj
+//   (../mesh/rock.lod*.obj come from: make_lods ../mesh/rock.obj 5 0.35)
+
+#include "mesh.h"
+#include "simplifier.h"
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2) {
+    std::cout << "usage: make_lods <mesh.obj> [levels] [ratio]" << std::endl;
+    return 1;
+  }
+  std::string path = argv[1];
+  int levels = argc > 2 ? atoi(argv[2]) : 5;
+  float ratio = argc > 3 ? atof(argv[3]) : 0.35f;
+  if (levels < 2) levels = 2;
+  if (ratio <= 0.0f || ratio >= 1.0f) ratio = 0.35f;
+
+  Mesh original;
+  if (!original.read(path.c_str()))
+    return 1;
+  unsigned int triangles = original.indices.size() / 3;
+  std::string base = path.size() > 4 && path.compare(path.size() - 4, 4, ".obj") == 0 ?
+                     path.substr(0, path.size() - 4) : path;
+
+  std::cout << "level  triangles   vertices      error  file" << std::endl;
+  std::cout << std::setw(5) << 0 << std::setw(11) << triangles << std::setw(11) << original.vertices.size() / 6
+            << std::fixed << std::setprecision(5) << std::setw(11) << 0.0f << "  " << path << std::endl;
+  for (int level = 1; level < levels; level++) {
+    unsigned int target = (unsigned int)(triangles * pow(ratio, level));
+    Mesh simplified = simplify(original, target > 0 ? target : 1);
+
+    std::ostringstream name;
+    name << base << ".lod" << level << ".obj";
+    if (!simplified.write(name.str().c_str()))
+      return 1;
+    std::cout << std::setw(5) << level << std::setw(11) << simplified.indices.size() / 3
+              << std::setw(11) << simplified.vertices.size() / 6
+              << std::setw(11) << simplified.error << "  " << name.str() << std::endl;
+  }
+  return 0;
+}
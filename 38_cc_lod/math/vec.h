@@ -0,0 +1,101 @@
+#ifndef VEC_H
+#define VEC_H
+
+#include <math.h>
+
+// 2, 3 and 4 component float vectors, the GLSL way: component-wise
+// operators, dot/cross/length/normalize as functions
+
+struct vec2
+{
+  float x, y;
+
+  vec2() : x(0.0f), y(0.0f) {}
+  explicit vec2(float s) : x(s), y(s) {}
+  vec2(float x, float y) : x(x), y(y) {}
+
+  float& operator[](int i) { return (&x)[i]; }
+  float operator[](int i) const { return (&x)[i]; }
+};
+
+struct vec3
+{
+  float x, y, z;
+
+  vec3() : x(0.0f), y(0.0f), z(0.0f) {}
+  explicit vec3(float s) : x(s), y(s), z(s) {}
+  vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+  vec3(const vec2 &v, float z) : x(v.x), y(v.y), z(z) {}
+
+  float& operator[](int i) { return (&x)[i]; }
+  float operator[](int i) const { return (&x)[i]; }
+};
+
+struct vec4
+{
+  float x, y, z, w;
+
+  vec4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
+  explicit vec4(float s) : x(s), y(s), z(s), w(s) {}
+  vec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+  vec4(const vec3 &v, float w) : x(v.x), y(v.y), z(v.z), w(w) {}
+
+  vec3 xyz() const { return vec3(x, y, z); }
+  float& operator[](int i) { return (&x)[i]; }
+  float operator[](int i) const { return (&x)[i]; }
+};
+
+// vec2
+inline vec2 operator+(const vec2 &a, const vec2 &b) { return vec2(a.x + b.x, a.y + b.y); }
+inline vec2 operator-(const vec2 &a, const vec2 &b) { return vec2(a.x - b.x, a.y - b.y); }
+inline vec2 operator*(const vec2 &a, const vec2 &b) { return vec2(a.x * b.x, a.y * b.y); }
+inline vec2 operator*(const vec2 &a, float s) { return vec2(a.x * s, a.y * s); }
+inline vec2 operator*(float s, const vec2 &a) { return a * s; }
+inline vec2 operator/(const vec2 &a, float s) { return a * (1.0f / s); }
+inline vec2 operator-(const vec2 &a) { return vec2(-a.x, -a.y); }
+inline vec2& operator+=(vec2 &a, const vec2 &b) { a = a + b; return a; }
+inline vec2& operator-=(vec2 &a, const vec2 &b) { a = a - b; return a; }
+inline vec2& operator*=(vec2 &a, float s) { a = a * s; return a; }
+inline float dot(const vec2 &a, const vec2 &b) { return a.x * b.x + a.y * b.y; }
+inline float length(const vec2 &a) { return sqrtf(dot(a, a)); }
+inline vec2 normalize(const vec2 &a) { return a * (1.0f / length(a)); }
+
+// vec3
+inline vec3 operator+(const vec3 &a, const vec3 &b) { return vec3(a.x + b.x, a.y + b.y, a.z + b.z); }
+inline vec3 operator-(const vec3 &a, const vec3 &b) { return vec3(a.x - b.x, a.y - b.y, a.z - b.z); }
+inline vec3 operator*(const vec3 &a, const vec3 &b) { return vec3(a.x * b.x, a.y * b.y, a.z * b.z); }
+inline vec3 operator*(const vec3 &a, float s) { return vec3(a.x * s, a.y * s, a.z * s); }
+inline vec3 operator*(float s, const vec3 &a) { return a * s; }
+inline vec3 operator/(const vec3 &a, float s) { return a * (1.0f / s); }
+inline vec3 operator-(const vec3 &a) { return vec3(-a.x, -a.y, -a.z); }
+inline vec3& operator+=(vec3 &a, const vec3 &b) { a = a + b; return a; }
+inline vec3& operator-=(vec3 &a, const vec3 &b) { a = a - b; return a; }
+inline vec3& operator*=(vec3 &a, float s) { a = a * s; return a; }
+inline float dot(const vec3 &a, const vec3 &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline vec3 cross(const vec3 &a, const vec3 &b)
+{
+  return vec3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+inline float length(const vec3 &a) { return sqrtf(dot(a, a)); }
+inline vec3 normalize(const vec3 &a) { return a * (1.0f / length(a)); }
+
+// vec4
+inline vec4 operator+(const vec4 &a, const vec4 &b) { return vec4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+inline vec4 operator-(const vec4 &a, const vec4 &b) { return vec4(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+inline vec4 operator*(const vec4 &a, const vec4 &b) { return vec4(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+inline vec4 operator*(const vec4 &a, float s) { return vec4(a.x * s, a.y * s, a.z * s, a.w * s); }
+inline vec4 operator*(float s, const vec4 &a) { return a * s; }
+inline vec4 operator/(const vec4 &a, float s) { return a * (1.0f / s); }
+inline vec4 operator-(const vec4 &a) { return vec4(-a.x, -a.y, -a.z, -a.w); }
+inline vec4& operator+=(vec4 &a, const vec4 &b) { a = a + b; return a; }
+inline vec4& operator-=(vec4 &a, const vec4 &b) { a = a - b; return a; }
+inline vec4& operator*=(vec4 &a, float s) { a = a * s; return a; }
+inline float dot(const vec4 &a, const vec4 &b) { return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w; }
+inline float length(const vec4 &a) { return sqrtf(dot(a, a)); }
+inline vec4 normalize(const vec4 &a) { return a * (1.0f / length(a)); }
+
+inline vec2 mix(const vec2 &a, const vec2 &b, float t) { return a + (b - a) * t; }
+inline vec3 mix(const vec3 &a, const vec3 &b, float t) { return a + (b - a) * t; }
+inline vec4 mix(const vec4 &a, const vec4 &b, float t) { return a + (b - a) * t; }
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef VMATH_H
+#define VMATH_H
+
+// header only vector / matrix / quaternion math for the samples,
+// the C++ counterpart of the pyrr calls of the Python ports
+//
+// vec.h    vec2 vec3 vec4
+// mat.h    mat3 mat4, translate rotate scale perspective ortho lookAt
+// quat.h   quat, angleAxis slerp toMat4
+// batch.h  N matrix products and N point transforms (scalar, SSE, AVX)
+
+#include "vec.h"
+#include "mat.h"
+#include "quat.h"
+#include "batch.h"
+
+#endif
@@ -0,0 +1,72 @@
+#include "mesh.h"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include <iomanip>
+
+Mesh::Mesh()
+  : error(0.0f)
+{
+}
+
+bool Mesh::read(const char* path)
+{
+  std::ifstream file(path);
+  if (!file) {
+    std::cout << "ERROR::MESH::FILE_NOT_SUCCESFULLY_READ " << path << std::endl;
+    return false;
+  }
+
+  this->vertices.clear();
+  this->indices.clear();
+  this->error = 0.0f;
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream in(line);
+    std::string type;
+    in >> type;
+    if (type == "v") {
+      float v[6] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+      in >> v[0] >> v[1] >> v[2];
+      if (!(in >> v[3] >> v[4] >> v[5])) {
+        v[3] = v[4] = v[5] = 1.0f;
+      }
+      this->vertices.insert(this->vertices.end(), v, v + 6);
+    } else if (type == "f") {
+      GLuint a, b, c;
+      if (!(in >> a >> b >> c) || a == 0 || b == 0 || c == 0) {
+        std::cout << "ERROR::MESH::BAD_FACE " << line << std::endl;
+        return false;
+      }
+      this->indices.push_back(a - 1);
+      this->indices.push_back(b - 1);
+      this->indices.push_back(c - 1);
+    } else if (type == "e") {
+      in >> this->error;
+    }
+  }
+  return true;
+}
+
+bool Mesh::write(const char* path) const
+{
+  std::ofstream file(path);
+  if (!file) {
+    std::cout << "ERROR::MESH::FILE_NOT_SUCCESFULLY_WRITTEN " << path << std::endl;
+    return false;
+  }
+
+  file << std::fixed << std::setprecision(4);
+  if (this->error > 0.0f)
+    file << "e " << std::setprecision(6) << this->error << std::setprecision(4) << "\n";
+  for (size_t i = 0; i + 6 <= this->vertices.size(); i += 6) {
+    const float *v = &this->vertices[i];
+    file << "v " << v[0] << " " << v[1] << " " << v[2] << " " << v[3] << " " << v[4] << " " << v[5] << "\n";
+  }
+  for (size_t i = 0; i + 3 <= this->indices.size(); i += 3)
+    file << "f " << this->indices[i] + 1 << " " << this->indices[i + 1] + 1 << " " << this->indices[i + 2] + 1 << "\n";
+  return file.good();
+}
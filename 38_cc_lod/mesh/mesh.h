@@ -0,0 +1,26 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+// triangle mesh read from an OBJ subset:
+//   v x y z [r g b]   (vertex colors, white if missing)
+//   f a b c           (1-based indices, triangles)
+//   e error           (simplified meshes: object space error against
+//                      the original, 0 if missing)
+// no GL calls, can be read on any thread
+struct Mesh
+{
+  std::vector<float> vertices;    // x y z r g b
+  std::vector<GLuint> indices;
+  float error;
+
+  Mesh();
+
+  bool read(const char* path);
+  bool write(const char* path) const;
+};
+
+#endif
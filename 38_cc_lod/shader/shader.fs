@@ -0,0 +1,21 @@
+#version 330 core
+
+in vec3 vertexColor;
+flat in float fade;
+out vec4 FragColor;
+
+// 4x4 ordered dither thresholds
+const float bayer[16] = float[16](0.0, 8.0, 2.0, 10.0, 12.0, 4.0, 14.0, 6.0,
+                                  3.0, 11.0, 1.0, 9.0, 15.0, 7.0, 13.0, 5.0);
+
+void main()
+{
+  // cross-fade between two levels of detail: the incoming one (fade in
+  // [0, 1]) keeps the pixels under the threshold, the outgoing one (fade
+  // - 1, in [-1, 0)) the others, so every pixel is drawn exactly once
+  ivec2 p = ivec2(gl_FragCoord.xy) % 4;
+  float threshold = (bayer[p.y * 4 + p.x] + 0.5f) / 16.0f;
+  if (fade >= 0.0f ? threshold >= fade : threshold < fade + 1.0f)
+    discard;
+  FragColor = vec4(vertexColor, 1.0f);
+}
@@ -0,0 +1,22 @@
+#ifndef SHADER_H
+#define SHADER_H
+
+#include <glad/glad.h>
+
+#include <string>
+
+class Shader
+{
+  public:
+    GLuint ID;
+
+    Shader(const GLchar* vertexPath, const GLchar* fragmentPath);
+
+    void use();
+
+    void setBool(const std::string &name, bool value) const;
+    void setInt(const std::string &name, int value) const;
+    void setFloat(const std::string &name, float value) const;
+};
+
+#endif
@@ -0,0 +1,17 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+layout (location = 2) in vec4 aInstance;   // world position, fade
+
+uniform mat4 viewProjection;
+
+out vec3 vertexColor;
+flat out float fade;
+
+void main()
+{
+  gl_Position = viewProjection * vec4(aPos + aInstance.xyz, 1.0f);
+  vertexColor = aColor;
+  fade = aInstance.w;
+}
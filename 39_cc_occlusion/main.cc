@@ -0,0 +1,287 @@
+// main.cc
+
+// hardware occlusion culling: a grid of rooms with doorways, a few dense
+// rocks in each; the walls are drawn first, every rock behind a
+// conditional render on last frame's query of its bounding box, then
+// the boxes are queried for the next frame; the camera turns around in
+// one room, most rocks are behind walls
+// usage: ./main [occlusion 0/1]
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "shader.h"
+#include "vmath.h"
+#include "mesh.h"
+#include "occlusion.h"
+
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 600
+
+#define ROOMS 6
+#define ROOM_SIZE 10.0f
+#define WALL_HEIGHT 3.0f
+#define WALL_THICKNESS 0.2f
+#define DOOR_WIDTH 2.0f
+#define ROCKS_PER_ROOM 4
+#define STATS_FRAMES 60
+
+struct Wall
+{
+  vec3 min, size;
+};
+
+void framebuffer_size_callback(GLFWwindow* window, int width, int height);
+void processInput(GLFWwindow* window);
+
+// the walls on one grid line, along x (or z), with a doorway in the
+// middle of every room unless on the outside
+static void addWalls(std::vector<Wall> &walls, int line, bool alongX)
+{
+  bool outside = line == 0 || line == ROOMS;
+  float across = line * ROOM_SIZE - WALL_THICKNESS * 0.5f;
+  for (int room = 0; room < ROOMS; room++) {
+    float start = room * ROOM_SIZE;
+    float pieces[2][2] = { { start, start + (outside ? ROOM_SIZE : (ROOM_SIZE - DOOR_WIDTH) * 0.5f) },
+                           { start + (ROOM_SIZE + DOOR_WIDTH) * 0.5f, start + ROOM_SIZE } };
+    for (int p = 0; p < (outside ? 1 : 2); p++) {
+      Wall wall;
+      float length = pieces[p][1] - pieces[p][0];
+      if (alongX) {
+        wall.min = vec3(pieces[p][0], 0.0f, across);
+        wall.size = vec3(length, WALL_HEIGHT, WALL_THICKNESS);
+      } else {
+        wall.min = vec3(across, 0.0f, pieces[p][0]);
+        wall.size = vec3(WALL_THICKNESS, WALL_HEIGHT, length);
+      }
+      walls.push_back(wall);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  bool occlusion = argc > 1 ? atoi(argv[1]) != 0 : true;
+
+  glfwInit();
+
+  // configure glfw (using OpenGL 3.3 Core)
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+  glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+  glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#ifdef __APPLE__
+  glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+#endif
+
+  GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Occlusion Culling", NULL, NULL);
+  if (window == NULL)
+  {
+    std::cout << "Failed to create GLFW window" << std::endl;
+    glfwTerminate();
+    return -1;
+  }
+  glfwMakeContextCurrent(window);
+  glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+  // init GLAD before calling any OpenGL function
+  if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+  {
+    std::cout << "Failed to initialize GLAD" << std::endl;
+    return -1;
+  }
+
+  glViewport(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+  glEnable(GL_DEPTH_TEST);
+
+  Shader ourShader("../shader/shader.vs", "../shader/shader.fs");
+
+  Mesh rock;
+  if (!rock.read("../mesh/rock.obj") || rock.indices.empty()) {
+    glfwTerminate();
+    return -1;
+  }
+  vec3 rockMin(1e30f), rockMax(-1e30f);
+  for (size_t i = 0; i + 6 <= rock.vertices.size(); i += 6) {
+    for (int k = 0; k < 3; k++) {
+      rockMin[k] = std::min(rockMin[k], rock.vertices[i + k]);
+      rockMax[k] = std::max(rockMax[k], rock.vertices[i + k]);
+    }
+  }
+
+  // rock data
+  GLuint rockVAO, rockVBO, rockEBO;
+  glGenVertexArrays(1, &rockVAO);
+  glGenBuffers(1, &rockVBO);
+  glGenBuffers(1, &rockEBO);
+  glBindVertexArray(rockVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, rockVBO);
+  glBufferData(GL_ARRAY_BUFFER, rock.vertices.size() * sizeof(float), &rock.vertices[0], GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, rockEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, rock.indices.size() * sizeof(GLuint), &rock.indices[0], GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+
+  // wall data: a unit cube, scaled and moved per wall
+  float cubeVertices[] = {
+    // coords               // color
+    0.0f, 0.0f, 0.0f,       0.45f, 0.42f, 0.40f,
+    1.0f, 0.0f, 0.0f,       0.50f, 0.47f, 0.44f,
+    1.0f, 1.0f, 0.0f,       0.80f, 0.78f, 0.74f,
+    0.0f, 1.0f, 0.0f,       0.75f, 0.73f, 0.70f,
+    0.0f, 0.0f, 1.0f,       0.50f, 0.47f, 0.44f,
+    1.0f, 0.0f, 1.0f,       0.45f, 0.42f, 0.40f,
+    1.0f, 1.0f, 1.0f,       0.75f, 0.73f, 0.70f,
+    0.0f, 1.0f, 1.0f,       0.80f, 0.78f, 0.74f
+  };
+  GLuint cubeIndices[] = {
+    0, 2, 1,  0, 3, 2,   4, 5, 6,  4, 6, 7,   0, 1, 5,  0, 5, 4,
+    3, 6, 2,  3, 7, 6,   0, 4, 7,  0, 7, 3,   1, 2, 6,  1, 6, 5
+  };
+  GLuint cubeVAO, cubeVBO, cubeEBO;
+  glGenVertexArrays(1, &cubeVAO);
+  glGenBuffers(1, &cubeVBO);
+  glGenBuffers(1, &cubeEBO);
+  glBindVertexArray(cubeVAO);
+  glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, cubeEBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)0);
+  glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6*sizeof(float), (void*)(3*sizeof(float)));
+  glEnableVertexAttribArray(0);
+  glEnableVertexAttribArray(1);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+
+  // the rooms: walls on every grid line, rocks spread in each room
+  std::vector<Wall> walls;
+  for (int line = 0; line <= ROOMS; line++) {
+    addWalls(walls, line, true);
+    addWalls(walls, line, false);
+  }
+  const unsigned int rocks = ROOMS * ROOMS * ROCKS_PER_ROOM;
+  std::vector<vec3> positions(rocks), boxMin(rocks), boxMax(rocks);
+  unsigned int seed = 1;
+  for (unsigned int i = 0; i < rocks; i++) {
+    unsigned int room = i / ROCKS_PER_ROOM;
+    float r[2];
+    for (int k = 0; k < 2; k++) {
+      seed = seed * 1103515245u + 12345u;
+      r[k] = ((seed >> 8) % 1000) / 1000.0f;
+    }
+    // one per quarter of the room, the middle stays free for the camera
+    unsigned int quarter = i % ROCKS_PER_ROOM;
+    positions[i] = vec3(((room % ROOMS) + (quarter & 1 ? 0.6f : 0.15f) + 0.25f * r[0]) * ROOM_SIZE, -rockMin.y,
+                        ((room / ROOMS) + (quarter & 2 ? 0.6f : 0.15f) + 0.25f * r[1]) * ROOM_SIZE);
+    boxMin[i] = positions[i] + rockMin;
+    boxMax[i] = positions[i] + rockMax;
+  }
+  std::cout << walls.size() << " walls, " << rocks << " rocks of " << rock.indices.size() / 3
+            << " triangles, occlusion " << (occlusion ? "on" : "off") << std::endl;
+
+  {
+    OcclusionCuller culler(rocks);
+
+    ourShader.use();
+    GLint viewProjectionLocation = glGetUniformLocation(ourShader.ID, "viewProjection");
+    GLint offsetLocation = glGetUniformLocation(ourShader.ID, "offset");
+    GLint scaleLocation = glGetUniformLocation(ourShader.ID, "scale");
+
+    unsigned int frame = 0;
+    double culledSum = 0.0, frameStart = glfwGetTime();
+    unsigned int culledFrames = 0;
+
+    // game loop
+    while(!glfwWindowShouldClose(window))
+    {
+      processInput(window);
+
+      // the camera turns around in a room near the middle
+      float t = glfwGetTime();
+      int width, height;
+      glfwGetFramebufferSize(window, &width, &height);
+      vec3 eye((ROOMS / 2 - 0.5f) * ROOM_SIZE, 1.7f, (ROOMS / 2 - 0.5f) * ROOM_SIZE);
+      vec3 forward(sinf(t * 0.3f), -0.1f, -cosf(t * 0.3f));
+      mat4 viewProjection = perspective(1.0f, (float)width / (height > 0 ? height : 1), 0.1f, 100.0f) *
+                            lookAt(eye, eye + forward, vec3(0.0f, 1.0f, 0.0f));
+
+      bool culledFresh = occlusion && culler.beginFrame();
+
+      // set the color buffer
+      glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+      glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+      // occluders first
+      ourShader.use();
+      glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, viewProjection.ptr());
+      glBindVertexArray(cubeVAO);
+      for (size_t i = 0; i < walls.size(); i++) {
+        glUniform3f(offsetLocation, walls[i].min.x, walls[i].min.y, walls[i].min.z);
+        glUniform3f(scaleLocation, walls[i].size.x, walls[i].size.y, walls[i].size.z);
+        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+      }
+
+      // every rock, skipped by the GPU when its box was hidden last frame
+      glBindVertexArray(rockVAO);
+      glUniform3f(scaleLocation, 1.0f, 1.0f, 1.0f);
+      for (unsigned int i = 0; i < rocks; i++) {
+        if (occlusion)
+          culler.beginDraw(i);
+        glUniform3f(offsetLocation, positions[i].x, positions[i].y, positions[i].z);
+        glDrawElements(GL_TRIANGLES, rock.indices.size(), GL_UNSIGNED_INT, 0);
+        if (occlusion)
+          culler.endDraw();
+      }
+
+      // boxes against this frame's depth, for the next one
+      if (occlusion)
+        culler.queryBoxes(&boxMin[0], &boxMax[0], viewProjection, eye);
+
+      if (culledFresh) {
+        culledSum += culler.culledPercent();
+        culledFrames++;
+      }
+      if (++frame % STATS_FRAMES == 0) {
+        double now = glfwGetTime();
+        std::cout << std::fixed << std::setprecision(2)
+                  << "frame " << std::setw(5) << frame
+                  << ", " << (now - frameStart) / STATS_FRAMES * 1000.0 << " ms/frame";
+        if (culledFrames > 0)
+          std::cout << std::setprecision(1) << ", culled " << culler.culledPercent() << "% of "
+                    << culler.queried() << " rocks (average " << culledSum / culledFrames << "%)";
+        std::cout << std::endl;
+        frameStart = now;
+        culledSum = 0.0;
+        culledFrames = 0;
+      }
+
+      glfwSwapBuffers(window);
+      glfwPollEvents();
+    }
+  }
+
+  glfwTerminate();
+  return 0;
+}
+
+// handler for window resizing (called ad startup)
+void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+{
+  glViewport(0, 0, width, height);
+}
+
+// handle key press
+void processInput(GLFWwindow* window)
+{
+  if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    glfwSetWindowShouldClose(window, true);
+}
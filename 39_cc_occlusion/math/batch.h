@@ -0,0 +1,205 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "vec.h"
+#include "mat.h"
+#include "simd.h"
+
+// batch transforms: one call for N matrices or points, so the SIMD loop
+// runs over the whole array; path picks the implementation (an
+// unavailable one falls back to MATH_BEST); outputs must not overlap
+// the inputs
+//
+// AVX does two matrix columns or eight SoA points per instruction; the
+// vec3 array (AoS) version has no AVX kernel and uses SSE for MATH_AVX
+
+inline MathPath mathResolvePath(MathPath path)
+{
+  return path != MATH_BEST && mathPathAvailable(path) ? path : mathBestPath();
+}
+
+// a advances by aStride floats (0: the same matrix for every b)
+
+inline void multiplyMatricesScalar(const float *a, size_t aStride, const float *b, float *out, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    multiply4x4Scalar(a + i * aStride, b + i * 16, out + i * 16);
+}
+
+inline void transformPointsScalar(const float *m, const float *in, float *out, size_t count)
+{
+  for (size_t i = 0; i < count; i++) {
+    const float *p = in + i * 3;
+    for (int r = 0; r < 3; r++)
+      out[i * 3 + r] = m[r] * p[0] + m[4 + r] * p[1] + m[8 + r] * p[2] + m[12 + r];
+  }
+}
+
+inline void transformPointsSoAScalar(const float *m, const float *x, const float *y, const float *z,
+                                     float *outX, float *outY, float *outZ, size_t begin, size_t count)
+{
+  for (size_t i = begin; i < count; i++) {
+    float px = x[i], py = y[i], pz = z[i];
+    outX[i] = m[0] * px + m[4] * py + m[8] * pz + m[12];
+    outY[i] = m[1] * px + m[5] * py + m[9] * pz + m[13];
+    outZ[i] = m[2] * px + m[6] * py + m[10] * pz + m[14];
+  }
+}
+
+#ifdef VMATH_SSE
+inline void multiplyMatricesSse(const float *a, size_t aStride, const float *b, float *out, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+    multiply4x4Sse(a + i * aStride, b + i * 16, out + i * 16);
+}
+
+// the last point is stored as 2 + 1 floats, the others as 4 floats
+// overwritten by the next point
+inline void transformPointsSse(const float *m, const float *in, float *out, size_t count)
+{
+  __m128 c0 = _mm_loadu_ps(m), c1 = _mm_loadu_ps(m + 4);
+  __m128 c2 = _mm_loadu_ps(m + 8), c3 = _mm_loadu_ps(m + 12);
+  for (size_t i = 0; i < count; i++) {
+    const float *p = in + i * 3;
+    __m128 r = _mm_add_ps(c3, _mm_mul_ps(c0, _mm_set1_ps(p[0])));
+    r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(p[1])));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(p[2])));
+    if (i + 1 < count) {
+      _mm_storeu_ps(out + i * 3, r);
+    } else {
+      _mm_storel_pi((__m64*)(out + i * 3), r);
+      _mm_store_ss(out + i * 3 + 2, _mm_movehl_ps(r, r));
+    }
+  }
+}
+
+inline void transformPointsSoASse(const float *m, const float *x, const float *y, const float *z,
+                                  float *outX, float *outY, float *outZ, size_t count)
+{
+  __m128 e[12];
+  for (int k = 0; k < 12; k++)
+    e[k] = _mm_set1_ps(m[(k / 3) * 4 + k % 3]);   // m[c][r], c = k / 3, r = k % 3
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 px = _mm_loadu_ps(x + i), py = _mm_loadu_ps(y + i), pz = _mm_loadu_ps(z + i);
+    float *outs[3] = { outX, outY, outZ };
+    for (int r = 0; r < 3; r++) {
+      __m128 v = _mm_add_ps(e[9 + r], _mm_mul_ps(e[r], px));
+      v = _mm_add_ps(v, _mm_mul_ps(e[3 + r], py));
+      v = _mm_add_ps(v, _mm_mul_ps(e[6 + r], pz));
+      _mm_storeu_ps(outs[r] + i, v);
+    }
+  }
+  transformPointsSoAScalar(m, x, y, z, outX, outY, outZ, i, count);
+}
+#endif
+
+#ifdef VMATH_AVX
+// two columns of the result at once: each 128 bit lane holds one
+VMATH_TARGET_AVX inline void multiplyMatricesAvx(const float *a, size_t aStride, const float *b,
+                                                 float *out, size_t count)
+{
+  for (size_t i = 0; i < count; i++) {
+    const float *pa = a + i * aStride;
+    __m256 a0 = _mm256_broadcast_ps((const __m128*)pa);
+    __m256 a1 = _mm256_broadcast_ps((const __m128*)(pa + 4));
+    __m256 a2 = _mm256_broadcast_ps((const __m128*)(pa + 8));
+    __m256 a3 = _mm256_broadcast_ps((const __m128*)(pa + 12));
+    for (int j = 0; j < 4; j += 2) {
+      __m256 columns = _mm256_loadu_ps(b + i * 16 + j * 4);
+      __m256 r = _mm256_mul_ps(a0, _mm256_permute_ps(columns, 0x00));
+      r = _mm256_add_ps(r, _mm256_mul_ps(a1, _mm256_permute_ps(columns, 0x55)));
+      r = _mm256_add_ps(r, _mm256_mul_ps(a2, _mm256_permute_ps(columns, 0xaa)));
+      r = _mm256_add_ps(r, _mm256_mul_ps(a3, _mm256_permute_ps(columns, 0xff)));
+      _mm256_storeu_ps(out + i * 16 + j * 4, r);
+    }
+  }
+}
+
+VMATH_TARGET_AVX inline void transformPointsSoAAvx(const float *m, const float *x, const float *y,
+                                                   const float *z, float *outX, float *outY,
+                                                   float *outZ, size_t count)
+{
+  __m256 e[12];
+  for (int k = 0; k < 12; k++)
+    e[k] = _mm256_set1_ps(m[(k / 3) * 4 + k % 3]);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 px = _mm256_loadu_ps(x + i), py = _mm256_loadu_ps(y + i), pz = _mm256_loadu_ps(z + i);
+    float *outs[3] = { outX, outY, outZ };
+    for (int r = 0; r < 3; r++) {
+      __m256 v = _mm256_add_ps(e[9 + r], _mm256_mul_ps(e[r], px));
+      v = _mm256_add_ps(v, _mm256_mul_ps(e[3 + r], py));
+      v = _mm256_add_ps(v, _mm256_mul_ps(e[6 + r], pz));
+      _mm256_storeu_ps(outs[r] + i, v);
+    }
+  }
+  transformPointsSoAScalar(m, x, y, z, outX, outY, outZ, i, count);
+}
+#endif
+
+inline void multiplyMatrices(const float *a, size_t aStride, const float *b, float *out, size_t count,
+                             MathPath path)
+{
+  switch (mathResolvePath(path)) {
+#ifdef VMATH_AVX
+    case MATH_AVX:
+      multiplyMatricesAvx(a, aStride, b, out, count);
+      return;
+#endif
+#ifdef VMATH_SSE
+    case MATH_SSE:
+      multiplyMatricesSse(a, aStride, b, out, count);
+      return;
+#endif
+    default:
+      multiplyMatricesScalar(a, aStride, b, out, count);
+  }
+}
+
+// out[i] = a[i] * b[i]
+inline void multiplyMatrices(const mat4 *a, const mat4 *b, mat4 *out, size_t count, MathPath path = MATH_BEST)
+{
+  multiplyMatrices(a->m, 16, b->m, out->m, count, path);
+}
+
+// out[i] = a * b[i]
+inline void multiplyMatrices(const mat4 &a, const mat4 *b, mat4 *out, size_t count, MathPath path = MATH_BEST)
+{
+  multiplyMatrices(a.m, 0, b->m, out->m, count, path);
+}
+
+// out[i] = m * (in[i], 1), no perspective divide
+inline void transformPoints(const mat4 &m, const vec3 *in, vec3 *out, size_t count, MathPath path = MATH_BEST)
+{
+  if (count == 0) return;
+#ifdef VMATH_SSE
+  if (mathResolvePath(path) != MATH_SCALAR) {
+    transformPointsSse(m.m, &in->x, &out->x, count);
+    return;
+  }
+#endif
+  transformPointsScalar(m.m, &in->x, &out->x, count);
+}
+
+// the same on separate x, y and z arrays (structure of arrays)
+inline void transformPoints(const mat4 &m, const float *x, const float *y, const float *z,
+                            float *outX, float *outY, float *outZ, size_t count, MathPath path = MATH_BEST)
+{
+  switch (mathResolvePath(path)) {
+#ifdef VMATH_AVX
+    case MATH_AVX:
+      transformPointsSoAAvx(m.m, x, y, z, outX, outY, outZ, count);
+      return;
+#endif
+#ifdef VMATH_SSE
+    case MATH_SSE:
+      transformPointsSoASse(m.m, x, y, z, outX, outY, outZ, count);
+      return;
+#endif
+    default:
+      transformPointsSoAScalar(m.m, x, y, z, outX, outY, outZ, 0, count);
+  }
+}
+
+#endif
@@ -0,0 +1,309 @@
+#ifndef MAT_H
+#define MAT_H
+
+#include "vec.h"
+#include "simd.h"
+
+// 3x3 and 4x4 float matrices, column major like OpenGL: m[c][r] is
+// column c, row r, and ptr() goes straight to glUniformMatrix*fv with
+// transpose GL_FALSE; vectors are columns, so M * v and A * B applies B
+// first; angles in radians
+//
+// mat4 products and mat4 * vec4 use SSE when available (simd.h)
+
+struct mat3
+{
+  float m[9];
+
+  // identity
+  mat3() { *this = mat3(1.0f); }
+  explicit mat3(float diagonal)
+  {
+    for (int i = 0; i < 9; i++) m[i] = 0.0f;
+    m[0] = m[4] = m[8] = diagonal;
+  }
+  explicit mat3(const float *columnMajor)
+  {
+    for (int i = 0; i < 9; i++) m[i] = columnMajor[i];
+  }
+  mat3(const vec3 &c0, const vec3 &c1, const vec3 &c2)
+  {
+    for (int r = 0; r < 3; r++) {
+      m[r] = c0[r];
+      m[3 + r] = c1[r];
+      m[6 + r] = c2[r];
+    }
+  }
+
+  float* operator[](int column) { return m + column * 3; }
+  const float* operator[](int column) const { return m + column * 3; }
+  const float* ptr() const { return m; }
+};
+
+struct mat4
+{
+  float m[16];
+
+  // identity
+  mat4() { *this = mat4(1.0f); }
+  explicit mat4(float diagonal)
+  {
+    for (int i = 0; i < 16; i++) m[i] = 0.0f;
+    m[0] = m[5] = m[10] = m[15] = diagonal;
+  }
+  explicit mat4(const float *columnMajor)
+  {
+    for (int i = 0; i < 16; i++) m[i] = columnMajor[i];
+  }
+  mat4(const vec4 &c0, const vec4 &c1, const vec4 &c2, const vec4 &c3)
+  {
+    for (int r = 0; r < 4; r++) {
+      m[r] = c0[r];
+      m[4 + r] = c1[r];
+      m[8 + r] = c2[r];
+      m[12 + r] = c3[r];
+    }
+  }
+  // upper left 3x3 of a 4x4, last row and column of the identity
+  explicit mat4(const mat3 &a)
+  {
+    *this = mat4(1.0f);
+    for (int c = 0; c < 3; c++)
+      for (int r = 0; r < 3; r++)
+        m[c * 4 + r] = a.m[c * 3 + r];
+  }
+
+  float* operator[](int column) { return m + column * 4; }
+  const float* operator[](int column) const { return m + column * 4; }
+  vec4 column(int c) const { return vec4(m[c * 4], m[c * 4 + 1], m[c * 4 + 2], m[c * 4 + 3]); }
+  const float* ptr() const { return m; }
+};
+
+// mat3
+
+inline mat3 toMat3(const mat4 &a)
+{
+  mat3 r;
+  for (int c = 0; c < 3; c++)
+    for (int i = 0; i < 3; i++)
+      r.m[c * 3 + i] = a.m[c * 4 + i];
+  return r;
+}
+
+inline mat3 operator*(const mat3 &a, const mat3 &b)
+{
+  mat3 r;
+  for (int j = 0; j < 3; j++)
+    for (int i = 0; i < 3; i++)
+      r.m[j * 3 + i] = a.m[i] * b.m[j * 3] + a.m[3 + i] * b.m[j * 3 + 1] + a.m[6 + i] * b.m[j * 3 + 2];
+  return r;
+}
+
+inline vec3 operator*(const mat3 &a, const vec3 &v)
+{
+  return vec3(a.m[0] * v.x + a.m[3] * v.y + a.m[6] * v.z,
+              a.m[1] * v.x + a.m[4] * v.y + a.m[7] * v.z,
+              a.m[2] * v.x + a.m[5] * v.y + a.m[8] * v.z);
+}
+
+inline mat3 transpose(const mat3 &a)
+{
+  mat3 r;
+  for (int c = 0; c < 3; c++)
+    for (int i = 0; i < 3; i++)
+      r.m[c * 3 + i] = a.m[i * 3 + c];
+  return r;
+}
+
+inline float determinant(const mat3 &a)
+{
+  const float *m = a.m;
+  return m[0] * (m[4] * m[8] - m[7] * m[5]) -
+         m[3] * (m[1] * m[8] - m[7] * m[2]) +
+         m[6] * (m[1] * m[5] - m[4] * m[2]);
+}
+
+inline mat3 inverse(const mat3 &a)
+{
+  const float *m = a.m;
+  float d = 1.0f / determinant(a);
+  mat3 r;
+  r.m[0] = (m[4] * m[8] - m[7] * m[5]) * d;
+  r.m[1] = (m[7] * m[2] - m[1] * m[8]) * d;
+  r.m[2] = (m[1] * m[5] - m[4] * m[2]) * d;
+  r.m[3] = (m[6] * m[5] - m[3] * m[8]) * d;
+  r.m[4] = (m[0] * m[8] - m[6] * m[2]) * d;
+  r.m[5] = (m[3] * m[2] - m[0] * m[5]) * d;
+  r.m[6] = (m[3] * m[7] - m[6] * m[4]) * d;
+  r.m[7] = (m[6] * m[1] - m[0] * m[7]) * d;
+  r.m[8] = (m[0] * m[4] - m[3] * m[1]) * d;
+  return r;
+}
+
+// for normals of a model matrix with non uniform scale
+inline mat3 normalMatrix(const mat4 &model)
+{
+  return transpose(inverse(toMat3(model)));
+}
+
+// mat4
+
+inline mat4 operator*(const mat4 &a, const mat4 &b)
+{
+  mat4 r;
+  multiply4x4(a.m, b.m, r.m);
+  return r;
+}
+
+inline mat4& operator*=(mat4 &a, const mat4 &b)
+{
+  a = a * b;
+  return a;
+}
+
+inline vec4 operator*(const mat4 &a, const vec4 &v)
+{
+  vec4 r;
+  multiply4x4Vector(a.m, &v.x, &r.x);
+  return r;
+}
+
+// w = 1, no perspective divide
+inline vec3 transformPoint(const mat4 &a, const vec3 &p)
+{
+  return (a * vec4(p, 1.0f)).xyz();
+}
+
+// w = 0: no translation
+inline vec3 transformVector(const mat4 &a, const vec3 &v)
+{
+  return (a * vec4(v, 0.0f)).xyz();
+}
+
+inline mat4 transpose(const mat4 &a)
+{
+  mat4 r;
+  for (int c = 0; c < 4; c++)
+    for (int i = 0; i < 4; i++)
+      r.m[c * 4 + i] = a.m[i * 4 + c];
+  return r;
+}
+
+// cofactors, 2x2 sub-determinants shared
+inline mat4 inverse(const mat4 &a)
+{
+  const float *m = a.m;
+  float s0 = m[0] * m[5] - m[4] * m[1];
+  float s1 = m[0] * m[6] - m[4] * m[2];
+  float s2 = m[0] * m[7] - m[4] * m[3];
+  float s3 = m[1] * m[6] - m[5] * m[2];
+  float s4 = m[1] * m[7] - m[5] * m[3];
+  float s5 = m[2] * m[7] - m[6] * m[3];
+  float c5 = m[10] * m[15] - m[14] * m[11];
+  float c4 = m[9] * m[15] - m[13] * m[11];
+  float c3 = m[9] * m[14] - m[13] * m[10];
+  float c2 = m[8] * m[15] - m[12] * m[11];
+  float c1 = m[8] * m[14] - m[12] * m[10];
+  float c0 = m[8] * m[13] - m[12] * m[9];
+  float d = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+  mat4 r;
+  r.m[0] = ( m[5] * c5 - m[6] * c4 + m[7] * c3) * d;
+  r.m[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * d;
+  r.m[2] = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * d;
+  r.m[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * d;
+  r.m[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * d;
+  r.m[5] = ( m[0] * c5 - m[2] * c2 + m[3] * c1) * d;
+  r.m[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * d;
+  r.m[7] = ( m[8] * s5 - m[10] * s2 + m[11] * s1) * d;
+  r.m[8] = ( m[4] * c4 - m[5] * c2 + m[7] * c0) * d;
+  r.m[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * d;
+  r.m[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * d;
+  r.m[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * d;
+  r.m[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * d;
+  r.m[13] = ( m[0] * c3 - m[1] * c1 + m[2] * c0) * d;
+  r.m[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * d;
+  r.m[15] = ( m[8] * s3 - m[9] * s1 + m[10] * s0) * d;
+  return r;
+}
+
+// transforms
+
+inline mat4 translate(const vec3 &t)
+{
+  mat4 r;
+  r.m[12] = t.x;
+  r.m[13] = t.y;
+  r.m[14] = t.z;
+  return r;
+}
+
+inline mat4 scale(const vec3 &s)
+{
+  mat4 r;
+  r.m[0] = s.x;
+  r.m[5] = s.y;
+  r.m[10] = s.z;
+  return r;
+}
+
+// counterclockwise around axis
+inline mat4 rotate(float angle, const vec3 &axis)
+{
+  vec3 u = normalize(axis);
+  float c = cosf(angle), s = sinf(angle), t = 1.0f - c;
+  mat4 r;
+  r.m[0] = t * u.x * u.x + c;
+  r.m[1] = t * u.x * u.y + s * u.z;
+  r.m[2] = t * u.x * u.z - s * u.y;
+  r.m[4] = t * u.x * u.y - s * u.z;
+  r.m[5] = t * u.y * u.y + c;
+  r.m[6] = t * u.y * u.z + s * u.x;
+  r.m[8] = t * u.x * u.z + s * u.y;
+  r.m[9] = t * u.y * u.z - s * u.x;
+  r.m[10] = t * u.z * u.z + c;
+  return r;
+}
+
+// OpenGL clip space (z in [-1, 1]), fovy in radians
+inline mat4 perspective(float fovy, float aspect, float near, float far)
+{
+  float f = 1.0f / tanf(fovy * 0.5f);
+  mat4 r(0.0f);
+  r.m[0] = f / aspect;
+  r.m[5] = f;
+  r.m[10] = (far + near) / (near - far);
+  r.m[11] = -1.0f;
+  r.m[14] = 2.0f * far * near / (near - far);
+  return r;
+}
+
+inline mat4 ortho(float left, float right, float bottom, float top, float near, float far)
+{
+  mat4 r;
+  r.m[0] = 2.0f / (right - left);
+  r.m[5] = 2.0f / (top - bottom);
+  r.m[10] = -2.0f / (far - near);
+  r.m[12] = -(right + left) / (right - left);
+  r.m[13] = -(top + bottom) / (top - bottom);
+  r.m[14] = -(far + near) / (far - near);
+  return r;
+}
+
+// view matrix, looking down -z
+inline mat4 lookAt(const vec3 &eye, const vec3 &center, const vec3 &up)
+{
+  vec3 f = normalize(center - eye);
+  vec3 s = normalize(cross(f, up));
+  vec3 u = cross(s, f);
+  mat4 r;
+  r.m[0] = s.x; r.m[4] = s.y; r.m[8] = s.z;
+  r.m[1] = u.x; r.m[5] = u.y; r.m[9] = u.z;
+  r.m[2] = -f.x; r.m[6] = -f.y; r.m[10] = -f.z;
+  r.m[12] = -dot(s, eye);
+  r.m[13] = -dot(u, eye);
+  r.m[14] = dot(f, eye);
+  return r;
+}
+
+#endif
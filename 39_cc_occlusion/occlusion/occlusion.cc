@@ -0,0 +1,200 @@
+#include "occlusion.h"
+
+#include <iostream>
+
+// boxes grow by this much on every side: the faces of a box must not
+// lose the depth test against the object inside it, and the camera
+// closer than that (near plane) counts as inside
+#define BOX_MARGIN 0.2f
+
+static const char* boxVertexSource = "#version 330 core\n"
+  "layout (location = 0) in vec3 aPos;\n"
+  "uniform mat4 viewProjection;\n"
+  "uniform vec3 boxMin;\n"
+  "uniform vec3 boxMax;\n"
+  "void main()\n"
+  "{\n"
+  "  gl_Position = viewProjection * vec4(mix(boxMin, boxMax, aPos), 1.0f);\n"
+  "}\n";
+
+static const char* boxFragmentSource = "#version 330 core\n"
+  "out vec4 FragColor;\n"
+  "void main()\n"
+  "{\n"
+  "  FragColor = vec4(1.0f);\n"
+  "}\n";
+
+static GLuint compileBoxProgram()
+{
+  int success;
+  char infoLog[512];
+
+  GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+  glShaderSource(vertex, 1, &boxVertexSource, NULL);
+  glCompileShader(vertex);
+  glGetShaderiv(vertex, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(vertex, 512, NULL, infoLog);
+    std::cout << "ERROR::OCCLUSION::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+  GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+  glShaderSource(fragment, 1, &boxFragmentSource, NULL);
+  glCompileShader(fragment);
+  glGetShaderiv(fragment, GL_COMPILE_STATUS, &success);
+  if (!success) {
+    glGetShaderInfoLog(fragment, 512, NULL, infoLog);
+    std::cout << "ERROR::OCCLUSION::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
+  }
+
+  GLuint program = glCreateProgram();
+  glAttachShader(program, vertex);
+  glAttachShader(program, fragment);
+  glLinkProgram(program);
+  glGetProgramiv(program, GL_LINK_STATUS, &success);
+  if (!success) {
+    glGetProgramInfoLog(program, 512, NULL, infoLog);
+    std::cout << "ERROR::OCCLUSION::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+  }
+  glDeleteShader(vertex);
+  glDeleteShader(fragment);
+  return program;
+}
+
+OcclusionCuller::OcclusionCuller(unsigned int objects)
+  : current(0), objects(objects), conditional(false), culled(-1.0f), lastQueried(0)
+{
+  for (int s = 0; s < 2; s++) {
+    this->queries[s].resize(objects);
+    this->issued[s].assign(objects, 0);
+    if (objects > 0)
+      glGenQueries(objects, &this->queries[s][0]);
+  }
+
+  this->program = compileBoxProgram();
+  this->viewProjectionLocation = glGetUniformLocation(this->program, "viewProjection");
+  this->boxMinLocation = glGetUniformLocation(this->program, "boxMin");
+  this->boxMaxLocation = glGetUniformLocation(this->program, "boxMax");
+
+  // unit cube, mixed between the corners of each box in the shader
+  float cubeVertices[] = {
+    0.0f, 0.0f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f, 0.0f,
+    0.0f, 0.0f, 1.0f,   1.0f, 0.0f, 1.0f,   1.0f, 1.0f, 1.0f,   0.0f, 1.0f, 1.0f
+  };
+  GLuint cubeIndices[] = {
+    0, 2, 1,  0, 3, 2,    // -z
+    4, 5, 6,  4, 6, 7,    // +z
+    0, 1, 5,  0, 5, 4,    // -y
+    3, 6, 2,  3, 7, 6,    // +y
+    0, 4, 7,  0, 7, 3,    // -x
+    1, 2, 6,  1, 6, 5     // +x
+  };
+  glGenVertexArrays(1, &this->VAO);
+  glGenBuffers(1, &this->VBO);
+  glGenBuffers(1, &this->EBO);
+  glBindVertexArray(this->VAO);
+  glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
+  glBufferData(GL_ARRAY_BUFFER, sizeof(cubeVertices), cubeVertices, GL_STATIC_DRAW);
+  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(cubeIndices), cubeIndices, GL_STATIC_DRAW);
+  glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3*sizeof(float), (void*)0);
+  glEnableVertexAttribArray(0);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+}
+
+OcclusionCuller::~OcclusionCuller()
+{
+  for (int s = 0; s < 2; s++) {
+    if (this->objects > 0)
+      glDeleteQueries(this->objects, &this->queries[s][0]);
+  }
+  glDeleteBuffers(1, &this->EBO);
+  glDeleteBuffers(1, &this->VBO);
+  glDeleteVertexArrays(1, &this->VAO);
+  glDeleteProgram(this->program);
+}
+
+// the set written two frames ago decided last frame's draws: count its
+// hidden boxes if every result is in, it is overwritten this frame;
+// false when culledPercent() still holds an older frame
+bool OcclusionCuller::beginFrame()
+{
+  this->current ^= 1;
+  const std::vector<GLuint> &queries = this->queries[this->current];
+  const std::vector<unsigned char> &issued = this->issued[this->current];
+
+  unsigned int queried = 0, hidden = 0;
+  for (unsigned int i = 0; i < this->objects; i++) {
+    if (!issued[i])
+      continue;
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+      return false;
+    GLuint passed = GL_TRUE;
+    glGetQueryObjectuiv(queries[i], GL_QUERY_RESULT, &passed);
+    queried++;
+    hidden += passed == GL_FALSE;
+  }
+  if (queried == 0)
+    return false;
+  this->culled = 100.0f * hidden / queried;
+  this->lastQueried = queried;
+  return true;
+}
+
+void OcclusionCuller::beginDraw(unsigned int object)
+{
+  unsigned int previous = this->current ^ 1;
+  this->conditional = object < this->objects && this->issued[previous][object];
+  if (this->conditional)
+    glBeginConditionalRender(this->queries[previous][object], GL_QUERY_NO_WAIT);
+}
+
+void OcclusionCuller::endDraw()
+{
+  if (this->conditional)
+    glEndConditionalRender();
+  this->conditional = false;
+}
+
+void OcclusionCuller::queryBoxes(const vec3 *min, const vec3 *max, const mat4 &viewProjection, const vec3 &eye)
+{
+  glUseProgram(this->program);
+  glUniformMatrix4fv(this->viewProjectionLocation, 1, GL_FALSE, viewProjection.ptr());
+  glBindVertexArray(this->VAO);
+  // test only: nothing reaches the color or depth buffers
+  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  glDepthMask(GL_FALSE);
+
+  const vec3 margin(BOX_MARGIN);
+  std::vector<GLuint> &queries = this->queries[this->current];
+  std::vector<unsigned char> &issued = this->issued[this->current];
+  for (unsigned int i = 0; i < this->objects; i++) {
+    vec3 low = min[i] - margin, high = max[i] + margin;
+    issued[i] = !(eye.x > low.x && eye.y > low.y && eye.z > low.z &&
+                  eye.x < high.x && eye.y < high.y && eye.z < high.z);
+    if (!issued[i])
+      continue;
+    glUniform3f(this->boxMinLocation, low.x, low.y, low.z);
+    glUniform3f(this->boxMaxLocation, high.x, high.y, high.z);
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, queries[i]);
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+  }
+
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+  glDepthMask(GL_TRUE);
+  glBindVertexArray(0);
+  glUseProgram(0);
+}
+
+float OcclusionCuller::culledPercent() const
+{
+  return this->culled;
+}
+
+unsigned int OcclusionCuller::queried() const
+{
+  return this->lastQueried;
+}
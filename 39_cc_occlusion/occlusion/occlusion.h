@@ -0,0 +1,63 @@
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include <glad/glad.h>
+
+#include <vector>
+
+#include "vmath.h"
+
+// hardware occlusion culling for large objects, the CPU never waits
+//
+// after a frame is drawn, queryBoxes() draws the bounding box of every
+// object inside a GL_ANY_SAMPLES_PASSED query, with color and depth
+// writes off, against the depth buffer of the frame. The next frame
+// draws each object between beginDraw() and endDraw(), a conditional
+// render on that query: the GPU skips the draw when no sample of the
+// box passed (GL_QUERY_NO_WAIT: drawn when the result is not there yet)
+//
+// an object hidden for a frame that comes into view shows one frame
+// late; a box around the camera cannot be queried (its faces get
+// clipped by the near plane), the object is drawn unconditionally
+//
+// two sets of queries: the one read by this frame's conditional renders
+// and the one written by this frame's boxes; beginFrame() reads the
+// results of the set it is about to reuse only if the GPU has them all,
+// for culledPercent(), and returns whether it did
+class OcclusionCuller
+{
+  public:
+    OcclusionCuller(unsigned int objects);
+    ~OcclusionCuller();
+
+    bool beginFrame();
+
+    void beginDraw(unsigned int object);
+    void endDraw();
+
+    // boxes of all the objects, after the frame is drawn; changes the
+    // program and the VAO binding
+    void queryBoxes(const vec3 *min, const vec3 *max, const mat4 &viewProjection, const vec3 &eye);
+
+    // objects skipped by the GPU in the last frame with results, percent
+    // of the queried ones (-1 before the first results)
+    float culledPercent() const;
+    unsigned int queried() const;
+
+  private:
+    OcclusionCuller(const OcclusionCuller&);
+    OcclusionCuller& operator=(const OcclusionCuller&);
+
+    std::vector<GLuint> queries[2];
+    std::vector<unsigned char> issued[2];
+    unsigned int current;
+    unsigned int objects;
+    bool conditional;
+    float culled;
+    unsigned int lastQueried;
+
+    GLuint program, VAO, VBO, EBO;
+    GLint viewProjectionLocation, boxMinLocation, boxMaxLocation;
+};
+
+#endif
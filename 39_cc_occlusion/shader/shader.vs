@@ -0,0 +1,16 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+
+uniform mat4 viewProjection;
+uniform vec3 offset;
+uniform vec3 scale;
+
+out vec3 vertexColor;
+
+void main()
+{
+  gl_Position = viewProjection * vec4(aPos * scale + offset, 1.0f);
+  vertexColor = aColor;
+}